@@ -0,0 +1,89 @@
+# Generates include/tempArcTable.h, the vertex table for the temperature gauges
+# drawn by DisplayTFT::fillArc. Runs as a PlatformIO pre script so the table
+# always matches the TEMP_ARC_ defines in DisplayTFT.h, or standalone with
+# python arcTable.py
+
+import math
+import os
+import re
+
+try:
+    Import("env")
+    projectDir = env.subst("$PROJECT_DIR")
+except NameError:
+    projectDir = os.path.dirname(os.path.abspath(__file__))
+
+headerPath = os.path.join(projectDir, "include", "DisplayTFT.h")
+tablePath = os.path.join(projectDir, "include", "tempArcTable.h")
+
+
+def readDefine(header, name):
+    match = re.search(r"#define\s+" + name + r"\s+(\d+)", header)
+    return int(match.group(1))
+
+
+def generateTable():
+    with open(headerPath) as file:
+        header = file.read()
+
+    start = readDefine(header, "TEMP_ARC_START")
+    span = readDefine(header, "TEMP_ARC_SPAN")
+    degreesPerSegment = readDefine(header, "TEMP_ARC_DEGREE_PER_SEG")
+    radius = readDefine(header, "TEMP_ARC_RADIUS")
+    width = readDefine(header, "TEMP_ARC_WIDTH")
+    segments = span // degreesPerSegment
+
+    lines = []
+    lines.append("// generated by arcTable.py from the TEMP_ARC_ defines in DisplayTFT.h, do not edit")
+    lines.append("")
+    lines.append("#ifndef _temp_arc_table_h")
+    lines.append("#define _temp_arc_table_h")
+    lines.append("")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("#define TEMP_ARC_TABLE_START            %d" % start)
+    lines.append("#define TEMP_ARC_TABLE_SPAN             %d" % span)
+    lines.append("#define TEMP_ARC_TABLE_DEGREE_PER_SEG   %d" % degreesPerSegment)
+    lines.append("#define TEMP_ARC_TABLE_RADIUS           %d" % radius)
+    lines.append("#define TEMP_ARC_TABLE_WIDTH            %d" % width)
+    lines.append("#define TEMP_ARC_SEGMENTS               %d" % segments)
+    lines.append("")
+    lines.append("// segment boundaries as offsets from the gauge centre, segment n runs from")
+    lines.append("// vertex n to vertex n + 1")
+    lines.append("typedef struct ArcVertex")
+    lines.append("{")
+    lines.append("    int8_t innerX;")
+    lines.append("    int8_t innerY;")
+    lines.append("    int8_t outerX;")
+    lines.append("    int8_t outerY;")
+    lines.append("} ArcVertex;")
+    lines.append("")
+    lines.append("const ArcVertex tempArcVertices[TEMP_ARC_SEGMENTS + 1] PROGMEM = {")
+
+    for i in range(segments + 1):
+        angle = math.radians(start + i * degreesPerSegment - 90)
+        sx = math.cos(angle)
+        sy = math.sin(angle)
+
+        # floor matches the truncation of the old float code for on screen coordinates
+        vertex = (math.floor(sx * (radius - width)), math.floor(sy * (radius - width)),
+                  math.floor(sx * radius), math.floor(sy * radius))
+        lines.append("    {%d, %d, %d, %d}," % vertex)
+
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif // _temp_arc_table_h")
+    lines.append("")
+
+    table = "\n".join(lines)
+
+    if os.path.exists(tablePath):
+        with open(tablePath) as file:
+            if file.read() == table:
+                return
+
+    with open(tablePath, "w") as file:
+        file.write(table)
+
+
+generateTable()
@@ -0,0 +1,158 @@
+# Generates include/Serverpages/PageTemplates.h from the html pages in
+# include/Serverpages. Each page is split at its %TOKEN% placeholders into a
+# table of literal spans and token ids, so WebServer::sendTemplate can stream a
+# page without matching token names at request time. Runs as a PlatformIO pre
+# script, or standalone with python compileTemplates.py
+
+import codecs
+import os
+import re
+
+try:
+    Import("env")
+    projectDir = env.subst("$PROJECT_DIR")
+except NameError:
+    projectDir = os.path.dirname(os.path.abspath(__file__))
+
+pagesDir = os.path.join(projectDir, "include", "Serverpages")
+templatesPath = os.path.join(pagesDir, "PageTemplates.h")
+
+# source header, page array
+pages = [
+    ("IndexPage.h", "index_html"),
+    ("PrintMonitorSettings.h", "printMonitorSettings_html"),
+    ("ScreenGrab.h", "screenGrab_html"),
+    ("SettingsPage.h", "settings_html"),
+    ("TaskProfile.h", "taskProfile_html"),
+    ("WeatherSettings.h", "weatherSettings_html"),
+]
+
+tokenPattern = re.compile(rb"%([A-Z0-9_]+)%")
+literalLineLength = 120
+
+
+def readPage(fileName, name):
+    with open(os.path.join(pagesDir, fileName), encoding="utf-8") as file:
+        header = file.read()
+
+    match = re.search(r"const char " + name + r"\[\] PROGMEM =\s*\{(.*?)\n\};", header, re.S)
+    pieces = re.findall(r'"((?:[^"\\]|\\.)*)"', match.group(1))
+
+    return b"".join(codecs.escape_decode(piece.encode("utf-8"))[0] for piece in pieces)
+
+
+def quote(data):
+    text = ""
+
+    for byte in data:
+        char = chr(byte)
+
+        if char == '"' or char == "\\":
+            text += "\\" + char
+        elif 32 <= byte < 127:
+            text += char
+        else:
+            text += "\\%03o" % byte
+
+    return '"' + text + '"'
+
+
+def splitPage(page):
+    spans = []
+    start = 0
+
+    for match in tokenPattern.finditer(page):
+        spans.append((page[start:match.start()], match.group(1).decode()))
+        start = match.end()
+
+    spans.append((page[start:], None))
+
+    return spans
+
+
+def generateTemplates():
+    compiled = []
+    tokens = set()
+
+    for fileName, name in pages:
+        spans = splitPage(readPage(fileName, name))
+        tokens.update(token for literal, token in spans if token is not None)
+        compiled.append((name, spans))
+
+    lines = []
+    lines.append("// generated by compileTemplates.py from the pages in include/Serverpages, do not edit")
+    lines.append("")
+    lines.append("#ifndef _page_templates_h")
+    lines.append("#define _page_templates_h")
+    lines.append("")
+    lines.append("#include <Arduino.h>")
+    lines.append("")
+    lines.append("enum TemplateToken : uint8_t")
+    lines.append("{")
+    lines.append("    TemplateToken_None,")
+
+    for token in sorted(tokens):
+        lines.append("    TemplateToken_%s," % token)
+
+    lines.append("};")
+    lines.append("")
+    lines.append("// literal is written first, then the value of token")
+    lines.append("typedef struct TemplateSpan")
+    lines.append("{")
+    lines.append("    const char* literal;")
+    lines.append("    uint16_t length;")
+    lines.append("    TemplateToken token;")
+    lines.append("} TemplateSpan;")
+    lines.append("")
+    lines.append("typedef struct PageTemplate")
+    lines.append("{")
+    lines.append("    const TemplateSpan* spans;")
+    lines.append("    uint8_t spanCount;")
+    lines.append("    uint16_t literalLength;")
+    lines.append("} PageTemplate;")
+
+    for name, spans in compiled:
+        lines.append("")
+        lines.append("/**** %s ****/" % name)
+        lines.append("")
+
+        for i, (literal, token) in enumerate(spans):
+            if len(literal) == 0:
+                continue
+
+            lines.append("static const char %s_%d[] PROGMEM =" % (name, i))
+
+            for offset in range(0, len(literal), literalLineLength):
+                lines.append("    " + quote(literal[offset:offset + literalLineLength]))
+
+            lines[-1] += ";"
+
+        lines.append("")
+        lines.append("static const TemplateSpan %s_spans[] PROGMEM = {" % name)
+
+        for i, (literal, token) in enumerate(spans):
+            literalName = "%s_%d" % (name, i) if len(literal) > 0 else "nullptr"
+            tokenName = "TemplateToken_" + (token if token is not None else "None")
+            lines.append("    {%s, %d, %s}," % (literalName, len(literal), tokenName))
+
+        lines.append("};")
+        lines.append("")
+        lines.append("const PageTemplate %s_template = {%s_spans, %d, %d};" %
+                     (name, name, len(spans), sum(len(literal) for literal, token in spans)))
+
+    lines.append("")
+    lines.append("#endif // _page_templates_h")
+    lines.append("")
+
+    header = "\n".join(lines)
+
+    if os.path.exists(templatesPath):
+        with open(templatesPath) as file:
+            if file.read() == header:
+                return
+
+    with open(templatesPath, "w") as file:
+        file.write(header)
+
+
+generateTemplates()
@@ -0,0 +1,78 @@
+# Generates include/Serverpages/StaticAssets.h, the gzipped copies of the static
+# javascript and css in devdata served by WebServer. Runs as a PlatformIO pre
+# script so the firmware always serves the current devdata files, or standalone
+# with python compressAssets.py
+#
+# The html pages are not compressed as they are filled in by the token processor.
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")
+    projectDir = env.subst("$PROJECT_DIR")
+except NameError:
+    projectDir = os.path.dirname(os.path.abspath(__file__))
+
+sourceDir = os.path.join(projectDir, "devdata")
+assetsPath = os.path.join(projectDir, "include", "Serverpages", "StaticAssets.h")
+
+# devdata file, symbol prefix
+assets = [
+    ("jquery.confirmModal.min.js", "confirmModal_js"),
+    ("printMonitorSettings.js", "printMonitorSettings_js"),
+    ("settings.js", "settings_js"),
+    ("station.js", "station_js"),
+    ("weatherSettings.js", "weatherSettings_js"),
+    ("station.css", "station_css"),
+]
+
+
+def compress(data):
+    # fixed timestamp so the output, and the etag, only change with the content
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def generateAssets():
+    lines = []
+    lines.append("// generated by compressAssets.py from the files in devdata, do not edit")
+    lines.append("")
+    lines.append("#ifndef _static_assets_h")
+    lines.append("#define _static_assets_h")
+    lines.append("")
+    lines.append("#include <avr/pgmspace.h>")
+
+    for fileName, symbol in assets:
+        with open(os.path.join(sourceDir, fileName), "rb") as file:
+            data = file.read()
+
+        compressed = compress(data)
+        etag = hashlib.sha1(data).hexdigest()[:16]
+
+        lines.append("")
+        lines.append("// %s, %d bytes, %d compressed" % (fileName, len(data), len(compressed)))
+        lines.append("const char %s_etag[] = \"\\\"%s\\\"\";" % (symbol, etag))
+        lines.append("const uint8_t %s_gz[] PROGMEM = {" % symbol)
+
+        for i in range(0, len(compressed), 16):
+            lines.append("    " + " ".join("0x%02x," % b for b in compressed[i:i + 16]))
+
+        lines.append("};")
+
+    lines.append("")
+    lines.append("#endif // _static_assets_h")
+    lines.append("")
+
+    header = "\n".join(lines)
+
+    if os.path.exists(assetsPath):
+        with open(assetsPath) as file:
+            if file.read() == header:
+                return
+
+    with open(assetsPath, "w") as file:
+        file.write(header)
+
+
+generateAssets()
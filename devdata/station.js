@@ -36,23 +36,34 @@ function updateInternetCurrent(messageData)
 
 function updateMonitorInfo(messageData)
 {
-    $("#monitorInfoList").empty();
+    var item = $("#printer-" + messageData.printerId);
+    var info;
 
     if(messageData.enabled)
     {
         if(messageData.validPrintData)
         {
-            $("#monitorInfoList").append('<li class="list-group-item">' + messageData.printerName + ' - state: ' + messageData.printState + '</li>');    
+            info = messageData.printerName + ' - state: ' + messageData.printState;
         }
         else
         {
-            $("#monitorInfoList").append('<li class="list-group-item">' + messageData.printerName + ' - no valid data received.' + '</li>');    
+            info = messageData.printerName + ' - no valid data received.';
         }
     }
     else
     {
-        $("#monitorInfoList").append('<li class="list-group-item">' + messageData.printerName + ' - not enabled.' + '</li>');
+        info = messageData.printerName + ' - not enabled.';
     }
+
+    if(item.length == 0)
+    {
+        // drop the waiting placeholder on the first printer
+        $("#monitorInfoList li:not([id])").remove();
+        $("#monitorInfoList").append('<li class="list-group-item" id="printer-' + messageData.printerId + '"></li>');
+        item = $("#printer-" + messageData.printerId);
+    }
+
+    item.html(info);
 }
 
 function openWebSocket() 
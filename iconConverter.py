@@ -0,0 +1,123 @@
+# Converts the raw RGB565 weather icons in include/icons/icon_*.h into the run
+# length encoded include/icons/weatherIconsRle.h drawn by DisplayTFT::drawIcon.
+# Run with python iconConverter.py after adding or changing an icon.
+#
+# Each icon is a stream of 16 bit words. A word with the top bit set is a run,
+# the next word is drawn (word & 0x7fff) times. Otherwise the word is a count of
+# literal pixels that follow.
+
+import glob
+import os
+import re
+
+projectDir = os.path.dirname(os.path.abspath(__file__))
+iconDir = os.path.join(projectDir, "include", "icons")
+outputPath = os.path.join(iconDir, "weatherIconsRle.h")
+
+RUN_FLAG = 0x8000
+MAX_COUNT = 0x7fff
+MIN_RUN = 3     # shorter runs are cheaper as literals
+
+
+def readIcon(path):
+    with open(path) as file:
+        source = file.read()
+
+    name = re.search(r"const unsigned short (\w+)\[", source).group(1)
+    data = source[source.index("{") + 1:source.index("}")]
+    data = re.sub(r"//.*", "", data)
+    pixels = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", data)]
+
+    return name, pixels
+
+
+def encode(pixels):
+    words = []
+    literals = []
+    i = 0
+
+    def flushLiterals():
+        while literals:
+            block = literals[:MAX_COUNT]
+            del literals[:MAX_COUNT]
+            words.append(len(block))
+            words.extend(block)
+
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < MAX_COUNT:
+            run += 1
+
+        if run >= MIN_RUN:
+            flushLiterals()
+            words.append(RUN_FLAG | run)
+            words.append(pixels[i])
+            i += run
+        else:
+            literals.append(pixels[i])
+            i += 1
+
+    flushLiterals()
+    return words
+
+
+def decode(words):
+    pixels = []
+    i = 0
+
+    while i < len(words):
+        if words[i] & RUN_FLAG:
+            pixels.extend([words[i + 1]] * (words[i] & MAX_COUNT))
+            i += 2
+        else:
+            pixels.extend(words[i + 1:i + 1 + words[i]])
+            i += 1 + words[i]
+
+    return pixels
+
+
+def convert():
+    lines = []
+    lines.append("// generated by iconConverter.py from include/icons/icon_*.h, do not edit")
+    lines.append("// 48x48 RGB565 weather icons, run length encoded")
+    lines.append("")
+    lines.append("#ifndef _weather_icons_rle_h")
+    lines.append("#define _weather_icons_rle_h")
+    lines.append("")
+    lines.append("#include <avr/pgmspace.h>")
+    lines.append("")
+    lines.append("#define ICON_RLE_RUN_FLAG   0x%04x" % RUN_FLAG)
+    lines.append("#define ICON_RLE_COUNT_MASK 0x%04x" % MAX_COUNT)
+
+    rawTotal = 0
+    encodedTotal = 0
+
+    for path in sorted(glob.glob(os.path.join(iconDir, "icon_*.h"))):
+        name, pixels = readIcon(path)
+        words = encode(pixels)
+
+        if decode(words) != pixels:
+            raise Exception("round trip failed for " + name)
+
+        rawTotal += len(pixels) * 2
+        encodedTotal += len(words) * 2
+        print("%s: %d -> %d bytes" % (name, len(pixels) * 2, len(words) * 2))
+
+        lines.append("")
+        lines.append("// %d bytes, %d raw" % (len(words) * 2, len(pixels) * 2))
+        lines.append("const uint16_t %s_rle[%d] PROGMEM = {" % (name, len(words)))
+        for i in range(0, len(words), 16):
+            lines.append("    " + " ".join("0x%04X," % word for word in words[i:i + 16]))
+        lines.append("};")
+
+    lines.append("")
+    lines.append("#endif // _weather_icons_rle_h")
+    lines.append("")
+
+    with open(outputPath, "w") as file:
+        file.write("\n".join(lines))
+
+    print("total: %d -> %d bytes" % (rawTotal, encodedTotal))
+
+
+convert()
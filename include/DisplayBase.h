@@ -23,6 +23,16 @@ enum DateFormat
     DateFormat_MMDDYY,  
 };
 
+// pixels pushed to and skipped by the panel over the last frame
+typedef struct DisplayRenderStats
+{
+    unsigned long frames;
+    unsigned long pixelsDrawn;
+    unsigned long pixelsSaved;
+    unsigned long totalPixelsSaved;
+    unsigned long spriteFallbacks;  // widgets drawn directly, too big for the sprite or it couldn't be made
+} DisplayRenderStats;
+
 class DisplayBase
 {
     public:
@@ -34,9 +44,11 @@ class DisplayBase
         virtual void drawCurrentTime(unsigned long epochTime) {};        
         virtual void drawCurrentWeather(OpenWeatherMapCurrentData* currentWeather, bool enabled) {};
         virtual void drawWiFiStrength(long dBm) {};
-        virtual void drawOctoPrintStatus(OctoPrintMonitorData* printData, String printerName, bool enabled) {};
+        virtual void drawOctoPrintStatus(OctoPrintMonitorData* printData, const String& printerName, bool enabled) {};
         
-        virtual void serveScreenShot() {};
+        virtual int getScreenWidth() { return 0; }
+        virtual int getScreenHeight() { return 0; }
+        virtual void readScreenRow(int y, uint16_t* pixels) {};
         virtual void setDisplayBrightness(int percent) {};        
         virtual void setDisplayMode(DisplayMode mode);
         DisplayMode getDisplayMode();
@@ -47,6 +59,10 @@ class DisplayBase
         void setDateFormat(DateFormat dateFormat) { this->dateFormat = dateFormat; }
         ClockFormat getClockFormat() { return clockFormat; }
         DateFormat getDateFormat() { return dateFormat; }
+        DisplayRenderStats* getRenderStats() { return &renderStats; }
+
+    protected:
+        DisplayRenderStats renderStats = {0, 0, 0, 0, 0};
 
     private:
         
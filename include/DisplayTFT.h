@@ -4,6 +4,7 @@
 #include "DisplayBase.h"
 #include "SPI.h"
 #include "TFT_eSPI.h"
+#include "TextLayout.h"
 
 // http://rinkydinkelectronics.com/calc_rgb565.php
 
@@ -47,39 +48,47 @@
 #define WEATHER_ICON_WIDTH  48
 #define WEATHER_ICON_HEIGHT 48
 
-#define PIXEL_TIMEOUT 100     // 100ms Time-out between pixel requests
-#define START_TIMEOUT 10000   // 10s Maximum time to wait at start transfer
-
-#define BITS_PER_PIXEL 16     // 24 for RGB colour format, 16 for 565 colour format
-
-// File names must be alpha-numeric characters (0-9, a-z, A-Z) or "/" underscore "_"
-// other ascii characters are stripped out by client, including / generates
-// sub-directories
-#define DEFAULT_FILENAME "tft_screenshots/screenshot" // In case none is specified
-#define FILE_TYPE "png"       // jpg, bmp, png, tif are valid
-
-
-// Filename extension
-// '#' = add 0-9, '@' = add timestamp, '%' add millis() timestamp, '*' = add nothing
-// '@' and '%' will generate new unique filenames, so beware of cluttering up your
-// hard drive with lots of images! The PC client sketch is set to limit the number of
-// saved images to 1000 and will then prompt for a restart.
-#define FILE_EXT  '%'         
-
-// Number of pixels to send in a burst (minimum of 1), no benefit above 8
-// NPIXELS values and render times: 1 = 5.0s, 2 = 1.75s, 4 = 1.68s, 8 = 1.67s
-#define NPIXELS 8  // Must be integer division of both TFT width and TFT height
-
 #define BRIGHTNESS_PIN          16   // D0
 #define MAX_BRIGHTNESS_VALUE    1023 // max value of analog out on ESP8266
 
-#define DEG2RAD 0.0174532925
 #define TEMP_ARC_START              240
 #define TEMP_ARC_SPAN               240
 #define TEMP_ARC_DEGREE_PER_SEG     3
+#define TEMP_ARC_RADIUS             40
+#define TEMP_ARC_WIDTH              8
 #define TOOL_TEMP_MAX               250
 #define BED_TEMP_MAX                100
 
+#define WIDGET_VALUE_SIZE   16  // temperatures, times and amounts
+#define WIDGET_LINE_SIZE    64  // title and file name, already cut to the screen width
+
+// last drawn state of the print monitor widgets, a widget is only pushed to the
+// panel when what it shows changes. Text is empty and counts -1 after the area
+// has been cleared.
+typedef struct TempArcWidget
+{
+    int segments;
+    char actual[WIDGET_VALUE_SIZE];
+    char target[WIDGET_VALUE_SIZE];
+} TempArcWidget;
+
+typedef struct PrintInfoWidgets
+{
+    bool labelsDrawn;
+    char title[WIDGET_LINE_SIZE];
+    TempArcWidget tool;
+    TempArcWidget bed;
+
+    bool jobShown;
+    int progressWidth;
+    char progress[WIDGET_VALUE_SIZE];
+    char estimatedTime[WIDGET_VALUE_SIZE];
+    char printTime[WIDGET_VALUE_SIZE];
+    char remainingTime[WIDGET_VALUE_SIZE];
+    char filament[WIDGET_VALUE_SIZE];
+    char fileName[WIDGET_LINE_SIZE];
+} PrintInfoWidgets;
+
 class DisplayTFT : public DisplayBase
 {
     public:
@@ -90,43 +99,54 @@ class DisplayTFT : public DisplayBase
         void drawCurrentTime(unsigned long epochTime);
         void drawCurrentWeather(OpenWeatherMapCurrentData* currentWeather, bool enabled);
         void drawWiFiStrength(long dBm);
-        void drawOctoPrintStatus(OctoPrintMonitorData* printData, String printerName, bool enabled);    
+        void drawOctoPrintStatus(OctoPrintMonitorData* printData, const String& printerName, bool enabled);    
 
         void setDisplayMode(DisplayMode mode);
-        void serveScreenShot();
+        int getScreenWidth() { return tft->width(); }
+        int getScreenHeight() { return tft->height(); }
+        void readScreenRow(int y, uint16_t* pixels);
         void setDisplayBrightness(int percent);
+
+        const uint16_t* getIconData(const String& iconId);
+        void drawIcon(int x, int y, const uint16_t* icon);
+
+        static void formatTemperature(char* buffer, size_t size, int16_t deciDegrees);
+        static int getArcSegments(int16_t deciDegrees, int max);
+        static int getProgressWidth(uint16_t progress);
         
     private:
         int drawCurrentWeather(OpenWeatherMapCurrentData* currentWeather, int y);
         void drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWeather, int y);
         void drawWeatherNotEnabled();
-        const unsigned short* getIconData(String iconId);
         void drawTimeDisplay(unsigned long epochTime, int y);
-        void formatClockString(char* buffer, tm* timeInfo);
+        void formatClockString(char* buffer, size_t size, tm* timeInfo);
 
-        void drawInvalidPrintData(String printerName);
-        void drawPrinterNotEnabled(String printerName);
+        void drawInvalidPrintData(const String& printerName);
+        void drawPrinterNotEnabled(const String& printerName);
         void drawNotSetupDisplay();
-        void drawPrintInfo(OctoPrintMonitorData* printData, String printerName);
-        void drawTempArc(String title, float value, float target, float max, int x, int y);
-        String getPrintInfoTitle(String printerName, uint16_t flags);
+        void drawPrintInfo(OctoPrintMonitorData* printData, const String& printerName);
+        void drawTempArc(const char* title, const char* widest, int16_t value, int16_t target, int max, int x, int y, TempArcWidget* widget);
+        void getPrintInfoTitle(char* title, size_t size, const char* printerName, uint16_t flags);
         void drawJobInfo(OctoPrintMonitorData* printData, int y);
-        void drawProgressBar(float percent, int x, int y, int width, int height, uint32_t barColour, uint32_t backgroundColour);
-        void formatSeconds(char* buffer, int seconds);
-
-        int fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour);
+        void drawProgressBar(uint16_t progress, int x, int y, int width, int height, uint32_t barColour, uint32_t backgroundColour);
+        void drawTextWidget(char* shown, size_t size, const char* text, int x, int y, int padding);
+        bool drawTextSprite(const char* text, int x, int y, int padding);
+        void createSprite();
+        int drawLabel(const char* label, int x, int y, bool draw);     // label must be constant text
+        void invalidateWidgets();
+        void clearJobWidgets();
+
+        void fillArc(int x, int y, int startSegment, int segmentCount, unsigned int colour);
         char* getTempPostfix();
 
-        boolean screenServer(void);
-        boolean screenServer(String filename);
-        boolean serialScreenServer(String filename);
-        void sendParameters(String filename);
-
         bool showingPrintInfo;
         bool showingNoPrintInfo;
         bool showingNotEnabled;
+        PrintInfoWidgets widgets;
 
         TFT_eSPI *tft;
+        TFT_eSprite* sprite;    // shared by the widgets, nullptr when sprites are off or it didn't fit
+        TextLayout textLayout;
         int brightness;
 };
 
@@ -0,0 +1,89 @@
+#ifndef _heapMetrics_h
+#define _heapMetrics_h
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+enum HeapSubsystem
+{
+    HeapSubsystem_Time,
+    HeapSubsystem_Weather,
+    HeapSubsystem_WiFi,
+    HeapSubsystem_PrintMonitor,
+    HeapSubsystem_Display,
+    HeapSubsystem_WebServer,
+    HeapSubsystem_Count,
+};
+
+typedef struct HeapSnapshot
+{
+    uint32_t freeHeap;
+    uint32_t maxFreeBlock;
+    uint8_t fragmentation;      // percent
+} HeapSnapshot;
+
+// high-water marks for the heap as each probe of the subsystem finishes
+typedef struct HeapSubsystemStats
+{
+    unsigned long calls;
+    uint32_t minFreeHeap;
+    uint32_t minMaxFreeBlock;
+    uint8_t maxFragmentation;
+    int32_t maxRetained;        // biggest drop in free heap across a single call
+    unsigned long allocations;  // made after warm up, STATIC_ALLOCATION_MODE only
+    size_t lastAllocationSize;
+} HeapSubsystemStats;
+
+// Heap samples taken around task callbacks and web handlers. Probes may nest,
+// an outer probe includes whatever its inner probes retained. In
+// STATIC_ALLOCATION_MODE every allocation is also charged to the innermost probe.
+class HeapMetrics
+{
+    public:
+        static void sample(HeapSnapshot* snapshot);
+        static void record(HeapSubsystem subsystem, const HeapSnapshot* before);
+
+        static HeapSubsystem enter(HeapSubsystem subsystem);
+        static void leave(HeapSubsystem previous) { active = previous; }
+        static void countAllocation(size_t size);
+        static void checkAllocations();
+
+        static HeapSubsystemStats* getStats(HeapSubsystem subsystem) { return &stats[subsystem]; }
+        static const char* getName(HeapSubsystem subsystem);
+        static void toJson(JsonObject metrics);
+
+    private:
+        static HeapSubsystemStats stats[HeapSubsystem_Count];
+        static HeapSnapshot lowest;     // whole device since boot
+        static HeapSubsystem active;    // HeapSubsystem_Count outside any probe
+        static bool counting;           // warm up is over
+        static unsigned long reportedAllocations;
+};
+
+// samples the heap for the lifetime of the probe, declare it first in the
+// function being measured
+class HeapProbe
+{
+    public:
+        HeapProbe(HeapSubsystem subsystem) : subsystem(subsystem) { previous = HeapMetrics::enter(subsystem); HeapMetrics::sample(&before); }
+        ~HeapProbe() { HeapMetrics::record(subsystem, &before); HeapMetrics::leave(previous); }
+
+    private:
+        HeapSubsystem subsystem;
+        HeapSubsystem previous;
+        HeapSnapshot before;
+};
+
+// allocations made while handing off to the network stack or web server
+// libraries aren't ours to remove, they aren't charged to the enclosing probe
+class HeapUntracked
+{
+    public:
+        HeapUntracked() { previous = HeapMetrics::enter(HeapSubsystem_Count); }
+        ~HeapUntracked() { HeapMetrics::leave(previous); }
+
+    private:
+        HeapSubsystem previous;
+};
+
+#endif // _heapMetrics_h
@@ -0,0 +1,38 @@
+#ifndef _octoPrintConnectionPool_h
+#define _octoPrintConnectionPool_h
+
+#include "AsyncHttpClient.h"
+#include "JsonStreamFilter.h"
+#include "Settings.h"
+
+typedef struct ConnectionPoolStats
+{
+    unsigned long requests;
+    unsigned long reused;
+    unsigned long reconnects;
+    unsigned long evicted;
+} ConnectionPoolStats;
+
+// keep-alive connections to OctoPrint, one per printer address:port. The pool
+// size is also the number of requests in flight at once, lwIP on the ESP8266
+// only has a handful of TCP control blocks to share with the web server.
+// Replies are filtered as they arrive, each connection only holds what's kept.
+class OctoPrintConnectionPool
+{
+    public:
+        OctoPrintConnectionPool();
+
+        AsyncHttpClient* acquire(const String& host, int port);
+        JsonStreamFilter* getBodyFilter(AsyncHttpClient* connection);
+        void evictIdle();
+
+        ConnectionPoolStats* getStats();
+
+    private:
+        AsyncHttpClient connections[OCTOPRINT_CONNECTION_POOL_SIZE];
+        JsonStreamFilter bodyFilters[OCTOPRINT_CONNECTION_POOL_SIZE];
+        char bodies[OCTOPRINT_CONNECTION_POOL_SIZE][OCTOPRINT_HTTP_BODY_SIZE];
+        ConnectionPoolStats stats;
+};
+
+#endif // _octoPrintConnectionPool_h
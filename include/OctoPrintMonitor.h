@@ -3,6 +3,11 @@
 
 #include <ESPAsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+#include "OctoPrintConnectionPool.h"
+#include "OctoPrintPushClient.h"
+#include "JsonArena.h"
+#include "Settings.h"
 
 #define OCTOPRINT_JOB       "/api/job"
 #define OCTOPRINT_PRINTER   "/api/printer?exclude=sd"
@@ -19,6 +24,20 @@
 #define PRINT_STATE_RESUMING            1 << 9
 #define PRINT_STATE_SD_READY            1 << 10
 
+#define OCTOPRINT_REQUEST_JOB           1
+#define OCTOPRINT_REQUEST_PRINTER       1 << 1
+
+// reserved up front so updates don't grow the strings, longer values still fit
+#define OCTOPRINT_FILE_NAME_RESERVE     96
+#define OCTOPRINT_STATE_RESERVE         24
+
+#define OCTOPRINT_FILTER_SIZE           256     // bytes, the job and printer filter documents
+
+// temperatures and progress are kept as integers, the ESP8266 has no FPU
+#define DECI_DEGREES_PER_DEGREE         10
+#define BASIS_POINTS_PER_PERCENT        100
+#define PROGRESS_COMPLETE               (100 * BASIS_POINTS_PER_PERCENT)
+
 typedef struct OctoPrintMonitorData
 {
     // job
@@ -26,16 +45,16 @@ typedef struct OctoPrintMonitorData
     unsigned int estimatedPrintTime;
     unsigned int filamentLength;
     String jobState;
-    float percentComplete;
+    uint16_t progress;              // basis points
     unsigned int printTimeElapsed;
     unsigned int printTimeRemaining;
     bool jobLoaded;
 
     // printer
-    float tool0Temp;
-    float tool0Target;
-    float bedTemp;
-    float bedTarget;
+    int16_t tool0Temp;              // deci-degrees
+    int16_t tool0Target;
+    int16_t bedTemp;
+    int16_t bedTarget;
     String printState;
     uint16_t printerFlags;
 
@@ -43,28 +62,83 @@ typedef struct OctoPrintMonitorData
     bool validPrintData;
 } PrinterMonitorData;
 
+// per printer polling state
+typedef struct OctoPrintPrinterState
+{
+    OctoPrintMonitorData data;
+    String headers;             // built on first use, cleared when the printers change
+    uint8_t pendingRequests;
+    bool inFlight;
+} OctoPrintPrinterState;
+
+class SettingsManager;
+struct OctoPrinterData;
+
+// Polls every enabled printer, requests run concurrently over the connection
+// pool and results are reported per printer through the updated callback. In
+// push mode the printer on display is kept up to date from OctoPrint's push
+// socket instead and only goes back to polling while the socket is down.
 class OctoPrintMonitor
 {
     public:
-        //void init(String server, int port, String apiKey, String userName, String password);
-        void setCurrentPrinter(String server, int port, String apiKey, String userName, String password);
+        OctoPrintMonitor();
+
+        void init(SettingsManager* settingsManager);
+        void setPrinterUpdatedCallback(void(* callback)(int printerId));
         void update();
-        OctoPrintMonitorData* getCurrentData() { return &data; }
+        void poll();
+        void setPushPrinter(int printerId);
+        void resetPrinterData();
+        void printersChanged();
+
+        OctoPrintMonitorData* getPrinterData(int printerId) { return &printers[printerId].data; }
+        ConnectionPoolStats* getConnectionStats() { return connectionPool.getStats(); }
+#if OCTOPRINT_PUSH_MODE
+        OctoPrintPushStats* getPushStats() { return pushClient.getStats(); }
+#endif
+
+        static int16_t toDeciDegrees(JsonVariant value);
+        static uint16_t toBasisPoints(JsonVariant value);
 
     private:
-        void updateJobStatus();
-        void updatePrinterStatus();
-        int performAPIGet(String apiCall, String& payload);
-        void deserialiseJob(String payload);
-        void deserialisePrint(String payload);
-
-        String apiKey;
-        String server;
-        String userName;
-        String password;
-        int port;
-
-        OctoPrintMonitorData data;
+        void sendRequests();
+        bool sendRequest(int printerId);
+        const String& getHeaders(int printerId);
+        void handleResponse(int printerId, uint8_t request, unsigned int requestGeneration, int httpCode, JsonStreamFilter* body);
+        void printerUpdated(int printerId);
+
+        void closePush();
+#if OCTOPRINT_PUSH_MODE
+        void subscribePush();
+        void handlePushMessage(char* message, size_t length);
+        void createPushFilter(JsonDocument& filter);
+        void deserialisePush(OctoPrintMonitorData* data, JsonObject current);
+#endif
+
+        void createJobFilter(JsonDocument& filter);
+        void createPrinterFilter(JsonDocument& filter);
+        void deserialiseJob(OctoPrintMonitorData* data, JsonDocument& doc);
+        void deserialisePrint(OctoPrintMonitorData* data, JsonDocument& doc);
+        uint16_t getPrinterFlags(JsonObject flags);
+
+        SettingsManager* settingsManager;
+        OctoPrintPrinterState printers[MAX_PRINTERS];
+        OctoPrintConnectionPool connectionPool;
+        unsigned int generation;
+
+        // replies are written through these while they arrive, built once
+        StaticJsonDocument<JSON_CAPACITY(OCTOPRINT_FILTER_SIZE)> jobFilter;
+        StaticJsonDocument<JSON_CAPACITY(OCTOPRINT_FILTER_SIZE)> printerFilter;
+
+        // the client and its buffers are only built in with push mode on
+#if OCTOPRINT_PUSH_MODE
+        OctoPrintPushClient pushClient;
+#endif
+        int pushPrinter;
+        bool pushActive;                // current messages are arriving, printer isn't polled
+        unsigned long lastPushAttempt;
+
+        void (* printerUpdatedCallback)(int printerId);
 };
 
 #endif // _octoPrintMonitor_h
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifndef _octoPrintPushClient_h
+#define _octoPrintPushClient_h
+
+#include <Arduino.h>
+#include <functional>
+#include <ESPAsyncTCP.h>
+#include "AsyncHttpClient.h"
+#include "Settings.h"
+
+#define OCTOPRINT_LOGIN             "/api/login"
+#define OCTOPRINT_PUSH_SOCKET       "/sockjs/websocket"
+
+#define WEBSOCKET_OPCODE_CONTINUATION   0x0
+#define WEBSOCKET_OPCODE_TEXT           0x1
+#define WEBSOCKET_OPCODE_CLOSE          0x8
+#define WEBSOCKET_OPCODE_PING           0x9
+#define WEBSOCKET_OPCODE_PONG           0xA
+#define WEBSOCKET_MAX_CONTROL_PAYLOAD   125
+#define WEBSOCKET_HANDSHAKE_LINE        64      // only the status line is looked at, longer lines are cut
+
+enum OctoPrintPushState
+{
+    OctoPrintPush_Closed,
+    OctoPrintPush_LoggingIn,    // passive login for the socket session
+    OctoPrintPush_Connecting,
+    OctoPrintPush_Upgrading,    // waiting for 101 Switching Protocols
+    OctoPrintPush_Open,
+};
+
+enum OctoPrintFrameState
+{
+    OctoPrintFrame_Header,
+    OctoPrintFrame_Length,
+    OctoPrintFrame_Payload,
+};
+
+typedef struct OctoPrintPushStats
+{
+    unsigned long subscribes;
+    unsigned long messages;
+    unsigned long dropped;
+} OctoPrintPushStats;
+
+// message is null terminated, only valid for the duration of the callback and
+// may be parsed in place
+typedef std::function<void(char* message, size_t length)> OctoPrintPushCallback;
+
+// Websocket subscription to OctoPrint's push socket. Logs in passively with the
+// API key, authenticates the socket with the returned session and hands each
+// complete text message to the callback from poll(). Messages bigger than
+// OCTOPRINT_PUSH_MAX_MESSAGE, like the history sent on connect, are skipped.
+class OctoPrintPushClient
+{
+    public:
+        OctoPrintPushClient();
+        ~OctoPrintPushClient();
+
+        void subscribe(const String& host, int port, const String& headers);
+        void close();
+        void poll();
+
+        void setMessageCallback(OctoPrintPushCallback callback) { this->callback = callback; }
+        bool isClosed() { return state == OctoPrintPush_Closed; }
+        bool isOpen() { return state == OctoPrintPush_Open; }
+        bool isSubscribedTo(const String& host, int port);
+        OctoPrintPushStats* getStats() { return &stats; }
+
+    private:
+        void handleLogin(int httpCode, char* body, size_t length);
+        void connect();
+        void sendAuth();
+        bool sendFrame(uint8_t opcode, const char* payload, size_t length);
+
+        void handleConnect();
+        void handleData(uint8_t* data, size_t len);
+        void handleDisconnect();
+
+        size_t readHandshake(uint8_t* data, size_t len);
+        size_t readFrame(uint8_t* data, size_t len);
+        void startPayload();
+        void readPayload(uint8_t* data, size_t len);
+        void endFrame();
+
+        AsyncClient client;
+        AsyncHttpClient loginClient;
+        OctoPrintPushState state;
+        OctoPrintPushCallback callback;
+
+        String host;
+        int port;
+        String headers;
+        String session;
+
+        char handshakeLine[WEBSOCKET_HANDSHAKE_LINE];
+        size_t handshakeLength;
+        bool statusRead;
+
+        OctoPrintFrameState frameState;
+        uint8_t frameOpcode;
+        bool frameFinal;
+        uint8_t headerLength;
+        uint8_t lengthBytes;
+        uint32_t payloadRemaining;
+
+        char message[OCTOPRINT_PUSH_MAX_MESSAGE + 1];
+        size_t messageLength;
+        bool discardMessage;
+        bool messageReady;
+
+        char control[WEBSOCKET_MAX_CONTROL_PAYLOAD];
+        size_t controlLength;
+        bool pongPending;
+        bool authPending;
+        bool closePending;
+
+        unsigned long stateTime;
+        unsigned long lastMessage;
+
+        OctoPrintPushStats stats;
+};
+
+#endif // _octoPrintPushClient_h
@@ -2,22 +2,32 @@
 #define _print_monitor_h
 
 #include "DisplayBase.h"
+#include "SettingsManager.h"
 
 // task callbacks
 void connectWifiCallback();
 void getTimeCallback();
 void getCurrentWeatherCallback();
+void currentWeatherUpdatedCallback();
 void updateWifiStrengthCallback();
-void checkScreenGrabCallback();
 void updatePrinterMonitorCallback();
 void cycleDisplayCallback();
+void reportMetricsCallback();
 
 void setupOtaUpdates();
 void setupDisplay();
+void drawCurrentPrinter();
+void printerUpdatedCallback(int printerId);
 
-void settingsChangedCallback();
+void brightnessChanged(SettingsChangeSet changes);
+void timeSettingsChanged(SettingsChangeSet changes);
+void intervalsChanged(SettingsChangeSet changes);
+void metricChanged(SettingsChangeSet changes);
+void displaySettingsChanged(SettingsChangeSet changes);
+void printersChanged(SettingsChangeSet changes);
 void printerDeletedCallback();
 
+void showNextDisplay();
 int getNextPrinter(int currentPrinter);
 
 #endif // _print_monitor_h
\ No newline at end of file
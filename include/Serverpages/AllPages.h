@@ -1,9 +1,2 @@
-#include "Serverpages/ConfirmModal.h"
-#include "Serverpages/WeatherSettings.h"
-#include "Serverpages/PrintMonitorSettings.h"
-#include "Serverpages/ScreenGrab.h"
-#include "Serverpages/SettingsPage.h"
-#include "Serverpages/StationCss.h"
-#include "Serverpages/IndexPage.h"
-
-
+#include "Serverpages/PageTemplates.h"
+#include "Serverpages/StaticAssets.h"
@@ -0,0 +1,319 @@
+// generated by compileTemplates.py from the pages in include/Serverpages, do not edit
+
+#ifndef _page_templates_h
+#define _page_templates_h
+
+#include <Arduino.h>
+
+enum TemplateToken : uint8_t
+{
+    TemplateToken_None,
+    TemplateToken_ADDPRINTERENABLED,
+    TemplateToken_BRIGHTNESS,
+    TemplateToken_CURRENTWEATHERINTERVAL,
+    TemplateToken_DATE1CHECKED,
+    TemplateToken_DATE2CHECKED,
+    TemplateToken_DISPLAYCYCLEINTERVAL,
+    TemplateToken_DISPLAYCYCLEMODE,
+    TemplateToken_DISPLAYMETRIC,
+    TemplateToken_DISPLAYTABLE,
+    TemplateToken_NAVBAR,
+    TemplateToken_PRINTERTABLE,
+    TemplateToken_PRINTMONITORINTERVAL,
+    TemplateToken_TASKTABLE,
+    TemplateToken_TIME1CHECKED,
+    TemplateToken_TIME2CHECKED,
+    TemplateToken_UTCOFFSET,
+    TemplateToken_WEATHERAPIKEY,
+    TemplateToken_WEATHERENABLED,
+    TemplateToken_WEATHERLOCATIONKEY,
+};
+
+// literal is written first, then the value of token
+typedef struct TemplateSpan
+{
+    const char* literal;
+    uint16_t length;
+    TemplateToken token;
+} TemplateSpan;
+
+typedef struct PageTemplate
+{
+    const TemplateSpan* spans;
+    uint8_t spanCount;
+    uint16_t literalLength;
+} PageTemplate;
+
+/**** index_html ****/
+
+static const char index_html_0[] PROGMEM =
+    "<!doctype html><html lang=\"en\"> <head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial"
+    "-scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstr"
+    "ap.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\">"
+    " <link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | Dashboard</title> </head> <body> ";
+static const char index_html_1[] PROGMEM =
+    " <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3 id=\"dashboardTitle\">Dashboard - not connected</h3> <table cla"
+    "ss=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Print Monitor Info</th> </tr></thead> <"
+    "tbody> <tr> <td> <ul id=\"monitorInfoList\" class=\"list-group\"> <li class=\"list-group-item\">Waiting...</li></ul> </td></tr"
+    "></tbody> </table> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Internet c"
+    "urrent weather</th> </tr></thead> <tbody> <tr> <td> <ul id=\"internetWeatherList\" class=\"list-group\"> <li class=\"list-gro"
+    "up-item\">Waiting...</li></ul> </td></tr></tbody> </table> </div><script src=\"https://code.jquery.com/jquery-3.3.1.slim.m"
+    "in.js\" integrity=\"sha384-q8i/X+965DzO0rT7abK41JStQIAqVgRVzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></scr"
+    "ipt> <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpH"
+    "qdSJQ6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\"></script> <script src=\"https://stackpat"
+    "h.bootstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzI"
+    "xFDsf4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script> <script src=\"js/station.js\"></script> </body></html>";
+
+static const TemplateSpan index_html_spans[] PROGMEM = {
+    {index_html_0, 468, TemplateToken_NAVBAR},
+    {index_html_1, 1306, TemplateToken_None},
+};
+
+const PageTemplate index_html_template = {index_html_spans, 2, 1774};
+
+/**** printMonitorSettings_html ****/
+
+static const char printMonitorSettings_html_0[] PROGMEM =
+    "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-"
+    "scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstra"
+    "p.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> "
+    "<link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | Printers</title></head><body> ";
+static const char printMonitorSettings_html_1[] PROGMEM =
+    " <div class=\"container-fluid\" style=\"margin-top:80px\"> <div class=\"table-responsive-md\"> <table class=\"table\" style=\"bac"
+    "kground-color: white\"> <thead class=\"thead-light\"> <tr> <th>ID</th> <th>Printer name</th> <th>OctoPrint address</th> <th"
+    ">Port</th> <th>Enabled</th> <th>Action</th> </tr></thead> <tbody> ";
+static const char printMonitorSettings_html_2[] PROGMEM =
+    " </tbody> </table> <br>Adding a new printer will reset your display settings.<br><br><button type=\"button\" class=\"btn bt"
+    "n-primary\" ";
+static const char printMonitorSettings_html_3[] PROGMEM =
+    " data-toggle=\"modal\" data-backdrop='static' data-target=\"#addPrinterModal\">Add Printer</button> </div><div class=\"modal\""
+    " id=\"addPrinterModal\"> <div class=\"modal-dialog\"> <div class=\"modal-content\"> <div class=\"modal-header\"> <h4 class=\"moda"
+    "l-title\">Add Printer</h4> <button type=\"button\" class=\"close\" data-dismiss=\"modal\">&times;</button> </div><div class=\"mo"
+    "dal-body\"> <form action=\"/addnewPrinter.html\"> <div class=\"form-group\"> <label for=\"octoPrintDisplayName\">Printer displa"
+    "y name (not an OctoPrint setting, e.g. Ender 3)</label> <input type=\"text\" class=\"form-control\" id=\"octoPrintDisplayName"
+    "\" required placeholder=\"Display name\" maxlength=\"64\" name=\"octoPrintDisplayName\"> </div><div class=\"form-group\"> <label "
+    "for=\"octoPrintUrl\">OctoPrint address (don't include http://):</label> <input type=\"text\" class=\"form-control\" id=\"octoPr"
+    "intUrl\" required placeholder=\"OctoPrint address\" maxlength=\"64\" name=\"octoPrintUrl\"> </div><div class=\"form-group\"> <lab"
+    "el for=\"octoPrintPort\">Port:</label> <input type=\"number\" class=\"form-control\" id=\"octoPrintPort\" required placeholder=\""
+    "Port number\" name=\"octoPrintPort\"> </div><div class=\"form-group\"> <label for=\"octoPrintUsername\">User name:</label> <inp"
+    "ut type=\"text\" class=\"form-control\" id=\"octoPrintUsername\" placeholder=\"User name\" maxlength=\"64\" name=\"octoPrintUsernam"
+    "e\"> </div><div class=\"form-group\"> <label for=\"octoPrintPassword\">Password:</label> <input type=\"password\" class=\"form-c"
+    "ontrol\" id=\"octoPrintPassword\" placeholder=\"Password\" maxlength=\"64\" name=\"octoPrintPassword\"> </div><div class=\"form-gr"
+    "oup\"> <label for=\"octoPrintAPIKey\">OctoPrint API Key:</label> <input type=\"text\" class=\"form-control\" id=\"octoPrintAPIKe"
+    "y\" required placeholder=\"API key\" name=\"octoPrintAPIKey\"> </div><div class=\"form-check form-group\"> <label class=\"form-c"
+    "heck-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"printerEnabled\" name=\"printerEnabled\" valu"
+    "e=\"Enabled\" Checked>Enabled </label> </div><button type=\"button\" class=\"btn btn-danger float-left\" data-dismiss=\"modal\">"
+    "Cancel</button> <button type=\"submit\" class=\"btn btn-primary float-right\">Add</button> </form> </div></div></div></div><"
+    "div class=\"modal\" id=\"editPrinterModal\"> <div class=\"modal-dialog\"> <div class=\"modal-content\"> <div class=\"modal-header"
+    "\"> <h4 class=\"modal-title\">Edit Printer</h4> <button type=\"button\" class=\"close\" data-dismiss=\"modal\">&times;</button> <"
+    "/div><div class=\"modal-body\"> <form action=\"/editPrinter.html\"> <input type=\"hidden\" id=\"printerId\" name=\"printerId\"> <d"
+    "iv class=\"form-group\"> <label for=\"editDisplayName\">Printer display name (not an OctoPrint setting, e.g. Ender 3)</label"
+    "> <input type=\"text\" class=\"form-control\" id=\"editDisplayName\" required placeholder=\"Display name\" maxlength=\"64\" name=\""
+    "editDisplayName\"> </div><div class=\"form-group\"> <label for=\"editPrintUrl\">OctoPrint address (don't include http://):</l"
+    "abel> <input type=\"text\" class=\"form-control\" id=\"editPrintUrl\" required placeholder=\"OctoPrint address\" maxlength=\"64\" "
+    "name=\"editPrintUrl\"> </div><div class=\"form-group\"> <label for=\"editPort\">Port:</label> <input type=\"number\" class=\"form"
+    "-control\" id=\"editPort\" required placeholder=\"Port number\" name=\"editPort\"> </div><div class=\"form-group\"> <label for=\"e"
+    "ditUsername\">User name:</label> <input type=\"text\" class=\"form-control\" id=\"editUsername\" placeholder=\"User name\" maxlen"
+    "gth=\"64\" name=\"editUsername\"> </div><div class=\"form-group\"> <label for=\"editPassword\">Password:</label> <input type=\"pa"
+    "ssword\" class=\"form-control\" id=\"editPassword\" placeholder=\"Password\" maxlength=\"64\" name=\"editPassword\"> </div><div cla"
+    "ss=\"form-group\"> <label for=\"editAPIKey\">OctoPrint API Key:</label> <input type=\"text\" class=\"form-control\" id=\"editAPIK"
+    "ey\" required placeholder=\"API key\" name=\"editAPIKey\"> </div><div class=\"form-check form-group\"> <label class=\"form-check"
+    "-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"editEnabled\" name=\"editEnabled\" value=\"Enabled"
+    "\">Enabled </label> </div><button type=\"button\" class=\"btn btn-danger float-left\" data-dismiss=\"modal\">Cancel</button> <b"
+    "utton type=\"submit\" class=\"btn btn-primary float-right\">Save</button> </form> </div></div></div></div></div><script src="
+    "\"https://code.jquery.com/jquery-3.3.1.min.js\" integrity=\"sha384-tsQFqpEReu7ZLhBV2VZlAu7zcOV+rXbYlF2cqB8txI/8aZajjp4Bqd+V"
+    "6D5IgvKT\" crossorigin=\"anonymous\"></script> <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/pop"
+    "per.min.js\" integrity=\"sha384-UO2eT0CpHqdSJQ6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\">"
+    "</script> <script src=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgy"
+    "d0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFDsf4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script> <script src=\"js/jquery.conf"
+    "irmModal.min.js\"></script> <script src=\"js/printMonitorSettings.js\"></script></body></html>";
+
+static const TemplateSpan printMonitorSettings_html_spans[] PROGMEM = {
+    {printMonitorSettings_html_0, 464, TemplateToken_NAVBAR},
+    {printMonitorSettings_html_1, 306, TemplateToken_PRINTERTABLE},
+    {printMonitorSettings_html_2, 131, TemplateToken_ADDPRINTERENABLED},
+    {printMonitorSettings_html_3, 4891, TemplateToken_None},
+};
+
+const PageTemplate printMonitorSettings_html_template = {printMonitorSettings_html_spans, 4, 5792};
+
+/**** screenGrab_html ****/
+
+static const char screenGrab_html_0[] PROGMEM =
+    "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-"
+    "scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstra"
+    "p.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> "
+    "<link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | Screen Grab</title></head><body> ";
+static const char screenGrab_html_1[] PROGMEM =
+    " <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3>Screengrab</h3> <div class=\"table-responsive-md\"> <table clas"
+    "s=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Take grab</th> </tr></thead> <tbody> <tr"
+    "> <td> <button class=\"btn btn-primary\" onclick=\"document.getElementById('screen').src = '/screenshot.bmp?' + Date.now()\""
+    ">Grab</button> </td></tr><tr> <td> <img id=\"screen\" src=\"/screenshot.bmp\" alt=\"Screen\"> </td></tr></tbody> </table> </di"
+    "v></div><script src=\"https://code.jquery.com/jquery-3.3.1.slim.min.js\" integrity=\"sha384-q8i/X+965DzO0rT7abK41JStQIAqVgR"
+    "Vzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></script> <script src=\"https://cdnjs.cloudflare.com/ajax/libs"
+    "/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpHqdSJQ6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\""
+    " crossorigin=\"anonymous\"></script> <script src=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" "
+    "integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFDsf4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script></b"
+    "ody></html>";
+
+static const TemplateSpan screenGrab_html_spans[] PROGMEM = {
+    {screenGrab_html_0, 467, TemplateToken_NAVBAR},
+    {screenGrab_html_1, 1091, TemplateToken_None},
+};
+
+const PageTemplate screenGrab_html_template = {screenGrab_html_spans, 2, 1558};
+
+/**** settings_html ****/
+
+static const char settings_html_0[] PROGMEM =
+    "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-"
+    "scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstra"
+    "p.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> "
+    "<link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | General Settings</title></head><body> ";
+static const char settings_html_1[] PROGMEM =
+    " <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3>Update one section at a time.</h3> <div class=\"table-responsi"
+    "ve-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Display</th> </tr></t"
+    "head> <tbody> <tr> <td> <form action=\"/updateDisplaySettings.html\"> <div class=\"form-check form-group\"> <label class=\"fo"
+    "rm-check-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"displayCycleMode\" name=\"displayCycleMo"
+    "de\" ";
+static const char settings_html_2[] PROGMEM =
+    ">Cycle through weather and enabled printers </label> </div><div id=\"chooseDisplayForm\"> <hr/> ";
+static const char settings_html_3[] PROGMEM =
+    " </div><hr/> <div class=\"form-group\"> <label for=\"displayBrighness\">Display brightness</label> <input type=\"range\" class"
+    "=\"custom-range\" id=\"displayBrighness\" name=\"brightness\" min=\"0\" max=\"100\" value=\"";
+static const char settings_html_4[] PROGMEM =
+    "\"> </div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </td></tr></tbody> </table> </div><div clas"
+    "s=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Cloc"
+    "k</th> </tr></thead> <tbody> <tr> <td> <form action=\"/updateClockSettings.html\"> <div class=\"form-group\"> <label for=\"ut"
+    "cOffset\">Offset from UTC in hours</label> <input type=\"number\" class=\"form-control\" id=\"utcOffset\" value=\"";
+static const char settings_html_5[] PROGMEM =
+    "\" placeholder=\"UTC offset\" name=\"utcOffset\" maxlength=\"12\"> </div><hr/> <div class=\"form-group\"> <label>Clock format</la"
+    "bel> <div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"24hour\" name=\"optTimeFormat\" value=\"24hou"
+    "r\" ";
+static const char settings_html_6[] PROGMEM =
+    ">24 hour </div><div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"ampm\" name=\"optTimeFormat\" valu"
+    "e=\"ampm\" ";
+static const char settings_html_7[] PROGMEM =
+    ">AM / PM </div></div><hr/> <div class=\"form-group\"> <label>Date format</label> <div class=\"form-check\"> <input type=\"rad"
+    "io\" class=\"form-check-input\" id=\"ddmmyy\" name=\"optClockFormat\" value=\"ddmmyy\" ";
+static const char settings_html_8[] PROGMEM =
+    ">DD/MM/YY </div><div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"mmddyy\" name=\"optClockFormat\" "
+    "value=\"mmddyy\" ";
+static const char settings_html_9[] PROGMEM =
+    ">MM/DD/YY </div></div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </td></tr></tbody> </table> </"
+    "div><div class=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> "
+    "<tr> <th>Timings - enter values in seconds</th> </tr></thead> <tbody> <tr> <td> <form action=\"/updateTimings.html\"> <div"
+    " class=\"form-group\"> <label for=\"currentWeatherInterval\">Current weather update interval: (min 30 seconds)</label> <inpu"
+    "t type=\"number\" class=\"form-control\" id=\"currentWeatherInterval\" value=\"";
+static const char settings_html_10[] PROGMEM =
+    "\" placeholder=\"Current weather update interval\" name=\"currentWeatherInterval\" min=\"30\"> </div><div class=\"form-group\"> <"
+    "label for=\"printMonitorInterval\">Print monitor interval: (min 5 seconds)</label> <input type=\"number\" class=\"form-contro"
+    "l\" id=\"printMonitorInterval\" value=\"";
+static const char settings_html_11[] PROGMEM =
+    "\" placeholder=\"Print monitor interval\" name=\"printMonitorInterval\" min=\"5\"> </div><div class=\"form-group\"> <label for=\"d"
+    "isplayCycleInterval\">Display cycle interval: (min 30 seconds)</label> <input type=\"number\" class=\"form-control\" id=\"disp"
+    "layCycleInterval\" value=\"";
+static const char settings_html_12[] PROGMEM =
+    "\" placeholder=\"Display cycle interval\" name=\"displayCycleInterval\" min=\"30\"> </div><button type=\"submit\" class=\"btn btn-"
+    "primary\">Save</button> </form> </td></tr></tbody> </table> </div><div class=\"table-responsive-md\"> <table class=\"table\" "
+    "style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Reset</th> </tr></thead> <tbody> <tr> <td> <a clas"
+    "s=\"btn btn-warning confirmResetSettings\">Reset settings</a> </td></tr><tr> <td> <a class=\"btn btn-warning confirmForgetW"
+    "ifi\">Forget Wifi</a> </td></tr></tbody> </table> </div></div><script src=\"https://code.jquery.com/jquery-3.3.1.slim.min."
+    "js\" integrity=\"sha384-q8i/X+965DzO0rT7abK41JStQIAqVgRVzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></script"
+    "> <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpHqdS"
+    "JQ6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\"></script> <script src=\"https://stackpath.b"
+    "ootstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFD"
+    "sf4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script> <script src=\"js/jquery.confirmModal.min.js\"></script> <script src=\"js"
+    "/settings.js\"></script></body></html>";
+
+static const TemplateSpan settings_html_spans[] PROGMEM = {
+    {settings_html_0, 472, TemplateToken_NAVBAR},
+    {settings_html_1, 484, TemplateToken_DISPLAYCYCLEMODE},
+    {settings_html_2, 94, TemplateToken_DISPLAYTABLE},
+    {settings_html_3, 201, TemplateToken_BRIGHTNESS},
+    {settings_html_4, 466, TemplateToken_UTCOFFSET},
+    {settings_html_5, 243, TemplateToken_TIME1CHECKED},
+    {settings_html_6, 129, TemplateToken_TIME2CHECKED},
+    {settings_html_7, 198, TemplateToken_DATE1CHECKED},
+    {settings_html_8, 135, TemplateToken_DATE2CHECKED},
+    {settings_html_9, 552, TemplateToken_CURRENTWEATHERINTERVAL},
+    {settings_html_10, 276, TemplateToken_PRINTMONITORINTERVAL},
+    {settings_html_11, 265, TemplateToken_DISPLAYCYCLEINTERVAL},
+    {settings_html_12, 1237, TemplateToken_None},
+};
+
+const PageTemplate settings_html_template = {settings_html_spans, 13, 4752};
+
+/**** taskProfile_html ****/
+
+static const char taskProfile_html_0[] PROGMEM =
+    "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-"
+    "scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstra"
+    "p.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> "
+    "<link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | Tasks</title></head><body> ";
+static const char taskProfile_html_1[] PROGMEM =
+    " <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3>Tasks</h3><div class=\"table-responsive-md\"><table class=\"tabl"
+    "e\" style=\"background-color: white\"><thead class=\"thead-light\"><tr><th>Task</th><th>Runs</th><th>Min ms</th><th>Avg ms</t"
+    "h><th>Max ms</th><th>p99 ms</th><th>Avg late ms</th><th>Max late ms</th><th>p99 late ms</th></tr></thead><tbody> ";
+static const char taskProfile_html_2[] PROGMEM =
+    " </tbody></table></div> <a href=\"/api/tasks\">JSON</a></div> <script src=\"https://code.jquery.com/jquery-3.3.1.slim.min.j"
+    "s\" integrity=\"sha384-q8i/X+965DzO0rT7abK41JStQIAqVgRVzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></script>"
+    " <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpHqdSJ"
+    "Q6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\"></script> <script src=\"https://stackpath.bo"
+    "otstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFDs"
+    "f4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script></body></html>";
+
+static const TemplateSpan taskProfile_html_spans[] PROGMEM = {
+    {taskProfile_html_0, 461, TemplateToken_NAVBAR},
+    {taskProfile_html_1, 353, TemplateToken_TASKTABLE},
+    {taskProfile_html_2, 663, TemplateToken_None},
+};
+
+const PageTemplate taskProfile_html_template = {taskProfile_html_spans, 3, 1477};
+
+/**** weatherSettings_html ****/
+
+static const char weatherSettings_html_0[] PROGMEM =
+    "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-"
+    "scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstra"
+    "p.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> "
+    "<link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | Weather Settings</title></head><body> ";
+static const char weatherSettings_html_1[] PROGMEM =
+    " <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3>Settings for OpenWeather API</h3> <div class=\"table-responsiv"
+    "e-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Weather - <a href=\"htt"
+    "p://bulk.openweathermap.org/sample/city.list.json.gz\">Link to city list for location ids:</a></th> </tr></thead> <tbody>"
+    " <tr> <td> <form action=\"/updateWeatherSettings.html\"> <div class=\"form-check form-group\"> <label class=\"form-check-labe"
+    "l\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"weatherEnabled\" name=\"weatherEnabled\" value=\"Enable"
+    "d\" ";
+static const char weatherSettings_html_2[] PROGMEM =
+    ">Enabled </label> </div><div id=\"weatherForm\"> <div class=\"form-group\"> <label for=\"locationID\">OpenWeather location ID:"
+    "</label> <input type=\"text\" class=\"form-control\" id=\"locationID\" value=\"";
+static const char weatherSettings_html_3[] PROGMEM =
+    "\" placeholder=\"OpenWeather location ID\" name=\"openWeatherLocation\"> </div><div class=\"form-group\"> <label for=\"weatherAp"
+    "iKey\">OpenWeather Api Key:</label> <input type=\"text\" class=\"form-control\" id=\"weatherApiKey\" value=\"";
+static const char weatherSettings_html_4[] PROGMEM =
+    "\" placeholder=\"OpenWeather API Key\" name=\"openWeatherApiKey\"> </div><div class=\"form-check form-group\"> <label class=\"fo"
+    "rm-check-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"displayMetric\" name=\"displayMetric\" va"
+    "lue=\"Metric\" ";
+static const char weatherSettings_html_5[] PROGMEM =
+    ">Metric display for weather </label> </div></div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </t"
+    "d></tr></tbody> </table> </div></div><script src=\"https://code.jquery.com/jquery-3.3.1.slim.min.js\" integrity=\"sha384-q8"
+    "i/X+965DzO0rT7abK41JStQIAqVgRVzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></script> <script src=\"https://c"
+    "dnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpHqdSJQ6hJty5KVphtPhzWj9WO1cl"
+    "HTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\"></script> <script src=\"https://stackpath.bootstrapcdn.com/bootstra"
+    "p/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFDsf4x0xIM+B07jRM\" crossor"
+    "igin=\"anonymous\"></script> <script src=\"js/jquery.confirmModal.min.js\"></script> <script src=\"js/weatherSettings.js\"></s"
+    "cript></body></html>";
+
+static const TemplateSpan weatherSettings_html_spans[] PROGMEM = {
+    {weatherSettings_html_0, 472, TemplateToken_NAVBAR},
+    {weatherSettings_html_1, 603, TemplateToken_WEATHERENABLED},
+    {weatherSettings_html_2, 192, TemplateToken_WEATHERLOCATIONKEY},
+    {weatherSettings_html_3, 221, TemplateToken_WEATHERAPIKEY},
+    {weatherSettings_html_4, 253, TemplateToken_DISPLAYMETRIC},
+    {weatherSettings_html_5, 860, TemplateToken_None},
+};
+
+const PageTemplate weatherSettings_html_template = {weatherSettings_html_spans, 6, 2601};
+
+#endif // _page_templates_h
@@ -6,9 +6,3 @@ const char settings_html[] PROGMEM =
 "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstrap.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> <link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | General Settings</title></head><body> %NAVBAR% <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3>Update one section at a time.</h3> <div class=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Display</th> </tr></thead> <tbody> <tr> <td> <form action=\"/updateDisplaySettings.html\"> <div class=\"form-check form-group\"> <label class=\"form-check-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"displayCycleMode\" name=\"displayCycleMode\" %DISPLAYCYCLEMODE%>Cycle through weather and enabled printers </label> </div><div id=\"chooseDisplayForm\"> <hr/> %DISPLAYTABLE% </div><hr/> <div class=\"form-group\"> <label for=\"displayBrighness\">Display brightness</label> <input type=\"range\" class=\"custom-range\" id=\"displayBrighness\" name=\"brightness\" min=\"0\" max=\"100\" value=\"%BRIGHTNESS%\"> </div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </td></tr></tbody> </table> </div><div class=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Clock</th> </tr></thead> <tbody> <tr> <td> <form action=\"/updateClockSettings.html\"> <div class=\"form-group\"> <label for=\"utcOffset\">Offset from UTC in hours</label> <input type=\"number\" class=\"form-control\" id=\"utcOffset\" value=\"%UTCOFFSET%\" placeholder=\"UTC offset\" name=\"utcOffset\" maxlength=\"12\"> </div><hr/> <div class=\"form-group\"> <label>Clock format</label> <div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"24hour\" name=\"optTimeFormat\" value=\"24hour\" %TIME1CHECKED%>24 hour </div><div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"ampm\" name=\"optTimeFormat\" value=\"ampm\" %TIME2CHECKED%>AM / PM </div></div><hr/> <div class=\"form-group\"> <label>Date format</label> <div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"ddmmyy\" name=\"optClockFormat\" value=\"ddmmyy\" %DATE1CHECKED%>DD/MM/YY </div><div class=\"form-check\"> <input type=\"radio\" class=\"form-check-input\" id=\"mmddyy\" name=\"optClockFormat\" value=\"mmddyy\" %DATE2CHECKED%>MM/DD/YY </div></div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </td></tr></tbody> </table> </div><div class=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Timings - enter values in seconds</th> </tr></thead> <tbody> <tr> <td> <form action=\"/updateTimings.html\"> <div class=\"form-group\"> <label for=\"currentWeatherInterval\">Current weather update interval: (min 30 seconds)</label> <input type=\"number\" class=\"form-control\" id=\"currentWeatherInterval\" value=\"%CURRENTWEATHERINTERVAL%\" placeholder=\"Current weather update interval\" name=\"currentWeatherInterval\" min=\"30\"> </div><div class=\"form-group\"> <label for=\"printMonitorInterval\">Print monitor interval: (min 5 seconds)</label> <input type=\"number\" class=\"form-control\" id=\"printMonitorInterval\" value=\"%PRINTMONITORINTERVAL%\" placeholder=\"Print monitor interval\" name=\"printMonitorInterval\" min=\"5\"> </div><div class=\"form-group\"> <label for=\"displayCycleInterval\">Display cycle interval: (min 30 seconds)</label> <input type=\"number\" class=\"form-control\" id=\"displayCycleInterval\" value=\"%DISPLAYCYCLEINTERVAL%\" placeholder=\"Display cycle interval\" name=\"displayCycleInterval\" min=\"30\"> </div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </td></tr></tbody> </table> </div><div class=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Reset</th> </tr></thead> <tbody> <tr> <td> <a class=\"btn btn-warning confirmResetSettings\">Reset settings</a> </td></tr><tr> <td> <a class=\"btn btn-warning confirmForgetWifi\">Forget Wifi</a> </td></tr></tbody> </table> </div></div><script src=\"https://code.jquery.com/jquery-3.3.1.slim.min.js\" integrity=\"sha384-q8i/X+965DzO0rT7abK41JStQIAqVgRVzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></script> <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpHqdSJQ6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\"></script> <script src=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFDsf4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script> <script src=\"js/jquery.confirmModal.min.js\"></script> <script src=\"js/settings.js\"></script></body></html>"
 
 };
-
-const char settings_js[] PROGMEM =
-{
-
-"function init(){if ($('#displayCycleMode').is(\":checked\")){$(\"#chooseDisplayForm\").hide();}else{$(\"#chooseDisplayForm\").show();}$(\"#displayCycleMode\").click(function (){if ($(this).is(\":checked\")){$(\"#chooseDisplayForm\").hide();}else{$(\"#chooseDisplayForm\").find('input:radio:nth(0)').prop('checked', true); $(\"#chooseDisplayForm\").show();}});}$(function (){$('.confirmResetSettings').click(function (e){var options={messageHeader: 'Reset Settings?', modalVerticalCenter: true, backgroundBlur: ['#header_wrap, #main_content_wrap, #footer_wrap'], autoFocusOnConfirmBtn: false,}; e.preventDefault(); $.confirmModal('Are you sure you want to reset?', options, function (el){window.location.href=\"/resetSettings.html\";});}); $('.confirmForgetWifi').click(function (e){var options={messageHeader: 'Forget WiFi?', modalVerticalCenter: true, backgroundBlur: ['#header_wrap, #main_content_wrap, #footer_wrap'], autoFocusOnConfirmBtn: false,}; e.preventDefault(); $.confirmModal('Are you sure you want to forget the current Wifi settings?', options, function (el){window.location.href=\"/forgetWiFi.html\";});});});window.addEventListener(\"load\", init, false);"
-};
\ No newline at end of file
@@ -0,0 +1,295 @@
+// generated by compressAssets.py from the files in devdata, do not edit
+
+#ifndef _static_assets_h
+#define _static_assets_h
+
+#include <avr/pgmspace.h>
+
+// jquery.confirmModal.min.js, 3841 bytes, 1247 compressed
+const char confirmModal_js_etag[] = "\"d6f06814ca5e7d7a\"";
+const uint8_t confirmModal_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x57, 0xef, 0x6e, 0xdb, 0x36,
+    0x10, 0xff, 0xbc, 0x3e, 0x05, 0x4b, 0x14, 0xb0, 0x54, 0x47, 0x8a, 0x53, 0x34, 0x41, 0x67, 0x47,
+    0x19, 0x9a, 0xb4, 0xc3, 0x86, 0xa1, 0x2b, 0x36, 0x14, 0xdb, 0x87, 0xa1, 0x1f, 0x28, 0xe9, 0x64,
+    0x31, 0xa6, 0x44, 0x81, 0xa4, 0x9c, 0x38, 0xa9, 0x9f, 0x63, 0x0f, 0xb4, 0x17, 0xdb, 0x51, 0x94,
+    0x6d, 0x59, 0x91, 0xd3, 0x6e, 0xc3, 0x80, 0x61, 0x06, 0x62, 0x93, 0x3c, 0xde, 0xef, 0xfe, 0x1f,
+    0x2f, 0xc7, 0xcf, 0x9f, 0x3e, 0x21, 0xcf, 0xc9, 0xf5, 0x4f, 0x35, 0xa8, 0x55, 0x98, 0xc8, 0x32,
+    0xe3, 0xaa, 0x78, 0x27, 0x53, 0x26, 0xc8, 0xf2, 0x24, 0x9c, 0x58, 0xda, 0x95, 0xac, 0x56, 0x8a,
+    0xcf, 0x73, 0x43, 0xbc, 0xc4, 0x27, 0x2f, 0x26, 0x27, 0xaf, 0xc8, 0x07, 0xc5, 0x0b, 0x72, 0x15,
+    0x5a, 0xea, 0xcf, 0x20, 0x80, 0x69, 0x48, 0x49, 0x5d, 0xa6, 0xa0, 0x88, 0xc9, 0x81, 0xbc, 0xfb,
+    0xfe, 0x03, 0x11, 0x3c, 0x81, 0x52, 0x83, 0xbd, 0xf1, 0x06, 0x74, 0xa2, 0x78, 0x65, 0xb8, 0x2c,
+    0xc9, 0x94, 0x68, 0x5e, 0x54, 0x02, 0x88, 0x91, 0xa4, 0xd6, 0x40, 0x2a, 0x51, 0xcf, 0x79, 0x49,
+    0x14, 0x54, 0x82, 0x25, 0xbc, 0x9c, 0x37, 0xfc, 0xb1, 0x92, 0x37, 0x1a, 0xd4, 0x48, 0x93, 0x14,
+    0x32, 0x56, 0x0b, 0x43, 0x5a, 0xbd, 0x48, 0x2c, 0x6f, 0xc9, 0x0d, 0x37, 0x39, 0x2e, 0xa4, 0xd1,
+    0x46, 0xb1, 0x8a, 0xbc, 0x24, 0x85, 0xd5, 0x16, 0x05, 0x1d, 0x3f, 0xf1, 0xb2, 0xba, 0x4c, 0xac,
+    0x1c, 0x8f, 0xf9, 0xf7, 0xcf, 0x92, 0x5a, 0x29, 0x28, 0x4d, 0x63, 0xcc, 0x07, 0xa6, 0xe6, 0x60,
+    0xa2, 0xfb, 0xf5, 0xec, 0x59, 0x8b, 0xa9, 0xaf, 0x3a, 0xb6, 0x5a, 0xc2, 0x80, 0x0b, 0xa2, 0x2d,
+    0x5e, 0x79, 0x24, 0x8f, 0x84, 0x7f, 0xbf, 0x64, 0x8a, 0xe4, 0x51, 0x2a, 0x93, 0xba, 0x40, 0xe4,
+    0x90, 0x21, 0x71, 0x09, 0x6f, 0x05, 0xd8, 0xdd, 0xcc, 0x12, 0xb3, 0x88, 0x85, 0x70, 0x6b, 0xa0,
+    0x4c, 0xbd, 0xfb, 0xf5, 0xd1, 0xa0, 0xac, 0x23, 0xe9, 0xcf, 0x78, 0xe6, 0x65, 0x51, 0x14, 0x59,
+    0x97, 0x65, 0xbc, 0x84, 0xd4, 0x21, 0x27, 0x11, 0x65, 0xb5, 0x91, 0xb4, 0x41, 0x2a, 0x22, 0xea,
+    0x16, 0x8b, 0xcd, 0xe2, 0x3a, 0xa2, 0xef, 0x7f, 0x70, 0xcb, 0x34, 0xa2, 0x57, 0xac, 0x4c, 0x40,
+    0xd0, 0x35, 0x08, 0x0d, 0xf7, 0x88, 0x37, 0x28, 0x6b, 0x63, 0xcd, 0x65, 0x6d, 0x8c, 0x2c, 0x1f,
+    0x4a, 0x74, 0x90, 0x0e, 0xc3, 0xed, 0xbf, 0x00, 0x66, 0x7d, 0x58, 0x5a, 0xa3, 0xd3, 0x21, 0x61,
+    0x7d, 0xa5, 0xdd, 0xd9, 0xe7, 0x91, 0xac, 0xbc, 0x2c, 0x6c, 0xa2, 0x7c, 0x29, 0x6f, 0x7f, 0xe5,
+    0xa9, 0xc9, 0x0f, 0xfb, 0x6e, 0x07, 0x9d, 0x44, 0x3d, 0xa6, 0x0e, 0xce, 0x2f, 0xa0, 0x0c, 0x4f,
+    0x98, 0xb8, 0xc2, 0xb8, 0x81, 0xea, 0xa2, 0x7d, 0xfa, 0x74, 0xe8, 0x4a, 0xc6, 0x10, 0xd9, 0x09,
+    0xb3, 0xb1, 0xd9, 0x09, 0xc2, 0x5d, 0xc3, 0x11, 0xa4, 0x9c, 0x09, 0x39, 0x0f, 0x92, 0x86, 0x03,
+    0x52, 0xda, 0x0a, 0x04, 0xad, 0xd9, 0x1c, 0xbe, 0x03, 0x96, 0x0e, 0x88, 0xea, 0x11, 0x29, 0x75,
+    0x12, 0x78, 0x44, 0x49, 0x47, 0x04, 0x8f, 0x7a, 0x57, 0x1d, 0x74, 0x86, 0xcb, 0xd7, 0x25, 0x2f,
+    0x98, 0xcd, 0xd1, 0x3e, 0x74, 0x9f, 0xd8, 0xd1, 0x7f, 0xb1, 0xa7, 0x3f, 0xee, 0xec, 0xdd, 0x56,
+    0xdd, 0x98, 0x25, 0x8b, 0xb9, 0x92, 0x08, 0x75, 0x29, 0x6a, 0xab, 0x92, 0x51, 0x35, 0xb2, 0x31,
+    0x8f, 0xda, 0x2c, 0x30, 0x0c, 0xe1, 0x15, 0xf5, 0x43, 0x66, 0x8c, 0xf2, 0xa8, 0x36, 0x2b, 0x01,
+    0xf4, 0x88, 0x06, 0x37, 0x10, 0x2f, 0xb8, 0x09, 0x32, 0x2e, 0xd0, 0xf4, 0x29, 0x89, 0x91, 0xd5,
+    0x9b, 0x84, 0x27, 0x0a, 0x0a, 0x7f, 0x46, 0x82, 0x42, 0xde, 0x0d, 0x93, 0xbe, 0x0a, 0xe4, 0x41,
+    0x1e, 0x7d, 0x80, 0x32, 0x78, 0x4a, 0xfd, 0x19, 0xf3, 0x36, 0x75, 0xe9, 0x87, 0xb2, 0x04, 0x8f,
+    0xe6, 0x3c, 0x85, 0x30, 0xd6, 0x2e, 0x9c, 0xa8, 0xa4, 0x5b, 0xb4, 0x69, 0x46, 0x8f, 0xb6, 0xb5,
+    0xfd, 0xd0, 0x38, 0x84, 0x94, 0x4b, 0x78, 0xdd, 0x31, 0xd1, 0x5f, 0xfb, 0xdb, 0x4a, 0x33, 0xab,
+    0x0a, 0xe4, 0x43, 0x57, 0xf9, 0x36, 0x7c, 0x32, 0xbe, 0x86, 0xc4, 0x60, 0x10, 0x07, 0x7c, 0x19,
+    0x0a, 0x28, 0xe7, 0x4d, 0xee, 0xbe, 0x70, 0x61, 0x80, 0xa8, 0x7f, 0xe5, 0xb7, 0x93, 0x8f, 0xbb,
+    0xb8, 0x40, 0x44, 0x9d, 0x79, 0x74, 0x6d, 0xb7, 0xf1, 0xc3, 0xdb, 0x93, 0x8f, 0x68, 0x75, 0xfc,
+    0x45, 0xc1, 0xa0, 0x63, 0x18, 0xd3, 0xc1, 0x58, 0x6c, 0x29, 0xf2, 0x10, 0x87, 0x1e, 0x26, 0x0c,
+    0x1d, 0xfe, 0xd3, 0x38, 0xc4, 0x87, 0x9c, 0xef, 0x92, 0xd3, 0x96, 0xf8, 0xb7, 0x88, 0xae, 0xdf,
+    0x97, 0x2d, 0xff, 0xa5, 0x29, 0x3b, 0x39, 0xda, 0x93, 0xac, 0x73, 0x79, 0x53, 0xfe, 0xa5, 0x14,
+    0xd8, 0x75, 0x39, 0x4c, 0x83, 0xcc, 0x4a, 0xf2, 0x1a, 0xe9, 0x36, 0x00, 0xf3, 0x68, 0x74, 0x9e,
+    0xf2, 0x25, 0x69, 0x94, 0x8a, 0xe8, 0x5d, 0xc0, 0xb1, 0xdc, 0x6e, 0xa7, 0xe4, 0x74, 0x32, 0x99,
+    0xcc, 0x28, 0x49, 0x04, 0xd3, 0xba, 0x6d, 0x05, 0x64, 0x34, 0x5e, 0x8c, 0x47, 0x64, 0x4f, 0x1a,
+    0x31, 0x2c, 0x6e, 0x38, 0x22, 0x1a, 0x9c, 0x50, 0xa2, 0xa4, 0x05, 0x71, 0x2d, 0x83, 0x12, 0xa6,
+    0x38, 0x0b, 0x04, 0x8b, 0x41, 0x08, 0x48, 0xe3, 0x55, 0x0b, 0xd3, 0x9e, 0xa3, 0x03, 0x53, 0x28,
+    0x23, 0x6a, 0xad, 0xa4, 0x17, 0x5d, 0x1d, 0x0a, 0x76, 0x1b, 0xdc, 0xd8, 0xde, 0x36, 0x45, 0x89,
+    0xc9, 0x78, 0xd4, 0x53, 0xa3, 0xed, 0x48, 0x48, 0x2b, 0xc6, 0xa3, 0xad, 0xc8, 0xd6, 0x47, 0x2d,
+    0xd2, 0xde, 0x7d, 0x5b, 0x04, 0x3b, 0x52, 0x2b, 0xa4, 0x62, 0x69, 0x8a, 0x4f, 0xf3, 0x94, 0x4c,
+    0xc2, 0x33, 0x9b, 0x8d, 0xfb, 0x2c, 0x79, 0xd3, 0x8f, 0x90, 0x23, 0x3f, 0xdb, 0x27, 0x18, 0x6e,
+    0x30, 0x76, 0x17, 0xa3, 0x31, 0x1f, 0x8f, 0xce, 0x8f, 0xf3, 0xb3, 0x8b, 0xf3, 0xb8, 0x71, 0x2c,
+    0xb1, 0xf5, 0x13, 0x51, 0xb7, 0xa1, 0x03, 0x42, 0x5e, 0x9e, 0xa2, 0x14, 0xfc, 0x7d, 0x85, 0x3f,
+    0x3b, 0x83, 0x12, 0x21, 0x35, 0x50, 0x92, 0x32, 0xc3, 0xd0, 0x2c, 0x5d, 0xf0, 0xad, 0xa4, 0xae,
+    0xf7, 0xf0, 0x89, 0x69, 0xee, 0x5d, 0x9c, 0xeb, 0x8a, 0x95, 0x43, 0xee, 0xfb, 0xe3, 0xf7, 0xf3,
+    0x63, 0x4b, 0xbb, 0x38, 0x3f, 0x76, 0x2a, 0xe0, 0x02, 0x8d, 0x3d, 0x64, 0x71, 0xa3, 0x04, 0xc9,
+    0xd0, 0x2f, 0x81, 0xe6, 0x77, 0x60, 0x8f, 0xbe, 0xde, 0xd3, 0xcb, 0x19, 0x1b, 0xcb, 0x74, 0x45,
+    0x0c, 0xbe, 0xfc, 0x41, 0xac, 0x80, 0x2d, 0xac, 0xd9, 0xa5, 0x35, 0xfb, 0x11, 0xe4, 0xd3, 0xd3,
+    0x06, 0x7a, 0x53, 0xad, 0x46, 0xd6, 0x49, 0x1e, 0xe0, 0x83, 0x23, 0x64, 0x6d, 0xa6, 0xa4, 0xc4,
+    0x04, 0xde, 0x11, 0x71, 0x54, 0x52, 0x81, 0xc6, 0x49, 0x2b, 0xd9, 0x91, 0x16, 0xb9, 0x29, 0xc4,
+    0x20, 0xc5, 0x96, 0xf8, 0xe0, 0xb9, 0x1e, 0x3a, 0x7e, 0x78, 0xd4, 0xb3, 0x2d, 0xc3, 0x59, 0xab,
+    0x89, 0xf0, 0x63, 0xf1, 0x1b, 0x8d, 0xbd, 0x6b, 0xdb, 0x00, 0x71, 0x9c, 0xf8, 0x86, 0xb6, 0x29,
+    0x79, 0x76, 0x56, 0xdd, 0xce, 0xe8, 0x14, 0xdf, 0x34, 0xac, 0x85, 0xad, 0xe5, 0xe1, 0x89, 0xf5,
+    0x29, 0x09, 0x4f, 0xf7, 0xc3, 0xdb, 0xad, 0x3d, 0x12, 0x9b, 0xe6, 0x2f, 0xa8, 0x70, 0xce, 0x64,
+    0x6a, 0xd5, 0xac, 0x75, 0x61, 0xbd, 0x7a, 0x6d, 0xbd, 0xba, 0x09, 0xdc, 0x67, 0x14, 0x4a, 0xad,
+    0x42, 0xed, 0xc8, 0xf1, 0xb7, 0x94, 0xda, 0xa8, 0xa1, 0x01, 0xd5, 0x4b, 0x3b, 0x8a, 0x0c, 0xa6,
+    0x21, 0x6a, 0x97, 0x8e, 0x69, 0x3f, 0xad, 0x1e, 0x7c, 0x53, 0x3b, 0xfd, 0xb1, 0x90, 0xeb, 0xb7,
+    0x45, 0x65, 0x56, 0xef, 0x9b, 0x07, 0xc3, 0x1b, 0x18, 0x56, 0xfd, 0xe1, 0x11, 0x36, 0xc7, 0x06,
+    0x4b, 0x6d, 0xba, 0x61, 0x83, 0xaa, 0x70, 0x6e, 0xb6, 0xa3, 0xe6, 0xdc, 0x76, 0xdd, 0x5e, 0x73,
+    0xf3, 0xdd, 0xd6, 0x35, 0x41, 0xea, 0x2e, 0xf4, 0x1b, 0x1c, 0x76, 0x3e, 0xac, 0x2b, 0x9e, 0x2c,
+    0x3a, 0xad, 0xb0, 0xf2, 0xef, 0x2b, 0x0b, 0xbc, 0x44, 0xb9, 0x6f, 0xdc, 0x68, 0xe6, 0x3d, 0x06,
+    0x6f, 0xbb, 0x3b, 0x6d, 0x26, 0xda, 0xf6, 0x5d, 0x14, 0xcd, 0x43, 0xb8, 0xc1, 0xc3, 0xa7, 0x50,
+    0x78, 0x79, 0xfb, 0x78, 0x4a, 0xbb, 0xea, 0xbc, 0xa4, 0x03, 0xf6, 0x85, 0x8d, 0xeb, 0x7f, 0x64,
+    0x05, 0x3c, 0x8d, 0xf2, 0xdd, 0xa6, 0x69, 0xd0, 0x4d, 0x91, 0x5d, 0x10, 0x74, 0x62, 0x5f, 0x17,
+    0xf7, 0x66, 0xa0, 0x9e, 0xff, 0xba, 0xc7, 0xb2, 0x6c, 0xe3, 0xb2, 0xff, 0xa6, 0x4b, 0xf3, 0xa7,
+    0xd1, 0x50, 0x2e, 0x1d, 0x4e, 0xa5, 0xff, 0x9b, 0x0f, 0x3e, 0x67, 0xd2, 0xda, 0x7e, 0x3c, 0xf7,
+    0xcf, 0x9e, 0xef, 0xcf, 0x9e, 0xfc, 0x09, 0x05, 0xf6, 0xae, 0x37, 0x01, 0x0f, 0x00, 0x00,
+};
+
+// printMonitorSettings.js, 2188 bytes, 783 compressed
+const char printMonitorSettings_js_etag[] = "\"2819b2fca83f3eeb\"";
+const uint8_t printMonitorSettings_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0xcb, 0x6e, 0xdb, 0x30,
+    0x10, 0xbc, 0xfb, 0x2b, 0x08, 0xd9, 0x00, 0x25, 0xd4, 0x51, 0x7b, 0xb6, 0x9b, 0x06, 0x79, 0xa2,
+    0x41, 0x5f, 0xb9, 0x24, 0x97, 0x20, 0x08, 0x68, 0x71, 0x65, 0xb3, 0xa1, 0x48, 0x81, 0xa4, 0xe2,
+    0x06, 0x81, 0xff, 0xbd, 0x4b, 0x3d, 0x2c, 0xca, 0x71, 0xd1, 0xd8, 0x80, 0x05, 0x61, 0x39, 0x1a,
+    0xcd, 0xcc, 0x2e, 0x69, 0xe7, 0x95, 0xca, 0x9c, 0xd0, 0x8a, 0x08, 0x25, 0x5c, 0x9c, 0x8c, 0x5e,
+    0x09, 0x21, 0x23, 0xfc, 0x12, 0x91, 0x93, 0x78, 0x12, 0xd3, 0x71, 0x69, 0x84, 0x72, 0x3f, 0x34,
+    0xae, 0x6a, 0x73, 0xa9, 0xd8, 0x42, 0x02, 0xa7, 0x49, 0x2a, 0x6c, 0x1c, 0xcd, 0xb2, 0x15, 0x64,
+    0x4f, 0xc0, 0xa3, 0x24, 0xa9, 0x9f, 0x78, 0xad, 0xaf, 0xfe, 0x33, 0x89, 0xa3, 0xc1, 0x73, 0x57,
+    0xda, 0x14, 0x51, 0x92, 0xda, 0x95, 0x5e, 0xc7, 0xc9, 0xbc, 0x86, 0x6d, 0xea, 0x2b, 0x48, 0x0b,
+    0xef, 0x7b, 0x76, 0x25, 0x38, 0xf4, 0xcf, 0x8e, 0xf6, 0x21, 0x5b, 0x75, 0x08, 0xce, 0xa4, 0xc8,
+    0x9e, 0xe2, 0xbc, 0xb5, 0x16, 0xef, 0xca, 0x13, 0x39, 0x3a, 0x73, 0x2b, 0x61, 0xf7, 0xfb, 0x18,
+    0x82, 0xdf, 0xe9, 0xa7, 0xf7, 0x34, 0xf0, 0xf5, 0x6e, 0xae, 0xd0, 0x5f, 0xcf, 0xb5, 0xc1, 0x0a,
+    0xba, 0x9d, 0x6c, 0xbd, 0x90, 0x38, 0x69, 0xf9, 0xb0, 0x37, 0x69, 0xa6, 0x55, 0x2e, 0x4c, 0x71,
+    0x01, 0x12, 0x1c, 0xdc, 0x78, 0x52, 0x30, 0x74, 0xd7, 0x3e, 0x89, 0x21, 0x09, 0x34, 0x3c, 0x33,
+    0x43, 0x74, 0xe9, 0x17, 0x2c, 0x39, 0xde, 0xd1, 0x56, 0x80, 0xb5, 0x6c, 0x09, 0x5f, 0x81, 0x71,
+    0x30, 0x33, 0x42, 0x1b, 0xe2, 0x13, 0x3a, 0x1d, 0xa2, 0x34, 0x67, 0xf2, 0x0e, 0x8c, 0x13, 0x19,
+    0x93, 0xe7, 0xe0, 0x5f, 0x3a, 0x23, 0xce, 0x54, 0x30, 0x84, 0x2d, 0x58, 0xf6, 0xb4, 0x34, 0xba,
+    0x52, 0xfc, 0x4c, 0x56, 0x88, 0xb8, 0xa7, 0xe3, 0x55, 0x4d, 0xfc, 0xb8, 0x36, 0xac, 0x9c, 0x92,
+    0x71, 0xc1, 0x84, 0x7a, 0x44, 0x0b, 0x0e, 0x29, 0xba, 0x5a, 0xae, 0xb5, 0x6b, 0x11, 0xf4, 0x61,
+    0xc8, 0xc7, 0x2a, 0xa7, 0xaf, 0x74, 0x56, 0xd9, 0x5f, 0xea, 0xbc, 0xf1, 0x7d, 0xe6, 0xd4, 0x8c,
+    0xe4, 0x0c, 0xb3, 0x0e, 0x91, 0x9b, 0xf9, 0xa8, 0xef, 0x43, 0x5a, 0x1a, 0x78, 0x46, 0xfe, 0x0b,
+    0xc8, 0x59, 0x25, 0x5d, 0x98, 0xf0, 0xc4, 0x19, 0x0c, 0xa0, 0x1b, 0x84, 0x4c, 0x6a, 0x0b, 0xd6,
+    0xc5, 0xd4, 0x61, 0x82, 0x01, 0xa8, 0xcb, 0xf8, 0x87, 0x37, 0x1d, 0xd3, 0x53, 0x03, 0xe4, 0x45,
+    0x57, 0xc4, 0x56, 0xed, 0xcd, 0x9a, 0x29, 0x47, 0x9c, 0x26, 0xbc, 0x8e, 0x8a, 0x78, 0x32, 0x52,
+    0x36, 0x9d, 0xc0, 0x00, 0xc9, 0x87, 0xba, 0x4f, 0x5c, 0xd8, 0x52, 0xb2, 0x97, 0x23, 0xc5, 0x0a,
+    0xa0, 0x53, 0xff, 0xe6, 0x24, 0x75, 0xf0, 0x07, 0xe5, 0x20, 0x80, 0x9e, 0x78, 0x18, 0xfd, 0xbc,
+    0x30, 0x5f, 0xea, 0xbc, 0x85, 0x5a, 0x12, 0xd6, 0x71, 0x90, 0xb5, 0x90, 0x92, 0x18, 0xb0, 0xe0,
+    0xfc, 0xeb, 0x0c, 0x69, 0xa9, 0x08, 0x16, 0x3c, 0xd2, 0xa6, 0xc8, 0x37, 0x88, 0xc9, 0x7f, 0xda,
+    0xfe, 0x4e, 0x49, 0x30, 0x03, 0x32, 0xd9, 0x69, 0xf6, 0x5a, 0x28, 0xae, 0xd7, 0xa9, 0xd4, 0x19,
+    0xf3, 0x90, 0x74, 0x65, 0x20, 0xc7, 0x40, 0xa2, 0x8f, 0x3c, 0x1c, 0xa7, 0x74, 0xe5, 0x0a, 0x79,
+    0xd2, 0xaa, 0xb9, 0xe6, 0xc7, 0x51, 0x6b, 0xa9, 0xad, 0x1c, 0x09, 0x3e, 0x34, 0x14, 0x4c, 0x70,
+    0xb7, 0x5b, 0xfd, 0x0c, 0xe3, 0x17, 0xa7, 0x38, 0x4a, 0x17, 0x4e, 0xdd, 0x73, 0xe6, 0xd8, 0x91,
+    0x63, 0x66, 0x09, 0xee, 0x98, 0x8e, 0x81, 0x0b, 0xd7, 0xbe, 0xab, 0xce, 0x98, 0x3e, 0xec, 0xd9,
+    0xc0, 0x64, 0xd4, 0x68, 0xf7, 0xc3, 0x9b, 0x69, 0x59, 0x15, 0xea, 0x8e, 0xc9, 0x0a, 0x6c, 0xd0,
+    0xc0, 0x92, 0x19, 0xec, 0x73, 0x8c, 0xbb, 0x52, 0x2c, 0xa4, 0x4f, 0x06, 0x6f, 0x0b, 0x56, 0x0e,
+    0x48, 0x86, 0xbb, 0xd1, 0x80, 0xab, 0x8c, 0xda, 0x12, 0x84, 0xfa, 0x37, 0x49, 0x8a, 0xea, 0x42,
+    0x37, 0xcd, 0x9e, 0xab, 0xab, 0x14, 0x2f, 0x61, 0x3a, 0x18, 0x00, 0xed, 0x03, 0xf2, 0xcd, 0x0c,
+    0x25, 0xde, 0x7f, 0x0a, 0xe6, 0x78, 0x2b, 0x06, 0x3b, 0x5a, 0x62, 0x87, 0xe0, 0x5f, 0x27, 0x0e,
+    0x4e, 0x9d, 0xd5, 0x12, 0xb0, 0x3b, 0xcb, 0x1e, 0x1b, 0x0c, 0x76, 0x7b, 0x02, 0xbc, 0x4d, 0x2f,
+    0x49, 0x73, 0xec, 0x6b, 0x77, 0x6e, 0x7b, 0x45, 0x58, 0x7a, 0xc6, 0xd1, 0xdd, 0xd1, 0x14, 0x58,
+    0xfb, 0x3f, 0x97, 0x5f, 0xb9, 0x68, 0x06, 0xef, 0xa7, 0x1f, 0xe1, 0x86, 0xb1, 0xd3, 0xd5, 0x8d,
+    0xb7, 0x5f, 0x3a, 0x98, 0xb6, 0x5e, 0xb9, 0x35, 0x72, 0x97, 0x93, 0x71, 0x8e, 0xf7, 0xf6, 0x70,
+    0x3e, 0x6d, 0xdc, 0x2e, 0x57, 0x89, 0xb5, 0x83, 0x89, 0x6e, 0x2d, 0x18, 0xb5, 0xc7, 0x6c, 0xd5,
+    0xd6, 0x0f, 0x57, 0xc6, 0xac, 0x5d, 0x6b, 0xc3, 0xdf, 0xa8, 0x6b, 0xeb, 0x07, 0x13, 0x9e, 0xde,
+    0x5c, 0x7f, 0x83, 0x97, 0x37, 0xc1, 0x95, 0x02, 0xab, 0x07, 0x93, 0xf5, 0x3f, 0xed, 0xa5, 0xd1,
+    0x65, 0x4c, 0xdb, 0xdf, 0x44, 0x9c, 0xed, 0x2d, 0x33, 0x34, 0x90, 0x64, 0x1e, 0x32, 0xf7, 0xdb,
+    0x7d, 0x4a, 0xa2, 0xdf, 0x56, 0xab, 0xa8, 0xae, 0x74, 0x7b, 0xbe, 0x3d, 0x64, 0xb0, 0x9b, 0x97,
+    0xfe, 0x18, 0xfe, 0x2e, 0x2c, 0x9e, 0xf6, 0x60, 0xe2, 0x48, 0x6a, 0xc6, 0xa3, 0x69, 0xfd, 0xaf,
+    0x63, 0xda, 0x9c, 0xe1, 0xc9, 0xfc, 0x2f, 0xef, 0x2b, 0x11, 0x60, 0x8c, 0x08, 0x00, 0x00,
+};
+
+// settings.js, 1533 bytes, 511 compressed
+const char settings_js_etag[] = "\"31eed0b6013f07e8\"";
+const uint8_t settings_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x94, 0xcd, 0x8a, 0xdb, 0x30,
+    0x14, 0x85, 0xf7, 0x79, 0x0a, 0xe1, 0x04, 0x24, 0x83, 0x71, 0xbb, 0x76, 0x28, 0xa5, 0x93, 0x69,
+    0xe8, 0xa2, 0x43, 0xa1, 0x85, 0xce, 0xa2, 0x0c, 0x83, 0x2a, 0x5d, 0xc5, 0x97, 0x28, 0x92, 0xd1,
+    0xcf, 0x84, 0x50, 0xf2, 0xee, 0x95, 0xed, 0x18, 0x3b, 0xe9, 0x10, 0x02, 0xed, 0xae, 0x5e, 0x84,
+    0xe0, 0x9c, 0x7b, 0x7c, 0xcf, 0x77, 0xe4, 0xa8, 0x68, 0x44, 0x40, 0x6b, 0x08, 0x1a, 0x0c, 0x2c,
+    0x9f, 0xfd, 0x9a, 0x91, 0x74, 0xa1, 0x22, 0x6c, 0xc1, 0xe8, 0x5c, 0xa2, 0x6f, 0x34, 0x3f, 0xac,
+    0x0e, 0x42, 0xc3, 0x83, 0x95, 0x40, 0xf3, 0x12, 0x3d, 0xcb, 0x2a, 0x51, 0x83, 0xd8, 0x82, 0xcc,
+    0xf2, 0x9c, 0xf4, 0x03, 0xed, 0xb5, 0x60, 0xd9, 0x5c, 0xd4, 0xd6, 0x7a, 0xb8, 0xef, 0xc7, 0xd6,
+    0xd6, 0xed, 0xb2, 0xbc, 0xac, 0x51, 0x02, 0xcb, 0x97, 0x9d, 0xee, 0xd8, 0x7d, 0x82, 0xf6, 0x70,
+    0xc3, 0xa0, 0xaf, 0xed, 0x7e, 0x1c, 0x9c, 0x0d, 0xd2, 0xcb, 0xa5, 0x92, 0x52, 0x68, 0x14, 0x5b,
+    0xa6, 0x86, 0x2c, 0x6c, 0xba, 0x56, 0x9f, 0x25, 0xd4, 0xe8, 0xaf, 0x2d, 0x7f, 0x6b, 0x80, 0x31,
+    0xc4, 0x2b, 0x41, 0xae, 0x99, 0x28, 0x34, 0x92, 0x51, 0x34, 0x4d, 0x0c, 0x95, 0xe3, 0x12, 0x6d,
+    0x65, 0x42, 0xcd, 0xde, 0xe6, 0x09, 0x69, 0xe3, 0x6c, 0xc3, 0xe8, 0x69, 0x2d, 0x5a, 0x90, 0xe0,
+    0x22, 0x4c, 0x1e, 0x77, 0x2b, 0xa2, 0x71, 0xb5, 0x63, 0xba, 0x93, 0x80, 0x2d, 0x5e, 0x21, 0x92,
+    0x5a, 0x2d, 0x85, 0x35, 0x0a, 0xdd, 0xee, 0x2b, 0x78, 0x08, 0xdf, 0x20, 0x04, 0x34, 0x1b, 0x4f,
+    0xff, 0x84, 0x08, 0x53, 0x3e, 0x2f, 0xdc, 0x11, 0xdb, 0xb4, 0x3f, 0x78, 0xf2, 0xee, 0x22, 0xf2,
+    0x0e, 0xbc, 0xe7, 0x1b, 0xf8, 0x04, 0x5c, 0x82, 0xab, 0x08, 0xed, 0x8c, 0xc9, 0xe0, 0xfc, 0x9e,
+    0x16, 0xe7, 0x6a, 0x2b, 0xb9, 0xfe, 0x0e, 0x2e, 0xa0, 0xe0, 0x7a, 0x05, 0x26, 0xb4, 0x33, 0x6d,
+    0xe4, 0x73, 0xd9, 0x4f, 0x2e, 0xb6, 0x1b, 0x67, 0xa3, 0x91, 0x77, 0x3a, 0x26, 0xc5, 0x0f, 0x3a,
+    0xaf, 0xbb, 0x07, 0x3c, 0xef, 0x1d, 0x6f, 0x0a, 0x32, 0xdf, 0x71, 0x34, 0xcf, 0x29, 0x4a, 0x48,
+    0x16, 0xc3, 0x3d, 0x65, 0x6d, 0x38, 0x29, 0xe8, 0xd3, 0xb9, 0x1f, 0x8f, 0xc1, 0xae, 0xad, 0x88,
+    0xfe, 0x8b, 0x59, 0xf5, 0xf9, 0xef, 0x82, 0xa9, 0x88, 0xe2, 0xa9, 0xc2, 0xa9, 0xf2, 0xb8, 0x9c,
+    0x8d, 0xf5, 0xa6, 0x6a, 0xe0, 0x25, 0xf9, 0xdf, 0x83, 0xe2, 0x51, 0x87, 0x29, 0xe9, 0xc5, 0x80,
+    0xf1, 0xa1, 0xcd, 0xc3, 0xe8, 0x07, 0x07, 0xe4, 0x60, 0x23, 0xf1, 0xf1, 0xf4, 0x65, 0xcf, 0x4d,
+    0x20, 0xc1, 0x12, 0xd7, 0xd2, 0x48, 0x10, 0x06, 0x7c, 0x05, 0x99, 0x20, 0xd6, 0x97, 0x67, 0x70,
+    0x9f, 0x8e, 0x89, 0xdd, 0x97, 0xda, 0x0a, 0xde, 0x4a, 0xca, 0xda, 0x81, 0x4a, 0xc0, 0xb3, 0x37,
+    0x6e, 0xda, 0x56, 0x59, 0x87, 0x9d, 0xce, 0x26, 0xb5, 0x0f, 0x6f, 0x49, 0xbe, 0x9c, 0x5d, 0xd6,
+    0x9c, 0x4e, 0xca, 0x06, 0xc2, 0x23, 0x2a, 0xfc, 0x97, 0x1d, 0xf7, 0xae, 0xe4, 0x11, 0xd7, 0xf8,
+    0xbf, 0x17, 0xac, 0x7a, 0x14, 0xa1, 0x06, 0x22, 0xa2, 0x73, 0xc9, 0x8d, 0xb4, 0xb4, 0x89, 0x1f,
+    0x5f, 0x80, 0xbf, 0xec, 0x5e, 0x9d, 0x2a, 0x5c, 0xe3, 0xb5, 0xe2, 0xbb, 0xf2, 0x4f, 0x1e, 0x5c,
+    0xca, 0x8f, 0x6d, 0xae, 0xcf, 0xe8, 0x13, 0x3e, 0x70, 0x2c, 0xd3, 0x96, 0xcb, 0xac, 0xe8, 0xfe,
+    0xe6, 0x8b, 0x1e, 0x4a, 0xbe, 0xfc, 0x0d, 0x4a, 0x50, 0xe9, 0x65, 0xfd, 0x05, 0x00, 0x00,
+};
+
+// station.js, 3007 bytes, 951 compressed
+const char station_js_etag[] = "\"8131f537c1c43a5a\"";
+const uint8_t station_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x56, 0xdd, 0x6f, 0xdb, 0x36,
+    0x10, 0x7f, 0xf7, 0x5f, 0x71, 0x50, 0xb7, 0x59, 0x5a, 0x6b, 0x29, 0x79, 0xe9, 0x00, 0xbb, 0xce,
+    0xc3, 0x92, 0x76, 0xcd, 0xd0, 0x36, 0x43, 0x3d, 0x2c, 0x0f, 0xc3, 0x1e, 0x68, 0xf1, 0x6c, 0x13,
+    0xa5, 0x48, 0x81, 0xa4, 0xed, 0x05, 0x85, 0xff, 0xf7, 0x1d, 0x25, 0xea, 0xc3, 0x8a, 0xdd, 0x65,
+    0x05, 0x8a, 0x05, 0x70, 0x60, 0xdf, 0xe7, 0xef, 0x8e, 0xbf, 0x3b, 0x72, 0xc7, 0x0c, 0xec, 0x71,
+    0x69, 0x75, 0xfe, 0x09, 0xdd, 0x6c, 0x34, 0x5a, 0x6d, 0x55, 0xee, 0x84, 0x56, 0x20, 0x94, 0x70,
+    0x71, 0x32, 0xfa, 0x0c, 0x00, 0x23, 0xfa, 0x80, 0x2e, 0x51, 0xdd, 0xe3, 0x72, 0x51, 0x19, 0xc6,
+    0xc9, 0x6c, 0x74, 0xe8, 0x19, 0x6f, 0x4b, 0xce, 0x1c, 0xde, 0x2a, 0x87, 0x46, 0xa1, 0xbb, 0xde,
+    0x1a, 0x83, 0xca, 0xc5, 0x05, 0x5a, 0xcb, 0xd6, 0x78, 0xc3, 0x1c, 0xa3, 0x40, 0x55, 0x94, 0x1d,
+    0xa5, 0xcb, 0x6b, 0x35, 0xcc, 0xa1, 0x67, 0x90, 0x06, 0xe9, 0x47, 0x64, 0x5c, 0xa8, 0xb5, 0x9d,
+    0x0d, 0xcd, 0xff, 0x60, 0x72, 0x8b, 0x9d, 0x54, 0x2f, 0x2d, 0x9a, 0x1d, 0xf2, 0xdf, 0x45, 0x51,
+    0x4b, 0x2b, 0xcd, 0x77, 0x71, 0xf4, 0x4c, 0x04, 0x14, 0xf7, 0xc8, 0xdc, 0x06, 0xcd, 0x3b, 0x61,
+    0x5d, 0x94, 0xa4, 0x58, 0x94, 0xee, 0xc1, 0xc3, 0xae, 0xec, 0xc4, 0x2a, 0x0e, 0x61, 0xd3, 0x02,
+    0x9d, 0x11, 0x79, 0x52, 0x89, 0x6b, 0x8c, 0xfe, 0xaf, 0x9f, 0x94, 0x80, 0x36, 0xc6, 0x8e, 0xc2,
+    0xa4, 0x4e, 0xbf, 0x11, 0x7f, 0x23, 0x8f, 0x2f, 0x13, 0x78, 0x0e, 0xd1, 0x35, 0x4c, 0x20, 0xa2,
+    0x2f, 0x8d, 0x09, 0x47, 0x9b, 0x1b, 0x51, 0xfa, 0xb6, 0xd4, 0x68, 0x0f, 0xd5, 0x7f, 0x94, 0x16,
+    0xbf, 0x3a, 0xc7, 0x9b, 0xa7, 0xe5, 0x38, 0x5f, 0x3d, 0x2b, 0xe9, 0xf4, 0x78, 0x3c, 0x7e, 0x25,
+    0x05, 0xe4, 0x92, 0x59, 0x3b, 0x8f, 0x24, 0x69, 0x26, 0x6b, 0xa3, 0xb7, 0xe5, 0x44, 0x50, 0xca,
+    0xe8, 0x6a, 0xdc, 0x25, 0xa8, 0x21, 0x3d, 0x87, 0xf1, 0xab, 0x4c, 0x8a, 0xab, 0x71, 0x52, 0x27,
+    0x19, 0x9d, 0x00, 0x1d, 0xbd, 0xdd, 0x16, 0x82, 0x0b, 0xf7, 0x30, 0x3d, 0x02, 0xb8, 0x09, 0x52,
+    0x0f, 0xfe, 0xfb, 0x68, 0xf6, 0xbf, 0xa1, 0xbb, 0x17, 0x8a, 0x83, 0x2d, 0x11, 0xf9, 0x31, 0xbe,
+    0x3d, 0xc9, 0x17, 0x5e, 0xec, 0x01, 0x16, 0x99, 0x85, 0x95, 0xd1, 0xc5, 0x23, 0x8b, 0x1b, 0x61,
+    0xb0, 0xe6, 0x37, 0x59, 0xfd, 0xf0, 0xec, 0xf2, 0xa7, 0x97, 0xdf, 0xbe, 0x94, 0x7a, 0xd6, 0x7a,
+    0xe4, 0xa6, 0x32, 0x14, 0xee, 0x81, 0x66, 0x04, 0x5b, 0xce, 0x3a, 0x2f, 0xff, 0x11, 0x2e, 0x2f,
+    0x2e, 0x2e, 0x42, 0xf5, 0xc3, 0xc2, 0xef, 0x42, 0x04, 0x60, 0xae, 0xae, 0xbc, 0x1f, 0x92, 0xd8,
+    0xf5, 0x4e, 0xe7, 0x4c, 0xa2, 0xff, 0xb1, 0x20, 0xfa, 0xab, 0x75, 0x1c, 0xa1, 0x9a, 0xfc, 0xf2,
+    0x73, 0x54, 0xd1, 0x0d, 0xa8, 0xe2, 0xb3, 0x3e, 0x1e, 0xc8, 0xc0, 0xe7, 0x9b, 0x37, 0xe5, 0xf1,
+    0xaa, 0x79, 0xaf, 0x69, 0x3d, 0x69, 0x73, 0xab, 0x56, 0xfa, 0xdc, 0x9a, 0xf1, 0x71, 0xa9, 0x15,
+    0x1e, 0x56, 0x69, 0x2a, 0x60, 0x13, 0x5f, 0x54, 0x7f, 0xe7, 0x04, 0xf9, 0x2d, 0x4f, 0xba, 0xc5,
+    0x22, 0x28, 0x64, 0xb7, 0x25, 0xfa, 0xd6, 0xa8, 0xd8, 0x52, 0x22, 0x1f, 0xae, 0x8a, 0x81, 0xd5,
+    0x8e, 0x49, 0xc1, 0x7f, 0xf3, 0x81, 0x6b, 0x40, 0x8d, 0x59, 0xe7, 0x50, 0x39, 0x51, 0x96, 0xc1,
+    0x02, 0x0c, 0x60, 0x3e, 0xb0, 0xa2, 0x2a, 0x9e, 0x46, 0xde, 0x3a, 0xaa, 0x74, 0x0a, 0xe3, 0x53,
+    0xa8, 0x17, 0x5e, 0x37, 0x6b, 0x63, 0x1e, 0xda, 0x6f, 0xed, 0xa2, 0xf9, 0xca, 0xa4, 0x4a, 0x43,
+    0x55, 0x02, 0x50, 0x9b, 0x19, 0xd0, 0x00, 0xa0, 0x20, 0x0a, 0xa4, 0xe3, 0x61, 0xae, 0xb3, 0x6b,
+    0xed, 0x89, 0x59, 0x1c, 0x84, 0x7e, 0x36, 0xa1, 0x0f, 0x6d, 0xd3, 0xfd, 0xc9, 0xa5, 0x12, 0xd5,
+    0xda, 0x6d, 0x60, 0x3e, 0x87, 0x8b, 0x61, 0xc7, 0xb3, 0x0c, 0xb8, 0xd1, 0x25, 0x10, 0xc5, 0x60,
+    0xcf, 0x84, 0x23, 0x2e, 0x42, 0x29, 0x59, 0x8e, 0x1b, 0x2d, 0x39, 0x1a, 0x4f, 0x5f, 0xaf, 0x5a,
+    0x09, 0x63, 0x1d, 0x84, 0xdc, 0xad, 0xb3, 0xe7, 0x43, 0xd1, 0xb1, 0xc7, 0x53, 0x14, 0xa4, 0x98,
+    0x12, 0xa0, 0xf8, 0x4f, 0xc1, 0xff, 0x4a, 0x88, 0xaf, 0x06, 0x0b, 0xbd, 0xc3, 0x38, 0x99, 0x7d,
+    0xc9, 0xe9, 0x69, 0xbc, 0x06, 0xc1, 0xe7, 0x51, 0x43, 0xbf, 0xf1, 0x39, 0xfa, 0xf9, 0xa6, 0x44,
+    0x57, 0x47, 0xeb, 0xac, 0x6a, 0xc5, 0x7f, 0x67, 0x70, 0xd3, 0x44, 0xdf, 0xc1, 0x8d, 0x2b, 0x64,
+    0xec, 0x4f, 0x63, 0x30, 0x41, 0x83, 0x9b, 0x1c, 0xc2, 0xcc, 0xb4, 0xaf, 0x80, 0xb0, 0x71, 0x3a,
+    0x93, 0xf1, 0xde, 0x4e, 0xb3, 0xcc, 0xa3, 0xe7, 0x3a, 0xdf, 0x16, 0x7e, 0x03, 0x49, 0xda, 0x05,
+    0x3e, 0x58, 0xba, 0xd1, 0xd4, 0x3f, 0x82, 0x9f, 0xed, 0x6d, 0x03, 0xbd, 0x0d, 0x94, 0x6a, 0xe5,
+    0x73, 0x51, 0xbc, 0x26, 0x77, 0x8c, 0x3b, 0x97, 0xc0, 0x67, 0x3a, 0xa1, 0x3b, 0x52, 0xd4, 0xbf,
+    0x0e, 0x8f, 0xbd, 0x72, 0xa9, 0x2d, 0x9e, 0x74, 0xbb, 0xf6, 0x9a, 0xb3, 0x7e, 0xa1, 0x33, 0x27,
+    0x3d, 0xdf, 0xd7, 0xba, 0xb3, 0xbe, 0x68, 0x8c, 0x36, 0x27, 0x3d, 0x5f, 0x7b, 0x4d, 0xeb, 0x77,
+    0xd4, 0xc9, 0xae, 0x8c, 0xea, 0xa1, 0xd4, 0x3d, 0x42, 0x38, 0xb3, 0x9b, 0xa5, 0x66, 0x86, 0x76,
+    0xa7, 0x93, 0x48, 0x5c, 0xa9, 0x0e, 0x23, 0xba, 0x69, 0xc4, 0x34, 0x02, 0xb9, 0x56, 0x8a, 0xae,
+    0x17, 0xe4, 0xd1, 0xf0, 0x7c, 0x7a, 0x55, 0x86, 0xb3, 0x79, 0x62, 0x48, 0x3f, 0x55, 0x5f, 0x08,
+    0xdb, 0x6f, 0x41, 0x08, 0x9c, 0x65, 0x64, 0x6f, 0xb5, 0x44, 0x3a, 0xd1, 0xb5, 0x57, 0xa4, 0x7e,
+    0xec, 0x9b, 0x7b, 0xc8, 0xef, 0xc3, 0x1e, 0xdb, 0xa8, 0x3b, 0xbf, 0x2e, 0xee, 0x3e, 0xa4, 0x25,
+    0x33, 0x35, 0xbc, 0x23, 0x63, 0xbb, 0x17, 0x2e, 0xdf, 0x1c, 0xed, 0x42, 0xf7, 0x50, 0xe2, 0xa3,
+    0x97, 0x15, 0xa3, 0xa3, 0x8d, 0xc2, 0xaa, 0x0f, 0xf7, 0x44, 0x34, 0x3d, 0xda, 0x53, 0xff, 0xfe,
+    0x9a, 0x9c, 0x1d, 0xd9, 0x2f, 0x0d, 0xb2, 0x4f, 0xb3, 0x41, 0x86, 0xde, 0xb8, 0x9e, 0x0c, 0x7f,
+    0xee, 0x06, 0x39, 0x15, 0xba, 0x2f, 0x09, 0x63, 0x76, 0xdc, 0xd9, 0x8e, 0x22, 0xd4, 0xd7, 0xbe,
+    0x8a, 0xeb, 0x85, 0x5f, 0x11, 0x21, 0x41, 0x32, 0x1c, 0xb5, 0xd4, 0xf6, 0xb5, 0xd5, 0x79, 0xf9,
+    0x87, 0x87, 0xde, 0xa7, 0x8c, 0xf3, 0xd7, 0x3b, 0x2a, 0xdb, 0xaf, 0x1a, 0x24, 0x72, 0xc6, 0x91,
+    0xd4, 0x8c, 0x47, 0x2f, 0xaa, 0x77, 0xf9, 0x0b, 0x58, 0x31, 0x5a, 0xbc, 0xe4, 0xf0, 0x0f, 0xc4,
+    0xf5, 0x5a, 0x4c, 0xbf, 0x0b, 0x00, 0x00,
+};
+
+// weatherSettings.js, 724 bytes, 275 compressed
+const char weatherSettings_js_etag[] = "\"b79b17ab43250af6\"";
+const uint8_t weatherSettings_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x92, 0xd1, 0x6a, 0xc3, 0x20,
+    0x14, 0x86, 0xef, 0xf3, 0x14, 0xe2, 0x0a, 0x51, 0x28, 0x79, 0x80, 0xed, 0x6a, 0xb0, 0x0e, 0xc6,
+    0x76, 0xbf, 0x6b, 0xa7, 0x27, 0x78, 0xa8, 0xd3, 0x4c, 0xcd, 0xc2, 0x08, 0x7d, 0xf7, 0xa9, 0x4b,
+    0xd7, 0x36, 0x69, 0xcb, 0x16, 0x50, 0xc1, 0xf3, 0xff, 0xc7, 0xef, 0xd7, 0xb4, 0xbd, 0x95, 0x11,
+    0x9d, 0x25, 0x68, 0x31, 0x32, 0x5e, 0x8d, 0x84, 0x90, 0x2a, 0x0d, 0x82, 0x2d, 0x61, 0x2b, 0x56,
+    0xdf, 0x0c, 0x20, 0xa2, 0x06, 0xbf, 0xb1, 0xe2, 0xcd, 0x80, 0xaa, 0x79, 0x83, 0x81, 0xd1, 0x5b,
+    0xa9, 0x41, 0x6e, 0x41, 0x51, 0xce, 0x8b, 0x78, 0x2c, 0x73, 0xfe, 0x82, 0x76, 0xc3, 0xeb, 0x8f,
+    0xe5, 0xd1, 0xf9, 0x77, 0xc6, 0xef, 0x4a, 0x69, 0x57, 0x66, 0x30, 0x01, 0x66, 0x7a, 0x8d, 0x0a,
+    0xce, 0xea, 0xcb, 0xb2, 0x62, 0x74, 0x06, 0x40, 0x79, 0x23, 0x0d, 0xca, 0x2d, 0x6b, 0x27, 0x70,
+    0x36, 0x27, 0xc0, 0x36, 0x71, 0x47, 0x8d, 0xe1, 0x3c, 0xea, 0xa9, 0xf8, 0x0a, 0xf2, 0x01, 0xfb,
+    0x04, 0x7d, 0xe9, 0xbf, 0x10, 0xe1, 0xe0, 0xdf, 0xa5, 0x9d, 0x14, 0x68, 0x4f, 0xbc, 0x3c, 0xb0,
+    0x1a, 0xe7, 0x69, 0xf3, 0x7e, 0x8a, 0x9a, 0x95, 0xfb, 0x7e, 0xb9, 0x6a, 0x9c, 0x14, 0xb9, 0xc5,
+    0xd3, 0x43, 0x2a, 0x76, 0xde, 0x75, 0xac, 0xf6, 0xf0, 0xd1, 0xa3, 0x4f, 0x2f, 0xb3, 0x26, 0xd1,
+    0xf7, 0x70, 0x24, 0x9e, 0x5a, 0xdd, 0x77, 0xf8, 0x0c, 0x5f, 0x57, 0xf4, 0xc7, 0x68, 0x8b, 0x2c,
+    0x17, 0xd1, 0xb2, 0xf2, 0xef, 0x68, 0xad, 0x48, 0xf7, 0xf7, 0x1f, 0xb6, 0xc9, 0x90, 0xf5, 0x19,
+    0x70, 0x40, 0xab, 0xdc, 0xd0, 0x08, 0xa5, 0x36, 0x9f, 0x60, 0xe3, 0x0b, 0x86, 0x08, 0x16, 0x3c,
+    0xa3, 0xc6, 0x09, 0x45, 0xd7, 0xe5, 0xef, 0xfd, 0x35, 0x7d, 0x03, 0xcd, 0xa3, 0x13, 0x48, 0xd4,
+    0x02, 0x00, 0x00,
+};
+
+// station.css, 1040 bytes, 306 compressed
+const char station_css_etag[] = "\"f15463474bcecd70\"";
+const uint8_t station_css_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x93, 0xd1, 0x6a, 0xc3, 0x20,
+    0x14, 0x86, 0xef, 0xf3, 0x14, 0xc2, 0x6e, 0x36, 0x98, 0x92, 0x15, 0xda, 0x31, 0xfb, 0x34, 0x26,
+    0x9e, 0xb4, 0x52, 0xf5, 0x84, 0x93, 0xd3, 0x96, 0x6e, 0xf4, 0xdd, 0x67, 0xd7, 0x36, 0x90, 0xc4,
+    0x96, 0x30, 0x2f, 0x04, 0xcf, 0xff, 0xfb, 0xa3, 0x9f, 0xc7, 0x0a, 0xed, 0x49, 0xfc, 0x14, 0x22,
+    0x8d, 0xca, 0xd4, 0xbb, 0x0d, 0xe1, 0x3e, 0x5a, 0x59, 0xa3, 0x47, 0xd2, 0xe2, 0xc5, 0x2e, 0xec,
+    0xca, 0x36, 0xeb, 0x24, 0x9f, 0x8b, 0x34, 0x29, 0xe3, 0x81, 0x58, 0x05, 0xeb, 0xb4, 0xae, 0xa0,
+    0x41, 0x82, 0xf7, 0x42, 0x55, 0x04, 0xc6, 0xd6, 0xb4, 0x0f, 0x95, 0x18, 0x2b, 0x1c, 0x47, 0x95,
+    0xda, 0x90, 0x95, 0xec, 0xd8, 0x43, 0x4e, 0xe8, 0xf6, 0xd5, 0x43, 0xcd, 0xbb, 0xb8, 0x1b, 0xd5,
+    0x2d, 0x61, 0x6b, 0xf1, 0x18, 0xa5, 0x63, 0x08, 0x23, 0xcd, 0xbb, 0x8e, 0xe5, 0xe5, 0x32, 0x6d,
+    0x4e, 0x8d, 0xe6, 0x30, 0x09, 0xbc, 0x41, 0x68, 0x30, 0xb2, 0xec, 0xdc, 0x37, 0x68, 0xf1, 0xa1,
+    0x16, 0x4b, 0x08, 0xeb, 0xbf, 0x72, 0x72, 0x83, 0xdc, 0x82, 0xdb, 0x6c, 0x59, 0x0b, 0x17, 0x1d,
+    0x3b, 0xe3, 0xaf, 0x4a, 0x8b, 0x5d, 0x5a, 0x61, 0xd4, 0x82, 0xc0, 0x1b, 0x76, 0x07, 0xb8, 0xd6,
+    0x19, 0x5b, 0x2d, 0x4a, 0x55, 0x7e, 0xd1, 0x25, 0xe3, 0x5c, 0xcc, 0x62, 0x17, 0x91, 0x5f, 0x35,
+    0x84, 0x96, 0x4f, 0x6f, 0x19, 0x8e, 0x79, 0x75, 0xc4, 0xf4, 0x89, 0x69, 0xc0, 0xf7, 0x89, 0xaf,
+    0x47, 0x93, 0xf7, 0x4c, 0xb9, 0xe7, 0x7d, 0x03, 0xca, 0x19, 0xcb, 0x8d, 0x78, 0x30, 0xb4, 0x71,
+    0x51, 0xd2, 0x95, 0x6d, 0x99, 0xa0, 0xdf, 0x89, 0xe5, 0x1e, 0x71, 0x7e, 0x4e, 0x1f, 0x33, 0xeb,
+    0xbc, 0xc3, 0x10, 0x0f, 0x4d, 0xca, 0x90, 0xa5, 0xfa, 0x5c, 0x3e, 0x7b, 0xbe, 0x7f, 0x1d, 0xb0,
+    0xcf, 0xee, 0xa3, 0x03, 0x5a, 0xe3, 0xa7, 0xdf, 0x22, 0xd7, 0x91, 0xf9, 0x86, 0x4c, 0x59, 0xb3,
+    0x9a, 0x71, 0xb1, 0xa2, 0xfb, 0xfe, 0x47, 0xb4, 0x7e, 0x01, 0x35, 0x39, 0x9b, 0x2d, 0x10, 0x04,
+    0x00, 0x00,
+};
+
+#endif // _static_assets_h
@@ -6,10 +6,3 @@ const char weatherSettings_html[] PROGMEM =
 "<!doctype html><html lang=\"en\"><head> <meta charset=\"utf-8\"> <meta name=\"viewport\" content=\"width=device-width, initial-scale=1, shrink-to-fit=no\"> <link rel=\"stylesheet\" href=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/css/bootstrap.min.css\" integrity=\"sha384-ggOyR0iXCbMQv3Xipma34MD+dH/1fQ784/j6cY/iJTQUOhcWr7x9JvoRxT2MZw1T\" crossorigin=\"anonymous\"> <link rel=\"stylesheet\" href=\"css/station.css\"> <title>OctoPrint Monitor | Weather Settings</title></head><body> %NAVBAR% <div class=\"container-fluid\" style=\"margin-top:80px\"> <h3>Settings for OpenWeather API</h3> <div class=\"table-responsive-md\"> <table class=\"table\" style=\"background-color: white\"> <thead class=\"thead-light\"> <tr> <th>Weather - <a href=\"http://bulk.openweathermap.org/sample/city.list.json.gz\">Link to city list for location ids:</a></th> </tr></thead> <tbody> <tr> <td> <form action=\"/updateWeatherSettings.html\"> <div class=\"form-check form-group\"> <label class=\"form-check-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"weatherEnabled\" name=\"weatherEnabled\" value=\"Enabled\" %WEATHERENABLED%>Enabled </label> </div><div id=\"weatherForm\"> <div class=\"form-group\"> <label for=\"locationID\">OpenWeather location ID:</label> <input type=\"text\" class=\"form-control\" id=\"locationID\" value=\"%WEATHERLOCATIONKEY%\" placeholder=\"OpenWeather location ID\" name=\"openWeatherLocation\"> </div><div class=\"form-group\"> <label for=\"weatherApiKey\">OpenWeather Api Key:</label> <input type=\"text\" class=\"form-control\" id=\"weatherApiKey\" value=\"%WEATHERAPIKEY%\" placeholder=\"OpenWeather API Key\" name=\"openWeatherApiKey\"> </div><div class=\"form-check form-group\"> <label class=\"form-check-label\" for=\"check1\"> <input type=\"checkbox\" class=\"form-check-input\" id=\"displayMetric\" name=\"displayMetric\" value=\"Metric\" %DISPLAYMETRIC%>Metric display for weather </label> </div></div><button type=\"submit\" class=\"btn btn-primary\">Save</button> </form> </td></tr></tbody> </table> </div></div><script src=\"https://code.jquery.com/jquery-3.3.1.slim.min.js\" integrity=\"sha384-q8i/X+965DzO0rT7abK41JStQIAqVgRVzpbzo5smXKp4YfRvH+8abtTE1Pi6jizo\" crossorigin=\"anonymous\"></script> <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.7/umd/popper.min.js\" integrity=\"sha384-UO2eT0CpHqdSJQ6hJty5KVphtPhzWj9WO1clHTMGa3JDZwrnQq4sF86dIHNDz0W1\" crossorigin=\"anonymous\"></script> <script src=\"https://stackpath.bootstrapcdn.com/bootstrap/4.3.1/js/bootstrap.min.js\" integrity=\"sha384-JjSmVgyd0p3pXB1rRibZUAYoIIy6OrQ6VrjIEaFf/nJGzIxFDsf4x0xIM+B07jRM\" crossorigin=\"anonymous\"></script> <script src=\"js/jquery.confirmModal.min.js\"></script> <script src=\"js/weatherSettings.js\"></script></body></html>"
 
 };
-
-const char weatherSettings_js[] PROGMEM =
-{
-
-"function init(){if ($('#weatherEnabled').is(\":checked\")){showWeatherForm();}else{hideWeatherForm();}$(\"#weatherEnabled\").click(function(){if($(this).is(\":checked\")){showWeatherForm();}else{hideWeatherForm();}});}function showWeatherForm(){$(\"#weatherForm\").show(); $(\"#locationID\").prop('required', true); $(\"#weatherApiKey\").prop('required', true);}function hideWeatherForm(){$(\"#weatherForm\").hide(); $(\"#locationID\").prop('required', false); $(\"#weatherApiKey\").prop('required', false);}window.addEventListener(\"load\", init, false);"
-
-};
\ No newline at end of file
@@ -17,8 +17,39 @@
 
 #define WIFI_STRENGTH_INTERVAL          10 * SECONDS_MULT
 #define SETTINGS_CHANGED_INTERVAL       10 * SECONDS_MULT
-#define SCREENGRAB_INTERVAL             10 * SECONDS_MULT
 #define WIFI_CONNECTING_DELAY           2 * SECONDS_MULT
+#define METRICS_INTERVAL                30 * SECONDS_MULT   // heap metrics pushed to websocket clients
+
+// OctoPrint keep-alive connections
+#define OCTOPRINT_CONNECTION_POOL_SIZE      3
+#define OCTOPRINT_CONNECTION_IDLE_TIMEOUT   (2 * MINUTES_MULT)
+#define OCTOPRINT_HTTP_TIMEOUT              2 * SECONDS_MULT
+#define OCTOPRINT_HTTP_BODY_SIZE            512     // bytes per pooled connection, only the fields kept from a reply
+
+// display sprite, made once at start up if this much heap is left after it
+#define SPRITE_MAX_BYTES                    8 * 1024
+#define SPRITE_HEAP_RESERVE                 12 * 1024
+
+// OctoPrint push socket
+#define OCTOPRINT_PUSH_MAX_MESSAGE          3072    // bytes, bigger messages are dropped, also holds the login reply
+#define OCTOPRINT_PUSH_THROTTLE             4       // multiples of OctoPrint's 500ms update rate
+#define OCTOPRINT_PUSH_CONNECT_TIMEOUT      5 * SECONDS_MULT
+#define OCTOPRINT_PUSH_SILENCE_TIMEOUT      (2 * MINUTES_MULT)
+#define OCTOPRINT_PUSH_RETRY_INTERVAL       (30 * SECONDS_MULT)
+
+// steady state allocation checking, turned on by the *_static environments in
+// platformio.ini which also wrap malloc. Once warmed up the poll, draw and update
+// paths shouldn't touch the heap, anything they allocate is counted in the metrics.
+#ifndef STATIC_ALLOCATION_MODE
+#define STATIC_ALLOCATION_MODE              false
+#endif
+#define STATIC_ALLOCATION_WARMUP            (10 * MINUTES_MULT)
+
+// connection pool, push and render counters written to serial after every
+// printer poll, for debugging. Add -D POLL_STATS_LOGGING=true to build_flags
+#ifndef POLL_STATS_LOGGING
+#define POLL_STATS_LOGGING                  false
+#endif
 
 
 #endif // _settings_h
\ No newline at end of file
@@ -4,8 +4,50 @@
 #include <ArduinoJson.h>
 #include "DisplayBase.h"
 #include "Settings.h"
+#include "SettingsRecord.h"
 
-const String SETTINGS_FILE_NAME = "/Settings.json";
+const String SETTINGS_FILE_NAME = "/Settings.json";    // before binary records, migrated on first boot
+
+#define SETTINGS_RECORD_FILE        "/settings.bin"
+#define PRINTER_RECORD_FILE         "/printer%d.bin"
+#define SETTINGS_RECORD_VERSION     1
+
+#define SETTINGS_DIRTY_GENERAL      0x01
+#define SETTINGS_DIRTY_PRINTER(n)   (1ul << ((n) + 1))
+#define SETTINGS_DIRTY_ALL          (SETTINGS_DIRTY_PRINTER(MAX_PRINTERS) - 1)
+
+// settings reported to listeners, a SettingsChangeSet is any combination
+enum SettingsChange : uint32_t
+{
+    SettingsChange_Weather              = 0x0001,   // enabled, location or API key
+    SettingsChange_Metric               = 0x0002,
+    SettingsChange_Brightness           = 0x0004,
+    SettingsChange_WeatherInterval      = 0x0008,
+    SettingsChange_PrintMonitorInterval = 0x0010,
+    SettingsChange_DisplayCycleInterval = 0x0020,
+    SettingsChange_Printers             = 0x0040,   // added, edited or deleted
+    SettingsChange_UtcOffset            = 0x0080,
+    SettingsChange_ClockFormat          = 0x0100,
+    SettingsChange_DateFormat           = 0x0200,
+    SettingsChange_CurrentDisplay       = 0x0400,
+};
+
+typedef uint32_t SettingsChangeSet;
+
+// called with the changes that match the mask it was added with
+typedef void (* SettingsListener)(SettingsChangeSet changes);
+
+typedef struct SettingsSubscriber
+{
+    SettingsChangeSet mask;
+    SettingsListener listener;
+} SettingsSubscriber;
+
+#define MAX_SETTINGS_SUBSCRIBERS    8
+
+#if MAX_PRINTERS > 30
+#error "MAX_PRINTERS doesn't fit in the settings dirty mask"
+#endif
 
 #define WEATHER_DISPLAY_SETTING 0
 #define CYCLE_DISPLAY_SETTING   -1
@@ -58,10 +100,10 @@ class SettingsManager
 
         void resetSettings();
 
-        String getOpenWeatherApiKey();
+        const String& getOpenWeatherApiKey();
         void setOpenWeatherApiKey(String apiKey);
 
-        String getOpenWeatherlocationID();
+        const String& getOpenWeatherlocationID();
         void setOpenWeatherlocationID(String locationID);
 
         void setWeatherEnabled(bool enabled);
@@ -101,22 +143,39 @@ class SettingsManager
         DateFormat getDateFormat();
         void setDateFormat(DateFormat dateFormat);
 
-        void setSettingsChangedCallback(void(* callback)());
+        void beginUpdate();
+        void commitUpdate();
+
+        bool addListener(SettingsChangeSet mask, SettingsListener listener);
         void setPrinterDeletedCallback(void(* callback)());
 
     private:
         SettingsData data;
-        OctoPrinterData* printersData[MAX_PRINTERS];
+        OctoPrinterData* printersData[MAX_PRINTERS];  // in printer order, points into printerSlots
+        OctoPrinterData printerSlots[MAX_PRINTERS];
 
-        void (* settingsChangedCallback)();
+        SettingsSubscriber subscribers[MAX_SETTINGS_SUBSCRIBERS];
+        int numSubscribers;
         void (* printerDeletedCallback)();
 
-        void loadSettings();
-        void saveSettings();
-        void updateSettings();
+        uint32_t dirtyRecords;      // SETTINGS_DIRTY_ records waiting to be saved
+        SettingsChangeSet pendingChanges;   // not yet notified
+        int updateDepth;
+
+        // one record buffer for every load and save, they never overlap
+        static SettingsRecord record;
 
-        void loadPrinters();
-        void savePrinters();
+        bool loadSettings();
+        void saveSettings();
+        void updateSettings(uint32_t dirty, SettingsChangeSet changes);
+        void applyUpdate();
+        bool loadPrinter(int printerNum);
+        bool savePrinter(int printerNum);
+        bool removePrinter(int printerNum);
+
+        void migrateJsonSettings();
+        void loadJsonSettings();
+        void loadJsonPrinters();
 };
 
 #endif // _settingsmanager_h
\ No newline at end of file
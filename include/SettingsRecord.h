@@ -0,0 +1,61 @@
+#ifndef _settingsRecord_h
+#define _settingsRecord_h
+
+#include <Arduino.h>
+
+#define SETTINGS_RECORD_MAGIC       0x4f504d53  // "SMPO"
+#define SETTINGS_RECORD_MAX_SIZE    512         // payload bytes
+#define SETTINGS_RECORD_TEMP_SUFFIX ".tmp"
+
+typedef struct SettingsRecordHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;        // payload bytes following the header
+    uint32_t crc;           // CRC-32 of the payload
+} SettingsRecordHeader;
+
+// Versioned binary settings file, a header with a CRC followed by a payload of
+// little endian fields. Saves go to a temporary file that is renamed over the
+// record, if power is lost before the rename load() falls back to the
+// temporary copy.
+class SettingsRecord
+{
+    public:
+        SettingsRecord(uint16_t version);
+
+        static bool remove(const char* path);
+
+        bool load(const char* path);
+        bool save(const char* path);
+        void clear();
+
+        uint16_t getVersion() { return version; }      // version of the loaded file
+        bool isValid() { return valid; }
+
+        void putBool(bool value) { putUInt8(value ? 1 : 0); }
+        void putUInt8(uint8_t value);
+        void putInt32(int32_t value);
+        void putString(const String& value);
+
+        bool getBool() { return getUInt8() != 0; }
+        uint8_t getUInt8();
+        int32_t getInt32();
+        String getString();
+
+    private:
+        bool loadFile(const String& path);
+        bool write(const void* data, size_t size);
+        bool read(void* data, size_t size);
+
+        static uint32_t crc32(const uint8_t* data, size_t length);
+
+        uint8_t payload[SETTINGS_RECORD_MAX_SIZE];
+        uint16_t currentVersion;
+        uint16_t version;
+        size_t length;
+        size_t position;
+        bool valid;         // false after writing past the end or reading past the payload
+};
+
+#endif // _settingsRecord_h
@@ -0,0 +1,86 @@
+#ifndef _taskProfiler_h
+#define _taskProfiler_h
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define TASK_PROFILE_BUCKETS    24      // power of two microsecond buckets, the last holds everything from 2^23us
+
+enum ProfiledTask
+{
+    ProfiledTask_Time,
+    ProfiledTask_Weather,
+    ProfiledTask_WiFi,
+    ProfiledTask_PrintMonitor,
+    ProfiledTask_CycleDisplay,
+    ProfiledTask_Metrics,
+    ProfiledTask_Count,
+};
+
+typedef struct LatencyHistogram
+{
+    unsigned long count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t buckets[TASK_PROFILE_BUCKETS];
+} LatencyHistogram;
+
+// microseconds spent in the callback and how late the scheduler ran it
+typedef struct TaskProfile
+{
+    LatencyHistogram execution;
+    LatencyHistogram lateness;
+} TaskProfile;
+
+// a task's figures for the tasks page, taken for every task at once so a page
+// sent over several chunks shows one moment
+typedef struct TaskSummary
+{
+    unsigned long count;
+    uint32_t executionMin;
+    uint32_t executionAverage;
+    uint32_t executionMax;
+    uint32_t executionP99;
+    uint32_t latenessAverage;
+    uint32_t latenessMax;
+    uint32_t latenessP99;
+} TaskSummary;
+
+class TaskProfiler
+{
+    public:
+        static void record(ProfiledTask task, uint32_t executionMicros, uint32_t latenessMicros);
+
+        static TaskProfile* getProfile(ProfiledTask task) { return &profiles[task]; }
+        static const char* getName(ProfiledTask task);
+        static uint32_t getAverage(const LatencyHistogram* histogram);
+        static uint32_t getPercentile(const LatencyHistogram* histogram, int percent);
+
+        static void toJson(JsonObject tasks);
+        static void summarise(TaskSummary* summaries);
+        static bool writeRow(Print* output, const TaskSummary* summaries, int task);
+
+    private:
+        static void add(LatencyHistogram* histogram, uint32_t micros);
+        static void histogramToJson(JsonObject json, const LatencyHistogram* histogram);
+        static void writeCell(Print* output, uint32_t micros);
+
+        static TaskProfile profiles[ProfiledTask_Count];
+};
+
+// times a task callback for the lifetime of the timer, declare it first in the
+// callback with the task's start delay in milliseconds
+class TaskTimer
+{
+    public:
+        TaskTimer(ProfiledTask task, unsigned long startDelay) : task(task), lateness(startDelay * 1000), start(micros()) {}
+        ~TaskTimer() { TaskProfiler::record(task, micros() - start, lateness); }
+
+    private:
+        ProfiledTask task;
+        uint32_t lateness;
+        uint32_t start;
+};
+
+#endif // _taskProfiler_h
@@ -0,0 +1,64 @@
+#ifndef _text_layout_h
+#define _text_layout_h
+
+#include <Arduino.h>
+#include "TFT_eSPI.h"
+
+#define TEXT_LAYOUT_FONTS           8       // TFT_eSPI font numbers
+#define TEXT_LAYOUT_FIRST_GLYPH     ' '
+#define TEXT_LAYOUT_GLYPHS          95      // printable ASCII
+#define TEXT_LAYOUT_CACHE_SIZE      4       // truncated strings remembered
+#define TEXT_LAYOUT_ELLIPSIS        "..."
+#define TEXT_METRICS_CACHE_SIZE     24      // constant strings measured
+
+// where a string was cut to fit a width, so the next draw of the same string
+// doesn't have to measure it again
+typedef struct TextCut
+{
+    uint32_t hash;
+    uint16_t length;
+    uint16_t kept;      // characters before the ellipsis, length when it fits
+    int16_t width;
+    uint8_t font;
+} TextCut;
+
+typedef struct TextMetric
+{
+    const char* text;
+    int16_t width;
+    uint8_t font;
+} TextMetric;
+
+// Measures text from per font glyph advances, read from the font the first time
+// it's used. The built in fonts have no kerning so a string is as wide as the sum
+// of its glyphs, and bytes outside printable ASCII have no glyph at all.
+class TextLayout
+{
+    public:
+        void init(TFT_eSPI* tft);
+
+        int textWidth(const char* text, uint8_t font);
+        void truncate(char* buffer, size_t size, const char* text, int width);
+
+        // widths of text that never changes, string literals and the like, found
+        // again by address. Don't pass a buffer that gets reused for other text.
+        int constantWidth(const char* text);
+        int constantWidth(const char* text, uint8_t font);
+        void precompute(const char* const* texts, int count, uint8_t font);
+
+    private:
+        const uint8_t* getAdvances(uint8_t font);
+        uint16_t findCut(const char* text, size_t length, int width, uint8_t font);
+        uint32_t hashText(const char* text, size_t length);
+
+        TFT_eSPI* tft;
+        uint8_t advances[TEXT_LAYOUT_FONTS][TEXT_LAYOUT_GLYPHS];
+        uint8_t loadedFonts;    // bit per font
+        TextCut cache[TEXT_LAYOUT_CACHE_SIZE];
+        uint8_t nextCacheEntry;
+        TextMetric metrics[TEXT_METRICS_CACHE_SIZE];
+        uint8_t metricCount;
+        uint8_t nextMetric;     // replaced next once the cache is full
+};
+
+#endif // _text_layout_h
@@ -18,4 +18,16 @@
 // maximum number of printers allowed
 #define MAX_PRINTERS 10
 
+// print monitor values are drawn off screen and pushed in one block to stop tearing,
+// holds SPRITE_MAX_BYTES of heap for good, drawn directly if that can't be spared
+#ifndef DISPLAY_USE_SPRITES
+#define DISPLAY_USE_SPRITES false
+#endif
+
+// printer on display follows OctoPrint's push socket instead of waiting for the next poll,
+// set to true to try it, false only polls and leaves the push client out of the build
+#ifndef OCTOPRINT_PUSH_MODE
+#define OCTOPRINT_PUSH_MODE false
+#endif
+
 #endif // _user_settings_h
\ No newline at end of file
@@ -7,23 +7,42 @@
 #include "OpenWeatherMapCurrent.h"
 #include "OctoPrintMonitor.h"
 #include "SettingsManager.h"
+#include "DisplayBase.h"
+
+#define SCREENSHOT_MAX_WIDTH    320
+#define BMP_HEADER_SIZE         66      // file and info headers plus RGB565 bit masks
+#define METRICS_JSON_SIZE       1024
+#define METRICS_TEXT_SIZE       1536    // serialized metrics pushed to the websocket
+#define TASKS_JSON_SIZE         2048
+#define TEMPLATE_ROW_SIZE       640     // one table row of a page, a printer row with the longest name and address
+#define STATIC_ASSET_CACHE_CONTROL  "no-cache"  // always revalidate, assets change with firmware updates
+
+// generated by compileTemplates.py, see Serverpages/PageTemplates.h
+struct PageTemplate;
+enum TemplateToken : uint8_t;
+
+// per-request state for pages and screenshots being sent, see WebServer.cpp
+struct TemplateState;
+struct ScreenshotState;
 
 class WebServer
 {
     public:
-        void init(SettingsManager* settingsManager);
+        void init(SettingsManager* settingsManager, DisplayBase* display);
         static AsyncWebServer* getServer();
 
         void updateCurrentWeather(OpenWeatherMapCurrentData* currentWeather);
-        void updatePrintMonitorInfo(OctoPrintMonitorData* printerInfo, String printerName, bool enabled);
-
-        bool screenGrabRequested();
-        void clearScreenGrabRequest();
+        void updatePrintMonitorInfo(int printerId, OctoPrintMonitorData* printerInfo, const String& printerName, bool enabled);
+        void updateMetrics();
 
     private:
         static void onEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len);
         static void updateClientOnConnect();
-        static String tokenProcessor(const String& token);
+        static void sendTemplate(AsyncWebServerRequest* request, const PageTemplate* page);
+        static size_t fillTemplate(TemplateState* state, uint8_t* buffer, size_t maxLen);
+        static void nextTemplateRow(TemplateState* state, TemplateToken token);
+        static bool writeToken(TemplateState* output, TemplateToken token, int row);
+        static void writeChecked(Print* output, bool checked);
         static void handleUpdateWeatherSettings(AsyncWebServerRequest* request);
         static void handleUpdateDisplaySettings(AsyncWebServerRequest* request);       
         static void handleUpdateTimings(AsyncWebServerRequest* request);
@@ -36,16 +55,21 @@ class WebServer
 
         static void handleForgetWiFi(AsyncWebServerRequest* request);
         static void handleResetSettings(AsyncWebServerRequest* request);
-        static void handleScreenGrab(AsyncWebServerRequest* request);
-        static String createPrinterList();
-        static String createDisplayList();
-        static String createDisplayButton(int id, String checked, String title);
+        static void sendStaticAsset(AsyncWebServerRequest* request, const char* contentType, const uint8_t* data, size_t length, const char* etag);
+        static void handleMetrics(AsyncWebServerRequest* request);
+        static void handleTasks(AsyncWebServerRequest* request);
+        static void handleScreenshot(AsyncWebServerRequest* request);
+        static size_t fillScreenshot(ScreenshotState* state, uint8_t* buffer, size_t maxLen, size_t index);
+        static void createBmpHeader(uint8_t* header, int width, int height);
+        static bool writePrinterRow(Print* output, int row);
+        static bool writeDisplayRow(Print* output, int row);
+        static void writeDisplayButton(Print* output, int id, bool checked, const char* title);
 
         static String currentWeatherJson;
-        static String currentPrinterJson;
-        static bool screenGrabRequest;
+        static String currentPrinterJson[MAX_PRINTERS];
         
         static SettingsManager* settingsManager;    
+        static DisplayBase* display;
 };
 
 #endif
\ No newline at end of file
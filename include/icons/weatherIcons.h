@@ -9,16 +9,7 @@
 
 #include <avr/pgmspace.h>
 
-#include "icon_01d.h"
-#include "icon_02d.h"
-#include "icon_03d.h"
-#include "icon_09d.h"
-#include "icon_10d.h"
-#include "icon_11d.h"
-#include "icon_13d.h"
-#include "icon_50d.h"
-#include "icon_01n.h"
-#include "icon_02n.h"
-#include "icon_09n.h"
-#include "icon_11n.h"
-#include "icon_13n.h"
\ No newline at end of file
+// icon_XXx.h hold the raw images, the firmware uses the run length encoded
+// copies made from them by iconConverter.py
+
+#include "weatherIconsRle.h"
\ No newline at end of file
@@ -0,0 +1,732 @@
+// generated by iconConverter.py from include/icons/icon_*.h, do not edit
+// 48x48 RGB565 weather icons, run length encoded
+
+#ifndef _weather_icons_rle_h
+#define _weather_icons_rle_h
+
+#include <avr/pgmspace.h>
+
+#define ICON_RLE_RUN_FLAG   0x8000
+#define ICON_RLE_COUNT_MASK 0x7fff
+
+// 2294 bytes, 4608 raw
+const uint16_t icon_01d_rle[1147] PROGMEM = {
+    0x8046, 0x0000, 0x0006, 0xFFA5, 0xFFC6, 0xFFE6, 0xFFC6, 0xFFC6, 0xF725, 0x8028, 0x0000, 0x0003, 0xFFEA, 0xFF86, 0xFFA6, 0x8004,
+    0xFFE6, 0x0002, 0xFFC6, 0xFF86, 0x8027, 0x0000, 0x0004, 0xFF65, 0xFFE6, 0xFFC6, 0xFF86, 0x8003, 0xFF66, 0x0003, 0xFFE6, 0xFF65,
+    0xFF65, 0x801D, 0x0000, 0x0013, 0xFFEA, 0xFFC6, 0xFF86, 0xFF85, 0xFF86, 0xFEC4, 0x0000, 0x0000, 0xFF65, 0xFF45, 0xFFE6, 0xFFC6,
+    0xFFE6, 0xFFE6, 0xFFC6, 0xFFC6, 0xFFA6, 0xFFE6, 0xFF25, 0x8004, 0x0000, 0x0003, 0xFFE5, 0xFFE7, 0xFF66, 0x8015, 0x0000, 0x0002,
+    0xF786, 0xFFE6, 0x8003, 0xFFC6, 0x0007, 0xFF65, 0xFF65, 0xFF05, 0xFFE0, 0xFF05, 0xFF25, 0xFF45, 0x8006, 0xFF05, 0x000B, 0xFF45,
+    0xFF05, 0xFF45, 0x0000, 0xFF65, 0xFFA6, 0xFF66, 0xFFA6, 0xFFC6, 0xFFE6, 0xFFC6, 0x8012, 0x0000, 0x000E, 0xF765, 0xFFA6, 0xFFE6,
+    0xFFA6, 0xFF85, 0xFF66, 0xFFC6, 0xFFA5, 0xFEE5, 0xFD40, 0xD540, 0xFF25, 0xFFA6, 0xFFE6, 0x8004, 0xFFE7, 0x000D, 0xFFE6, 0xFEC4,
+    0xFE84, 0x0000, 0xFF05, 0xFF65, 0xFFE6, 0xFFA6, 0xFFA6, 0xFFC6, 0xFFE6, 0xFFC6, 0xFFA6, 0x8011, 0x0000, 0x000E, 0xFFA6, 0xFFE6,
+    0xFF86, 0xFF65, 0xFF85, 0xFF85, 0xFF25, 0xFEC5, 0xFF26, 0xFFE6, 0xFFC6, 0xFFE6, 0xFF85, 0xFF85, 0x8003, 0xFFC5, 0x000F, 0xFF65,
+    0xFF85, 0xFFC6, 0xFFC6, 0xFFE6, 0xFF45, 0xFF05, 0xFF25, 0xFFA5, 0xFF86, 0xFF65, 0xFF86, 0xFFE6, 0xFFA6, 0xF786, 0x800F, 0x0000,
+    0x0021, 0xFF85, 0xFF86, 0xFFC6, 0xFF66, 0xFFA6, 0xFF45, 0xFF25, 0xFF47, 0xFFE6, 0xFFC5, 0xFF85, 0xFFC5, 0xFFC6, 0xFFAA, 0xFF8D,
+    0xFF8E, 0xFF8F, 0xFF8E, 0xFF8C, 0xFFAA, 0xFFC6, 0xFFC5, 0xFF85, 0xFFC5, 0xFFE6, 0xF724, 0xFF25, 0xFF45, 0xFFA6, 0xFF65, 0xFF86,
+    0xFFE6, 0xFF86, 0x800F, 0x0000, 0x0021, 0xFF86, 0xFF85, 0xFFA6, 0xFFC6, 0xFF45, 0xFEA4, 0xFFE6, 0xFFA6, 0xFFC5, 0xFF86, 0xFF6C,
+    0xFFB3, 0xFFF9, 0xFFFC, 0xFFFB, 0xFFFB, 0xFFFC, 0xFFFB, 0xFFFB, 0xFFFC, 0xFFF9, 0xFFB3, 0xFF6C, 0xFF86, 0xFFA5, 0xFFA6, 0xFFE6,
+    0xFE84, 0xFF25, 0xFFA5, 0xFF65, 0xFFE6, 0xFF66, 0x800F, 0x0000, 0x000F, 0xFF45, 0xFF45, 0xFFE6, 0xFF25, 0xFEA5, 0xFFC6, 0xFF85,
+    0xFF85, 0xFF6D, 0xFFD8, 0xFFFC, 0xFFD9, 0xFFB3, 0xFF6F, 0xFF4B, 0x8003, 0xFF4A, 0x000F, 0xFF4B, 0xFF6F, 0xFF93, 0xFFD9, 0xFFFC,
+    0xFFD8, 0xFF6C, 0xFF85, 0xFF65, 0xFFC6, 0xFEE3, 0xFF05, 0xFF65, 0xFFC6, 0xFF45, 0x800F, 0x0000, 0x000E, 0xFFE7, 0xFF25, 0xFF25,
+    0xFFE5, 0xFF86, 0xFFA5, 0xFF48, 0xFFB5, 0xFFFC, 0xFFB6, 0xFF4C, 0xFF06, 0xFF05, 0xFF04, 0x8005, 0xFF05, 0x000E, 0xFEE4, 0xFF05,
+    0xFF06, 0xFF4C, 0xFFB6, 0xFFFC, 0xFFB5, 0xFF28, 0xFFA5, 0xFF86, 0xFFEA, 0xFF05, 0xFFE6, 0xFF25, 0x8010, 0x0000, 0x000B, 0xFF05,
+    0xFF25, 0xFF86, 0xFFA5, 0xFF2A, 0xFFD9, 0xFFD9, 0xFF4C, 0xFEE5, 0xFEE4, 0xFEE5, 0x8009, 0xFEE6, 0x000C, 0xFEE5, 0xFEE4, 0xFEE5,
+    0xFF2C, 0xFFD9, 0xFFD9, 0xFF2A, 0xFF85, 0xFF66, 0xE725, 0xFF05, 0xFEE5, 0x800C, 0x0000, 0x000D, 0xFF85, 0xFF45, 0xFF05, 0xFEE5,
+    0x0000, 0xFF86, 0xFF85, 0xFF2A, 0xFFD9, 0xFF93, 0xFEE6, 0xFEE4, 0xFEE5, 0x800D, 0xFEE6, 0x000C, 0xFEC5, 0xFEC4, 0xFEE6, 0xFF93,
+    0xFFD9, 0xFF0A, 0xFF65, 0xFF66, 0x0000, 0xFDE7, 0xFF25, 0xFFE7, 0x8008, 0x0000, 0x000D, 0xF7A6, 0xFFA6, 0xFF85, 0xFFA6, 0xFF85,
+    0xFEE5, 0xFF86, 0xFF65, 0xFF08, 0xFFB7, 0xFF50, 0xFEC4, 0xFEC5, 0x8011, 0xFEC6, 0x000C, 0xFEC5, 0xFEC5, 0xFF50, 0xFF97, 0xFEE8,
+    0xFF45, 0xFF65, 0xFF05, 0xFF25, 0xFF65, 0xFFA6, 0xFFA6, 0x8005, 0x0000, 0x000D, 0xFFE6, 0xFFA6, 0xFFE6, 0xFF86, 0xFFA6, 0xFF05,
+    0xF7E5, 0xFF25, 0xFF06, 0xFF73, 0xFF50, 0xFEA4, 0xFEC5, 0x8007, 0xFEC6, 0x800C, 0xFEA6, 0x000C, 0xFEA5, 0xFEA4, 0xFF30, 0xFF73,
+    0xFF06, 0xFF25, 0xFF85, 0xFF05, 0xFFE6, 0xFFE6, 0xFFC6, 0xFFA6, 0x8004, 0x0000, 0x000D, 0xFFC6, 0xFFE6, 0xFF86, 0xFF86, 0xFF45,
+    0xFF05, 0xFF46, 0xFF45, 0xFF0D, 0xFF52, 0xFEA5, 0xFEA5, 0xFEA6, 0x8016, 0xFEA5, 0x0007, 0xFF52, 0xFEED, 0xFF25, 0xFF45, 0xFF25,
+    0xFF65, 0xFF65, 0x8003, 0xFFC6, 0x000D, 0x0000, 0x0000, 0xFFE0, 0xFFC6, 0xFFE6, 0xFF65, 0xFFA6, 0xFF25, 0xFF85, 0xFEE5, 0xFEE7,
+    0xFF32, 0xFEA8, 0x8019, 0xFE85, 0x0017, 0xFEA8, 0xFF31, 0xFEC7, 0xFEE5, 0xFF45, 0xFF25, 0xFFA6, 0xFF66, 0xFFE6, 0xFFA6, 0xFFE6,
+    0x0000, 0xFFE7, 0xFFA6, 0xFFE6, 0xFF66, 0xFFA6, 0xFF25, 0xFF45, 0xFF05, 0xFEEC, 0xFEED, 0xFE64, 0x8012, 0xFE85, 0x8007, 0xFE65,
+    0x0016, 0xFE64, 0xFECC, 0xFECC, 0xFEE5, 0xFF05, 0xFF25, 0xFFA6, 0xFF65, 0xFFC6, 0xFFA6, 0xFF85, 0x0000, 0xFFE7, 0xFFA6, 0xFFE6,
+    0xFF86, 0xFF45, 0xFF25, 0xFEE5, 0xFEE6, 0xFECD, 0xFE87, 0x801B, 0xFE65, 0x0015, 0xFE67, 0xFECD, 0xFEE6, 0xFEE5, 0xFF25, 0xFF25,
+    0xFF65, 0xFFA6, 0xFFA6, 0xFF85, 0x0000, 0x0000, 0xFF86, 0xFFE6, 0xFFA6, 0xFF25, 0xFF45, 0xFEA5, 0xFEA8, 0xFEAA, 0xFE45, 0x8004,
+    0xFE65, 0x8018, 0xFE45, 0x0013, 0xFE8A, 0xFEA8, 0xFE84, 0xFF45, 0xFF25, 0xFFA5, 0xFFA6, 0xFF85, 0xFFE5, 0x0000, 0x0000, 0xF7A5,
+    0xFF85, 0xFFE6, 0xFF25, 0xFF25, 0xFEA5, 0xFE89, 0xFE67, 0x8017, 0xFE45, 0x8006, 0xFE25, 0x0008, 0xFE47, 0xFE68, 0xFE85, 0xFF04,
+    0xFF25, 0xFFC6, 0xFFE6, 0xFF86, 0x8004, 0x0000, 0x0007, 0xFF25, 0xFF85, 0xFF25, 0xFF05, 0xFEA5, 0xFE47, 0xFE47, 0x801D, 0xFE25,
+    0x0008, 0xFE27, 0xFE47, 0xFEA5, 0xFEC4, 0xFF05, 0xFFE6, 0xFF45, 0xFF46, 0x8005, 0x0000, 0x0005, 0xF684, 0xFF45, 0xFEA5, 0xFE85,
+    0xFE26, 0x8003, 0xFE25, 0x801C, 0xFE05, 0x0006, 0xFE26, 0xFE65, 0xFE84, 0xFF05, 0xFF25, 0xFEE5, 0x8007, 0x0000, 0x0003, 0xDDA4,
+    0xFEA4, 0xFE85, 0x8016, 0xFE05, 0x800B, 0xFDE5, 0x0003, 0xFE65, 0xFE84, 0xFEA5, 0x8007, 0x0000, 0x0005, 0xFF25, 0xFF25, 0xFF05,
+    0xFE85, 0xFE65, 0x8021, 0xFDE5, 0x0004, 0xFE45, 0xFE84, 0xFF25, 0xFEC4, 0x8005, 0x0000, 0x0007, 0xFF46, 0xFF45, 0xFFE6, 0xFF05,
+    0xFE84, 0xFE65, 0xFDC5, 0x8006, 0xFDE5, 0x801A, 0xFDC5, 0x0005, 0xFE45, 0xFE44, 0xFF25, 0xFF85, 0xFF25, 0x8004, 0x0000, 0x0006,
+    0xFF65, 0xFFE6, 0xFFC6, 0xFF25, 0xFE83, 0xFE45, 0x8019, 0xFDC5, 0x8008, 0xFDA5, 0x0010, 0xFE05, 0xFE83, 0xFF25, 0xFFE6, 0xFF85,
+    0xF765, 0x0000, 0x0000, 0xFFE5, 0xFF86, 0xFFA6, 0xFFA6, 0xFF25, 0xFEE4, 0xFE24, 0xFDE5, 0x801F, 0xFDA5, 0x0014, 0xFDC5, 0xFE04,
+    0xFEC4, 0xFF25, 0xFFA6, 0xFFE6, 0xFF86, 0x0000, 0x0000, 0xFF85, 0xFFA6, 0xFFA6, 0xFF85, 0xFF25, 0xFF25, 0xFE24, 0xFE05, 0xFD85,
+    0xFDA5, 0xFDA5, 0x801C, 0xFD85, 0x0011, 0xFDE5, 0xFE04, 0xFF45, 0xFF45, 0xFF65, 0xFFE6, 0xFFA6, 0xFFE7, 0x0000, 0xFF85, 0xFFA6,
+    0xFFC6, 0xFF65, 0xFFA6, 0xFF45, 0xFE44, 0xFE05, 0x8015, 0xFD85, 0x800A, 0xFD65, 0x0012, 0xFDE5, 0xFE03, 0xFF45, 0xFF85, 0xFF65,
+    0xFFC6, 0xFFA6, 0xFFE7, 0x0000, 0xFFE6, 0xFFC6, 0xFFE6, 0xFF66, 0xFFA6, 0xFF25, 0xFEC3, 0xFDE4, 0xFD85, 0x801D, 0xFD65, 0x000B,
+    0xFD85, 0xFDC4, 0xFE83, 0xFF25, 0xFFA6, 0xFF65, 0xFFE6, 0xFFC6, 0xFFEA, 0x0000, 0x0000, 0x8003, 0xFFC6, 0x0005, 0xFF66, 0xFF65,
+    0xFF65, 0xFE04, 0xFDE5, 0x801D, 0xFD45, 0x0008, 0xFDE5, 0xFDE3, 0xFF25, 0xFF45, 0xFF65, 0xFF86, 0xFFE6, 0xFFA6, 0x8004, 0x0000,
+    0x0008, 0xFFA6, 0xFFC6, 0xFFE6, 0xFFE6, 0xFF25, 0xFEC4, 0xFDC4, 0xFD65, 0x800B, 0xFD45, 0x8010, 0xFD25, 0x0009, 0xFD65, 0xFDC4,
+    0xFE42, 0xFF05, 0xFFA5, 0xFF65, 0xFFE6, 0xFF86, 0xFFE6, 0x8005, 0x0000, 0x0007, 0xFF86, 0xFFA6, 0xFF65, 0xFF25, 0xFF65, 0xFDE3,
+    0xFDC4, 0x8014, 0xFD25, 0x8005, 0xFD24, 0x000A, 0xFD04, 0xFD25, 0xFDA4, 0xFDC3, 0xFF25, 0xFF85, 0xFFA6, 0xFF85, 0xFF85, 0xF746,
+    0x8008, 0x0000, 0x0007, 0xDEE3, 0xFF26, 0xFFEA, 0x0000, 0xFDC3, 0xFDA4, 0xFD05, 0x8017, 0xFD04, 0x0008, 0xFCE5, 0xFDA4, 0xFDA3,
+    0x0000, 0xFEE5, 0xFF05, 0xFF45, 0xFF65, 0x800C, 0x0000, 0x0006, 0xFEE5, 0xFF05, 0xFE84, 0xFDA3, 0xFD85, 0xFCE5, 0x8005, 0xFD04,
+    0x8010, 0xFCE4, 0x0005, 0xFCE5, 0xFD84, 0xFD83, 0xFEE4, 0xFF25, 0x8010, 0x0000, 0x0007, 0xFF25, 0xFFE6, 0xFF25, 0xFDC1, 0xFDA3,
+    0xFD84, 0xFCE5, 0x8010, 0xFCE4, 0x8004, 0xFCC4, 0x0006, 0xFD64, 0xFD83, 0xFE02, 0xFF45, 0xFF25, 0xFFE7, 0x800F, 0x0000, 0x0008,
+    0xFF45, 0xFFC6, 0xFF65, 0xFF25, 0xF601, 0xFD83, 0xFD64, 0xFD04, 0x8011, 0xFCC4, 0x0008, 0xFD04, 0xFD64, 0xFD83, 0xF6A3, 0xFF45,
+    0xFFE6, 0xFF45, 0xFF25, 0x800F, 0x0000, 0x000A, 0xFF66, 0xFFE6, 0xFF65, 0xFFA5, 0xFF45, 0xFF45, 0xFD62, 0xFD63, 0xFD64, 0xFCE4,
+    0x800D, 0xFCC4, 0x000A, 0xFCE4, 0xFD64, 0xFD43, 0xFD62, 0xFF44, 0xFF45, 0xFFA6, 0xFF86, 0xFF65, 0xFF86, 0x800F, 0x0000, 0x000D,
+    0xFF85, 0xFFE6, 0xFF86, 0xFF65, 0xFFA6, 0xFF45, 0xFF65, 0xFE23, 0xFD63, 0xFD43, 0xFD44, 0xFD44, 0xFD04, 0x8007, 0xFCC4, 0x000D,
+    0xFD04, 0xFD44, 0xFD44, 0xFD43, 0xFD62, 0xFDC2, 0xFF45, 0xFF45, 0xFFA6, 0xFF65, 0xFFC6, 0xFF86, 0xFF85, 0x800F, 0x0000, 0x000E,
+    0xF786, 0xFFA6, 0xFFE6, 0xFF86, 0xFF65, 0xFF86, 0xFFA5, 0xFF25, 0xFF45, 0xFEE4, 0xFDC3, 0xFD63, 0xFD43, 0xFD24, 0x8005, 0xFD44,
+    0x000D, 0xFD03, 0xFD23, 0xFD83, 0xFDA3, 0xFEA4, 0xFF45, 0xFF45, 0xFF85, 0xFF85, 0xFF65, 0xFF86, 0xFFE6, 0xFFA6, 0x8011, 0x0000,
+    0x001F, 0xFF86, 0xFFC6, 0xFFE6, 0xFFC6, 0xFFA6, 0xFFA6, 0xFFE6, 0xFF65, 0xFF25, 0x0000, 0xFF65, 0xFE63, 0xFE02, 0xFDA2, 0xFD62,
+    0xFD22, 0xFD42, 0xFDE2, 0xFE43, 0xFEC4, 0xFFE6, 0xFFEF, 0xFF05, 0xFFA5, 0xFFA6, 0xFF65, 0xFF85, 0xFFA6, 0xFFE6, 0xFFC6, 0xF765,
+    0x8012, 0x0000, 0x000C, 0xFFC6, 0xFFE6, 0xFFA6, 0xFFA6, 0xFF85, 0xFFA5, 0xFF45, 0x0000, 0xFF45, 0xFF05, 0xFF45, 0xFF25, 0x8006,
+    0xFF45, 0x000B, 0xFF25, 0xFF25, 0xFFE0, 0xFEE5, 0xFF45, 0xFF65, 0xFFA6, 0xFFC6, 0xFFC6, 0xFFE6, 0xFFA6, 0x8015, 0x0000, 0x0003,
+    0xEF66, 0xFFE7, 0xFF66, 0x8004, 0x0000, 0x0003, 0xFF25, 0xFFE6, 0xFFA6, 0x8004, 0xFFC6, 0x000C, 0xFFA6, 0xFFE6, 0xFF45, 0xFF44,
+    0x0000, 0x0000, 0xFFE5, 0xFFA6, 0xFF86, 0xFF86, 0xFFC6, 0xFFE0, 0x801D, 0x0000, 0x000A, 0xFF65, 0xFF65, 0xFFE6, 0xFF65, 0xFF65,
+    0xFF66, 0xFF86, 0xFFC6, 0xFFE6, 0xFF65, 0x8027, 0x0000, 0x0002, 0xFF66, 0xFFA6, 0x8004, 0xFFE6, 0x0003, 0xFFA6, 0xFF86, 0xFFEA,
+    0x8028, 0x0000, 0x0006, 0xF725, 0xFFC6, 0xFFC6, 0xFFE6, 0xFFA6, 0xFFA5, 0x8015, 0x0000,
+};
+
+// 1334 bytes, 4608 raw
+const uint16_t icon_01n_rle[667] PROGMEM = {
+    0x8108, 0x0000, 0x0002, 0xF800, 0xFEA0, 0x8003, 0xFEE0, 0x8029, 0x0000, 0x0007, 0xFE60, 0xFEE0, 0xFEE2, 0xFF24, 0xFFA2, 0xFEE0,
+    0xFEC0, 0x8027, 0x0000, 0x0008, 0xFE40, 0xFEE0, 0xFF24, 0xFFA8, 0xFFCA, 0xFFC6, 0xFEE1, 0xFE80, 0x8027, 0x0000, 0x0008, 0xFEA0,
+    0xFF22, 0xFFC9, 0xFFAC, 0xFF8C, 0xFFA7, 0xFEE0, 0xFFE0, 0x8026, 0x0000, 0x0009, 0xFFE0, 0xFEC0, 0xFF45, 0xFFCC, 0xFF8D, 0xFF6C,
+    0xFFA9, 0xFEE1, 0xFE60, 0x8027, 0x0000, 0x0008, 0xFEA0, 0xFF87, 0xFFAD, 0xFF6D, 0xFF6C, 0xFFAB, 0xFF23, 0xFEA0, 0x8027, 0x0000,
+    0x0008, 0xFEC0, 0xFF87, 0xFFAE, 0xFF6D, 0xFF6C, 0xFF6C, 0xFFA7, 0xFEC0, 0x8027, 0x0000, 0x0009, 0xFEA0, 0xFF25, 0xFFAE, 0xFF6D,
+    0xFF6C, 0xFF6B, 0xFF8B, 0xFF03, 0xFEA0, 0x8026, 0x0000, 0x0009, 0xFE80, 0xFEE2, 0xFFCC, 0xFF6D, 0xFF6C, 0xFF6C, 0xFF6B, 0xFFA6,
+    0xFEC0, 0x8027, 0x0000, 0x0003, 0xFEC0, 0xFFA8, 0xFF8E, 0x8003, 0xFF6C, 0x0003, 0xFF48, 0xFF40, 0xFEE0, 0x8026, 0x0000, 0x000A,
+    0xFE60, 0xFF03, 0xFFCD, 0xFF6D, 0xFF6C, 0xFF6C, 0xFF4A, 0xFF21, 0xFEC0, 0xFEC0, 0x8026, 0x0000, 0x000A, 0xFEC0, 0xFF47, 0xFF8E,
+    0xFF6C, 0xFF6C, 0xFF6B, 0xFF04, 0xFF20, 0xFEE0, 0xFEA1, 0x8026, 0x0000, 0x000A, 0xFEE1, 0xFFCB, 0xFF6D, 0xFF6C, 0xFF6C, 0xFF48,
+    0xFEE0, 0xFF20, 0xFEE0, 0xFEE1, 0x8025, 0x0000, 0x000B, 0xFDA0, 0xFF03, 0xFFCD, 0xFF6D, 0xFF6C, 0xFF6B, 0xFF04, 0xFEE0, 0xFF21,
+    0xFEC1, 0xFF01, 0x8025, 0x0000, 0x000B, 0xFEC0, 0xFF05, 0xFFAD, 0xFF6C, 0xFF6C, 0xFF48, 0xFEE1, 0xFEE1, 0xFF21, 0xFEC1, 0xFEC1,
+    0x8025, 0x0000, 0x000B, 0xFEC0, 0xFF26, 0xFF8D, 0xFF6C, 0xFF6B, 0xFF25, 0xFEE1, 0xFEE1, 0xFF01, 0xFF21, 0xFEE1, 0x8025, 0x0000,
+    0x0006, 0xFEC0, 0xFF67, 0xFF8C, 0xFF6B, 0xFF6A, 0xFF03, 0x8003, 0xFEE1, 0x0002, 0xFF62, 0xFEE1, 0x8025, 0x0000, 0x0005, 0xFEC0,
+    0xFF67, 0xFF6C, 0xFF6B, 0xFF48, 0x8004, 0xFEE2, 0x0003, 0xFF22, 0xFEE1, 0xFFE0, 0x8024, 0x0000, 0x0005, 0xFEC0, 0xFF06, 0xFF8B,
+    0xFF6A, 0xFF27, 0x8004, 0xFEE2, 0x0003, 0xFF02, 0xFF22, 0xFEE2, 0x8024, 0x0000, 0x0006, 0xFEA0, 0xFF05, 0xFFAB, 0xFF6A, 0xFF26,
+    0xFEE2, 0x8004, 0xFF02, 0x0003, 0xFF42, 0xFEE2, 0xEEE2, 0x8023, 0x0000, 0x0006, 0xFFE0, 0xFF04, 0xFFCA, 0xFF6A, 0xFF25, 0xFEE2,
+    0x8005, 0xFF03, 0x0002, 0xFF63, 0xFEE3, 0x8024, 0x0000, 0x0005, 0xFF03, 0xFFA8, 0xFF69, 0xFF25, 0xFEE3, 0x8005, 0xFF03, 0x0003,
+    0xFF23, 0xFF23, 0xFEE3, 0x8023, 0x0000, 0x0005, 0xFEE2, 0xFF26, 0xFF88, 0xFF25, 0xFF03, 0x8006, 0xFF04, 0x0003, 0xFF44, 0xFF04,
+    0xFF04, 0x801B, 0x0000, 0x0001, 0xFFE0, 0x8006, 0x0000, 0x0004, 0xF800, 0xFF05, 0xFFA7, 0xFF25, 0x8008, 0xFF04, 0x0004, 0xFF44,
+    0xFF24, 0xFF04, 0xFDA4, 0x800E, 0x0000, 0x0002, 0xFEA3, 0xFF24, 0x8009, 0x0000, 0x0003, 0xFF21, 0xFF21, 0xFEA0, 0x8005, 0x0000,
+    0x0003, 0xFF04, 0xFF66, 0xFF45, 0x8009, 0xFF04, 0x0004, 0xFF25, 0xFF65, 0xFF25, 0xFF05, 0x800B, 0x0000, 0x0004, 0xFEA4, 0xFF05,
+    0xFF45, 0xFF04, 0x8009, 0x0000, 0x000B, 0xFEE1, 0xFFE9, 0xFF48, 0xFEC0, 0xFE40, 0xFEE0, 0xFF43, 0xFEE1, 0xFFE7, 0xFF05, 0xFFA5,
+    0x800A, 0xFF05, 0x000C, 0xFF25, 0xFF65, 0xFF05, 0xFF05, 0xFF25, 0xFF05, 0xFF26, 0xFFE0, 0x0000, 0x0000, 0xFDE7, 0xFF45, 0x8003,
+    0xFF05, 0x0003, 0xFFA5, 0xFF45, 0xFF25, 0x8009, 0x0000, 0x000D, 0xFEC0, 0xFF8A, 0xFFEE, 0xFF48, 0xFF26, 0xFF67, 0xFFE6, 0xFEE1,
+    0x0000, 0xF706, 0xFF46, 0xFF66, 0xFF05, 0x8009, 0xFF25, 0x0007, 0xFF05, 0xFF46, 0xFF66, 0xFF66, 0xFF25, 0xFF05, 0xFF06, 0x8003,
+    0xFF05, 0x0006, 0xFF25, 0xFF25, 0xFF66, 0xFF86, 0xFF66, 0xFF05, 0x800A, 0x0000, 0x000D, 0xFEE2, 0xFFAA, 0xFF6C, 0xFF8B, 0xFFA9,
+    0xFFA7, 0xFF02, 0xF660, 0x0000, 0x0000, 0xFF06, 0xFF46, 0xFF66, 0x800D, 0xFF26, 0x0002, 0xFF46, 0xFF66, 0x8004, 0xFF86, 0x0005,
+    0xFF66, 0xFF26, 0xFF26, 0xFFA7, 0xFF06, 0x8009, 0x0000, 0x0009, 0xFE80, 0xFF24, 0xFF48, 0xFF8B, 0xFF69, 0xFF47, 0xFF24, 0xFF41,
+    0xFEC0, 0x8004, 0x0000, 0x0003, 0xFF06, 0xFF47, 0xFF67, 0x8013, 0xFF27, 0x0004, 0xFF47, 0xFFA7, 0xFF26, 0xFEC9, 0x8008, 0x0000,
+    0x000B, 0xFEC0, 0xFF25, 0xFFEA, 0xFFAA, 0xFF47, 0xFF24, 0xFF02, 0xFEE1, 0xFF21, 0xFEE1, 0xFF01, 0x8004, 0x0000, 0x0004, 0xFF07,
+    0xFF47, 0xFFA8, 0xFF47, 0x8010, 0xFF27, 0x0004, 0xFF88, 0xFF67, 0xFF27, 0xFFE9, 0x8009, 0x0000, 0x000C, 0xFEC2, 0xFF04, 0xFF25,
+    0xFF03, 0xFF23, 0xFEE2, 0xFEE2, 0xFF23, 0xFF43, 0xFFA3, 0xFF03, 0xE623, 0x8004, 0x0000, 0x0005, 0xFEC8, 0xFF48, 0xFF88, 0xFF88,
+    0xFF48, 0x800B, 0xFF28, 0x0005, 0xFF48, 0xFF88, 0xFFA8, 0xFF68, 0xFF28, 0x800E, 0x0000, 0x0009, 0xFEC2, 0xFF24, 0xFF64, 0xFF44,
+    0xFF04, 0xFF04, 0xFF24, 0xFF04, 0xFEE4, 0x8003, 0x0000, 0x0009, 0xFEC0, 0xFEE0, 0xFD4A, 0xFF28, 0xFF28, 0xFF49, 0xFFA9, 0xFF89,
+    0xFF69, 0x8005, 0xFF49, 0x0007, 0xFF69, 0xFF69, 0xFFA9, 0xFF89, 0xFF49, 0xFF49, 0xFEC9, 0x8010, 0x0000, 0x001E, 0xFF05, 0xFFA6,
+    0xFF26, 0xFF05, 0xFEE6, 0xFF05, 0xFF05, 0xFEE5, 0xFD40, 0x0000, 0xBBE0, 0xFF48, 0xFF27, 0x0000, 0x0000, 0xFFEF, 0xFF49, 0xFF69,
+    0xFF49, 0xFF49, 0xFF29, 0xFF49, 0xFF8A, 0xFF6A, 0xFF49, 0xFF49, 0xFF29, 0xFF49, 0xFF29, 0xFF4A, 0x8012, 0x0000, 0x0003, 0xFF08,
+    0xFFA8, 0xFF07, 0x8005, 0x0000, 0x0006, 0xFF05, 0xFF67, 0xFF28, 0xFFAC, 0xFF4A, 0xFE80, 0x8004, 0x0000, 0x0004, 0xFFEA, 0xFF4A,
+    0xFF2A, 0xFF2A, 0x8003, 0xFF4A, 0x0002, 0xFF6A, 0xEEE9, 0x8015, 0x0000, 0x0003, 0xFF8A, 0xFF29, 0xFF0A, 0x8005, 0x0000, 0x0008,
+    0xFF05, 0xFF46, 0xFFC9, 0xFF69, 0xFF69, 0xFF68, 0xFF04, 0xFEE0, 0x8029, 0x0000, 0x0007, 0xFEE3, 0xFF83, 0xFF03, 0xFF23, 0xFF23,
+    0xFF03, 0xFEA0, 0x8028, 0x0000, 0x0006, 0xFF48, 0xFF26, 0xFF85, 0xFF43, 0xFF22, 0xFEC0, 0x802A, 0x0000, 0x0006, 0xFF28, 0xFF28,
+    0xFEE6, 0xFF04, 0xFF04, 0xFF03, 0x802E, 0x0000, 0x0002, 0xFF25, 0xFF04, 0x80DB, 0x0000,
+};
+
+// 1732 bytes, 4608 raw
+const uint16_t icon_02d_rle[866] PROGMEM = {
+    0x8131, 0x0000, 0x0005, 0xFFE0, 0xFFC6, 0xFFE6, 0xFFA6, 0xFFE0, 0x802A, 0x0000, 0x0007, 0xFFC6, 0xFFA6, 0xFFA6, 0xFFE6, 0xFFA6,
+    0xFFA6, 0xF766, 0x8028, 0x0000, 0x0003, 0xF705, 0xFF86, 0xFFE6, 0x8003, 0xFFC6, 0x0003, 0xFFE6, 0xFF65, 0xFEA5, 0x8020, 0x0000,
+    0x000A, 0xFFE5, 0xFFA6, 0xFFA6, 0xFF66, 0xFF85, 0xFF25, 0x0000, 0xFF45, 0xFFE6, 0xFF45, 0x8004, 0xFF25, 0x0008, 0xFFA5, 0xFF25,
+    0x0000, 0xFF25, 0xFFA6, 0xFFA6, 0xFFE6, 0xF7A6, 0x8019, 0x0000, 0x0002, 0xFFE5, 0xFFA6, 0x8004, 0xFFE6, 0x0002, 0xFF05, 0xFDC3,
+    0x8003, 0xFF45, 0x0008, 0xFF85, 0xFF85, 0xFF65, 0xFF45, 0xFF05, 0xFEC4, 0xFEE4, 0xFF45, 0x8004, 0xFFE6, 0x0001, 0xFFA6, 0x8018,
+    0x0000, 0x0009, 0xFFA6, 0xFFE6, 0xFFA6, 0xFFA6, 0xFF45, 0xFF05, 0xFF45, 0xFFA5, 0xFFC4, 0x8006, 0xFF85, 0x000A, 0xFFA4, 0xFFC4,
+    0xFF86, 0xFF25, 0xFF45, 0xFFC6, 0xFF86, 0xFFE6, 0xFF86, 0xFF65, 0x8017, 0x0000, 0x0019, 0xFF86, 0xFFE6, 0xFFC6, 0xFF45, 0xFF25,
+    0xFFC5, 0xFF84, 0xFF86, 0xFFEB, 0xFFCF, 0xFFF4, 0xFFF6, 0xFFF6, 0xFFF5, 0xFFD1, 0xFFEC, 0xFFE8, 0xFF84, 0xFFC5, 0xFF85, 0xFF45,
+    0xFF45, 0xFFA6, 0xFFE6, 0xFF85, 0x8017, 0x0000, 0x0019, 0xFF65, 0xFFE6, 0xFF25, 0xFF66, 0xFFA4, 0xFFA6, 0xFFCE, 0xFFD7, 0xFFDA,
+    0xFFB7, 0xFFB3, 0xFF91, 0xFF90, 0xFF92, 0xFFB5, 0xFFD9, 0xFFD8, 0xFFD2, 0xFFA8, 0xFF84, 0xFF85, 0xFF25, 0xFF45, 0xFFE6, 0xFF45,
+    0x8017, 0x0000, 0x0019, 0xFF45, 0xFF25, 0xFFA6, 0xFF85, 0xFFC9, 0xFFD6, 0xFFD8, 0xFF70, 0xFF28, 0xFF06, 0xFF05, 0xFF04, 0xFEE4,
+    0xFF05, 0xFF05, 0xFF07, 0xFF4D, 0xFFB5, 0xFFD9, 0xFFAE, 0xFF45, 0xFF85, 0xFF05, 0xFFA5, 0xFF05, 0x8015, 0x0000, 0x000C, 0xFF05,
+    0xFF26, 0xFF25, 0xFF85, 0xFF44, 0xFFAB, 0xFFD8, 0xFF92, 0xFF07, 0xFEE4, 0xFEE5, 0xFEE5, 0x8004, 0xFEE6, 0x000B, 0xFEE5, 0xFEE5,
+    0xFEE4, 0xFEE5, 0xFF4D, 0xFFD8, 0xFF90, 0xFF65, 0xFF65, 0xFEC5, 0xFEE5, 0x8013, 0x0000, 0x000B, 0xFF65, 0xFF85, 0xFFA5, 0xFF05,
+    0xFF65, 0xFF44, 0xFF8A, 0xFFB7, 0xFF2C, 0xFEC4, 0xFEC5, 0x8004, 0xFEE6, 0x8006, 0xFEC6, 0x000B, 0xFEC5, 0xFEC4, 0xFEE8, 0xFF95,
+    0xFF70, 0xFF25, 0xFF85, 0xFF04, 0xFF23, 0xFF61, 0xFFA0, 0x800F, 0x0000, 0x000B, 0xFF86, 0xFFC6, 0xFFE6, 0xFFC6, 0xFF05, 0xFF44,
+    0xFF68, 0xFF74, 0xFF0B, 0xFEA4, 0xFEC5, 0x8006, 0xFEC6, 0x8007, 0xFEA6, 0x000C, 0xFEA4, 0xFEC7, 0xFF74, 0xFF4C, 0xFEE3, 0xFF23,
+    0xFF29, 0xFFEE, 0xFFB2, 0xFFDD, 0xEF7D, 0xF79E, 0x800B, 0x0000, 0x000A, 0xFFE0, 0xFFA6, 0xFFE6, 0xFFA6, 0xFF25, 0xFF45, 0xFEE4,
+    0xFF4F, 0xFF0D, 0xFE84, 0x8010, 0xFEA5, 0x0006, 0xFE84, 0xFEC8, 0xFF30, 0xFF0B, 0xF798, 0xF7BE, 0x8004, 0xFFFF, 0x0003, 0xFFDF,
+    0xF7BE, 0xE71C, 0x8009, 0x0000, 0x0008, 0xFFE8, 0xFFA6, 0xFFC6, 0xFFA6, 0xFF25, 0xFF24, 0xFF28, 0xFF0E, 0x8013, 0xFE85, 0x0005,
+    0xFE64, 0xFF10, 0xFFDF, 0xFFFF, 0xF7BF, 0x8003, 0xF79E, 0x0005, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF5D, 0x8008, 0x0000, 0x0008,
+    0xFFE8, 0xFFA6, 0xFFE6, 0xFF45, 0xFF25, 0xFEC4, 0xFF0B, 0xFEA9, 0x8012, 0xFE65, 0x0006, 0xFE44, 0xFEAC, 0xF7BD, 0xF7BF, 0xF79E,
+    0xEF7D, 0x8003, 0xF79E, 0x0006, 0xEF7D, 0xEF7D, 0xF79E, 0xFFFF, 0xF7BE, 0xE73C, 0x8007, 0x0000, 0x0008, 0xFFE0, 0xFF86, 0xFFE6,
+    0xFF25, 0xFF24, 0xFE85, 0xFEAA, 0xFE66, 0x8012, 0xFE45, 0x0003, 0xFE46, 0xF77A, 0xF7BF, 0x8008, 0xF79E, 0x0004, 0xEF7D, 0xF7BE,
+    0xFFFF, 0xF79E, 0x8008, 0x0000, 0x0007, 0xFF86, 0xFF86, 0xFF45, 0xFEE4, 0xFEC7, 0xFE68, 0xFE25, 0x8009, 0xFE45, 0x8005, 0xFE25,
+    0x0001, 0xFE24, 0x8003, 0xFE03, 0x0002, 0xFEAE, 0xF7BF, 0x800A, 0xF79E, 0x0004, 0xEF7D, 0xFFDF, 0xF7BE, 0xE73C, 0x8008, 0x0000,
+    0x0005, 0xFEE5, 0xFF25, 0xFEA5, 0xFEA6, 0xFE26, 0x800A, 0xFE25, 0x8005, 0xFE05, 0x0006, 0xFE6B, 0xFEAF, 0xFEAF, 0xFE6A, 0xF715,
+    0xF79F, 0x800C, 0xF79E, 0x0002, 0xFFFF, 0xEF7D, 0x8009, 0x0000, 0x0003, 0xFE66, 0xFE85, 0xFE85, 0x800D, 0xFE05, 0x0008, 0xFDE4,
+    0xFE06, 0xFF14, 0xFFDE, 0xF7DF, 0xF7DF, 0xF79D, 0xF77D, 0x800D, 0xF79E, 0x0002, 0xFFFF, 0xEF7D, 0x8007, 0x0000, 0x0005, 0xFFE9,
+    0xFF25, 0xFF25, 0xFE85, 0xFE65, 0x800D, 0xFDE5, 0x0004, 0xFDC4, 0xFEF3, 0xFFFF, 0xF7BF, 0x8012, 0xF79E, 0x0003, 0xF7BE, 0xF79E,
+    0xFFFF, 0x8004, 0x0000, 0x0006, 0xFFE0, 0xFF65, 0xFFE6, 0xFF25, 0xFE84, 0xFE65, 0x800A, 0xFDC5, 0x0007, 0xFDA4, 0xFDA4, 0xFDA3,
+    0xFE09, 0xFFBD, 0xF7BF, 0xEF7D, 0x8011, 0xF79E, 0x0005, 0xEF7D, 0xF7BE, 0xFFFF, 0xEF7D, 0xEF7D, 0x8003, 0x0000, 0x0007, 0xFF47,
+    0xFF85, 0xFFE6, 0xFF25, 0xFEA4, 0xFDE5, 0xFDC5, 0x8007, 0xFDA5, 0x0007, 0xFDA4, 0xFDA4, 0xFDE8, 0xFE0A, 0xFDC7, 0xFE6E, 0xF7DF,
+    0x8016, 0xF79E, 0x0002, 0xFFFF, 0xF79E, 0x8003, 0x0000, 0x0007, 0xFF25, 0xFF86, 0xFFA6, 0xFF45, 0xFF05, 0xFDE4, 0xFDC5, 0x8006,
+    0xFD85, 0x0007, 0xFD84, 0xFDC8, 0xF6D4, 0xF75B, 0xF79E, 0xF77C, 0xF75B, 0x8017, 0xF79E, 0x000C, 0xFFDF, 0xEF7D, 0xF79E, 0x0000,
+    0x0000, 0xFFE7, 0xFFA6, 0xFFC6, 0xFFA6, 0xFF45, 0xFE04, 0xFDC5, 0x8005, 0xFD65, 0x0004, 0xFD64, 0xFDA7, 0xF73A, 0xEFBF, 0x8004,
+    0xF79E, 0x0001, 0xF79D, 0x8017, 0xF79E, 0x000B, 0xFFDF, 0xF79E, 0x0000, 0x0000, 0xFFE0, 0xFFA6, 0xFFE6, 0xFFC6, 0xFF45, 0xFEA4,
+    0xFDA4, 0x8003, 0xFD65, 0x0005, 0xFD45, 0xFD44, 0xFD44, 0xF6B3, 0xEFBF, 0x801D, 0xF79E, 0x0002, 0xFFFF, 0xF79E, 0x8003, 0x0000,
+    0x000D, 0xFF86, 0xFFA6, 0xFFA6, 0xFFE6, 0xFF45, 0xFDE4, 0xFDC5, 0xFD25, 0xFD45, 0xFD45, 0xFD24, 0xFD66, 0xF75B, 0x801E, 0xF79E,
+    0x0002, 0xFFFF, 0xEF7D, 0x8005, 0x0000, 0x000B, 0xFFA6, 0xFF85, 0xFF25, 0xFE63, 0xFD84, 0xFD65, 0xFD05, 0xFD25, 0xFD04, 0xFD46,
+    0xF77D, 0x801E, 0xF79E, 0x0002, 0xF7BE, 0xEF7D, 0x8008, 0x0000, 0x0009, 0xFF05, 0xFE23, 0xFD64, 0xFD45, 0xFCE4, 0xFCE4, 0xFD26,
+    0xF73B, 0xEF9E, 0x801C, 0xEF7D, 0x0003, 0xFFDF, 0xEF5D, 0xE71C, 0x8007, 0x0000, 0x000A, 0xFF65, 0xFF25, 0xFF45, 0xFDC3, 0xFD64,
+    0xFD45, 0xFCC4, 0xFCC4, 0xEE53, 0xE79F, 0x801B, 0xEF5D, 0x0003, 0xF79E, 0xEF7D, 0xDEFB, 0x8008, 0x0000, 0x000B, 0xFF65, 0xFFA6,
+    0xFF85, 0xFF45, 0xFE23, 0xFD43, 0xFD24, 0xFCE4, 0xFD07, 0xE697, 0xDF3D, 0x8007, 0xE73D, 0x0003, 0xE75D, 0xEF5D, 0xE73D, 0x8003,
+    0xE71D, 0x0001, 0xE73D, 0x800B, 0xEF5D, 0x0003, 0xEF7D, 0xE71C, 0xD6BA, 0x8009, 0x0000, 0x000C, 0xFF86, 0xFF66, 0xFFA6, 0xFFA6,
+    0xFF45, 0xFEE4, 0xFD83, 0xFD23, 0xFD23, 0xFD47, 0xEE13, 0xDE98, 0x8004, 0xDE99, 0x0009, 0xE6B9, 0xE6F9, 0xD699, 0xCE9B, 0xD699,
+    0xDEB9, 0xD6B8, 0xD6B9, 0xDEB9, 0x8003, 0xD69A, 0x8006, 0xCE79, 0x0004, 0xD69A, 0xD69A, 0xCE79, 0xCE59, 0x800A, 0x0000, 0x001C,
+    0xFFEF, 0xFF86, 0xFFE6, 0xFF86, 0xFFA6, 0xFF45, 0xFF45, 0xFEC4, 0xFDA3, 0xFD22, 0xFD02, 0xF547, 0xF528, 0xF528, 0xF548, 0xF548,
+    0xF589, 0xEDCA, 0xE64E, 0xEECB, 0xF709, 0xF729, 0xF729, 0xFFCA, 0xEF2A, 0xC638, 0xC619, 0xC638, 0x8006, 0xBDF7, 0x0002, 0xC618,
+    0xC618, 0x800D, 0x0000, 0x0002, 0xFFA6, 0xFFC6, 0x8003, 0xFFE6, 0x0013, 0xFF85, 0xFF45, 0xFFFF, 0xFF04, 0xFEE4, 0xFE62, 0xFE01,
+    0xFE01, 0xFE22, 0xFEA2, 0xFF23, 0x0000, 0xFF03, 0xFF85, 0xFFC5, 0xFFE5, 0xFFE5, 0xFFC5, 0xFFE1, 0x8019, 0x0000, 0x0016, 0xFFE7,
+    0xFFC6, 0xFFA6, 0xFFA6, 0xFF66, 0x0000, 0xFEE3, 0xFF25, 0xFF85, 0xFF25, 0xFF25, 0xFF45, 0xFF25, 0xFFA6, 0xFF45, 0x0000, 0xFF85,
+    0xFF45, 0xFF65, 0xFFA6, 0xFFE6, 0xFFA6, 0x8021, 0x0000, 0x0008, 0xFF45, 0xFFC6, 0xFFE6, 0xFFA6, 0xFFA6, 0xFFE6, 0xFFA6, 0xFF65,
+    0x8029, 0x0000, 0x0002, 0xFF66, 0xFFC6, 0x8003, 0xFFE6, 0x0001, 0xFFA6, 0x802B, 0x0000, 0x0004, 0xF786, 0xFFE6, 0xFFE6, 0xFFA5,
+    0x810B, 0x0000,
+};
+
+// 1358 bytes, 4608 raw
+const uint16_t icon_02n_rle[679] PROGMEM = {
+    0x8162, 0x0000, 0x0004, 0xFE60, 0xFF02, 0xFF20, 0xFEE0, 0x802A, 0x0000, 0x0006, 0xFEE0, 0xFF24, 0xFF47, 0xFFC6, 0xFF02, 0xFEC0,
+    0x8028, 0x0000, 0x0007, 0xF800, 0xFEE2, 0xFF68, 0xFFEC, 0xFFEA, 0xFEE2, 0xFBE0, 0x8023, 0x0000, 0x0002, 0xF6C3, 0xFEE4, 0x8003,
+    0x0000, 0x0007, 0x7800, 0xFF04, 0xFFAA, 0xFFAD, 0xFFCB, 0xFF03, 0xFDE0, 0x8022, 0x0000, 0x000D, 0xFF05, 0xFF27, 0xFF6A, 0xFF4A,
+    0xFEE2, 0xFFE0, 0x0000, 0xFEE2, 0xFFCB, 0xFF8D, 0xFF8C, 0xFF67, 0xFEC0, 0x8023, 0x0000, 0x000D, 0xFF05, 0xFF25, 0xFFE8, 0xFF88,
+    0xFF25, 0xFF01, 0xFEC0, 0xFF49, 0xFFAE, 0xFF6C, 0xFFCA, 0xFF03, 0xFAA0, 0x8023, 0x0000, 0x000C, 0xFEAA, 0xFF05, 0xFFA3, 0xFF02,
+    0xFF02, 0xFFE0, 0xFF05, 0xFFED, 0xFF6D, 0xFF6B, 0xFF84, 0xFEE0, 0x8024, 0x0000, 0x000C, 0xFF8A, 0xFF28, 0xFF25, 0xFEE4, 0x0000,
+    0xFEC0, 0xFF49, 0xFFAD, 0xFF6C, 0xFF47, 0xFEE0, 0xFEC0, 0x8027, 0x0000, 0x0009, 0xFFEA, 0x0000, 0xFF03, 0xFFEC, 0xFF6D, 0xFF6A,
+    0xFF02, 0xFEE0, 0xFEC1, 0x8029, 0x0000, 0x0007, 0xFF26, 0xFFCD, 0xFF6C, 0xFF27, 0xFF00, 0xFF01, 0xFEE1, 0x8027, 0x0000, 0x0009,
+    0xEF5E, 0xEF39, 0xFF28, 0xFFAD, 0xFF6B, 0xFF03, 0xFEE1, 0xFF61, 0xFEC1, 0x8025, 0x0000, 0x000C, 0xE71C, 0xF7BE, 0xFFDF, 0xF79C,
+    0xFF6C, 0xFF6B, 0xFF49, 0xFEE2, 0xFEE2, 0xFF42, 0xFEE1, 0xFFE0, 0x800C, 0x0000, 0x0005, 0xDEDB, 0xEF5D, 0xEF5D, 0xEF7D, 0xD6BA,
+    0x8012, 0x0000, 0x000D, 0xE75E, 0xFFDF, 0xFFFF, 0xF79F, 0xEF5C, 0xFF2C, 0xFF6A, 0xFF47, 0xFEE2, 0xFEE2, 0xFF02, 0xFF22, 0xFEE2,
+    0x800A, 0x0000, 0x0009, 0xEF7D, 0xF79E, 0xFFDF, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xF79E, 0xEF7D, 0x800E, 0x0000, 0x0010, 0xFEE0,
+    0xF708, 0xF79D, 0xFFDF, 0xE71C, 0xE71B, 0xE73D, 0xF72F, 0xFF68, 0xFF26, 0xFF02, 0xFF03, 0xFF03, 0xFF43, 0xFEE3, 0xFF03, 0x8007,
+    0x0000, 0x0003, 0xE71C, 0xF79E, 0xFFDF, 0x8003, 0xFFFF, 0x0001, 0xFFDF, 0x8003, 0xFFFF, 0x0003, 0xF7BE, 0xEF7D, 0xCE79, 0x800C,
+    0x0000, 0x000A, 0xFEE2, 0xFFAB, 0xFF90, 0xEF12, 0xFF2A, 0xEF14, 0xE71F, 0xEF13, 0xFF47, 0xFF26, 0x8004, 0xFF03, 0x0003, 0xFF63,
+    0xFF03, 0xE623, 0x8005, 0x0000, 0x0005, 0xEF5D, 0xF7BE, 0xFFFF, 0xFFDF, 0xF79E, 0x8004, 0xEF7D, 0x0006, 0xF79E, 0xF79E, 0xFFFF,
+    0xFFFF, 0xF7BE, 0xE73C, 0x800B, 0x0000, 0x000A, 0xFF04, 0xFF8C, 0xFF6A, 0xFF46, 0xFF26, 0xE718, 0xE71E, 0xE719, 0xFF29, 0xFF25,
+    0x8004, 0xFF04, 0x0004, 0xFF24, 0xFF64, 0xFF04, 0xF704, 0x8003, 0x0000, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xF79E, 0xEF7D, 0x8006,
+    0xF79E, 0x0005, 0xEF7D, 0xEF7D, 0xFFDF, 0xFFFF, 0xF79E, 0x8009, 0x0000, 0x000C, 0xFEE0, 0xFF23, 0xFF68, 0xFF89, 0xFF26, 0xFF01,
+    0xF6E8, 0xDEFC, 0xDF1C, 0xDF1D, 0xEF10, 0xFF23, 0x8005, 0xFF05, 0x0009, 0xFF25, 0xFF65, 0xFF04, 0xFF05, 0xFF25, 0x0000, 0xF79E,
+    0xFFFF, 0xF7BE, 0x800A, 0xF79E, 0x0004, 0xEF7D, 0xFFDF, 0xFFDF, 0xEF7D, 0x8008, 0x0000, 0x000D, 0xFEA4, 0xF6EC, 0xFF8A, 0xFF03,
+    0xFF02, 0xFF01, 0xFF01, 0xEEF0, 0xDEFC, 0xDEFC, 0xE6FA, 0xFF09, 0xFF04, 0x8006, 0xFF05, 0x0007, 0xFF45, 0xFF65, 0xFF04, 0xFF28,
+    0xF79D, 0xF7BF, 0xEF7D, 0x800C, 0xF79E, 0x0003, 0xFFFF, 0xF79E, 0xD6BA, 0x8007, 0x0000, 0x000E, 0xDEDB, 0xDF1D, 0xE6F9, 0xFF08,
+    0xFF03, 0xF70C, 0xEEEE, 0xEEEE, 0xDEFB, 0xDEFB, 0xDEFC, 0xE6F7, 0xFF28, 0xFF25, 0x8003, 0xFF26, 0x0007, 0xFF25, 0xFF27, 0xFF29,
+    0xFF29, 0xFF46, 0xFF8D, 0xF7BF, 0x800E, 0xF79E, 0x0003, 0xF7BE, 0xF79E, 0xEF7D, 0x8006, 0x0000, 0x0008, 0xD6BA, 0xDEDB, 0xE71C,
+    0xD6DC, 0xF70F, 0xF70C, 0xDEDB, 0xDEDC, 0x8004, 0xDEDB, 0x000C, 0xDEDC, 0xE6F7, 0xFF2A, 0xFF26, 0xFF26, 0xFF29, 0xFF53, 0xF7BB,
+    0xF7BE, 0xF7BD, 0xF798, 0xF778, 0x8010, 0xF79E, 0x0002, 0xFFFF, 0xEF7D, 0x8006, 0x0000, 0x0007, 0xD6BA, 0xE73C, 0xDEDB, 0xD6DB,
+    0xDED8, 0xDED9, 0xD6DB, 0x8006, 0xDEDB, 0x000A, 0xD6DC, 0xDED9, 0xF70F, 0xFF2B, 0xF799, 0xFFDF, 0xFFDF, 0xF7BF, 0xF79E, 0xF79F,
+    0x8011, 0xF79E, 0x0003, 0xFFDF, 0xF79E, 0xEF5D, 0x8005, 0x0000, 0x0006, 0xD6BA, 0xE73C, 0xD6BA, 0xD6BA, 0xD6BB, 0xD6BB, 0x8008,
+    0xD6BA, 0x0008, 0xD6BB, 0xD6BB, 0xEF5B, 0xFFFF, 0xF7BE, 0xF79D, 0xEF7D, 0xEF7D, 0x8013, 0xF79E, 0x0003, 0xFFDF, 0xF7BE, 0xEF5D,
+    0x8004, 0x0000, 0x0003, 0xD69A, 0xE73C, 0xD69A, 0x8009, 0xD6BA, 0x8003, 0xD69A, 0x0004, 0xD6DB, 0xF7BF, 0xF7BE, 0xEF7D, 0x8017,
+    0xF79E, 0x0003, 0xFFFF, 0xF7BE, 0xEF7D, 0x8003, 0x0000, 0x0002, 0xD69A, 0xDEFB, 0x8009, 0xD69A, 0x0006, 0xD6BA, 0xD6BA, 0xDEDB,
+    0xD6BA, 0xDEFB, 0xF7BE, 0x801A, 0xF79E, 0x0008, 0xFFFF, 0xF79E, 0xF7BE, 0x0000, 0x0000, 0xE73C, 0xD69A, 0xDEDB, 0x8003, 0xCE79,
+    0x0006, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xDEFB, 0xEF5D, 0x8003, 0xEF7D, 0x0001, 0xEF5D, 0x801C, 0xF79E, 0x0002, 0xFFFF, 0xEF7D,
+    0x8003, 0x0000, 0x8003, 0xDEDB, 0x8004, 0xD69A, 0x0002, 0xCE79, 0xE71C, 0x8022, 0xF79E, 0x0003, 0xFFDF, 0xF79E, 0xFFFF, 0x8003,
+    0x0000, 0x0007, 0xCE79, 0xD69A, 0xCE79, 0xCE59, 0xCE79, 0xC638, 0xDEDB, 0x8023, 0xF79E, 0x0003, 0xF7BE, 0xF79E, 0xF79E, 0x8005,
+    0x0000, 0x0006, 0xC618, 0xC638, 0xC638, 0xCE59, 0xEF5D, 0xFFDF, 0x8022, 0xF79E, 0x0003, 0xF7BE, 0xF79E, 0xF79E, 0x8008, 0x0000,
+    0x0003, 0xFFFF, 0xEF7D, 0xFFDF, 0x8022, 0xF79E, 0x0003, 0xF7BE, 0xEF7D, 0xEF7D, 0x8008, 0x0000, 0x0003, 0xF79E, 0xF79E, 0xF7BE,
+    0x8022, 0xF79E, 0x0003, 0xFFFF, 0xEF7D, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xEF5D, 0xEF7D, 0xFFDF, 0x8021, 0xEF7D, 0x0003, 0xF79E,
+    0xFFDF, 0xE73C, 0x800A, 0x0000, 0x0002, 0xE73C, 0xFFDF, 0x8021, 0xEF5D, 0x0003, 0xFFDF, 0xE71C, 0xD6BA, 0x800A, 0x0000, 0x0004,
+    0xDEDB, 0xE71C, 0xF79E, 0xEF5D, 0x801D, 0xE73C, 0x0004, 0xEF5D, 0xF79E, 0xDEFB, 0xCE79, 0x800C, 0x0000, 0x0003, 0xD69A, 0xDEDB,
+    0xE71C, 0x801C, 0xEF5D, 0x0004, 0xE71C, 0xD6BA, 0xD69A, 0xC638, 0x800E, 0x0000, 0x0001, 0xBDD7, 0x800A, 0xCE79, 0x800F, 0xCE59,
+    0x0002, 0xC638, 0xC638, 0x8004, 0xCE59, 0x8125, 0x0000,
+};
+
+// 960 bytes, 4608 raw
+const uint16_t icon_03d_rle[480] PROGMEM = {
+    0x8247, 0x0000, 0x0008, 0xCE79, 0xEF5D, 0xF79E, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xDEFB, 0x8027, 0x0000, 0x0002, 0xD6BA, 0xF79E,
+    0x8006, 0xFFFF, 0x0002, 0xFFDF, 0xEF5D, 0x800D, 0x0000, 0x0001, 0x9CD3, 0x8003, 0xF79E, 0x0004, 0xF7BE, 0xF79E, 0xF79E, 0xEF7D,
+    0x8010, 0x0000, 0x0004, 0xDEFB, 0xEF7D, 0xFFFF, 0xEF7D, 0x8005, 0xE73C, 0x0003, 0xFFDF, 0xF7BE, 0xE73C, 0x800B, 0x0000, 0x0002,
+    0xEF5D, 0xFFDF, 0x8006, 0xFFFF, 0x0003, 0xFFDF, 0xF7BE, 0xEF7D, 0x800E, 0x0000, 0x0004, 0xEF5D, 0xFFFF, 0xE73C, 0xE71C, 0x8005,
+    0xE73C, 0x0004, 0xE71C, 0xF7BE, 0xEF5D, 0xE71C, 0x8008, 0x0000, 0x0006, 0xFFFF, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFDF, 0xF7BE, 0x8003,
+    0xF79E, 0x0005, 0xF7BE, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF5D, 0x800C, 0x0000, 0x0003, 0xD69A, 0xEF5D, 0xF79E, 0x8008, 0xE71C, 0x0005,
+    0xE73C, 0xF7BE, 0xE73C, 0x0000, 0xB5B6, 0x8006, 0x0000, 0x0003, 0xEF7D, 0xFFFF, 0xFFFF, 0x8003, 0xEF7D, 0x8003, 0xF79E, 0x0006,
+    0xEF7D, 0xEF7D, 0xF79E, 0xFFFF, 0xFFDF, 0xEF7D, 0x800B, 0x0000, 0x0003, 0xE71C, 0xE73C, 0xE73C, 0x8009, 0xE71C, 0x0006, 0xEF7D,
+    0xE71C, 0xEF5D, 0xEF7D, 0xF7BE, 0xE71C, 0x8003, 0x0000, 0x0004, 0xEF7D, 0xF7BE, 0xFFDF, 0xEF7D, 0x8008, 0xF79E, 0x0005, 0xEF7D,
+    0xF79E, 0xFFFF, 0xF7BE, 0xEF5D, 0x8009, 0x0000, 0x0004, 0xD6BA, 0xE71C, 0xE73C, 0xE71C, 0x8006, 0xDEFB, 0x8003, 0xE71C, 0x000B,
+    0xDEFB, 0xEF5D, 0xF79E, 0xF79E, 0xFFFF, 0xF7BE, 0xE73C, 0x0000, 0xFFFF, 0xF79E, 0xFFFF, 0x800B, 0xF79E, 0x0004, 0xEF7D, 0xF79E,
+    0xFFFF, 0xEF7D, 0x8008, 0x0000, 0x0003, 0xDEFB, 0xE71C, 0xEF5D, 0x800F, 0xDEFB, 0x0007, 0xDEDB, 0xF79E, 0xEF5D, 0x52AA, 0xEF5D,
+    0xF7BE, 0xF7BE, 0x800D, 0xF79E, 0x0003, 0xFFFF, 0xF79E, 0xF79E, 0x8006, 0x0000, 0x0003, 0xE71C, 0xDEDB, 0xEF7D, 0x8004, 0xDEDB,
+    0x800A, 0xDEFB, 0x0008, 0xDEDB, 0xDEFB, 0xE73C, 0xEF5D, 0xF7BE, 0xEF7D, 0xEF7D, 0xFFDF, 0x800F, 0xF79E, 0x0002, 0xFFDF, 0xEF7D,
+    0x8006, 0x0000, 0x0002, 0xD6BA, 0xE71C, 0x800F, 0xDEDB, 0x0003, 0xE71C, 0xF7BE, 0xFFFF, 0x8003, 0xFFDF, 0x0001, 0xEF7D, 0x8010,
+    0xF79E, 0x0002, 0xFFDF, 0xEF7D, 0x8006, 0x0000, 0x0002, 0xD6BA, 0xEF5D, 0x8009, 0xD6BA, 0x8004, 0xDEDB, 0x0004, 0xD6BA, 0xE71C,
+    0xFFDF, 0xFFDF, 0x8015, 0xF79E, 0x0004, 0xF7BE, 0xF7BE, 0xF79E, 0xD6BA, 0x8004, 0x0000, 0x0002, 0xD6BA, 0xE73C, 0x800E, 0xD6BA,
+    0x0004, 0xF79E, 0xFFDF, 0xF79E, 0xEF7D, 0x8014, 0xF79E, 0x0005, 0xEF7D, 0xFFDF, 0xFFFF, 0xF79E, 0xEF7D, 0x8003, 0x0000, 0x0002,
+    0xCE79, 0xE71C, 0x800D, 0xD69A, 0x0002, 0xDEDB, 0xF7BE, 0x801A, 0xF79E, 0x0008, 0xFFFF, 0xEF7D, 0xCE79, 0x0000, 0x0000, 0xD69A,
+    0xD6BA, 0xD6BA, 0x8008, 0xD69A, 0x0005, 0xDEFB, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0x801B, 0xF79E, 0x0009, 0xF7BE, 0xFFDF, 0xEF7D,
+    0x0000, 0x0000, 0xFFFF, 0xD6BA, 0xE71C, 0xD69A, 0x8005, 0xCE79, 0x0002, 0xD6BA, 0xEF5D, 0x8021, 0xF79E, 0x0009, 0xFFFF, 0xF79E,
+    0xFFFF, 0x0000, 0x0000, 0xDEFB, 0xD6BA, 0xD6BA, 0xDEDB, 0x8003, 0xD6BA, 0x0002, 0xD69A, 0xEF7D, 0x8022, 0xF79E, 0x0003, 0xF7BE,
+    0xEF7D, 0xEF5D, 0x8003, 0x0000, 0x0008, 0x52AA, 0xCE59, 0xCE79, 0xC638, 0xCE59, 0xCE59, 0xE73C, 0xF7BE, 0x8022, 0xF79E, 0x0003,
+    0xF7BE, 0xF79E, 0xF79E, 0x8008, 0x0000, 0x0003, 0xEF7D, 0xF79E, 0xFFDF, 0x8022, 0xF79E, 0x0003, 0xF7BE, 0xF79E, 0xF79E, 0x8008,
+    0x0000, 0x0003, 0xF7BE, 0xF79E, 0xF7BE, 0x8022, 0xF79E, 0x0003, 0xFFDF, 0xF79E, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xEF5D, 0xEF7D,
+    0xF7BE, 0x800E, 0xF79E, 0x8006, 0xEF7D, 0x800D, 0xF79E, 0x0004, 0xEF7D, 0xFFFF, 0xEF7D, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xF79E,
+    0xEF5D, 0xFFDF, 0x8021, 0xEF7D, 0x0003, 0xF7BE, 0xEF5D, 0xE71C, 0x800A, 0x0000, 0x0003, 0xE71C, 0xF7BE, 0xEF7D, 0x8015, 0xEF5D,
+    0x800A, 0xE73C, 0x0003, 0xEF7D, 0xEF7D, 0xDEDB, 0x800B, 0x0000, 0x0004, 0xCE79, 0xDEDB, 0xEF7D, 0xEF5D, 0x8010, 0xE73C, 0x800C,
+    0xE71C, 0x0005, 0xE73C, 0xEF7D, 0xDEFB, 0xD6BA, 0xAD55, 0x800C, 0x0000, 0x0003, 0xBDF7, 0xD69A, 0xD6BA, 0x8010, 0xDEDB, 0x800C,
+    0xD6BA, 0x0003, 0xCE79, 0xD69A, 0xCE59, 0x8010, 0x0000, 0x800F, 0xC638, 0x800D, 0xC618, 0x0002, 0xC638, 0xC618, 0x8216, 0x0000,
+};
+
+// 1698 bytes, 4608 raw
+const uint16_t icon_09d_rle[849] PROGMEM = {
+    0x8131, 0x0000, 0x0004, 0xFFE5, 0xFFC6, 0xFFE6, 0xFFE7, 0x802B, 0x0000, 0x0006, 0xFF86, 0xFF86, 0xFFE6, 0xFFE6, 0xFF85, 0xF785,
+    0x8026, 0x0000, 0x000E, 0xFFC6, 0xFFC6, 0xFF65, 0xFF04, 0xFF25, 0xFF65, 0xFF45, 0xFF45, 0xFF65, 0xFF05, 0xFEE4, 0xFF85, 0xFFE6,
+    0xFFA6, 0x8021, 0x0000, 0x0010, 0xFFC6, 0xFFE6, 0xFFE6, 0xFF45, 0xFF24, 0xFF83, 0xFF64, 0xFF64, 0xFF84, 0xFF64, 0xFF63, 0xFF24,
+    0xFF85, 0xFFE6, 0xFFC6, 0xFFC6, 0x801F, 0x0000, 0x0012, 0xFFE5, 0xFF86, 0xFFA6, 0xFF25, 0xFF84, 0xFFA9, 0xFFCF, 0xFFB2, 0xFFD3,
+    0xFFD3, 0xFFD2, 0xFFAD, 0xFF88, 0xFF63, 0xFF45, 0xFFE6, 0xFF86, 0xFFE5, 0x801F, 0x0000, 0x0011, 0xFF45, 0xFF44, 0xFF66, 0xFFB0,
+    0xFFF5, 0xFF91, 0xFF6D, 0xFF4C, 0xFF4C, 0xFF6E, 0xFF92, 0xFFF5, 0xFFAE, 0xFF65, 0xFF24, 0xFF25, 0xFFE3, 0x801D, 0x0000, 0x0008,
+    0xFF65, 0xFF25, 0xF72A, 0xFF46, 0xFFF2, 0xFF91, 0xFF08, 0xFEE4, 0x8004, 0xFEE5, 0x0008, 0xFEE4, 0xFF09, 0xFF93, 0xFFB0, 0xFF25,
+    0xFF04, 0xF705, 0xFDE3, 0x801A, 0x0000, 0x0009, 0xBDFA, 0xFFA8, 0xFF84, 0xFF8C, 0xFF4D, 0xFF6E, 0xFF2E, 0xFEC4, 0xFEC5, 0x8006,
+    0xFEC6, 0x0008, 0xFEA5, 0xFEC5, 0xFF50, 0xFF4D, 0xFF24, 0xFF45, 0xFFC6, 0xFFA3, 0x8018, 0x0000, 0x0008, 0xDEDF, 0xF7BA, 0xFFE8,
+    0xFF85, 0xFF4F, 0xFF4C, 0xFF0D, 0xFE85, 0x8008, 0xFEA5, 0x8003, 0xFE85, 0x0007, 0xFF4E, 0xFEE8, 0xFF24, 0xFFE5, 0xFFA7, 0xF79C,
+    0xF79F, 0x8003, 0xF7BE, 0x0003, 0xFFDF, 0xF79E, 0xCE79, 0x800F, 0x0000, 0x0008, 0xDEDC, 0xF79F, 0xFFFB, 0xFFA5, 0xFF49, 0xF70E,
+    0xFECA, 0xFE87, 0x800C, 0xFE65, 0x0005, 0xFE88, 0xFECA, 0xFEC3, 0xFF4F, 0xFFFA, 0x8006, 0xFFFF, 0x0003, 0xFFDF, 0xF7BE, 0xEF7D,
+    0x800E, 0x0000, 0x0007, 0xEF5D, 0xFFFF, 0xE73B, 0xFF68, 0xFF4A, 0xF6CC, 0xFE88, 0x800D, 0xFE45, 0x0006, 0xFE25, 0xFE69, 0xF735,
+    0xF7DF, 0xFFDF, 0xF7BE, 0x8005, 0xF79E, 0x0004, 0xFFDF, 0xFFFF, 0xFFDF, 0xEF7D, 0x800C, 0x0000, 0x0008, 0xDEFB, 0xEF5D, 0xEF7D,
+    0xE71C, 0xE738, 0xF731, 0xFE88, 0xFE26, 0x800B, 0xFE25, 0x0008, 0xFE05, 0xFE05, 0xFE04, 0xF6F4, 0xFFFF, 0xF7BF, 0xF79E, 0xEF7D,
+    0x8005, 0xF79E, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xFFFF, 0xEF7D, 0x800B, 0x0000, 0x0009, 0xE71C, 0xE73C, 0xE71C, 0xDF1C, 0xE719,
+    0xEF13, 0xFE47, 0xFDE5, 0xFE05, 0x800B, 0xFDE5, 0x0005, 0xFDC4, 0xFE6D, 0xF7BF, 0xF7BF, 0xEF7D, 0x8008, 0xF79E, 0x0005, 0xEF7D,
+    0xF79E, 0xFFFF, 0xF7BE, 0xEF5D, 0x8009, 0x0000, 0x0009, 0xD6BA, 0xE71C, 0xE73C, 0xDEFC, 0xE719, 0xFF48, 0xF70B, 0xF64A, 0xFDC4,
+    0x800B, 0xFDC5, 0x0005, 0xFDA4, 0xFDC6, 0xF739, 0xF7BF, 0xF79D, 0x800A, 0xF79E, 0x0004, 0xEF7D, 0xF79E, 0xFFFF, 0xF79E, 0x8008,
+    0x0000, 0x000A, 0xDEDB, 0xE71C, 0xEF5D, 0xDEFB, 0xDEDC, 0xE734, 0xFF84, 0xF72A, 0xF64C, 0xFD83, 0x8006, 0xFDA5, 0x0001, 0xFD85,
+    0x8004, 0xFD84, 0x0002, 0xFD62, 0xFE0A, 0x800F, 0xF79E, 0x0003, 0xFFDF, 0xF79E, 0xEF7D, 0x8006, 0x0000, 0x000B, 0xD6BA, 0xD6BA,
+    0xEF5D, 0xDEDB, 0xDEDB, 0xDEDC, 0xE716, 0xFFA5, 0xFF67, 0xF6AD, 0xFD85, 0x8005, 0xFD65, 0x0008, 0xFD64, 0xFD44, 0xFDEB, 0xFEB3,
+    0xF739, 0xFF18, 0xFE70, 0xF693, 0x8010, 0xF79E, 0x0002, 0xFFDF, 0xF79E, 0x8006, 0x0000, 0x0002, 0xD6BA, 0xE73C, 0x8005, 0xDEDB,
+    0x0005, 0xEF4F, 0xFF84, 0xF70B, 0xF5E9, 0xFD24, 0x8003, 0xFD45, 0x0008, 0xFD44, 0xFD24, 0xFE71, 0xFFDE, 0xFFFF, 0xF7DF, 0xF7DF,
+    0xF7BF, 0x8011, 0xF79E, 0x0002, 0xFFDF, 0xEF7D, 0x8006, 0x0000, 0x0002, 0xD6BA, 0xEF5D, 0x8004, 0xD6BA, 0x0010, 0xD6BB, 0xD6BA,
+    0xE6F5, 0xE6F4, 0xE692, 0xFD65, 0xFD04, 0xFD05, 0xFD04, 0xFCE3, 0xFE2F, 0xFFFF, 0xFFDF, 0xF79E, 0xEF7D, 0xEF7D, 0x8015, 0xF79E,
+    0x0001, 0xF7BE, 0x8004, 0x0000, 0x0002, 0xD6BA, 0xE73C, 0x8006, 0xD6BA, 0x000C, 0xD6BC, 0xDEB9, 0xF70B, 0xEE6D, 0xFD25, 0xFCC3,
+    0xFCC3, 0xFD06, 0xF75B, 0xFFDF, 0xF79E, 0xEF7D, 0x8015, 0xF79E, 0x0004, 0xF7BE, 0xFFFF, 0xF79E, 0xF79E, 0x8003, 0x0000, 0x0002,
+    0xD69A, 0xE71C, 0x8006, 0xD69A, 0x000B, 0xD69B, 0xDED7, 0xFF64, 0xFF46, 0xEE8D, 0xF568, 0xFCC2, 0xFD6A, 0xF7BE, 0xF79E, 0xEF7D,
+    0x8018, 0xF79E, 0x0009, 0xFFFF, 0xEF7D, 0xDEDB, 0x0000, 0x0000, 0xDEDB, 0xD69A, 0xD6BA, 0xCE79, 0x8005, 0xD69A, 0x0009, 0xD699,
+    0xF74E, 0xFF90, 0xF777, 0xEF5B, 0xF6B4, 0xF6B4, 0xF79E, 0xEF9E, 0x801A, 0xF79E, 0x0002, 0xFFFF, 0xF79E, 0x8003, 0x0000, 0x0003,
+    0xD6BA, 0xDEFB, 0xD6BA, 0x8005, 0xCE79, 0x0007, 0xDEDB, 0xEF7D, 0xF79F, 0xF79F, 0xF79E, 0xEFBF, 0xEF9F, 0x8016, 0xF79E, 0x0002,
+    0xEF7E, 0xC6FE, 0x8004, 0xF79E, 0x000E, 0xFFFF, 0xF79E, 0xFFFF, 0x0000, 0x0000, 0xD6BA, 0xD69A, 0xCE79, 0xD6BA, 0xDEDB, 0xDEFB,
+    0xDEDB, 0xD6BA, 0xEF7D, 0x8012, 0xF79E, 0x0002, 0xEF7E, 0xEF7E, 0x8007, 0xF79E, 0x000A, 0xFFBD, 0xAEBE, 0x355F, 0xD73E, 0xFF9D,
+    0xF79E, 0xF79E, 0xF7BE, 0xEF7D, 0xEF7D, 0x8004, 0x0000, 0x0007, 0xCE59, 0xCE59, 0xC638, 0xCE59, 0xC638, 0xEF5D, 0xF7BE, 0x8010,
+    0xF79E, 0x0005, 0xF79D, 0xE75E, 0x5DDF, 0xC6FE, 0xFFBD, 0x8006, 0xF79E, 0x000A, 0xE77E, 0x6E5F, 0x35BF, 0x7E5F, 0xF79D, 0xF79E,
+    0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0x8008, 0x0000, 0x0003, 0xFFFF, 0xF79E, 0xFFDF, 0x8010, 0xF79E, 0x0005, 0xFF9D, 0xAEFE, 0x3DDF,
+    0x763F, 0xF79D, 0x8005, 0xF79E, 0x000B, 0xF79D, 0xB71F, 0x871F, 0x7EFF, 0x4DFF, 0xBEFE, 0xFF9D, 0xF79E, 0xF7BE, 0xF79E, 0xF79E,
+    0x8008, 0x0000, 0x0003, 0xF79E, 0xF79E, 0xF7BE, 0x8010, 0xF79E, 0x0006, 0xDF5E, 0x8F1F, 0x8F3F, 0x4E1F, 0xB6DE, 0xFFBD, 0x8004,
+    0xF79E, 0x000B, 0xE77E, 0x86DF, 0x9F9F, 0x8F3F, 0x4E1F, 0x761F, 0xF79D, 0xF79E, 0xFFDF, 0xF79E, 0xFFFF, 0x8008, 0x0000, 0x0003,
+    0xE73C, 0xEF7D, 0xF7BE, 0x8007, 0xF79E, 0x8008, 0xEF7D, 0x0007, 0xF79D, 0xBF1E, 0x76DF, 0x8F3F, 0x3DDF, 0x7E3F, 0xFF9D, 0x8004,
+    0xF79D, 0x000A, 0xE77E, 0x6E7F, 0x669F, 0x667F, 0x2D9F, 0x6DFF, 0xF79D, 0xF77D, 0xFFFF, 0xEF7D, 0x8009, 0x0000, 0x0003, 0xCE79,
+    0xEF5D, 0xFFDF, 0x800F, 0xEF7D, 0x0015, 0xF77D, 0xDF3D, 0x6E3F, 0x45DF, 0x3D7F, 0xAEBE, 0xF77D, 0xEF5D, 0xE75D, 0xEF7D, 0xEF5D,
+    0xF77D, 0xB6DE, 0x55FF, 0x3D9F, 0x4D9F, 0xC6FD, 0xF77D, 0xF7BE, 0xEF5D, 0xDEFB, 0x800A, 0x0000, 0x0003, 0xE71C, 0xF79E, 0xEF7D,
+    0x8004, 0xEF5D, 0x800B, 0xE73C, 0x0013, 0xEF5C, 0xD71D, 0xA69D, 0xC6DD, 0xEF5C, 0xF75C, 0xC6DD, 0x5DBE, 0xDF1D, 0xEF5C, 0xE73C,
+    0xEF5C, 0xD6FD, 0xBEBD, 0xDF1D, 0xEF5C, 0xEF7D, 0xEF5D, 0xD6BA, 0x800B, 0x0000, 0x0006, 0x7BEF, 0xD6BA, 0xE73C, 0xEF5D, 0xEF5D,
+    0xE73C, 0x8003, 0xEF5D, 0x800A, 0xE73C, 0x0011, 0xEF5C, 0xF75C, 0xEF5C, 0xEF3C, 0xE71C, 0x6E1E, 0x151F, 0x8E3D, 0xEF3C, 0xE73C,
+    0xE73C, 0xEF3C, 0xEF5C, 0xEF5C, 0xE73C, 0xDEFB, 0xD69A, 0x800E, 0x0000, 0x0001, 0xCE79, 0x8003, 0xD69A, 0x8010, 0xCE79, 0x0009,
+    0xD679, 0xA67B, 0x5E5F, 0x4E1F, 0x4DDF, 0xB65A, 0xD679, 0xCE59, 0xCE59, 0x8003, 0xCE79, 0x0001, 0xC618, 0x8011, 0x0000, 0x0001,
+    0xC618, 0x800E, 0xC638, 0x000E, 0xBDF7, 0xBDF7, 0xC5F7, 0xA61A, 0x7EBF, 0x8F5F, 0x7EDF, 0x565F, 0x4D9E, 0xD616, 0xBDF7, 0xC618,
+    0xC618, 0xAD55, 0x8025, 0x0000, 0x0007, 0x5E7F, 0x8F7F, 0xAFDF, 0x8F3F, 0x669F, 0x359F, 0x049F, 0x8029, 0x0000, 0x0007, 0x5E5F,
+    0x877F, 0x975F, 0x86FF, 0x5E5F, 0x35BF, 0x14FF, 0x8029, 0x0000, 0x0007, 0x4DFF, 0x5EBF, 0x669F, 0x5E5F, 0x461F, 0x1D1F, 0x0C9F,
+    0x8029, 0x0000, 0x0006, 0x259F, 0x3D9F, 0x3DBF, 0x35DF, 0x255F, 0x14DF, 0x802C, 0x0000, 0x0003, 0x1D1F, 0x1D5F, 0x04BF, 0x80FC,
+    0x0000,
+};
+
+// 1612 bytes, 4608 raw
+const uint16_t icon_09n_rle[806] PROGMEM = {
+    0x80D3, 0x0000, 0x0003, 0xE540, 0xFF40, 0xFF00, 0x802B, 0x0000, 0x0005, 0xFEC0, 0xFF23, 0xFF44, 0xFF01, 0xFEC0, 0x8029, 0x0000,
+    0x0006, 0xFE60, 0xFF23, 0xFF68, 0xFFEA, 0xFF25, 0xFEC2, 0x8024, 0x0000, 0x0001, 0xFD40, 0x8004, 0x0000, 0x0006, 0xFEC0, 0xFF46,
+    0xFFEC, 0xFFED, 0xFF46, 0xFEA0, 0x8022, 0x0000, 0x0004, 0xFEE2, 0xFE60, 0xFF28, 0xFF26, 0x8003, 0x0000, 0x0006, 0xFEC0, 0xFF67,
+    0xFFED, 0xFF8D, 0xFFA9, 0xFEC1, 0x8023, 0x0000, 0x000D, 0xFF04, 0xFF67, 0xFF8B, 0xFF6A, 0xFF25, 0xFE60, 0xF620, 0xFF26, 0xFFEE,
+    0xFF6D, 0xFFCB, 0xFF04, 0xEDC0, 0x8023, 0x0000, 0x000C, 0xFEA2, 0xFF04, 0xFFE5, 0xFF65, 0xFF24, 0xFEA0, 0xFEE3, 0xFFEC, 0xFF6D,
+    0xFF6C, 0xFFA7, 0xFEE0, 0x8008, 0x0000, 0x0009, 0xE73C, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE, 0xF79E, 0xEF7D, 0x8013,
+    0x0000, 0x000C, 0xFF29, 0xFF26, 0xFF43, 0xFEE2, 0xFEA0, 0xFEA0, 0xFF48, 0xFFAE, 0xFF6C, 0xFF69, 0xFEE1, 0xFEC0, 0x8006, 0x0000,
+    0x0003, 0xDEFB, 0xF79E, 0xFFDF, 0x8007, 0xFFFF, 0x0003, 0xF7BE, 0xF7BE, 0xEF5D, 0x8011, 0x0000, 0x000C, 0xFF28, 0xFF49, 0xFEA6,
+    0xFF04, 0x0000, 0xFEE3, 0xFFEC, 0xFF6D, 0xFF6B, 0xFF24, 0xFEC0, 0xFEA0, 0x8005, 0x0000, 0x0006, 0xEF5D, 0xF7BE, 0xFFFF, 0xFFFF,
+    0xFFDF, 0xF7BE, 0x8004, 0xF79E, 0x0005, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0x8014, 0x0000, 0x0008, 0xFBE0, 0xFF06, 0xFFCD,
+    0xFF6C, 0xFF48, 0xFF01, 0xFEC0, 0xFF01, 0x8004, 0x0000, 0x0007, 0xE73C, 0xF79E, 0xFFFF, 0xF7BE, 0xF79E, 0xEF7D, 0xEF7D, 0x8003,
+    0xF79E, 0x0007, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0xFFFF, 0xFFFF, 0xEF7D, 0x8013, 0x0000, 0x0008, 0xFE80, 0xFF27, 0xFFAD, 0xFF6B,
+    0xFF04, 0xFF00, 0xFEE1, 0xFEE1, 0x8003, 0x0000, 0x0005, 0xEF5D, 0xF79E, 0xFFFF, 0xF79E, 0xEF7D, 0x8009, 0xF79E, 0x0005, 0xEF7D,
+    0xF79E, 0xFFFF, 0xFFFF, 0xEF7D, 0x8012, 0x0000, 0x0008, 0xF640, 0xFF27, 0xFFAD, 0xFF49, 0xFEE2, 0xFEE1, 0xFF42, 0xFEE1, 0x8003,
+    0x0000, 0x0004, 0xF79E, 0xFFFF, 0xF79E, 0xEF7D, 0x800B, 0xF79E, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xF7BE, 0xEF5D, 0x8011, 0x0000,
+    0x000E, 0xFEA0, 0xFF27, 0xFFAC, 0xFF47, 0xFEE2, 0xFEE2, 0xFF42, 0xFEE2, 0xFF42, 0x0000, 0xEF5D, 0xF79E, 0xFFDF, 0xEF7D, 0x800D,
+    0xF79E, 0x0004, 0xEF7D, 0xF7BE, 0xFFFF, 0xEF7D, 0x800B, 0x0000, 0x0002, 0xFEE0, 0xFD40, 0x8004, 0x0000, 0x0004, 0xFDE0, 0xFF26,
+    0xFFAB, 0xFF26, 0x8003, 0xFEE1, 0x0005, 0xFF41, 0xFEC0, 0x0000, 0xEF7E, 0xFFFF, 0x8011, 0xF79E, 0x0003, 0xFFFF, 0xEF7D, 0xE71C,
+    0x800A, 0x0000, 0x0012, 0xFEE2, 0xFF27, 0xFEC0, 0xFDA0, 0xFEE2, 0xFF41, 0xF800, 0xFF26, 0xFFC9, 0xFF24, 0xFF05, 0xFF2A, 0xFF2D,
+    0xFF6D, 0xFF2A, 0xF6EA, 0xF79E, 0xFFDF, 0x8011, 0xF79E, 0x0003, 0xF7BE, 0xF79E, 0xEF5D, 0x800A, 0x0000, 0x0010, 0xFF05, 0xFFED,
+    0xFF49, 0xFF68, 0xFF04, 0xFEE1, 0x0000, 0xFF03, 0xFF87, 0xFF71, 0xF79B, 0xFFDF, 0xFFDF, 0xF7DF, 0xFFFF, 0xF77B, 0x8014, 0xF79E,
+    0x0002, 0xFFDF, 0xEF7D, 0x8009, 0x0000, 0x000D, 0xFEE3, 0xFF28, 0xFFAC, 0xFFAA, 0xFFE6, 0xFF02, 0x0000, 0x0000, 0xFEA5, 0xF755,
+    0xFFFF, 0xFFFF, 0xF7BE, 0x8003, 0xF79E, 0x0003, 0xFFDF, 0xF79E, 0xF79D, 0x8012, 0xF79E, 0x0003, 0xFFDF, 0xF79E, 0xEF7D, 0x8007,
+    0x0000, 0x000E, 0xFEE1, 0xFF26, 0xFFE9, 0xFF46, 0xFF03, 0xFF62, 0xFEE1, 0xFF00, 0x0000, 0xEF7E, 0xFFDF, 0xFFDF, 0xF79E, 0xEF7D,
+    0x8019, 0xF79E, 0x0004, 0xFFFF, 0xF79E, 0xEF7D, 0xFFFF, 0x8005, 0x0000, 0x000D, 0xFEE2, 0xFF04, 0xFF23, 0xFF03, 0xFF23, 0xFEE3,
+    0xFF43, 0xFF02, 0xBDFF, 0xF79E, 0xFFFF, 0xF79E, 0xEF7D, 0x801B, 0xF79E, 0x0004, 0xFFDF, 0xFFFF, 0xEF7D, 0xFFFF, 0x8006, 0x0000,
+    0x000A, 0xFFE0, 0xFF04, 0xFF24, 0xFEE0, 0xFF20, 0xFEE0, 0xEF5E, 0xF79E, 0xFFDF, 0xEF7D, 0x801D, 0xF79E, 0x0003, 0xF7BE, 0xFFFF,
+    0xEF7D, 0x8007, 0x0000, 0x0008, 0xFF4C, 0xFF73, 0xEF9F, 0xF79F, 0xEF7F, 0xEF7D, 0xF79E, 0xF7BE, 0x801F, 0xF79E, 0x0003, 0xFFDF,
+    0xF79E, 0xF79E, 0x8004, 0x0000, 0x0009, 0xF79E, 0xF7BE, 0xF7BF, 0xF7BF, 0xFFDF, 0xFFDF, 0xF7BE, 0xEF7D, 0xEF7D, 0x8021, 0xF79E,
+    0x0002, 0xFFFF, 0xF79E, 0x8003, 0x0000, 0x0004, 0xF7BE, 0xEF7D, 0xFFFF, 0xF7BE, 0x8004, 0xF79E, 0x0001, 0xF7BE, 0x8022, 0xF79E,
+    0x0007, 0xFFDF, 0xEF7D, 0xFFFF, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0x8029, 0xF79E, 0x0007, 0xF7BE, 0xEF7D, 0xF79E, 0x0000, 0xF79E,
+    0xEF7D, 0xF7BE, 0x8020, 0xF79E, 0x0002, 0xEF7E, 0xE75E, 0x8007, 0xF79E, 0x0006, 0xF7BE, 0xEF7D, 0xF79E, 0x0000, 0xF79E, 0xFFFF,
+    0x8020, 0xF79E, 0x0004, 0xFF9D, 0xBEFE, 0x55BF, 0xE77E, 0x8006, 0xF79E, 0x0006, 0xF7BE, 0xEF7D, 0xF79E, 0x0000, 0xF79E, 0xFFFF,
+    0x8016, 0xF79E, 0x0003, 0xE77E, 0x7E1F, 0xDF3E, 0x8007, 0xF79E, 0x0005, 0xEF7E, 0x765F, 0x257F, 0x9E9E, 0xFFBD, 0x8005, 0xF79E,
+    0x0006, 0xFFDF, 0xEF7D, 0xFFFF, 0x0000, 0xF79E, 0xFFFF, 0x8015, 0xF79E, 0x0005, 0xFF9D, 0xB6FE, 0x2D9F, 0x8E7F, 0xFFBD, 0x8005,
+    0xF79E, 0x0007, 0xF79D, 0xBF3E, 0x76DF, 0x6E9F, 0x55FF, 0xD73E, 0xF79D, 0x8003, 0xF79E, 0x0007, 0xEF7D, 0xFFFF, 0xEF7D, 0x0000,
+    0x0000, 0xEF5D, 0xFFFF, 0x8014, 0xEF7D, 0x0007, 0xF77D, 0xDF5E, 0x8F1F, 0x76FF, 0x561F, 0xC71E, 0xF79D, 0x8003, 0xEF7D, 0x0008,
+    0xF77D, 0xE75D, 0x8EFF, 0x9F9F, 0x8F3F, 0x45FF, 0x865E, 0xF79D, 0x8003, 0xEF7D, 0x0008, 0xF79E, 0xF79E, 0xE73C, 0x0000, 0x0000,
+    0xE73C, 0xEF5D, 0xF79E, 0x8013, 0xEF5D, 0x0007, 0xF75D, 0xB6FE, 0x7F1F, 0x975F, 0x3DDF, 0x8E5E, 0xF77D, 0x8004, 0xEF5D, 0x0007,
+    0xDF3D, 0x667F, 0x7EFF, 0x76BF, 0x35BF, 0x65DF, 0xF77D, 0x8003, 0xEF5D, 0x0003, 0xFFDF, 0xDEFB, 0x7BEF, 0x8003, 0x0000, 0x0003,
+    0xDEFB, 0xF7BE, 0xEF5D, 0x8012, 0xE73C, 0x0017, 0xEF5C, 0xC6FD, 0x5E3F, 0x4E1F, 0x2D7F, 0xA67D, 0xF75C, 0xEF3C, 0xEF3C, 0xE73C,
+    0xE73C, 0xEF3C, 0x967E, 0x45FF, 0x3DBF, 0x3D7F, 0xB69D, 0xEF5C, 0xE73C, 0xEF5D, 0xF79E, 0xDEDB, 0xCE79, 0x8004, 0x0000, 0x0005,
+    0xDEDB, 0xDEFB, 0xEF5D, 0xEF5D, 0xE73C, 0x8012, 0xE71C, 0x0007, 0xAE9D, 0x861D, 0xA67D, 0xE71C, 0xEF3B, 0xC6BC, 0x7DFD, 0x8004,
+    0xE71C, 0x0009, 0xB69D, 0x9E5D, 0xC6BC, 0xEF3C, 0xE71C, 0xE73C, 0xE71C, 0xD69A, 0xCE59, 0x8006, 0x0000, 0x0004, 0xBDF7, 0xD69A,
+    0xD6BA, 0xD6BA, 0x8005, 0xE73C, 0x800D, 0xE71C, 0x8003, 0xEF3C, 0x0010, 0xE71C, 0xDEDA, 0x6DDD, 0x151F, 0xA63B, 0xEF1B, 0xE71C,
+    0xE71C, 0xEF1B, 0xEF1B, 0xE71B, 0xDEDB, 0xCE79, 0xCE79, 0xCE59, 0x9CF3, 0x8009, 0x0000, 0x8003, 0xCE79, 0x800B, 0xCE59, 0x8009,
+    0xC638, 0x0007, 0xCE38, 0x963C, 0x565F, 0x45FF, 0x4D9E, 0xB619, 0xC618, 0x8006, 0xC638, 0x0001, 0xBDF7, 0x8023, 0x0000, 0x0005,
+    0x6EBF, 0x873F, 0x76BF, 0x4E3F, 0x155F, 0x802A, 0x0000, 0x0007, 0x6E9F, 0x977F, 0xA7BF, 0x8F3F, 0x669F, 0x359F, 0x14DF, 0x8029,
+    0x0000, 0x0007, 0x667F, 0x8F9F, 0x9F7F, 0x871F, 0x5E5F, 0x359F, 0x14FF, 0x8029, 0x0000, 0x0007, 0x4E1F, 0x6EFF, 0x6EBF, 0x667F,
+    0x4E1F, 0x251F, 0x0CDF, 0x8029, 0x0000, 0x0007, 0x3DBF, 0x45BF, 0x463F, 0x3DFF, 0x257F, 0x14FF, 0x03FF, 0x802A, 0x0000, 0x0004,
+    0x1CFF, 0x253F, 0x1D1F, 0x14BF, 0x80CF, 0x0000,
+};
+
+// 1766 bytes, 4608 raw
+const uint16_t icon_10d_rle[883] PROGMEM = {
+    0x80A1, 0x0000, 0x0009, 0xEF7D, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xEF7D, 0xDEDB, 0x8025, 0x0000, 0x0003, 0xDEFB,
+    0xF79E, 0xFFDF, 0x8007, 0xFFFF, 0x0002, 0xF7BE, 0xEF5D, 0x8023, 0x0000, 0x000E, 0xEF5D, 0xF7BE, 0xFFFF, 0xFFFF, 0xF79E, 0xF79E,
+    0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF7BE, 0xFFFF, 0xF7BE, 0xF79E, 0x8021, 0x0000, 0x0005, 0xE73C, 0xF7BE, 0xFFFF, 0xF7BE, 0xEF7D,
+    0x8006, 0xF79E, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xFFDF, 0xEF7D, 0x801F, 0x0000, 0x0005, 0xAD55, 0xF79E, 0xFFFF, 0xF79E, 0xEF7D,
+    0x800A, 0xF79E, 0x0003, 0xFFFF, 0xF79E, 0xEF7D, 0x801E, 0x0000, 0x0004, 0xEF5D, 0xF7BE, 0xFFDF, 0xEF7D, 0x800C, 0xF79E, 0x0002,
+    0xFFFF, 0xEF7D, 0x801E, 0x0000, 0x0002, 0xF79E, 0xFFFF, 0x800E, 0xF79E, 0x0006, 0xFFFF, 0xF79E, 0x0000, 0x0000, 0xE73C, 0xD6BA,
+    0x801A, 0x0000, 0x0002, 0xF79E, 0xFFFF, 0x800E, 0xF79E, 0x0001, 0xF7BE, 0x8003, 0xF79E, 0x0004, 0xF7BE, 0xFFDF, 0xF79E, 0xEF7D,
+    0x8017, 0x0000, 0x0003, 0xF79E, 0xEF7D, 0xFFDF, 0x8010, 0xF79E, 0x0001, 0xFFDF, 0x8004, 0xFFFF, 0x0002, 0xF7BE, 0xEF7D, 0x8014,
+    0x0000, 0x0004, 0xCE79, 0xEF7D, 0xF7BE, 0xF7BE, 0x8013, 0xF79E, 0x0006, 0xEF7D, 0xEF7D, 0xF79E, 0xFFFF, 0xF7BE, 0xEF5D, 0x8013,
+    0x0000, 0x0003, 0xEF7D, 0xFFFF, 0xFFDF, 0x8016, 0xF79E, 0x0004, 0xEF7D, 0xF79E, 0xFFFF, 0xF7BE, 0x8012, 0x0000, 0x0003, 0xEF7D,
+    0xFFFF, 0xF7BE, 0x8018, 0xF79E, 0x0007, 0xEF7D, 0xFFFF, 0xF7BE, 0x0000, 0xBDF7, 0xF79E, 0xFFFF, 0x800D, 0x0000, 0x0003, 0xF79E,
+    0xEF7D, 0xFFDF, 0x801A, 0xF79E, 0x0001, 0xF7BE, 0x8005, 0xF79E, 0x0002, 0xF7BE, 0xEF7D, 0x800B, 0x0000, 0x0002, 0xEF7D, 0xF7BE,
+    0x801D, 0xF79E, 0x0007, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0x800A, 0x0000, 0x0002, 0xEF7D, 0xFFFF, 0x8022,
+    0xF79E, 0x0003, 0xFFFF, 0xF79E, 0xEF7D, 0x8009, 0x0000, 0x0002, 0xF79E, 0xFFFF, 0x8023, 0xF79E, 0x0002, 0xFFFF, 0xF79E, 0x8009,
+    0x0000, 0x0002, 0xEF7D, 0xFFFF, 0x8003, 0xF79E, 0x0001, 0xEF9F, 0x8003, 0xEFBF, 0x8004, 0xF79E, 0x0002, 0xE73C, 0xEF5D, 0x8016,
+    0xF79E, 0x0002, 0xFFFF, 0xEF7D, 0x8009, 0x0000, 0x000F, 0xF79E, 0xF7BF, 0xF7BF, 0xF79E, 0xF75A, 0xF718, 0xF6F5, 0xF6D5, 0xF6F7,
+    0xF73A, 0xF79E, 0xF7BF, 0xEF7E, 0xD6BB, 0xEF5D, 0x8016, 0xF79E, 0x0002, 0xFFFF, 0xF79E, 0x8009, 0x0000, 0x0010, 0xDF9F, 0xEF18,
+    0xFF11, 0xFE48, 0xFDE4, 0xFDC2, 0xFD81, 0xFD61, 0xFD42, 0xFD44, 0xFD87, 0xFE2D, 0xE653, 0xD6BA, 0xF7BF, 0xEF7E, 0x8015, 0xEF7D,
+    0x0002, 0xFFFF, 0xEF7D, 0x8008, 0x0000, 0x0008, 0xFE63, 0xFE62, 0xFE41, 0xFE20, 0xFDE0, 0xFDC0, 0xFDA0, 0xFD81, 0x8004, 0xFD60,
+    0x0006, 0xFD40, 0xFD40, 0xFDC7, 0xF6B4, 0xEF7E, 0xEF7E, 0x8012, 0xEF5D, 0x0004, 0xEF7D, 0xEF7D, 0xFFDF, 0xE73C, 0x8007, 0x0000,
+    0x0014, 0xFEA2, 0xFEA1, 0xFEC1, 0xFE41, 0xFE21, 0xFE01, 0xFDE1, 0xFDC1, 0xFDE1, 0xFE00, 0xFE20, 0xFE00, 0xFDE0, 0xFDC1, 0xFDC1,
+    0xFDA0, 0xFD81, 0xF62D, 0xE73C, 0xE75D, 0x8011, 0xE73C, 0x0004, 0xEF5D, 0xF7BE, 0xDEFB, 0xD6BA, 0x8005, 0x0000, 0x0018, 0xFFFF,
+    0xFEC2, 0xFEC1, 0xFEC1, 0xFE61, 0xFE41, 0xFE41, 0xFE01, 0xFE01, 0xFE60, 0xFEA0, 0xFE80, 0xFE60, 0xFE20, 0xFE00, 0xFE01, 0xFE22,
+    0xFE02, 0xFDE1, 0xFD80, 0xF609, 0xE6DA, 0xDEFC, 0xE71B, 0x8004, 0xE73C, 0x0002, 0xDEFB, 0xDEFB, 0x8003, 0xE73C, 0x0009, 0xE71C,
+    0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xDEDB, 0xD69A, 0x8005, 0x0000, 0x001E, 0xFEA5, 0xFEE2, 0xFF41, 0xFF41, 0xFEA1,
+    0xFE81, 0xFE61, 0xFE41, 0xFE41, 0xFEC0, 0xFEE0, 0xFEC0, 0xFEA0, 0xFE60, 0xFE40, 0xFE41, 0xFE82, 0xFE62, 0xFE62, 0xFE42, 0xFDE2,
+    0xFDA0, 0xF609, 0xD69A, 0xCE7A, 0xCE79, 0xCE59, 0xCE79, 0xCE59, 0xD6BA, 0x8005, 0xCE79, 0x0001, 0xD6BA, 0x8003, 0xCE79, 0x0003,
+    0xD69A, 0xCE79, 0xBDD7, 0x8006, 0x0000, 0x0028, 0xFF06, 0xFEE3, 0xFEE1, 0xFEA1, 0xFEA1, 0xFEC1, 0xFE61, 0xFE61, 0xFEE0, 0xFF20,
+    0xFF00, 0xFEE0, 0xFEC0, 0xFEA0, 0xFE60, 0xFEA1, 0xFEC3, 0xFEA3, 0xFEA2, 0xFE82, 0xFE42, 0xFDE2, 0xFDE0, 0xF68E, 0xCE9B, 0xBE59,
+    0x9CD3, 0xB5B6, 0xBDD7, 0xCE79, 0xDEFB, 0xCE59, 0x0000, 0xB5B6, 0xCE79, 0xDEDB, 0xD69A, 0xBDF7, 0xB5B6, 0x7BEF, 0x8008, 0x0000,
+    0x0001, 0xFF07, 0x8003, 0x0000, 0x8003, 0xFEA1, 0x0013, 0xFEE0, 0xFF40, 0xFF20, 0xFF00, 0xFF00, 0xFEE0, 0xFEA0, 0xFEA0, 0xFF03,
+    0xFF03, 0xFEE3, 0xFEE3, 0xFEC3, 0xFE82, 0xFE02, 0xFE22, 0xFE43, 0xEEF6, 0xCE9C, 0x8003, 0x0000, 0x0009, 0xD6BA, 0xDEDB, 0xDEDB,
+    0xCE79, 0x0000, 0x0000, 0xCE79, 0xEF5D, 0xD69A, 0x800F, 0x0000, 0x0016, 0xFE81, 0xFF01, 0xFFC0, 0xFFE0, 0xFFC0, 0xFF60, 0xFF00,
+    0xFEE0, 0xFEC0, 0xFF01, 0xFF63, 0xFF43, 0xFF23, 0xFF23, 0xFF03, 0xFEE3, 0xFE42, 0xFE43, 0xFE41, 0xF68A, 0xDEDB, 0xD69A, 0x8003,
+    0x0000, 0x0009, 0xD69A, 0xE71C, 0xD6BA, 0xD69A, 0x0000, 0xCE79, 0xD69A, 0xE71C, 0xCE79, 0x800E, 0x0000, 0x0003, 0xFEA1, 0xFF00,
+    0xFF80, 0x8003, 0xFF40, 0x0011, 0xFF80, 0xFF00, 0xFF00, 0xFF63, 0xFF84, 0xFF63, 0xFF63, 0xFF43, 0xFF43, 0xFF03, 0xFE63, 0xFE63,
+    0xFE62, 0xFE83, 0xE6D7, 0xD69B, 0xCE59, 0x8003, 0x0000, 0x0009, 0xCE79, 0xEF5D, 0xD69A, 0x0000, 0x0000, 0xCE79, 0xDEDB, 0xD6BA,
+    0xD6BA, 0x800E, 0x0000, 0x000B, 0xFF60, 0xFEA0, 0x0000, 0x0000, 0xFF80, 0xFF60, 0xFF80, 0xFF41, 0xFFC4, 0xFFA4, 0xFFA4, 0x8003,
+    0xFF84, 0x0014, 0xFF23, 0xFE63, 0xFE83, 0xFE83, 0xFEA2, 0xEE8C, 0xD6BB, 0xD6BA, 0xD6BA, 0x0000, 0x0000, 0xB5B6, 0xD6BA, 0xE73C,
+    0xD69A, 0x0000, 0x0000, 0xCE79, 0xEF5D, 0xD69A, 0x8013, 0x0000, 0x0003, 0xFF20, 0xFF40, 0xFFE3, 0x8003, 0xFFE4, 0x000C, 0xFFC4,
+    0xFFA4, 0xFFA4, 0xFF23, 0xFE83, 0xFE83, 0xFEA3, 0xFF03, 0xFEC1, 0xCE7B, 0xEF5D, 0xCE79, 0x8003, 0x0000, 0x0009, 0xCE79, 0xDEDB,
+    0xDEDB, 0xD69A, 0x0000, 0xCE79, 0xD69A, 0xEF5D, 0xCE79, 0x8013, 0x0000, 0x0004, 0xEF2B, 0xFFE4, 0xFFC4, 0xFFC4, 0x8003, 0xFFE4,
+    0x000B, 0xFFC4, 0xFF03, 0xFE83, 0xFEA3, 0xFEC3, 0xFF44, 0xFEE3, 0xAEBF, 0xD69A, 0xE71C, 0xD69A, 0x8003, 0x0000, 0x0009, 0xCE79,
+    0xE71C, 0xD69A, 0xC638, 0x0000, 0xD6BA, 0xD6BA, 0xDEFB, 0xCE79, 0x8011, 0x0000, 0x0009, 0xD6BB, 0xD6BA, 0xD674, 0x0000, 0x0000,
+    0xFF22, 0xFFC4, 0xFFE4, 0xFFC4, 0x8004, 0xFEE3, 0x0007, 0xFF44, 0xFF03, 0x0000, 0xCE5B, 0xDEDB, 0xD6BA, 0xD69A, 0x8003, 0x0000,
+    0x0009, 0xCE79, 0xF79E, 0xD69A, 0xD6BA, 0x0000, 0xD69A, 0xEF5D, 0xD69A, 0xCE79, 0x800F, 0x0000, 0x0003, 0xBDF7, 0xDEDB, 0xD69A,
+    0x8005, 0x0000, 0x0011, 0xFFE4, 0xFFE4, 0xFEC3, 0xFEC3, 0xFEE3, 0xFF44, 0xFF64, 0xFF04, 0xFFE0, 0x0000, 0xCE79, 0xDEDB, 0xD69A,
+    0xCE79, 0x0000, 0x0000, 0xC638, 0x8003, 0xD69A, 0x0005, 0x0000, 0x0000, 0xD69A, 0xD6BA, 0xD69A, 0x800F, 0x0000, 0x0003, 0xD6BA,
+    0xD6BA, 0xD69A, 0x8005, 0x0000, 0x0008, 0xFFC4, 0xFF24, 0xFEC3, 0xFEC3, 0xFEE3, 0xFF03, 0xFFA4, 0xFF04, 0x8003, 0x0000, 0x0003,
+    0x9CD3, 0xD6BA, 0xFFFF, 0x8004, 0x0000, 0x0002, 0xD6BA, 0xCE79, 0x8003, 0x0000, 0x0002, 0xBDD7, 0xCE79, 0x800F, 0x0000, 0x0002,
+    0xD6BA, 0xD6BA, 0x8006, 0x0000, 0x0001, 0xF800, 0x8005, 0x0000, 0x0002, 0xFF04, 0xFF04, 0x801F, 0x0000, 0x0003, 0xCE59, 0xDEDB,
+    0xD6BA, 0x800C, 0x0000, 0x0003, 0xFF63, 0xFF24, 0xFFE0, 0x801E, 0x0000, 0x0002, 0xD6BA, 0xDEDB, 0x802D, 0x0000, 0x0003, 0xBEDF,
+    0xD6BB, 0xDEFB, 0x802D, 0x0000, 0x0003, 0xE633, 0xDEB9, 0xCE79, 0x802C, 0x0000, 0x0003, 0xFD21, 0xFDA3, 0xFDC5, 0x802D, 0x0000,
+    0x0003, 0xFD81, 0xFDE1, 0xFD80, 0x802D, 0x0000, 0x0007, 0xFDE2, 0xFE83, 0xFE22, 0x0000, 0x0000, 0xFF04, 0xFF04, 0x8029, 0x0000,
+    0x0007, 0xFE03, 0xFE83, 0xFEE3, 0xFEC3, 0xFF04, 0xFFC4, 0xFF04, 0x802A, 0x0000, 0x0006, 0xFE63, 0xFEE3, 0xFF04, 0xFF44, 0xFF44,
+    0xFF26, 0x8080, 0x0000,
+};
+
+// 1632 bytes, 4608 raw
+const uint16_t icon_11d_rle[816] PROGMEM = {
+    0x8129, 0x0000, 0x0005, 0xA534, 0xD6BA, 0xDEFB, 0xBDF7, 0x73AE, 0x8029, 0x0000, 0x0008, 0xB5B6, 0xDEFB, 0xE73C, 0xEF5D, 0xEF5D,
+    0xE71C, 0xE71C, 0xCE59, 0x8010, 0x0000, 0x0001, 0x52AA, 0x8003, 0x7BEF, 0x0001, 0x4A49, 0x8012, 0x0000, 0x000B, 0xB5B6, 0xE71C,
+    0xEF7D, 0xCE59, 0xBDF7, 0xBDF7, 0xC618, 0xD6BA, 0xEF5D, 0xCE79, 0xA534, 0x800C, 0x0000, 0x0003, 0xB5B6, 0xD6BA, 0xDEDB, 0x8003,
+    0xDEFB, 0x0003, 0xDEDB, 0xCE79, 0xB5B6, 0x800F, 0x0000, 0x0005, 0xBDD7, 0xDEFB, 0xDEDB, 0xB596, 0xB596, 0x8003, 0xB5B6, 0x0004,
+    0xB596, 0xBDF7, 0xE71C, 0xC638, 0x800A, 0x0000, 0x000D, 0x9CD3, 0xCE79, 0xEF5D, 0xFFDF, 0xEF7D, 0xE73C, 0xE71C, 0xE73C, 0xF79E,
+    0xFFFF, 0xE71C, 0xC638, 0x52AA, 0x800D, 0x0000, 0x0004, 0xCE59, 0xDEFB, 0xB596, 0xB596, 0x8005, 0xB5B6, 0x0004, 0xB596, 0xBDF7,
+    0xC638, 0xB5B6, 0x8008, 0x0000, 0x0006, 0xB596, 0xCE79, 0xF7BE, 0xDEFB, 0xC638, 0xC618, 0x8003, 0xBDF7, 0x0006, 0xC618, 0xCE79,
+    0xEF7D, 0xFFDF, 0xCE59, 0x7BEF, 0x800B, 0x0000, 0x0003, 0xA534, 0xC618, 0xBDF7, 0x8006, 0xB596, 0x0008, 0xB5B6, 0xB5B6, 0xB596,
+    0xC638, 0xBDD7, 0xB5B6, 0xBDD7, 0xB596, 0x8004, 0x0000, 0x0005, 0xA514, 0xCE59, 0xF79E, 0xCE79, 0xBDF7, 0x8006, 0xC618, 0x0005,
+    0xBDF7, 0xBDF7, 0xDEFB, 0xF7BE, 0xC638, 0x800B, 0x0000, 0x0002, 0xB596, 0xBDD7, 0x800A, 0xB596, 0x000D, 0xB5B6, 0xB596, 0xC618,
+    0xD6BA, 0xE71C, 0xD6BA, 0xA514, 0x0000, 0x0000, 0xBDF8, 0xE71C, 0xCE79, 0xBDF7, 0x8009, 0xC618, 0x0004, 0xBDF7, 0xE71C, 0xDEFB,
+    0xB5B6, 0x8009, 0x0000, 0x0003, 0xAD75, 0xB596, 0xB596, 0x800B, 0xAD75, 0x8003, 0xB5B6, 0x0008, 0xC618, 0xEF7D, 0xCE5A, 0x0000,
+    0x63FC, 0xC659, 0xD6BB, 0xBDF8, 0x8004, 0xBE18, 0x8008, 0xC618, 0x0003, 0xEF5D, 0xC638, 0xBDF7, 0x8007, 0x0000, 0x0003, 0xAD55,
+    0xB5B6, 0xB5B6, 0x800F, 0xAD75, 0x0007, 0xA535, 0xBDD7, 0xDED7, 0xFF51, 0xF712, 0xEF15, 0xE6D4, 0x8004, 0xE6B4, 0x0002, 0xE6D4,
+    0xD656, 0x8007, 0xC618, 0x0003, 0xD69A, 0xD69A, 0xBDD7, 0x8006, 0x0000, 0x0003, 0xA534, 0xAD55, 0xB596, 0x8009, 0xAD55, 0x8004,
+    0xAD75, 0x0008, 0xAD55, 0xAD55, 0xBDD7, 0xCE7A, 0xE6B5, 0xFF50, 0xFFD2, 0xFFB2, 0x8006, 0xFF70, 0x0003, 0xFF90, 0xE6D4, 0xBDF8,
+    0x8006, 0xC618, 0x0003, 0xC638, 0xD69A, 0xBDF7, 0x8006, 0x0000, 0x0002, 0xA534, 0xB5B6, 0x800F, 0xAD55, 0x0005, 0xC638, 0xEF7E,
+    0xF77B, 0xFF72, 0xFF50, 0x8007, 0xFF51, 0x0003, 0xFF50, 0xFF51, 0xCE56, 0x8008, 0xC618, 0x0003, 0xCE59, 0xC638, 0xAD55, 0x8005,
+    0x0000, 0x0002, 0xA534, 0xB5B6, 0x800C, 0xA534, 0x0007, 0xAD55, 0xA534, 0xBDD7, 0xEF7D, 0xD6BB, 0xE6D3, 0xFF50, 0x8008, 0xFF51,
+    0x0003, 0xFF70, 0xE6D4, 0xBE18, 0x8009, 0xC618, 0x0003, 0xC638, 0xC638, 0xBDF7, 0x8004, 0x0000, 0x0002, 0xA514, 0xB596, 0x800E,
+    0xA534, 0x0005, 0xDEDB, 0xDEDB, 0xCE36, 0xFF51, 0xFF50, 0x8007, 0xFF51, 0x0003, 0xFF50, 0xFF31, 0xCE37, 0x800A, 0xC618, 0x0004,
+    0xC638, 0xCE79, 0xC618, 0xBDF7, 0x8003, 0x0000, 0x0002, 0xA514, 0xAD55, 0x800A, 0xA514, 0x0007, 0xA534, 0xA534, 0xA514, 0xAD75,
+    0xD6BB, 0xC639, 0xEED2, 0x800A, 0xFF50, 0x0002, 0xE6B4, 0xBE18, 0x800C, 0xC618, 0x0008, 0xCE79, 0xC618, 0xC618, 0x0000, 0x0000,
+    0xAD75, 0xA534, 0xA534, 0x8003, 0x9CF3, 0x000C, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0xAD55, 0xBDD7, 0xBDF7, 0xC618, 0xBDF7, 0xBDF7,
+    0xC639, 0xD676, 0x800A, 0xFF50, 0x0002, 0xF711, 0xC637, 0x800E, 0xC618, 0x0002, 0xD69A, 0xC618, 0x8003, 0x0000, 0x0003, 0xA534,
+    0xAD55, 0xA534, 0x8005, 0x9CF3, 0x0003, 0xB596, 0xC618, 0xC638, 0x8005, 0xC618, 0x0002, 0xF6F2, 0xFF50, 0x8008, 0xFF30, 0x0003,
+    0xFF50, 0xDE95, 0xBE18, 0x800E, 0xC618, 0x0003, 0xCE59, 0xC618, 0xAD55, 0x8003, 0x0000, 0x0001, 0xA514, 0x8003, 0x9CF3, 0x0004,
+    0x9CD3, 0x94B2, 0xA534, 0xC638, 0x8005, 0xC618, 0x0003, 0xBE18, 0xDE75, 0xFF2F, 0x8008, 0xFF30, 0x0004, 0xFF2F, 0xF6F2, 0xC618,
+    0xBE18, 0x800E, 0xC618, 0x0003, 0xC638, 0xC618, 0xCE79, 0x8004, 0x0000, 0x0007, 0x9492, 0x9CD3, 0x9CD3, 0x94B2, 0x9CD3, 0xBDF7,
+    0xCE59, 0x8005, 0xC618, 0x0003, 0xC637, 0xF6F1, 0xFF2F, 0x8008, 0xFF0F, 0x0004, 0xFF2F, 0xDE94, 0xCE37, 0xCE57, 0x800E, 0xC618,
+    0x0003, 0xC638, 0xC618, 0xBDD7, 0x8008, 0x0000, 0x0003, 0xD6BA, 0xC618, 0xCE59, 0x8004, 0xC618, 0x0002, 0xBE18, 0xDE94, 0x8008,
+    0xFF0F, 0x8003, 0xFF10, 0x0004, 0xFEF0, 0xFEEE, 0xFECA, 0xDE6F, 0x800D, 0xC618, 0x0003, 0xC638, 0xC618, 0xC618, 0x8008, 0x0000,
+    0x0003, 0xC618, 0xC618, 0xC638, 0x8004, 0xC618, 0x0005, 0xCE37, 0xFEF0, 0xFF0F, 0xFF10, 0xFF0F, 0x8003, 0xFEEF, 0x000A, 0xFEEE,
+    0xFEEE, 0xFEED, 0xFECA, 0xFEA8, 0xFEA5, 0xFE82, 0xFE80, 0xE64C, 0xBE19, 0x800C, 0xC618, 0x0003, 0xCE59, 0xC618, 0xD6BA, 0x8008,
+    0x0000, 0x0003, 0xBDF7, 0xBDF7, 0xC638, 0x8003, 0xC618, 0x000C, 0xBE19, 0xDE51, 0xFEA5, 0xFEA6, 0xFEA8, 0xFEA7, 0xFEA6, 0xFEA7,
+    0xFE86, 0xFE84, 0xFE82, 0xFE61, 0x8004, 0xFE60, 0x0003, 0xF664, 0xC616, 0xBE18, 0x800C, 0xC618, 0x0002, 0xCE79, 0xBDD7, 0x8009,
+    0x0000, 0x0003, 0xBDF7, 0xBDD7, 0xCE59, 0x8003, 0xBDF7, 0x0002, 0xBDF8, 0xC5F4, 0x8004, 0xDE0B, 0x0004, 0xDE0C, 0xF644, 0xFE60,
+    0xFE40, 0x8003, 0xFE60, 0x0005, 0xFE61, 0xFE60, 0xFE60, 0xD60E, 0xBDD9, 0x800C, 0xBDF7, 0x0003, 0xC638, 0xB5B6, 0xA534, 0x800A,
+    0x0000, 0x0003, 0xAD75, 0xB5B6, 0xBDF7, 0x8003, 0xBDD7, 0x0001, 0xB5D7, 0x8003, 0xB5D8, 0x0004, 0xB5B9, 0xBDD4, 0xF643, 0xFE40,
+    0x8005, 0xFE41, 0x0005, 0xFE40, 0xF625, 0xBDD6, 0xB5B7, 0xBDD7, 0x8008, 0xB5B6, 0x0005, 0xBDD7, 0xBDD7, 0xBDF7, 0xB596, 0xA534,
+    0x800C, 0x0000, 0x0002, 0xA534, 0xAD75, 0x8007, 0xB5B6, 0x0003, 0xAD97, 0xDDEA, 0xFE40, 0x8006, 0xFE21, 0x0003, 0xFE61, 0xCDEF,
+    0xAD97, 0x800B, 0xB596, 0x0003, 0xAD75, 0xA534, 0x9CF3, 0x800E, 0x0000, 0x0002, 0x9CF3, 0xA514, 0x8005, 0x9CF3, 0x0003, 0x94D4,
+    0xB52F, 0xFE22, 0x8006, 0xFE21, 0x0004, 0xFE40, 0xE5E5, 0x9CD3, 0x94D3, 0x8008, 0x9CD3, 0x0001, 0x94B2, 0x8003, 0x9CD3, 0x0001,
+    0x8430, 0x8012, 0x0000, 0x0001, 0x9492, 0x8003, 0x8C71, 0x0003, 0x5B79, 0xF5E2, 0xFE61, 0x8005, 0xFE01, 0x0006, 0xFE21, 0xFE21,
+    0xE5C4, 0x3B1F, 0x6BF9, 0x7C34, 0x8007, 0x8C71, 0x0002, 0x8C51, 0x52AA, 0x8019, 0x0000, 0x0001, 0xFE00, 0x8008, 0xFE01, 0x0005,
+    0xFDE1, 0xFDE1, 0xFE00, 0xFDE0, 0xFE60, 0x8022, 0x0000, 0x0005, 0xFDE1, 0xFE82, 0xFE62, 0xFE62, 0xFE42, 0x8005, 0xFDE1, 0x0004,
+    0xFE22, 0xFEA2, 0xFDE1, 0xFE01, 0x8022, 0x0000, 0x0007, 0xF5C2, 0xFDC1, 0xFDE2, 0xFDE2, 0xFDC2, 0xFDC1, 0xFDE2, 0x8003, 0xFDC2,
+    0x0003, 0xFE22, 0xFDC1, 0xF5C2, 0x8027, 0x0000, 0x0001, 0xFDA2, 0x8004, 0xFDC2, 0x0003, 0xFE22, 0xFDC1, 0xF5A2, 0x8028, 0x0000,
+    0x0007, 0xFDA2, 0xFDE2, 0xFDA2, 0xFDA2, 0xFE02, 0xFDC2, 0xFDC1, 0x8029, 0x0000, 0x0006, 0xFD82, 0xFDE2, 0xFDA2, 0xFDE2, 0xFD82,
+    0xFD42, 0x8029, 0x0000, 0x0006, 0xFD45, 0xFD62, 0xFDC2, 0xFDC2, 0xFD82, 0xE583, 0x802A, 0x0000, 0x0005, 0xF543, 0xFD42, 0xFDC3,
+    0xFD62, 0xFD43, 0x802B, 0x0000, 0x0004, 0xFD43, 0xFDA3, 0xFD22, 0xFCE3, 0x802C, 0x0000, 0x0002, 0xFD43, 0xFD43, 0x8139, 0x0000,
+};
+
+// 1632 bytes, 4608 raw
+const uint16_t icon_11n_rle[816] PROGMEM = {
+    0x8129, 0x0000, 0x0005, 0xA534, 0xD6BA, 0xDEFB, 0xBDF7, 0x73AE, 0x8029, 0x0000, 0x0008, 0xB5B6, 0xDEFB, 0xE73C, 0xEF5D, 0xEF5D,
+    0xE71C, 0xE71C, 0xCE59, 0x8010, 0x0000, 0x0001, 0x52AA, 0x8003, 0x7BEF, 0x0001, 0x4A49, 0x8012, 0x0000, 0x000B, 0xB5B6, 0xE71C,
+    0xEF7D, 0xCE59, 0xBDF7, 0xBDF7, 0xC618, 0xD6BA, 0xEF5D, 0xCE79, 0xA534, 0x800C, 0x0000, 0x0003, 0xB5B6, 0xD6BA, 0xDEDB, 0x8003,
+    0xDEFB, 0x0003, 0xDEDB, 0xCE79, 0xB5B6, 0x800F, 0x0000, 0x0005, 0xBDD7, 0xDEFB, 0xDEDB, 0xB596, 0xB596, 0x8003, 0xB5B6, 0x0004,
+    0xB596, 0xBDF7, 0xE71C, 0xC638, 0x800A, 0x0000, 0x000D, 0x9CD3, 0xCE79, 0xEF5D, 0xFFDF, 0xEF7D, 0xE73C, 0xE71C, 0xE73C, 0xF79E,
+    0xFFFF, 0xE71C, 0xC638, 0x52AA, 0x800D, 0x0000, 0x0004, 0xCE59, 0xDEFB, 0xB596, 0xB596, 0x8005, 0xB5B6, 0x0004, 0xB596, 0xBDF7,
+    0xC638, 0xB5B6, 0x8008, 0x0000, 0x0006, 0xB596, 0xCE79, 0xF7BE, 0xDEFB, 0xC638, 0xC618, 0x8003, 0xBDF7, 0x0006, 0xC618, 0xCE79,
+    0xEF7D, 0xFFDF, 0xCE59, 0x7BEF, 0x800B, 0x0000, 0x0003, 0xA534, 0xC618, 0xBDF7, 0x8006, 0xB596, 0x0008, 0xB5B6, 0xB5B6, 0xB596,
+    0xC638, 0xBDD7, 0xB5B6, 0xBDD7, 0xB596, 0x8004, 0x0000, 0x0005, 0xA514, 0xCE59, 0xF79E, 0xCE79, 0xBDF7, 0x8006, 0xC618, 0x0005,
+    0xBDF7, 0xBDF7, 0xDEFB, 0xF7BE, 0xC638, 0x800B, 0x0000, 0x0002, 0xB596, 0xBDD7, 0x800A, 0xB596, 0x000D, 0xB5B6, 0xB596, 0xC618,
+    0xD6BA, 0xE71C, 0xD6BA, 0xA514, 0x0000, 0x0000, 0xBDF8, 0xE71C, 0xCE79, 0xBDF7, 0x8009, 0xC618, 0x0004, 0xBDF7, 0xE71C, 0xDEFB,
+    0xB5B6, 0x8009, 0x0000, 0x0003, 0xAD75, 0xB596, 0xB596, 0x800B, 0xAD75, 0x8003, 0xB5B6, 0x0008, 0xC618, 0xEF7D, 0xCE5A, 0x0000,
+    0x63FC, 0xC659, 0xD6BB, 0xBDF8, 0x8004, 0xBE18, 0x8008, 0xC618, 0x0003, 0xEF5D, 0xC638, 0xBDF7, 0x8007, 0x0000, 0x0003, 0xAD55,
+    0xB5B6, 0xB5B6, 0x800F, 0xAD75, 0x0007, 0xA535, 0xBDD7, 0xDED7, 0xFF51, 0xF712, 0xEF15, 0xE6D4, 0x8004, 0xE6B4, 0x0002, 0xE6D4,
+    0xD656, 0x8007, 0xC618, 0x0003, 0xD69A, 0xD69A, 0xBDD7, 0x8006, 0x0000, 0x0003, 0xA534, 0xAD55, 0xB596, 0x8009, 0xAD55, 0x8004,
+    0xAD75, 0x0008, 0xAD55, 0xAD55, 0xBDD7, 0xCE7A, 0xE6B5, 0xFF50, 0xFFD2, 0xFFB2, 0x8006, 0xFF70, 0x0003, 0xFF90, 0xE6D4, 0xBDF8,
+    0x8006, 0xC618, 0x0003, 0xC638, 0xD69A, 0xBDF7, 0x8006, 0x0000, 0x0002, 0xA534, 0xB5B6, 0x800F, 0xAD55, 0x0005, 0xC638, 0xEF7E,
+    0xF77B, 0xFF72, 0xFF50, 0x8007, 0xFF51, 0x0003, 0xFF50, 0xFF51, 0xCE56, 0x8008, 0xC618, 0x0003, 0xCE59, 0xC638, 0xAD55, 0x8005,
+    0x0000, 0x0002, 0xA534, 0xB5B6, 0x800C, 0xA534, 0x0007, 0xAD55, 0xA534, 0xBDD7, 0xEF7D, 0xD6BB, 0xE6D3, 0xFF50, 0x8008, 0xFF51,
+    0x0003, 0xFF70, 0xE6D4, 0xBE18, 0x8009, 0xC618, 0x0003, 0xC638, 0xC638, 0xBDF7, 0x8004, 0x0000, 0x0002, 0xA514, 0xB596, 0x800E,
+    0xA534, 0x0005, 0xDEDB, 0xDEDB, 0xCE36, 0xFF51, 0xFF50, 0x8007, 0xFF51, 0x0003, 0xFF50, 0xFF31, 0xCE37, 0x800A, 0xC618, 0x0004,
+    0xC638, 0xCE79, 0xC618, 0xBDF7, 0x8003, 0x0000, 0x0002, 0xA514, 0xAD55, 0x800A, 0xA514, 0x0007, 0xA534, 0xA534, 0xA514, 0xAD75,
+    0xD6BB, 0xC639, 0xEED2, 0x800A, 0xFF50, 0x0002, 0xE6B4, 0xBE18, 0x800C, 0xC618, 0x0008, 0xCE79, 0xC618, 0xC618, 0x0000, 0x0000,
+    0xAD75, 0xA534, 0xA534, 0x8003, 0x9CF3, 0x000C, 0xA514, 0xA514, 0x9CF3, 0x9CF3, 0xAD55, 0xBDD7, 0xBDF7, 0xC618, 0xBDF7, 0xBDF7,
+    0xC639, 0xD676, 0x800A, 0xFF50, 0x0002, 0xF711, 0xC637, 0x800E, 0xC618, 0x0002, 0xD69A, 0xC618, 0x8003, 0x0000, 0x0003, 0xA534,
+    0xAD55, 0xA534, 0x8005, 0x9CF3, 0x0003, 0xB596, 0xC618, 0xC638, 0x8005, 0xC618, 0x0002, 0xF6F2, 0xFF50, 0x8008, 0xFF30, 0x0003,
+    0xFF50, 0xDE95, 0xBE18, 0x800E, 0xC618, 0x0003, 0xCE59, 0xC618, 0xAD55, 0x8003, 0x0000, 0x0001, 0xA514, 0x8003, 0x9CF3, 0x0004,
+    0x9CD3, 0x94B2, 0xA534, 0xC638, 0x8005, 0xC618, 0x0003, 0xBE18, 0xDE75, 0xFF2F, 0x8008, 0xFF30, 0x0004, 0xFF2F, 0xF6F2, 0xC618,
+    0xBE18, 0x800E, 0xC618, 0x0003, 0xC638, 0xC618, 0xCE79, 0x8004, 0x0000, 0x0007, 0x9492, 0x9CD3, 0x9CD3, 0x94B2, 0x9CD3, 0xBDF7,
+    0xCE59, 0x8005, 0xC618, 0x0003, 0xC637, 0xF6F1, 0xFF2F, 0x8008, 0xFF0F, 0x0004, 0xFF2F, 0xDE94, 0xCE37, 0xCE57, 0x800E, 0xC618,
+    0x0003, 0xC638, 0xC618, 0xBDD7, 0x8008, 0x0000, 0x0003, 0xD6BA, 0xC618, 0xCE59, 0x8004, 0xC618, 0x0002, 0xBE18, 0xDE94, 0x8008,
+    0xFF0F, 0x8003, 0xFF10, 0x0004, 0xFEF0, 0xFEEE, 0xFECA, 0xDE6F, 0x800D, 0xC618, 0x0003, 0xC638, 0xC618, 0xC618, 0x8008, 0x0000,
+    0x0003, 0xC618, 0xC618, 0xC638, 0x8004, 0xC618, 0x0005, 0xCE37, 0xFEF0, 0xFF0F, 0xFF10, 0xFF0F, 0x8003, 0xFEEF, 0x000A, 0xFEEE,
+    0xFEEE, 0xFEED, 0xFECA, 0xFEA8, 0xFEA5, 0xFE82, 0xFE80, 0xE64C, 0xBE19, 0x800C, 0xC618, 0x0003, 0xCE59, 0xC618, 0xD6BA, 0x8008,
+    0x0000, 0x0003, 0xBDF7, 0xBDF7, 0xC638, 0x8003, 0xC618, 0x000C, 0xBE19, 0xDE51, 0xFEA5, 0xFEA6, 0xFEA8, 0xFEA7, 0xFEA6, 0xFEA7,
+    0xFE86, 0xFE84, 0xFE82, 0xFE61, 0x8004, 0xFE60, 0x0003, 0xF664, 0xC616, 0xBE18, 0x800C, 0xC618, 0x0002, 0xCE79, 0xBDD7, 0x8009,
+    0x0000, 0x0003, 0xBDF7, 0xBDD7, 0xCE59, 0x8003, 0xBDF7, 0x0002, 0xBDF8, 0xC5F4, 0x8004, 0xDE0B, 0x0004, 0xDE0C, 0xF644, 0xFE60,
+    0xFE40, 0x8003, 0xFE60, 0x0005, 0xFE61, 0xFE60, 0xFE60, 0xD60E, 0xBDD9, 0x800C, 0xBDF7, 0x0003, 0xC638, 0xB5B6, 0xA534, 0x800A,
+    0x0000, 0x0003, 0xAD75, 0xB5B6, 0xBDF7, 0x8003, 0xBDD7, 0x0001, 0xB5D7, 0x8003, 0xB5D8, 0x0004, 0xB5B9, 0xBDD4, 0xF643, 0xFE40,
+    0x8005, 0xFE41, 0x0005, 0xFE40, 0xF625, 0xBDD6, 0xB5B7, 0xBDD7, 0x8008, 0xB5B6, 0x0005, 0xBDD7, 0xBDD7, 0xBDF7, 0xB596, 0xA534,
+    0x800C, 0x0000, 0x0002, 0xA534, 0xAD75, 0x8007, 0xB5B6, 0x0003, 0xAD97, 0xDDEA, 0xFE40, 0x8006, 0xFE21, 0x0003, 0xFE61, 0xCDEF,
+    0xAD97, 0x800B, 0xB596, 0x0003, 0xAD75, 0xA534, 0x9CF3, 0x800E, 0x0000, 0x0002, 0x9CF3, 0xA514, 0x8005, 0x9CF3, 0x0003, 0x94D4,
+    0xB52F, 0xFE22, 0x8006, 0xFE21, 0x0004, 0xFE40, 0xE5E5, 0x9CD3, 0x94D3, 0x8008, 0x9CD3, 0x0001, 0x94B2, 0x8003, 0x9CD3, 0x0001,
+    0x8430, 0x8012, 0x0000, 0x0001, 0x9492, 0x8003, 0x8C71, 0x0003, 0x5B79, 0xF5E2, 0xFE61, 0x8005, 0xFE01, 0x0006, 0xFE21, 0xFE21,
+    0xE5C4, 0x3B1F, 0x6BF9, 0x7C34, 0x8007, 0x8C71, 0x0002, 0x8C51, 0x52AA, 0x8019, 0x0000, 0x0001, 0xFE00, 0x8008, 0xFE01, 0x0005,
+    0xFDE1, 0xFDE1, 0xFE00, 0xFDE0, 0xFE60, 0x8022, 0x0000, 0x0005, 0xFDE1, 0xFE82, 0xFE62, 0xFE62, 0xFE42, 0x8005, 0xFDE1, 0x0004,
+    0xFE22, 0xFEA2, 0xFDE1, 0xFE01, 0x8022, 0x0000, 0x0007, 0xF5C2, 0xFDC1, 0xFDE2, 0xFDE2, 0xFDC2, 0xFDC1, 0xFDE2, 0x8003, 0xFDC2,
+    0x0003, 0xFE22, 0xFDC1, 0xF5C2, 0x8027, 0x0000, 0x0001, 0xFDA2, 0x8004, 0xFDC2, 0x0003, 0xFE22, 0xFDC1, 0xF5A2, 0x8028, 0x0000,
+    0x0007, 0xFDA2, 0xFDE2, 0xFDA2, 0xFDA2, 0xFE02, 0xFDC2, 0xFDC1, 0x8029, 0x0000, 0x0006, 0xFD82, 0xFDE2, 0xFDA2, 0xFDE2, 0xFD82,
+    0xFD42, 0x8029, 0x0000, 0x0006, 0xFD45, 0xFD62, 0xFDC2, 0xFDC2, 0xFD82, 0xE583, 0x802A, 0x0000, 0x0005, 0xF543, 0xFD42, 0xFDC3,
+    0xFD62, 0xFD43, 0x802B, 0x0000, 0x0004, 0xFD43, 0xFDA3, 0xFD22, 0xFCE3, 0x802C, 0x0000, 0x0002, 0xFD43, 0xFD43, 0x8139, 0x0000,
+};
+
+// 2172 bytes, 4608 raw
+const uint16_t icon_13d_rle[1086] PROGMEM = {
+    0x8080, 0x0000, 0x0004, 0x3DFF, 0x4EDF, 0x573F, 0xFFFF, 0x802A, 0x0000, 0x0008, 0x57FF, 0x469F, 0x363F, 0x575F, 0x5F9F, 0x573F,
+    0x365F, 0x555F, 0x8028, 0x0000, 0x0008, 0x2DBF, 0x46BF, 0x46DF, 0x4EFF, 0x573F, 0x4EFF, 0x4EDF, 0x3EBF, 0x8026, 0x0000, 0x000C,
+    0x467F, 0x3E5F, 0x055F, 0x469F, 0x4F5F, 0x4EFF, 0x571F, 0x575F, 0x4EFF, 0x0000, 0x467F, 0x469F, 0x8021, 0x0000, 0x0012, 0x3E3F,
+    0x3E5F, 0x3E3F, 0x3E7F, 0x467F, 0x0000, 0x1CFF, 0x3E7F, 0x4F3F, 0x573F, 0x4EDF, 0x555F, 0x0000, 0x469F, 0x469F, 0x3E9F, 0x469F,
+    0x3DFF, 0x801E, 0x0000, 0x0012, 0x3E3F, 0x4F1F, 0x46BF, 0x3E7F, 0x469F, 0x35DF, 0x0000, 0x2DFF, 0x46BF, 0x4EFF, 0x46BF, 0x0000,
+    0x3E7F, 0x46BF, 0x469F, 0x46BF, 0x4F3F, 0x467F, 0x801E, 0x0000, 0x0012, 0x361F, 0x3E5F, 0x46DF, 0x46BF, 0x46DF, 0x3E5F, 0x2DDF,
+    0x2DDF, 0x3E7F, 0x46BF, 0x467F, 0x2E1F, 0x3E7F, 0x46FF, 0x46BF, 0x46BF, 0x469F, 0x3E3F, 0x801E, 0x0000, 0x0011, 0x2DBF, 0x2DFF,
+    0x363F, 0x46DF, 0x46BF, 0x46DF, 0x3E5F, 0x361F, 0x3E9F, 0x46BF, 0x3E5F, 0x3E3F, 0x46BF, 0x46BF, 0x46FF, 0x3E5F, 0x363F, 0x8011,
+    0x0000, 0x0002, 0x56FF, 0x5F1F, 0x800C, 0x0000, 0x0003, 0x2DDF, 0x361F, 0x363F, 0x8003, 0x361F, 0x000C, 0x3EBF, 0x3E5F, 0x363F,
+    0x361F, 0x3E7F, 0x3EBF, 0x363F, 0x361F, 0x363F, 0x367F, 0x363F, 0x3DFF, 0x800E, 0x0000, 0x0005, 0x67FF, 0x4EDF, 0x575F, 0x575F,
+    0x4EFF, 0x8010, 0x0000, 0x000C, 0x259F, 0x2E1F, 0x361F, 0x0000, 0x0000, 0x361F, 0x361F, 0x2DFF, 0x0000, 0x0000, 0x367F, 0x361F,
+    0x800D, 0x0000, 0x000A, 0x049F, 0x3E5F, 0x46BF, 0x4EFF, 0x579F, 0x579F, 0x4F1F, 0x467F, 0x469F, 0x2EBF, 0x8008, 0x0000, 0x0012,
+    0x2D5F, 0x259F, 0x259F, 0x155F, 0x257F, 0x2DDF, 0x363F, 0x2DDF, 0x25DF, 0x2DBF, 0x2DFF, 0x363F, 0x2DDF, 0x2DDF, 0x2DBF, 0x2DBF,
+    0x2D9F, 0x367F, 0x800B, 0x0000, 0x000C, 0x3E7F, 0x46BF, 0x46DF, 0x3E7F, 0x575F, 0x4EDF, 0x4EDF, 0x56FF, 0x469F, 0x46FF, 0x469F,
+    0x3E7F, 0x8007, 0x0000, 0x0007, 0x1D9F, 0x259F, 0x25BF, 0x2DBF, 0x2DBF, 0x2E3F, 0x2E3F, 0x8003, 0x2DBF, 0x0004, 0x2DDF, 0x2E3F,
+    0x2E3F, 0x2DBF, 0x8004, 0x2DDF, 0x800B, 0x0000, 0x000C, 0x35FF, 0x3E5F, 0x4F5F, 0x3E7F, 0x3E5F, 0x3E7F, 0x3E7F, 0x3E5F, 0x46DF,
+    0x4F3F, 0x3E7F, 0x367F, 0x8007, 0x0000, 0x0012, 0x151F, 0x257F, 0x25DF, 0x2DFF, 0x2DFF, 0x25BF, 0x259F, 0x259F, 0x25DF, 0x2DDF,
+    0x259F, 0x259F, 0x25BF, 0x2DDF, 0x2DFF, 0x25BF, 0x25BF, 0x367F, 0x800B, 0x0000, 0x000C, 0x2DDF, 0x35FF, 0x3E3F, 0x363F, 0x3E5F,
+    0x363F, 0x3E3F, 0x3E7F, 0x3E5F, 0x3E3F, 0x361F, 0x07FF, 0x8007, 0x0000, 0x0012, 0x1D5F, 0x1D7F, 0x25FF, 0x259F, 0x25BF, 0x1D7F,
+    0x0000, 0x1D7F, 0x259F, 0x259F, 0x257F, 0x0000, 0x259F, 0x25DF, 0x25BF, 0x25DF, 0x25BF, 0x259F, 0x800B, 0x0000, 0x000C, 0x25BF,
+    0x2DFF, 0x001F, 0x259F, 0x2DFF, 0x2DBF, 0x2DDF, 0x35FF, 0x2DDF, 0x25BF, 0x2DFF, 0x03FF, 0x8007, 0x0000, 0x0001, 0x151F, 0x8004,
+    0x1D5F, 0x000D, 0x1D3F, 0x0000, 0x1D5F, 0x1D7F, 0x1D7F, 0x1D5F, 0x0000, 0x257F, 0x1D7F, 0x1D7F, 0x1D5F, 0x257F, 0x259F, 0x800B,
+    0x0000, 0x0002, 0x259F, 0x259F, 0x8003, 0x2DDF, 0x0007, 0x25BF, 0x2DBF, 0x2DBF, 0x2DDF, 0x2DFF, 0x2DDF, 0x2D5F, 0x8004, 0x0000,
+    0x0014, 0x3E3F, 0x4EDF, 0x4F3F, 0x3E7F, 0x14FF, 0x14BF, 0x153F, 0x1D3F, 0x0000, 0x555F, 0x1D3F, 0x1D7F, 0x1D7F, 0x153F, 0x07FF,
+    0x07FF, 0x1D5F, 0x1D5F, 0x2DDF, 0x253F, 0x800C, 0x0000, 0x0005, 0x1D5F, 0x25BF, 0x263F, 0x257F, 0x257F, 0x8004, 0x259F, 0x0003,
+    0x263F, 0x257F, 0x257F, 0x8004, 0x0000, 0x0012, 0x571F, 0x5FFF, 0x67FF, 0x4EFF, 0x0000, 0x0000, 0x04BF, 0x0D3F, 0x0000, 0x151F,
+    0x157F, 0x151F, 0x151F, 0x155F, 0x151F, 0x0000, 0x1D3F, 0x159F, 0x800E, 0x0000, 0x8003, 0x1D5F, 0x001A, 0x1D3F, 0x0CBF, 0x1D5F,
+    0x1D5F, 0x1CFF, 0x1D5F, 0x1D5F, 0x257F, 0x1D7F, 0x0000, 0x3E5F, 0x3E9F, 0x2DDF, 0x5F5F, 0x67FF, 0x5F9F, 0x56FF, 0x365F, 0x469F,
+    0x4EBF, 0x0000, 0x0D1F, 0x14FF, 0x151F, 0x14FF, 0x0CDF, 0x8003, 0x151F, 0x8012, 0x0000, 0x0008, 0x153F, 0x14BF, 0x151F, 0x157F,
+    0x159F, 0x14FF, 0x155F, 0x1D3F, 0x8003, 0x0000, 0x0013, 0x3E7F, 0x57BF, 0x3E7F, 0x571F, 0x5FBF, 0x575F, 0x4EFF, 0x469F, 0x57BF,
+    0x4EBF, 0x0000, 0x03FF, 0x14DF, 0x0CFF, 0x0CDF, 0x0CDF, 0x0CBF, 0x153F, 0x055F, 0x8013, 0x0000, 0x0005, 0x367F, 0x14FF, 0x0CFF,
+    0x0CFF, 0x151F, 0x8005, 0x0000, 0x000A, 0x363F, 0x4EDF, 0x4F1F, 0x4EBF, 0x573F, 0x573F, 0x46DF, 0x4EFF, 0x4F1F, 0x3E7F, 0x8004,
+    0x0000, 0x0002, 0x0CBF, 0x0CBF, 0x8018, 0x0000, 0x0011, 0x0C7F, 0x01DF, 0x0000, 0x0000, 0x3E5F, 0x469F, 0x363F, 0x0000, 0x0000,
+    0x3E5F, 0x4EFF, 0x573F, 0x4EFF, 0x4EFF, 0x4F1F, 0x575F, 0x467F, 0x8003, 0x0000, 0x0003, 0x465F, 0x46FF, 0x571F, 0x801A, 0x0000,
+    0x0006, 0x3E1F, 0x361F, 0x1D5F, 0x3E5F, 0x57BF, 0x3E5F, 0x8003, 0x0000, 0x0010, 0x467F, 0x4F1F, 0x4EFF, 0x4EFF, 0x4F3F, 0x469F,
+    0x03FF, 0x0000, 0x0000, 0x363F, 0x46DF, 0x4F1F, 0x361F, 0x3E7F, 0x3E7F, 0x3E3F, 0x8016, 0x0000, 0x0010, 0x361F, 0x46BF, 0x4F3F,
+    0x3E7F, 0x361F, 0x46BF, 0x3E7F, 0x2DBF, 0x0000, 0x0000, 0x03FF, 0x469F, 0x4F3F, 0x4EFF, 0x46BF, 0x35FF, 0x8003, 0x0000, 0x0007,
+    0x3E7F, 0x4F5F, 0x3E5F, 0x3E7F, 0x46DF, 0x4F3F, 0x3E9F, 0x8016, 0x0000, 0x0008, 0x361F, 0x4F5F, 0x4EDF, 0x4EFF, 0x469F, 0x3E7F,
+    0x46DF, 0x35FF, 0x8003, 0x0000, 0x000F, 0x46BF, 0x4F3F, 0x46DF, 0x3E7F, 0x2DFF, 0x0000, 0x0000, 0x3E3F, 0x46DF, 0x46BF, 0x469F,
+    0x4EFF, 0x46DF, 0x4F3F, 0x467F, 0x8016, 0x0000, 0x001A, 0x2DDF, 0x3E7F, 0x46DF, 0x46BF, 0x46BF, 0x469F, 0x46DF, 0x365F, 0x2DDF,
+    0x0000, 0x0000, 0x469F, 0x471F, 0x46DF, 0x3E5F, 0x2DFF, 0x0000, 0x2DDF, 0x3E5F, 0x46FF, 0x469F, 0x469F, 0x46BF, 0x46FF, 0x46BF,
+    0x3E5F, 0x8017, 0x0000, 0x0018, 0x1D3F, 0x361F, 0x3E5F, 0x3E7F, 0x3E9F, 0x3E7F, 0x46BF, 0x3E7F, 0x363F, 0x1CFF, 0x469F, 0x471F,
+    0x46BF, 0x3E5F, 0x1D5F, 0x361F, 0x3E5F, 0x46BF, 0x3E9F, 0x3E7F, 0x3E9F, 0x3E9F, 0x3E5F, 0x361F, 0x8017, 0x0000, 0x0004, 0x2DDF,
+    0x367F, 0x361F, 0x365F, 0x8003, 0x3EBF, 0x0013, 0x3E7F, 0x3E9F, 0x3EBF, 0x361F, 0x3E3F, 0x46DF, 0x3EBF, 0x365F, 0x361F, 0x3E7F,
+    0x3EBF, 0x3E7F, 0x3E9F, 0x3EBF, 0x3EBF, 0x363F, 0x361F, 0x35FF, 0x07FF, 0x8016, 0x0000, 0x0003, 0x2DDF, 0x365F, 0x363F, 0x8003,
+    0x361F, 0x0014, 0x363F, 0x3E9F, 0x3E7F, 0x3E5F, 0x3EBF, 0x361F, 0x2DDF, 0x35FF, 0x363F, 0x3EBF, 0x3E5F, 0x3E7F, 0x3E9F, 0x361F,
+    0x363F, 0x363F, 0x3E7F, 0x3EDF, 0x363F, 0x35DF, 0x8016, 0x0000, 0x001A, 0x055F, 0x14FF, 0x0CDF, 0x0CDF, 0x1D1F, 0x03FF, 0x25BF,
+    0x2DDF, 0x361F, 0x3E7F, 0x363F, 0x2DDF, 0x0000, 0x0000, 0x2DBF, 0x363F, 0x3E7F, 0x365F, 0x363F, 0x2DDF, 0x249F, 0x2DFF, 0x35FF,
+    0x363F, 0x361F, 0x3E3F, 0x801E, 0x0000, 0x0003, 0x255F, 0x2E1F, 0x2DDF, 0x8004, 0x0000, 0x0003, 0x2DFF, 0x363F, 0x2DBF, 0x8025,
+    0x0000, 0x000D, 0x25BF, 0x2DFF, 0x2E1F, 0x2DFF, 0x2DBF, 0x0000, 0x0000, 0x25BF, 0x2DFF, 0x361F, 0x2DFF, 0x2DDF, 0x25BF, 0x801C,
+    0x0000, 0x0002, 0x1D9F, 0x25BF, 0x8005, 0x259F, 0x000C, 0x2DFF, 0x363F, 0x2DFF, 0x2E3F, 0x2DBF, 0x2D9F, 0x25BF, 0x2DDF, 0x2E3F,
+    0x2DFF, 0x2E3F, 0x2E3F, 0x8005, 0x2DDF, 0x0002, 0x2DFF, 0x2DDF, 0x8016, 0x0000, 0x0003, 0x1D7F, 0x2E3F, 0x2DBF, 0x8003, 0x2DFF,
+    0x000D, 0x2E1F, 0x2DFF, 0x2DDF, 0x2E1F, 0x2DBF, 0x25BF, 0x2E1F, 0x2E1F, 0x2DDF, 0x25BF, 0x2E1F, 0x2DFF, 0x2DDF, 0x8004, 0x2E1F,
+    0x0003, 0x2DDF, 0x2E1F, 0x2DDF, 0x8016, 0x0000, 0x0013, 0x2D5F, 0x1D5F, 0x1D5F, 0x259F, 0x25BF, 0x2DBF, 0x2DBF, 0x2DDF, 0x25DF,
+    0x259F, 0x257F, 0x25BF, 0x2E3F, 0x2DDF, 0x259F, 0x1D9F, 0x25BF, 0x25BF, 0x2DFF, 0x8003, 0x25BF, 0x0004, 0x2DDF, 0x2DBF, 0x2DDF,
+    0x2DFF, 0x8016, 0x0000, 0x0014, 0x1D1F, 0x1D7F, 0x25BF, 0x25BF, 0x259F, 0x259F, 0x25BF, 0x259F, 0x257F, 0x249F, 0x0000, 0x259F,
+    0x261F, 0x25BF, 0x259F, 0x03FF, 0x0000, 0x259F, 0x259F, 0x25DF, 0x8003, 0x259F, 0x0003, 0x25BF, 0x25BF, 0x259F, 0x8016, 0x0000,
+    0x0008, 0x1D5F, 0x261F, 0x259F, 0x259F, 0x25BF, 0x257F, 0x25DF, 0x1D5F, 0x8003, 0x0000, 0x000F, 0x257F, 0x25FF, 0x25BF, 0x257F,
+    0x1D3F, 0x0000, 0x0000, 0x257F, 0x25BF, 0x259F, 0x25BF, 0x25BF, 0x257F, 0x25FF, 0x259F, 0x8016, 0x0000, 0x0008, 0x1D3F, 0x25DF,
+    0x25BF, 0x1D5F, 0x1D5F, 0x1D3F, 0x1D7F, 0x1D5F, 0x8003, 0x0000, 0x000F, 0x1D5F, 0x25DF, 0x1D9F, 0x1D5F, 0x151F, 0x0000, 0x0000,
+    0x2D7F, 0x1D5F, 0x1D7F, 0x257F, 0x1D7F, 0x25BF, 0x25FF, 0x257F, 0x8016, 0x0000, 0x000D, 0x155F, 0x1D1F, 0x1D5F, 0x1D3F, 0x153F,
+    0x1DBF, 0x1D3F, 0x03FF, 0x0000, 0x0000, 0x055F, 0x1D5F, 0x1D9F, 0x8003, 0x1D5F, 0x8003, 0x0000, 0x0007, 0x1D7F, 0x1DFF, 0x1D5F,
+    0x259F, 0x259F, 0x257F, 0x257F, 0x801A, 0x0000, 0x0003, 0x1D1F, 0x1D7F, 0x153F, 0x8003, 0x0000, 0x000C, 0x1D1F, 0x1D7F, 0x1D3F,
+    0x1D3F, 0x1D7F, 0x1D5F, 0x1D3F, 0x0000, 0x0000, 0x255F, 0x1D9F, 0x1D5F, 0x801E, 0x0000, 0x000D, 0x1D1F, 0x151F, 0x055F, 0x0000,
+    0x0000, 0x153F, 0x153F, 0x155F, 0x151F, 0x151F, 0x153F, 0x1D9F, 0x1D1F, 0x8003, 0x0000, 0x0002, 0x1D1F, 0x155F, 0x8022, 0x0000,
+    0x000A, 0x14FF, 0x151F, 0x153F, 0x151F, 0x151F, 0x14FF, 0x151F, 0x153F, 0x153F, 0x1D1F, 0x8026, 0x0000, 0x000A, 0x14FF, 0x153F,
+    0x14FF, 0x14DF, 0x153F, 0x14FF, 0x14FF, 0x151F, 0x155F, 0x151F, 0x8026, 0x0000, 0x000A, 0x14DF, 0x151F, 0x1CDF, 0x0CDF, 0x0D5F,
+    0x0D3F, 0x14DF, 0x1D5F, 0x151F, 0x151F, 0x8029, 0x0000, 0x0004, 0x14FF, 0x0CDF, 0x0CFF, 0x14FF, 0x8076, 0x0000,
+};
+
+// 1638 bytes, 4608 raw
+const uint16_t icon_13n_rle[819] PROGMEM = {
+    0x80D3, 0x0000, 0x0003, 0xE540, 0xFF40, 0xFF00, 0x802B, 0x0000, 0x0005, 0xFEC0, 0xFF23, 0xFF44, 0xFF01, 0xFEC0, 0x8029, 0x0000,
+    0x0006, 0xFE60, 0xFF23, 0xFF47, 0xFFEA, 0xFF25, 0xFEC2, 0x8024, 0x0000, 0x0001, 0xFBE0, 0x8004, 0x0000, 0x0006, 0xFEC0, 0xFF26,
+    0xFFEB, 0xFFED, 0xFF46, 0xFEA0, 0x8022, 0x0000, 0x0004, 0xFEE3, 0x0000, 0xFF27, 0xFF26, 0x8003, 0x0000, 0x0006, 0xFEA0, 0xFF67,
+    0xFFED, 0xFF8D, 0xFFA9, 0xFEC1, 0x8023, 0x0000, 0x000D, 0xFF25, 0xFF68, 0xFF8A, 0xFF6A, 0xFF25, 0xFDE0, 0xFE80, 0xFF26, 0xFFEE,
+    0xFF6D, 0xFFCC, 0xFF05, 0xEDC0, 0x8023, 0x0000, 0x000C, 0xFEE3, 0xFF04, 0xFFE5, 0xFF85, 0xFF04, 0xFE60, 0xFF03, 0xFFEC, 0xFF6D,
+    0xFF6C, 0xFFA7, 0xFEE0, 0x8008, 0x0000, 0x0004, 0xDEFB, 0xF7BE, 0xF79E, 0xF7BE, 0x8005, 0xF79E, 0x8013, 0x0000, 0x000C, 0xFF29,
+    0xFF26, 0xFF63, 0xFF02, 0xFF00, 0xFEE0, 0xFF28, 0xFFAE, 0xFF6C, 0xFF69, 0xFEE1, 0xFEC0, 0x8006, 0x0000, 0x0004, 0xD6BA, 0xEF7D,
+    0xF7BE, 0xFFDF, 0x8006, 0xFFFF, 0x0003, 0xF7BE, 0xF7BE, 0xEF5D, 0x8011, 0x0000, 0x000C, 0xE728, 0xFF29, 0xFEA5, 0xFF04, 0x0000,
+    0xFF03, 0xFFCB, 0xFF6D, 0xFF6B, 0xFF24, 0xFEC0, 0xFEE0, 0x8005, 0x0000, 0x0006, 0xEF5D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE,
+    0x8004, 0xF79E, 0x0005, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0x8015, 0x0000, 0x0007, 0xFF26, 0xFFED, 0xFF6C, 0xFF48, 0xFF01,
+    0xFEC0, 0xFEC1, 0x8004, 0x0000, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xFFDF, 0xF79E, 0x8003, 0xEF7D, 0x0009, 0xF79E, 0xF79E, 0xEF7D,
+    0xEF7D, 0xF79E, 0xF7BE, 0xFFFF, 0xFFFF, 0xEF7D, 0x8013, 0x0000, 0x0008, 0xE5C0, 0xFF27, 0xFFAD, 0xFF6B, 0xFF04, 0xFF00, 0xFEE1,
+    0xFEE1, 0x8003, 0x0000, 0x0005, 0xF79E, 0xF79E, 0xFFFF, 0xF7BE, 0xEF7D, 0x8009, 0xF79E, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xFFFF,
+    0xEF7D, 0x8012, 0x0000, 0x0008, 0xF640, 0xFF27, 0xFFAD, 0xFF49, 0xFEE2, 0xFEE1, 0xFF41, 0xFEE1, 0x8003, 0x0000, 0x0004, 0xEF7D,
+    0xFFFF, 0xF7BE, 0xEF7D, 0x800B, 0xF79E, 0x0005, 0xEF7D, 0xF79E, 0xFFFF, 0xF79E, 0xE73C, 0x8011, 0x0000, 0x000E, 0xFEA0, 0xFF27,
+    0xFFAC, 0xFF47, 0xFEE2, 0xFEE2, 0xFF42, 0xFEE2, 0xFE23, 0x0000, 0xEF7D, 0xF79E, 0xFFDF, 0xEF7D, 0x800E, 0xF79E, 0x0003, 0xF7BE,
+    0xFFFF, 0xEF7D, 0x800B, 0x0000, 0x0002, 0xFE80, 0xF800, 0x8004, 0x0000, 0x000C, 0xFDE0, 0xFF26, 0xFFAB, 0xFF26, 0xFEE1, 0xFEE1,
+    0xFF01, 0xFF21, 0xFEE0, 0x0000, 0xEF7E, 0xFFFF, 0x8011, 0xF79E, 0x0003, 0xFFFF, 0xF79E, 0xE71C, 0x800A, 0x0000, 0x0012, 0xFEE2,
+    0xFF46, 0xFE80, 0x0000, 0xFEE2, 0xF6A1, 0xF800, 0xFF26, 0xFFCA, 0xFF24, 0xFF04, 0xFF09, 0xFF2C, 0xFF6C, 0xFF28, 0xFF08, 0xEF7E,
+    0xFFFF, 0x8011, 0xF79E, 0x0003, 0xF7BE, 0xF79E, 0xEF5D, 0x800A, 0x0000, 0x0011, 0xFF05, 0xFFEC, 0xFF49, 0xFF67, 0xFF25, 0xFEC1,
+    0x0000, 0xFF03, 0xFFA7, 0xFF4F, 0xF799, 0xF7DF, 0xFFDF, 0xFFDF, 0xFFFE, 0xF77B, 0xEF7E, 0x8013, 0xF79E, 0x0002, 0xFFDF, 0xEF7D,
+    0x8009, 0x0000, 0x0013, 0xFEC0, 0xFF27, 0xFFAC, 0xFFCA, 0xFFE7, 0xFF03, 0xFBE0, 0x0000, 0xFEE0, 0xF752, 0xFFFF, 0xFFFF, 0xF7DF,
+    0xF7BE, 0xF79E, 0xF79E, 0xFFDF, 0xF7BE, 0xEF7D, 0x8012, 0xF79E, 0x0003, 0xFFDF, 0xEF7D, 0xEF5D, 0x8007, 0x0000, 0x000F, 0xFEC2,
+    0xFF26, 0xFFE9, 0xFF47, 0xFF24, 0xFF62, 0xFEC1, 0xFDE0, 0x0000, 0xEF5E, 0xFFDF, 0xFFFF, 0xF79E, 0xEF7D, 0xEF7D, 0x8018, 0xF79E,
+    0x0003, 0xF7BE, 0xF79E, 0xEF7D, 0x8006, 0x0000, 0x000D, 0xF6E2, 0xFF26, 0xFF24, 0xFF03, 0xFF23, 0xFF23, 0xFF43, 0xFEE2, 0x07FF,
+    0xF79E, 0xFFFF, 0xF79E, 0xEF7D, 0x801B, 0xF79E, 0x0003, 0xFFFF, 0xFFDF, 0xEF7D, 0x8007, 0x0000, 0x000A, 0xFE80, 0xFF04, 0xFF04,
+    0xFEE1, 0xFF00, 0xFEE0, 0xE77E, 0xF79E, 0xFFDF, 0xEF7D, 0x801D, 0xF79E, 0x0003, 0xF7BE, 0xFFDF, 0xEF7D, 0x8007, 0x0000, 0x0008,
+    0xFF2A, 0xFF70, 0xEF9F, 0xF7BF, 0xE77F, 0xEF7D, 0xF79E, 0xF7BE, 0x801E, 0xF79E, 0x0004, 0xEF7D, 0xFFDF, 0xF79E, 0xEF7D, 0x8004,
+    0x0000, 0x0009, 0xFFFF, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xF79E, 0xEF7D, 0xEF7D, 0x8021, 0xF79E, 0x0002, 0xFFFF, 0xF79E,
+    0x8003, 0x0000, 0x0004, 0xF79E, 0xF79E, 0xFFFF, 0xFFDF, 0x8004, 0xF79E, 0x0001, 0xFFDF, 0x8022, 0xF79E, 0x0007, 0xFFFF, 0xF79E,
+    0xBDF7, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0x8029, 0xF79E, 0x0007, 0xF7BE, 0xEF7D, 0xEF7D, 0x0000, 0xF79E, 0xEF7D, 0xF7BE, 0x8020,
+    0xF79E, 0x000F, 0xFF9D, 0xFF9D, 0xBF3E, 0x86DF, 0xD75E, 0xFF9D, 0xFF9D, 0xF79E, 0xF79E, 0xF7BE, 0xEF7D, 0xF79E, 0x0000, 0xEF7D,
+    0xFFFF, 0x8019, 0xF79E, 0x0001, 0xEF7E, 0x8007, 0xF79E, 0x000F, 0xC73E, 0xBF1E, 0x96FF, 0x2E3F, 0xA71E, 0xBF3E, 0xCF5E, 0xF79E,
+    0xF79E, 0xF7BE, 0xF79E, 0xF79E, 0x0000, 0xF79E, 0xFFFF, 0x8018, 0xF79E, 0x0003, 0xDF7E, 0x76DF, 0xB73E, 0x8005, 0xF79E, 0x0010,
+    0xEF7E, 0x563F, 0x2DFF, 0x8EBF, 0x565F, 0x8EDF, 0x2E1F, 0x76BF, 0xF79E, 0xF79E, 0xFFDF, 0xEF7D, 0xFFFF, 0x0000, 0xEF7D, 0xFFFF,
+    0x8016, 0xF79E, 0x0007, 0xF79D, 0xA6FE, 0x5E5F, 0x5E7F, 0x667F, 0x7EBF, 0xEF7E, 0x8003, 0xF79E, 0x0010, 0xEF9E, 0x9EDE, 0x767F,
+    0x4E1F, 0x767F, 0x463F, 0x7E9F, 0xB71E, 0xF79E, 0xF79E, 0xFFFF, 0xEF7D, 0xFFFF, 0x0000, 0xEF7D, 0xFFFF, 0x8015, 0xEF7D, 0x001C,
+    0xF77D, 0xF79D, 0xA6DE, 0x45FF, 0x4E1F, 0x461F, 0x7E9F, 0xEF7D, 0xF77D, 0xEF7D, 0xEF7D, 0xF79D, 0x969E, 0x55FF, 0x45DF, 0x663F,
+    0x3DDF, 0x5E3F, 0x96BE, 0xF77D, 0xF79E, 0xF7BE, 0xEF5D, 0x0000, 0x0000, 0xE71C, 0xEF7D, 0xF79E, 0x8008, 0xEF7D, 0x800D, 0xEF5D,
+    0x0008, 0xF77D, 0x969E, 0x3DBF, 0x55FF, 0x4DFF, 0x663F, 0xE75D, 0xEF7D, 0x8003, 0xEF5D, 0x0010, 0x4DDF, 0x257F, 0x8E7E, 0x45DF,
+    0x8E9E, 0x259F, 0x6E3F, 0xF77D, 0xFFDF, 0xE71C, 0xCE79, 0x0000, 0x0000, 0xAD55, 0xDEFB, 0xF7BE, 0x8006, 0xEF5D, 0x800F, 0xE73C,
+    0x0015, 0xEF5C, 0xD71D, 0xA69D, 0x459F, 0x7E3E, 0xCEFD, 0xEF3C, 0xEF3C, 0xE73C, 0xEF3C, 0xE73C, 0xCEFD, 0xC6DD, 0x863E, 0x0D1F,
+    0x8E5E, 0xC6FD, 0xDF3D, 0xF79E, 0xE71C, 0xD6BA, 0x8004, 0x0000, 0x0004, 0xD69A, 0xDEDB, 0xEF7D, 0xE73C, 0x8014, 0xE71C, 0x0013,
+    0xEF3C, 0xEF3C, 0xBEBC, 0xDEFC, 0xF73B, 0xE71C, 0x8EBE, 0x6EBE, 0xCEFC, 0xEF1B, 0xEF3B, 0xEF3C, 0xB69D, 0x7E1E, 0xBEBC, 0xF75C,
+    0xEF5D, 0xDEDB, 0xCE79, 0x8006, 0x0000, 0x0003, 0xCE79, 0xD6BA, 0xD6BA, 0x8009, 0xE73C, 0x800D, 0xE71C, 0x0010, 0xEF3C, 0xD6FB,
+    0xAE9C, 0xB6BC, 0x5E7F, 0x365F, 0xA6BC, 0xAEBC, 0xC6DC, 0xE71C, 0xEF1C, 0xEF3B, 0xDEFB, 0xD69A, 0xD69A, 0xC618, 0x8009, 0x0000,
+    0x800A, 0xCE79, 0x800C, 0xCE59, 0x000F, 0xCE38, 0xD658, 0x6DFC, 0x369F, 0x661D, 0x6E3D, 0x461F, 0x863C, 0x3EBF, 0x4E3E, 0xBE39,
+    0xCE38, 0xCE59, 0xC638, 0xBDF7, 0x8023, 0x0000, 0x0008, 0x15BF, 0x2E1F, 0x25BF, 0x25DF, 0x35FF, 0x2DFF, 0x365F, 0x2E1F, 0x8028,
+    0x0000, 0x0008, 0x1D7F, 0x25BF, 0x259F, 0x259F, 0x2DBF, 0x2DDF, 0x2DFF, 0x2DDF, 0x8028, 0x0000, 0x0003, 0x1D5F, 0x263F, 0x1D7F,
+    0x8003, 0x259F, 0x0003, 0x2E5F, 0x25BF, 0x367F, 0x8027, 0x0000, 0x0009, 0x151F, 0x1DBF, 0x1D3F, 0x1D5F, 0x1D5F, 0x1D7F, 0x259F,
+    0x259F, 0x1D5F, 0x8028, 0x0000, 0x0006, 0x001F, 0x151F, 0x151F, 0x1DBF, 0x1D3F, 0x1C7F, 0x802C, 0x0000, 0x0003, 0x14FF, 0x151F,
+    0x1C7F, 0x80CD, 0x0000,
+};
+
+// 1360 bytes, 4608 raw
+const uint16_t icon_50d_rle[680] PROGMEM = {
+    0x818C, 0x0000, 0x0002, 0xFFFF, 0xFFFF, 0x802B, 0x0000, 0x0002, 0xFFFF, 0xF79E, 0x8003, 0xEF5D, 0x0003, 0xF79E, 0xE73C, 0xFFFF,
+    0x8026, 0x0000, 0x000B, 0xAD55, 0xEF7D, 0xDEFB, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xE73C, 0xD6BA, 0x8024, 0x0000,
+    0x0008, 0xFFFF, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0x8004, 0xE73C, 0x0001, 0xFFFF, 0x8009, 0x0000, 0x8003,
+    0xFFFF, 0x0006, 0xEF7D, 0xEF7D, 0xEF5D, 0xE73C, 0xFFFF, 0xFFFF, 0x8010, 0x0000, 0x0003, 0xFFFF, 0xE71C, 0xEF5D, 0x8007, 0xE73C,
+    0x0005, 0xE71C, 0xE73C, 0xE71C, 0xEF5D, 0xFFFF, 0x8007, 0x0000, 0x0003, 0xFFFF, 0xF79E, 0xEF7D, 0x8004, 0xF79E, 0x0004, 0xEF7D,
+    0xEF7D, 0xEF5D, 0xFFFF, 0x800F, 0x0000, 0x0003, 0xD6BA, 0xE73C, 0xE71C, 0x8008, 0xE73C, 0x0004, 0xE71C, 0xE71C, 0xDEFB, 0xEF7D,
+    0x8005, 0x0000, 0x0004, 0xFFFF, 0xEF5D, 0xEF7D, 0xF79E, 0x8006, 0xEF7D, 0x8003, 0xF79E, 0x0001, 0xFFFF, 0x800E, 0x0000, 0x8004,
+    0xE71C, 0x8003, 0xE73C, 0x0005, 0xE71C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0x8003, 0xE71C, 0x0007, 0xDEFB, 0xE73C, 0xDEFB, 0xAD55,
+    0x0000, 0xFFFF, 0xEF5D, 0x8004, 0xF79E, 0x8005, 0xEF7D, 0x0004, 0xF79E, 0xEF7D, 0xF79E, 0xFFFF, 0x800D, 0x0000, 0x8004, 0xE71C,
+    0x0005, 0xE73C, 0xE73C, 0xE71C, 0xE73C, 0xE73C, 0x8005, 0xE71C, 0x0016, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xF79E, 0xF79E,
+    0xEF7D, 0xF79E, 0xEF7D, 0xF79E, 0xF79E, 0xEF7D, 0xEF7D, 0xF79E, 0xEF7D, 0xEF7D, 0xF79E, 0xEF7D, 0xF79E, 0xF79E, 0xFFFF, 0x800A,
+    0x0000, 0x0005, 0xFFFF, 0xDEDB, 0xE71C, 0xE71C, 0xDEFB, 0x800A, 0xE71C, 0x0003, 0xE73C, 0xEF7D, 0xEF5D, 0x8003, 0xDEDB, 0x0001,
+    0xEF5D, 0x8005, 0xEF7D, 0x8007, 0xF79E, 0x0004, 0xEF7D, 0xF79E, 0xF79E, 0xEF7D, 0x8009, 0x0000, 0x0002, 0xFFFF, 0xDEDB, 0x8003,
+    0xDEFB, 0x8008, 0xE71C, 0x000E, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xEF5D, 0xF79E, 0xF7BE, 0xDEFB, 0xDEFB, 0xEF5D, 0xEF7D, 0xF79E,
+    0xEF7D, 0xEF7D, 0x8009, 0xF79E, 0x0004, 0xEF7D, 0xF79E, 0xEF7D, 0xF79E, 0x8008, 0x0000, 0x0003, 0xEF7D, 0xDEDB, 0xDEDB, 0x8010,
+    0xDEFB, 0x0007, 0xEF5D, 0xEF7D, 0xE71C, 0xE73C, 0xEF7D, 0xF79E, 0xEF7D, 0x800B, 0xF79E, 0x0003, 0xEF7D, 0xF79E, 0xF79E, 0x8007,
+    0x0000, 0x0001, 0xFFFF, 0x8004, 0xDEDB, 0x0001, 0xDEFB, 0x8004, 0xDEDB, 0x800A, 0xDEFB, 0x0006, 0xE71C, 0xEF7D, 0xE73C, 0xE73C,
+    0xEF5D, 0xEF7D, 0x800C, 0xF79E, 0x8003, 0xEF7D, 0x0001, 0xFFFF, 0x8006, 0x0000, 0x0003, 0xDEFB, 0xDEDB, 0xD6BA, 0x800C, 0xDEDB,
+    0x8003, 0xDEFB, 0x0008, 0xEF5D, 0xF7BE, 0xF7BE, 0xF79E, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF7D, 0x800D, 0xF79E, 0x8003, 0xEF7D, 0x8006,
+    0x0000, 0x8004, 0xD6BA, 0x0003, 0xDEDB, 0xD6BA, 0xD6BA, 0x8009, 0xDEDB, 0x0006, 0xDEFB, 0xEF7D, 0xFFDF, 0xF79E, 0xEF7D, 0xEF7D,
+    0x8011, 0xF79E, 0x0004, 0xEF7D, 0xEF7D, 0xF79E, 0xF7BE, 0x8005, 0x0000, 0x0001, 0xDEDB, 0x8003, 0xD69A, 0x800A, 0xD6BA, 0x0004,
+    0xDEDB, 0xDEDB, 0xEF5D, 0xFFDF, 0x8003, 0xEF7D, 0x8015, 0xF79E, 0x0002, 0xEF7D, 0xF7BE, 0x8004, 0x0000, 0x0001, 0xD6BA, 0x8003,
+    0xD69A, 0x0003, 0xD6BA, 0xD69A, 0xD69A, 0x8007, 0xD6BA, 0x0005, 0xDEDB, 0xDEFB, 0xEF7D, 0xF79E, 0xEF7D, 0x8017, 0xF79E, 0x0003,
+    0xEF7D, 0xEF7D, 0xF7BE, 0x8003, 0x0000, 0x0001, 0xDEDB, 0x8009, 0xD69A, 0x0008, 0xD6BA, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C,
+    0xEF7D, 0xEF7D, 0x8017, 0xF79E, 0x0005, 0xEF7D, 0xEF7D, 0xF79E, 0xEF7D, 0xFFFF, 0x8003, 0x0000, 0x0002, 0xD69A, 0xD69A, 0x8005,
+    0xCE79, 0x0009, 0xD69A, 0xD6BA, 0xD6BA, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF7D, 0x8019, 0xF79E, 0x0004, 0xEF7D, 0xF79E,
+    0xEF7D, 0xF7BE, 0x8003, 0x0000, 0x0003, 0xD6BA, 0xD69A, 0xD69A, 0x8003, 0xCE79, 0x0006, 0xD69A, 0xD69A, 0xDEDB, 0xE71C, 0xE73C,
+    0xEF5D, 0x8004, 0xEF7D, 0x801B, 0xF79E, 0x0006, 0xEF7D, 0xEF7D, 0x0000, 0x0000, 0xFFFF, 0xD6BA, 0x8006, 0xD69A, 0x0005, 0xDEDB,
+    0xE71C, 0xEF5D, 0xEF7D, 0xEF7D, 0x801E, 0xF79E, 0x8003, 0xEF7D, 0x0006, 0x0000, 0x0000, 0xFFFF, 0xD6BA, 0xCE79, 0xCE79, 0x8003,
+    0xD69A, 0x0005, 0xDEDB, 0xDEFB, 0xEF5D, 0xEF7D, 0xEF7D, 0x801F, 0xF79E, 0x0003, 0xEF7D, 0xEF7D, 0xF79E, 0x8003, 0x0000, 0x000A,
+    0xCE79, 0xD69A, 0xCE79, 0xCE79, 0xD69A, 0xD6BA, 0xDEDB, 0xE73C, 0xEF7D, 0xEF7D, 0x8022, 0xF79E, 0x0001, 0xEF7D, 0x8003, 0x0000,
+    0x0001, 0xFFFF, 0x8004, 0xCE79, 0x0005, 0xD6BA, 0xDEFB, 0xE73C, 0xEF5D, 0xEF7D, 0x801F, 0xF79E, 0x8004, 0xEF7D, 0x8004, 0x0000,
+    0x0009, 0xDEFB, 0xCE79, 0xCE59, 0xCE79, 0xDEDB, 0xDEFB, 0xE71C, 0xEF5D, 0xEF5D, 0x801E, 0xEF7D, 0x0005, 0xEF5D, 0xEF5D, 0xEF7D,
+    0xEF5D, 0xD6BA, 0x8005, 0x0000, 0x000A, 0xCE79, 0xD69A, 0xD69A, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xE73C, 0x8019,
+    0xEF5D, 0x8004, 0xE73C, 0x0003, 0xEF5D, 0xEF5D, 0xE73C, 0x8008, 0x0000, 0x0001, 0xE71C, 0x8005, 0xEF5D, 0x0001, 0xE73C, 0x801E,
+    0xE71C, 0x0003, 0xE73C, 0xEF5D, 0xFFFF, 0x8008, 0x0000, 0x0002, 0xE71C, 0xF7BE, 0x8003, 0xF79E, 0x0003, 0xEF7D, 0xEF5D, 0xE73C,
+    0x801B, 0xE71C, 0x0005, 0xE73C, 0xEF5D, 0xEF7D, 0xEF7D, 0xFFFF, 0x8008, 0x0000, 0x0002, 0xFFFF, 0xEF5D, 0x8003, 0xEF7D, 0x000A,
+    0xEF5D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF5D, 0xEF7D, 0x8013, 0xEF5D, 0x8003, 0xEF7D, 0x0003, 0xF79E,
+    0xEF5D, 0xFFFF, 0x8008, 0x0000, 0x0003, 0xFFFF, 0xD69A, 0xE73C, 0x8006, 0xEF5D, 0x0001, 0xE73C, 0x8015, 0xEF5D, 0x0001, 0xE73C,
+    0x8005, 0xEF5D, 0x0002, 0xEF7D, 0xFFFF, 0x800A, 0x0000, 0x0003, 0xFFFF, 0xE73C, 0xEF5D, 0x8003, 0xE73C, 0x8004, 0xE71C, 0x0002,
+    0xE73C, 0xE71C, 0x800F, 0xE73C, 0x000A, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xE73C, 0xE71C, 0xEF5D, 0xFFFF, 0x800C,
+    0x0000, 0x0007, 0xFFFF, 0xCE79, 0xE73C, 0xDEFB, 0xE73C, 0xDEFB, 0xDEFB, 0x800D, 0xE71C, 0x8006, 0xDEDB, 0x8003, 0xE71C, 0x0006,
+    0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xBDF7, 0xFFFF, 0x81B5, 0x0000,
+};
+
+#endif // _weather_icons_rle_h
@@ -0,0 +1,109 @@
+// generated by arcTable.py from the TEMP_ARC_ defines in DisplayTFT.h, do not edit
+
+#ifndef _temp_arc_table_h
+#define _temp_arc_table_h
+
+#include <Arduino.h>
+
+#define TEMP_ARC_TABLE_START            240
+#define TEMP_ARC_TABLE_SPAN             240
+#define TEMP_ARC_TABLE_DEGREE_PER_SEG   3
+#define TEMP_ARC_TABLE_RADIUS           40
+#define TEMP_ARC_TABLE_WIDTH            8
+#define TEMP_ARC_SEGMENTS               80
+
+// segment boundaries as offsets from the gauge centre, segment n runs from
+// vertex n to vertex n + 1
+typedef struct ArcVertex
+{
+    int8_t innerX;
+    int8_t innerY;
+    int8_t outerX;
+    int8_t outerY;
+} ArcVertex;
+
+const ArcVertex tempArcVertices[TEMP_ARC_SEGMENTS + 1] PROGMEM = {
+    {-28, 15, -35, 19},
+    {-29, 14, -36, 18},
+    {-30, 13, -37, 16},
+    {-30, 11, -38, 14},
+    {-31, 9, -39, 12},
+    {-31, 8, -39, 10},
+    {-32, 6, -40, 8},
+    {-32, 5, -40, 6},
+    {-32, 3, -40, 4},
+    {-32, 1, -40, 2},
+    {-32, 0, -40, 0},
+    {-32, -2, -40, -3},
+    {-32, -4, -40, -5},
+    {-32, -6, -40, -7},
+    {-32, -7, -40, -9},
+    {-31, -9, -39, -11},
+    {-31, -10, -39, -13},
+    {-30, -12, -38, -15},
+    {-30, -14, -37, -17},
+    {-29, -15, -36, -19},
+    {-28, -17, -35, -21},
+    {-27, -18, -34, -22},
+    {-26, -19, -33, -24},
+    {-25, -21, -32, -26},
+    {-24, -22, -30, -27},
+    {-23, -23, -29, -29},
+    {-22, -24, -27, -30},
+    {-21, -25, -26, -32},
+    {-19, -26, -24, -33},
+    {-18, -27, -22, -34},
+    {-17, -28, -21, -35},
+    {-15, -29, -19, -36},
+    {-14, -30, -17, -37},
+    {-12, -30, -15, -38},
+    {-10, -31, -13, -39},
+    {-9, -31, -11, -39},
+    {-7, -32, -9, -40},
+    {-6, -32, -7, -40},
+    {-4, -32, -5, -40},
+    {-2, -32, -3, -40},
+    {-1, -32, -1, -40},
+    {1, -32, 2, -40},
+    {3, -32, 4, -40},
+    {5, -32, 6, -40},
+    {6, -32, 8, -40},
+    {8, -31, 10, -39},
+    {9, -31, 12, -39},
+    {11, -30, 14, -38},
+    {13, -30, 16, -37},
+    {14, -29, 18, -36},
+    {16, -28, 20, -35},
+    {17, -27, 21, -34},
+    {18, -26, 23, -33},
+    {20, -25, 25, -32},
+    {21, -24, 26, -30},
+    {22, -23, 28, -29},
+    {23, -22, 29, -27},
+    {24, -21, 31, -26},
+    {25, -19, 32, -24},
+    {26, -18, 33, -22},
+    {27, -17, 34, -21},
+    {28, -15, 35, -19},
+    {29, -14, 36, -17},
+    {29, -12, 37, -15},
+    {30, -10, 38, -13},
+    {30, -9, 38, -11},
+    {31, -7, 39, -9},
+    {31, -6, 39, -7},
+    {31, -4, 39, -5},
+    {31, -2, 39, -3},
+    {32, -1, 40, -1},
+    {31, 1, 39, 2},
+    {31, 3, 39, 4},
+    {31, 5, 39, 6},
+    {31, 6, 39, 8},
+    {30, 8, 38, 10},
+    {30, 9, 38, 12},
+    {29, 11, 37, 14},
+    {29, 13, 36, 16},
+    {28, 14, 35, 18},
+    {27, 16, 34, 20},
+};
+
+#endif // _temp_arc_table_h
@@ -0,0 +1,555 @@
+#include "AsyncHttpClient.h"
+
+AsyncHttpClient* AsyncHttpClient::first = nullptr;
+
+AsyncHttpClient::AsyncHttpClient()
+{
+    state = AsyncHttp_Idle;
+    callback = nullptr;
+    port = 0;
+    body = nullptr;
+    bodyLength = 0;
+    bodySize = 0;
+    bodyStream = nullptr;
+    reconnectPending = false;
+    disconnectPending = false;
+    closePending = false;
+    startTime = 0;
+    lastUsed = 0;
+    timeout = ASYNC_HTTP_DEFAULT_TIMEOUT;
+    keepAliveEnabled = true;
+
+    stats.requests = 0;
+    stats.reused = 0;
+    stats.reconnects = 0;
+
+    resetResponse();
+
+    // socket callbacks run in the network context, they only collect data
+    client.onConnect([](void* arg, AsyncClient* c) { ((AsyncHttpClient*)arg)->handleConnect(); }, this);
+    client.onData([](void* arg, AsyncClient* c, void* data, size_t len) { ((AsyncHttpClient*)arg)->handleData((char*)data, len); }, this);
+    client.onDisconnect([](void* arg, AsyncClient* c) { ((AsyncHttpClient*)arg)->handleDisconnect(); }, this);
+    client.onError([](void* arg, AsyncClient* c, int8_t error) { ((AsyncHttpClient*)arg)->handleError(error); }, this);
+
+    next = first;
+    first = this;
+}
+
+AsyncHttpClient::~AsyncHttpClient()
+{
+    AsyncHttpClient** link = &first;
+
+    while(*link != nullptr)
+    {
+        if(*link == this)
+        {
+            *link = next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+
+    state = AsyncHttp_Idle;
+    client.close(true);
+}
+
+void AsyncHttpClient::pollAll()
+{
+    for(AsyncHttpClient* httpClient = first; httpClient != nullptr; httpClient = httpClient->next)
+    {
+        httpClient->poll();
+    }
+}
+
+bool AsyncHttpClient::get(const String& host, int port, const char* uri, const String& headers, AsyncHttpCallback callback)
+{
+    return send(host, port, "GET", uri, headers, "", callback);
+}
+
+bool AsyncHttpClient::post(const String& host, int port, const char* uri, const String& headers, const char* contentType, const String& content, AsyncHttpCallback callback)
+{
+    String postHeaders = headers;
+
+    postHeaders += "Content-Type: ";
+    postHeaders += contentType;
+    postHeaders += "\r\nContent-Length: ";
+    postHeaders += content.length();
+    postHeaders += "\r\n";
+
+    return send(host, port, "POST", uri, postHeaders, content, callback);
+}
+
+bool AsyncHttpClient::send(const String& host, int port, const char* method, const char* uri, const String& headers, const String& content, AsyncHttpCallback callback)
+{
+    if(isBusy())
+    {
+        return false;
+    }
+
+    this->callback = callback;
+
+    // appended a piece at a time so the request reuses its buffer
+    request = method;
+    request += ' ';
+    request += uri;
+    request += " HTTP/1.1\r\nHost: ";
+    request += host;
+    request += ':';
+    request += port;
+    request += "\r\n";
+    request += keepAliveEnabled ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+    request += headers;
+    request += "\r\n";
+    request += content;
+
+    stats.requests++;
+    startTime = millis();
+    resetResponse();
+
+    if(isConnectedTo(host, port))
+    {
+        stats.reused++;
+        reusedSocket = true;
+        state = AsyncHttp_ReadingHeaders;
+        sendRequest();
+    }
+    else
+    {
+        // state is idle so the disconnect callback is ignored
+        client.close(true);
+
+        this->host = host;
+        this->port = port;
+        connect();
+    }
+
+    return true;
+}
+
+bool AsyncHttpClient::isConnectedTo(const String& host, int port)
+{
+    return client.connected() && this->port == port && this->host == host;
+}
+
+void AsyncHttpClient::close()
+{
+    if(!isBusy())
+    {
+        client.close(true);
+    }
+}
+
+void AsyncHttpClient::poll()
+{
+    if(reconnectPending && !disconnectPending)
+    {
+        // server closed the keep-alive socket before answering, try once on a new one
+        reconnectPending = false;
+        stats.reconnects++;
+        resetResponse();
+        connect();
+    }
+
+    if(isBusy() && state != AsyncHttp_Complete && millis() - startTime > timeout)
+    {
+        finish(ASYNC_HTTP_ERROR_TIMEOUT);
+    }
+
+    if(state == AsyncHttp_Complete)
+    {
+        AsyncHttpCallback completed = callback;
+
+        state = AsyncHttp_Idle;
+        callback = nullptr;
+        lastUsed = millis();
+
+        if(closePending)
+        {
+            closePending = false;
+            client.close(true);
+        }
+
+        if(completed)
+        {
+            completed(this, result, body, bodyLength);
+        }
+
+        bodyLength = 0;
+    }
+}
+
+void AsyncHttpClient::connect()
+{
+    state = AsyncHttp_Connecting;
+    reusedSocket = false;
+    disconnectPending = false;
+
+    if(!client.connect(host.c_str(), port))
+    {
+        finish(ASYNC_HTTP_ERROR_CONNECT);
+    }
+}
+
+void AsyncHttpClient::sendRequest()
+{
+    state = AsyncHttp_ReadingHeaders;
+
+    if(client.write(request.c_str(), request.length()) != request.length())
+    {
+        if(reusedSocket)
+        {
+            // the keep-alive socket has gone, it's closed before reconnecting so
+            // none of its callbacks can land in the retry
+            reconnectPending = true;
+            disconnectPending = true;
+            client.close(true);
+        }
+        else
+        {
+            finish(ASYNC_HTTP_ERROR_DISCONNECTED);
+        }
+    }
+}
+
+void AsyncHttpClient::resetResponse()
+{
+    clearLine();
+    httpCode = 0;
+    contentLength = -1;
+    chunked = false;
+    keepAlive = keepAliveEnabled;
+    result = 0;
+    chunkState = AsyncHttpChunk_Size;
+    chunkRemaining = 0;
+    bodyLength = 0;
+
+    if(body != nullptr)
+    {
+        body[0] = 0;
+    }
+}
+
+void AsyncHttpClient::finish(int result)
+{
+    this->result = result;
+    reconnectPending = false;
+
+    if(result < 0 || !keepAlive)
+    {
+        closePending = true;
+    }
+
+    state = AsyncHttp_Complete;
+}
+
+/****************************************************************************************
+ *
+ *  Socket callbacks
+ *
+****************************************************************************************/
+
+void AsyncHttpClient::handleConnect()
+{
+    if(state == AsyncHttp_Connecting)
+    {
+        sendRequest();
+    }
+}
+
+void AsyncHttpClient::handleData(char* data, size_t len)
+{
+    if(state == AsyncHttp_ReadingHeaders)
+    {
+        size_t used = readHeaders(data, len);
+        data += used;
+        len -= used;
+    }
+
+    if(state == AsyncHttp_ReadingBody && len > 0)
+    {
+        if(chunked)
+        {
+            readChunked(data, len);
+        }
+        else if(appendBody(data, len))
+        {
+            if(contentLength >= 0 && (long)bodyLength >= contentLength)
+            {
+                finish(httpCode);
+            }
+        }
+    }
+}
+
+void AsyncHttpClient::handleDisconnect()
+{
+    disconnectPending = false;
+
+    switch(state)
+    {
+        case AsyncHttp_Connecting:
+            finish(ASYNC_HTTP_ERROR_CONNECT);
+            break;
+
+        case AsyncHttp_ReadingHeaders:
+            if(reusedSocket && httpCode == 0 && lineLength == 0)
+            {
+                reconnectPending = true;
+            }
+            else
+            {
+                finish(ASYNC_HTTP_ERROR_DISCONNECTED);
+            }
+            break;
+
+        case AsyncHttp_ReadingBody:
+            // no length given, the body ends when the server closes
+            if(!chunked && contentLength < 0)
+            {
+                keepAlive = false;
+                finish(httpCode);
+            }
+            else
+            {
+                finish(ASYNC_HTTP_ERROR_DISCONNECTED);
+            }
+            break;
+
+        default:
+            // idle keep-alive socket closed by the server
+            break;
+    }
+}
+
+void AsyncHttpClient::handleError(int8_t error)
+{
+    if(state == AsyncHttp_Connecting)
+    {
+        finish(ASYNC_HTTP_ERROR_CONNECT);
+    }
+    else if(state == AsyncHttp_ReadingHeaders || state == AsyncHttp_ReadingBody)
+    {
+        finish(ASYNC_HTTP_ERROR_DISCONNECTED);
+    }
+}
+
+/****************************************************************************************
+ *
+ *  Response parsing
+ *
+****************************************************************************************/
+
+size_t AsyncHttpClient::readHeaders(char* data, size_t len)
+{
+    size_t i;
+
+    for(i=0; i<len && state == AsyncHttp_ReadingHeaders; i++)
+    {
+        char c = data[i];
+
+        if(c == '\r')
+        {
+            continue;
+        }
+        if(c != '\n')
+        {
+            appendLine(c);
+            continue;
+        }
+
+        if(lineLength != 0)
+        {
+            parseHeaderLine();
+            clearLine();
+            continue;
+        }
+
+        // blank line, end of headers
+        if(httpCode == 0)
+        {
+            finish(ASYNC_HTTP_ERROR_PROTOCOL);
+        }
+        else if(httpCode == 204 || httpCode == 304 || contentLength == 0)
+        {
+            finish(httpCode);
+        }
+        else if(bodyStream == nullptr && contentLength >= (long)bodySize)
+        {
+            finish(ASYNC_HTTP_ERROR_TOO_LARGE);
+        }
+        else
+        {
+            state = AsyncHttp_ReadingBody;
+        }
+    }
+
+    return i;
+}
+
+// status, header and chunk size lines are collected in a fixed buffer, nothing
+// a server should send needs more so a line that doesn't fit fails the request
+void AsyncHttpClient::appendLine(char c)
+{
+    if(lineLength + 1 >= ASYNC_HTTP_LINE_SIZE)
+    {
+        finish(ASYNC_HTTP_ERROR_PROTOCOL);
+        return;
+    }
+
+    line[lineLength++] = c;
+    line[lineLength] = 0;
+}
+
+void AsyncHttpClient::parseHeaderLine()
+{
+    if(httpCode == 0)
+    {
+        // status line, HTTP/1.1 200 OK
+        const char* space = strchr(line, ' ');
+        if(strncmp(line, "HTTP/", 5) != 0 || space == nullptr)
+        {
+            finish(ASYNC_HTTP_ERROR_PROTOCOL);
+            return;
+        }
+        if(strncmp(line, "HTTP/1.0", 8) == 0)
+        {
+            keepAlive = false;
+        }
+        httpCode = atoi(space + 1);
+        return;
+    }
+
+    const char* colon = strchr(line, ':');
+    if(colon == nullptr)
+    {
+        return;
+    }
+
+    // matched in place, the line is thrown away afterwards
+    for(size_t i=0; i<lineLength; i++)
+    {
+        line[i] = tolower(line[i]);
+    }
+    int nameLength = colon - line;
+    const char* value = colon + 1;
+
+    if(isHeader(line, nameLength, "content-length"))
+    {
+        contentLength = atol(value);
+    }
+    else if(isHeader(line, nameLength, "transfer-encoding"))
+    {
+        chunked = strstr(value, "chunked") != nullptr;
+    }
+    else if(isHeader(line, nameLength, "connection"))
+    {
+        if(strstr(value, "close") != nullptr)
+        {
+            keepAlive = false;
+        }
+        else if(strstr(value, "keep-alive") != nullptr)
+        {
+            keepAlive = keepAliveEnabled;
+        }
+    }
+}
+
+bool AsyncHttpClient::isHeader(const char* line, int nameLength, const char* name)
+{
+    return strlen(name) == (size_t)nameLength && strncmp(line, name, nameLength) == 0;
+}
+
+void AsyncHttpClient::readChunked(char* data, size_t len)
+{
+    size_t i = 0;
+
+    while(i < len && state == AsyncHttp_ReadingBody)
+    {
+        char c = data[i];
+
+        switch(chunkState)
+        {
+            case AsyncHttpChunk_Size:
+                i++;
+                if(c == '\n')
+                {
+                    // size line may carry extensions after ';'
+                    chunkRemaining = strtol(line, nullptr, 16);
+                    clearLine();
+                    chunkState = chunkRemaining > 0 ? AsyncHttpChunk_Data : AsyncHttpChunk_Trailer;
+                }
+                else if(c != '\r')
+                {
+                    appendLine(c);
+                }
+                break;
+
+            case AsyncHttpChunk_Data:
+            {
+                size_t count = min((size_t)chunkRemaining, len - i);
+                if(!appendBody(data + i, count))
+                {
+                    return;
+                }
+                i += count;
+                chunkRemaining -= count;
+                if(chunkRemaining == 0)
+                {
+                    chunkState = AsyncHttpChunk_DataEnd;
+                }
+                break;
+            }
+
+            case AsyncHttpChunk_DataEnd:
+                i++;
+                if(c == '\n')
+                {
+                    chunkState = AsyncHttpChunk_Size;
+                }
+                break;
+
+            case AsyncHttpChunk_Trailer:
+                i++;
+                if(c == '\n')
+                {
+                    if(lineLength == 0)
+                    {
+                        finish(httpCode);
+                    }
+                    clearLine();
+                }
+                else if(c != '\r')
+                {
+                    appendLine(c);
+                }
+                break;
+        }
+    }
+}
+
+bool AsyncHttpClient::appendBody(const char* data, size_t len)
+{
+    if(bodyStream != nullptr)
+    {
+        if(bodyStream->write((const uint8_t*)data, len) != len)
+        {
+            finish(ASYNC_HTTP_ERROR_TOO_LARGE);
+            return false;
+        }
+
+        bodyLength += len;
+        return true;
+    }
+
+    if(bodyLength + len >= bodySize)
+    {
+        finish(ASYNC_HTTP_ERROR_TOO_LARGE);
+        return false;
+    }
+
+    memcpy(body + bodyLength, data, len);
+    bodyLength += len;
+    body[bodyLength] = 0;
+
+    return true;
+}
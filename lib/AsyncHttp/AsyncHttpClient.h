@@ -0,0 +1,138 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include <ESPAsyncTCP.h>
+
+#define ASYNC_HTTP_DEFAULT_TIMEOUT      5000    // ms, whole request including connect
+#define ASYNC_HTTP_LINE_SIZE            384     // bytes, status, header and chunk size lines, a longer one fails the request
+
+// negative result codes, positive codes are the HTTP status
+#define ASYNC_HTTP_ERROR_CONNECT        -1
+#define ASYNC_HTTP_ERROR_TIMEOUT        -2
+#define ASYNC_HTTP_ERROR_DISCONNECTED   -3
+#define ASYNC_HTTP_ERROR_TOO_LARGE      -4
+#define ASYNC_HTTP_ERROR_PROTOCOL       -5
+
+enum AsyncHttpState
+{
+    AsyncHttp_Idle,             // no request, socket may still be open for keep-alive
+    AsyncHttp_Connecting,
+    AsyncHttp_ReadingHeaders,
+    AsyncHttp_ReadingBody,
+    AsyncHttp_Complete,         // result waiting to be dispatched from poll()
+};
+
+enum AsyncHttpChunkState
+{
+    AsyncHttpChunk_Size,
+    AsyncHttpChunk_Data,
+    AsyncHttpChunk_DataEnd,
+    AsyncHttpChunk_Trailer,
+};
+
+typedef struct AsyncHttpStats
+{
+    unsigned long requests;
+    unsigned long reused;
+    unsigned long reconnects;
+} AsyncHttpStats;
+
+class AsyncHttpClient;
+
+// body is null terminated, only valid for the duration of the callback and may be
+// parsed in place. With a body stream it is null and length counts the bytes written
+// to the stream
+typedef std::function<void(AsyncHttpClient* client, int httpCode, char* body, size_t length)> AsyncHttpCallback;
+
+// Non-blocking HTTP/1.1 client on top of ESPAsyncTCP. Socket callbacks only
+// collect data, the completion callback is always run from poll() so it is safe
+// to draw or parse from it. Keep-alive sockets are reused for the next request to
+// the same host and port. Bodies are read into a fixed buffer given by the
+// owner, responses that don't fit it fail with ASYNC_HTTP_ERROR_TOO_LARGE. Owners
+// that only keep part of a body can take it a segment at a time from a stream
+// instead, which fails the request the same way if it takes less than it's given.
+class AsyncHttpClient
+{
+    public:
+        AsyncHttpClient();
+        ~AsyncHttpClient();
+
+        bool get(const String& host, int port, const char* uri, const String& headers, AsyncHttpCallback callback);
+        bool post(const String& host, int port, const char* uri, const String& headers, const char* contentType, const String& content, AsyncHttpCallback callback);
+        void poll();
+        void close();
+
+        bool isBusy() { return state != AsyncHttp_Idle; }
+        bool isConnected() { return client.connected(); }
+        bool isConnectedTo(const String& host, int port);
+        unsigned long getLastUsed() { return lastUsed; }
+        void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+        void setKeepAlive(bool keepAlive) { keepAliveEnabled = keepAlive; }
+        AsyncHttpStats* getStats() { return &stats; }
+
+        // size includes the terminator, set before the first request
+        void setBodyBuffer(char* buffer, size_t size) { body = buffer; bodySize = size; }
+        void setBodyStream(Print* stream) { bodyStream = stream; }
+
+        // run every client's state machine, call from loop()
+        static void pollAll();
+
+    private:
+        bool send(const String& host, int port, const char* method, const char* uri, const String& headers, const String& content, AsyncHttpCallback callback);
+        void connect();
+        void sendRequest();
+        void resetResponse();
+        void finish(int result);
+
+        void handleConnect();
+        void handleData(char* data, size_t len);
+        void handleDisconnect();
+        void handleError(int8_t error);
+
+        size_t readHeaders(char* data, size_t len);
+        void appendLine(char c);
+        void clearLine() { lineLength = 0; line[0] = 0; }
+        void parseHeaderLine();
+        static bool isHeader(const char* line, int nameLength, const char* name);
+        void readChunked(char* data, size_t len);
+        bool appendBody(const char* data, size_t len);
+
+        AsyncClient client;
+        AsyncHttpState state;
+        AsyncHttpCallback callback;
+
+        String host;
+        int port;
+        String request;
+
+        char line[ASYNC_HTTP_LINE_SIZE];
+        size_t lineLength;
+        int httpCode;
+        long contentLength;
+        bool chunked;
+        bool keepAlive;
+        bool keepAliveEnabled;
+        bool reusedSocket;
+        bool reconnectPending;
+        bool disconnectPending;     // old socket closed for a reconnect, waiting for its disconnect
+        bool closePending;
+        int result;
+
+        AsyncHttpChunkState chunkState;
+        long chunkRemaining;
+
+        char* body;
+        size_t bodyLength;
+        size_t bodySize;
+        Print* bodyStream;
+
+        unsigned long startTime;
+        unsigned long lastUsed;
+        unsigned long timeout;
+
+        AsyncHttpStats stats;
+
+        AsyncHttpClient* next;
+        static AsyncHttpClient* first;
+};
@@ -0,0 +1,169 @@
+#include "Format.h"
+
+static const unsigned long powersOfTen[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+FormatBuffer::FormatBuffer(char* buffer, size_t size)
+{
+    this->buffer = buffer;
+    this->size = size;
+    used = 0;
+
+    if(size > 0)
+    {
+        buffer[0] = 0;
+    }
+}
+
+FormatBuffer& FormatBuffer::character(char c)
+{
+    if(used + 1 < size)
+    {
+        buffer[used++] = c;
+        buffer[used] = 0;
+    }
+
+    return *this;
+}
+
+size_t FormatBuffer::write(uint8_t c)
+{
+    if(used + 1 >= size)
+    {
+        return 0;
+    }
+
+    character(c);
+    return 1;
+}
+
+size_t FormatBuffer::write(const uint8_t* data, size_t length)
+{
+    size_t i;
+
+    for(i=0; i<length && used + 1 < size; i++)
+    {
+        character(data[i]);
+    }
+
+    return i;
+}
+
+FormatBuffer& FormatBuffer::text(const char* text)
+{
+    for(; *text != 0; text++)
+    {
+        character(*text);
+    }
+
+    return *this;
+}
+
+FormatBuffer& FormatBuffer::digits(unsigned long value, uint8_t minDigits)
+{
+    char reversed[20];  // enough for a 64 bit unsigned long on the host
+    uint8_t count = 0;
+
+    do
+    {
+        reversed[count++] = '0' + (value % 10);
+        value /= 10;
+    } while(value > 0);
+
+    for(; minDigits > count; minDigits--)
+    {
+        character('0');
+    }
+
+    while(count > 0)
+    {
+        character(reversed[--count]);
+    }
+
+    return *this;
+}
+
+FormatBuffer& FormatBuffer::number(long value, uint8_t minDigits)
+{
+    if(value < 0)
+    {
+        character('-');
+        return digits(0ul - (unsigned long)value, minDigits);
+    }
+
+    return digits(value, minDigits);
+}
+
+FormatBuffer& FormatBuffer::fixed(long value, uint8_t decimals)
+{
+    unsigned long magnitude = value < 0 ? 0ul - (unsigned long)value : value;
+    unsigned long scale;
+
+    if(decimals == 0)
+    {
+        return number(value);
+    }
+
+    decimals = min(decimals, (uint8_t)9);
+    scale = powersOfTen[decimals];
+
+    if(value < 0)
+    {
+        character('-');
+    }
+
+    digits(magnitude / scale, 1);
+    character('.');
+    return digits(magnitude % scale, decimals);
+}
+
+// halves round away from zero
+FormatBuffer& FormatBuffer::rounded(long value, uint8_t decimals)
+{
+    unsigned long magnitude = value < 0 ? 0ul - (unsigned long)value : value;
+    unsigned long scale = powersOfTen[min(decimals, (uint8_t)9)];
+
+    magnitude = (magnitude + scale / 2) / scale;
+
+    if(value < 0 && magnitude > 0)
+    {
+        character('-');
+    }
+
+    return digits(magnitude, 1);
+}
+
+FormatBuffer& FormatBuffer::duration(unsigned long seconds)
+{
+    digits(seconds / 3600, 2);
+    character(':');
+    digits((seconds % 3600) / 60, 2);
+    character(':');
+    return digits(seconds % 60, 2);
+}
+
+FormatBuffer& FormatBuffer::clock(int hour, int minute, bool twelveHour)
+{
+    const char* termination = hour < 12 ? "am" : "pm";
+
+    if(!twelveHour)
+    {
+        number(hour, 2);
+        character(':');
+        return number(minute, 2);
+    }
+
+    hour %= 12;
+    number(hour == 0 ? 12 : hour);
+    character(':');
+    number(minute, 2);
+    return text(termination);
+}
+
+FormatBuffer& FormatBuffer::date(int first, int second, int year)
+{
+    number(first);
+    character('/');
+    number(second);
+    character('/');
+    return number(year % 100, 2);
+}
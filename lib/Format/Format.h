@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Builds text in a caller's buffer for the handful of formats the display
+// uses, integers only so none of printf or its float support is pulled in.
+// Output past the end of the buffer is dropped, the text is always terminated.
+// It's also a Print, so JSON can be serialized straight into it.
+//
+//   FormatBuffer(buffer, sizeof(buffer)).rounded(deciDegrees, 1).character('C');
+class FormatBuffer : public Print
+{
+    public:
+        FormatBuffer(char* buffer, size_t size);
+
+        FormatBuffer& text(const char* text);
+        FormatBuffer& character(char c);
+        FormatBuffer& number(long value, uint8_t minDigits = 1);    // zero padded to minDigits
+        FormatBuffer& fixed(long value, uint8_t decimals);          // value in 10^-decimals units
+        FormatBuffer& rounded(long value, uint8_t decimals);        // same units, to the nearest whole number
+
+        FormatBuffer& duration(unsigned long seconds);              // HH:MM:SS, hours grow past 99
+        FormatBuffer& clock(int hour, int minute, bool twelveHour); // 13:05 or 1:05pm
+        FormatBuffer& date(int first, int second, int year);        // d/m/yy, in the order given
+
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* data, size_t length) override;
+
+        const char* c_str() const { return buffer; }
+        size_t length() const { return used; }
+
+    private:
+        FormatBuffer& digits(unsigned long value, uint8_t minDigits);
+
+        char* buffer;
+        size_t size;
+        size_t used;
+};
@@ -0,0 +1,63 @@
+#include <assert.h>
+#include "JsonArena.h"
+
+uint8_t JsonArena::buffer[JSON_ARENA_SIZE] __attribute__((aligned(8)));
+bool JsonArena::leased = false;
+bool JsonArena::heapFallback = !JSON_ARENA_STRICT;
+JsonArenaStats JsonArena::stats = {0, 0, 0};
+
+void JsonArena::recordUsage(size_t used)
+{
+    if(used > stats.highWater)
+    {
+        stats.highWater = used;
+    }
+}
+
+void* JsonArenaAllocator::allocate(size_t size)
+{
+    if(!JsonArena::leased && size <= JSON_ARENA_SIZE)
+    {
+        JsonArena::leased = true;
+        JsonArena::stats.leases++;
+        return JsonArena::buffer;
+    }
+
+    JsonArena::stats.fallbacks++;
+
+    if(JsonArena::leased)
+    {
+        Serial.println("JSON arena reentered, release the first document before making another.");
+        assert(!JSON_ARENA_STRICT);
+    }
+
+    if(!JsonArena::heapFallback)
+    {
+        Serial.println("JSON arena unavailable, document dropped.");
+        return nullptr;
+    }
+
+    return malloc(size);
+}
+
+void JsonArenaAllocator::deallocate(void* pointer)
+{
+    if(pointer == JsonArena::buffer)
+    {
+        JsonArena::leased = false;
+        return;
+    }
+
+    free(pointer);
+}
+
+// only used by shrinkToFit, the arena stays where it is
+void* JsonArenaAllocator::reallocate(void* pointer, size_t size)
+{
+    if(pointer == JsonArena::buffer)
+    {
+        return size <= JSON_ARENA_SIZE ? pointer : nullptr;
+    }
+
+    return realloc(pointer, size);
+}
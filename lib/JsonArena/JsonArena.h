@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// document sizes are worked out for the ESP8266, a host build with 64 bit
+// pointers needs twice the memory for the same document
+#define JSON_CAPACITY(bytes)    ((bytes) * sizeof(void*) / 4)
+
+#define JSON_ARENA_SIZE     JSON_CAPACITY(2048)     // bytes, the largest document any caller asks for
+
+// static allocation builds treat a document that can't have the arena as a bug,
+// a second document while the arena is leased stops with an assert and the heap
+// fallback starts off
+#if defined(STATIC_ALLOCATION_MODE) && STATIC_ALLOCATION_MODE
+#define JSON_ARENA_STRICT   true
+#else
+#define JSON_ARENA_STRICT   false
+#endif
+
+typedef struct JsonArenaStats
+{
+    unsigned long leases;       // documents given the arena
+    unsigned long fallbacks;    // documents not given the arena, from the heap unless the fallback is off
+    size_t highWater;           // most memory any document has used
+} JsonArenaStats;
+
+// BasicJsonDocument allocator handing out the shared arena, a document created
+// while another holds the arena, or bigger than the arena, falls back to the heap.
+// With the fallback off it gets no memory and parsing or building it fails.
+struct JsonArenaAllocator
+{
+    void* allocate(size_t size);
+    void deallocate(void* pointer);
+    void* reallocate(void* pointer, size_t size);
+};
+
+class JsonArena
+{
+    public:
+        static bool isLeased() { return leased; }
+        static JsonArenaStats* getStats() { return &stats; }
+        static void setHeapFallback(bool enabled) { heapFallback = enabled; }
+
+    private:
+        friend struct JsonArenaAllocator;
+        friend class ArenaJsonDocument;
+
+        static void recordUsage(size_t used);
+
+        static uint8_t buffer[JSON_ARENA_SIZE];
+        static bool leased;
+        static bool heapFallback;
+        static JsonArenaStats stats;
+};
+
+// Document leasing the arena for its lifetime, use in place of a
+// DynamicJsonDocument and keep the scope short. Only one parse or serialize
+// should be in flight at a time, so don't call out to other code while holding one.
+class ArenaJsonDocument : public BasicJsonDocument<JsonArenaAllocator>
+{
+    public:
+        explicit ArenaJsonDocument(size_t capacity) : BasicJsonDocument<JsonArenaAllocator>(JSON_CAPACITY(capacity)) {}
+        ~ArenaJsonDocument() { JsonArena::recordUsage(memoryUsage()); }
+};
@@ -0,0 +1,387 @@
+#include "JsonStreamFilter.h"
+
+JsonStreamFilter::JsonStreamFilter()
+{
+    output = nullptr;
+    outputSize = 0;
+    outputLength = 0;
+    overflowed = false;
+    depth = 0;
+    keyLength = 0;
+    keyTooLong = false;
+    keyEscape = false;
+    rawCopy = false;
+    rawDepth = 0;
+    rawString = false;
+    rawEscape = false;
+
+    // nothing is kept until begin()
+    state = JsonStream_Error;
+}
+
+void JsonStreamFilter::begin(JsonVariantConst filter)
+{
+    state = JsonStream_Value;
+    valueFilter = filter;
+    depth = 0;
+    outputLength = 0;
+    overflowed = false;
+
+    if(output != nullptr && outputSize > 0)
+    {
+        output[0] = 0;
+    }
+}
+
+size_t JsonStreamFilter::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t JsonStreamFilter::write(const uint8_t* buffer, size_t size)
+{
+    if(overflowed)
+    {
+        return 0;
+    }
+
+    for(size_t i=0; i<size; i++)
+    {
+        process((char)buffer[i]);
+
+        if(overflowed)
+        {
+            return i;
+        }
+    }
+
+    // malformed input is still taken, isComplete() tells the caller
+    return size;
+}
+
+void JsonStreamFilter::process(char c)
+{
+    switch(state)
+    {
+        case JsonStream_Value:
+            if(isSpace(c))
+            {
+                break;
+            }
+            if(c == ']' && depth > 0 && levels[depth - 1].array)
+            {
+                closeContainer(c);
+                break;
+            }
+            startValue(c);
+            break;
+
+        case JsonStream_Member:
+            if(isSpace(c))
+            {
+                break;
+            }
+            if(c == '"')
+            {
+                keyLength = 0;
+                keyTooLong = false;
+                keyEscape = false;
+                state = JsonStream_Key;
+            }
+            else if(c == '}')
+            {
+                closeContainer(c);
+            }
+            else
+            {
+                fail();
+            }
+            break;
+
+        case JsonStream_Key:
+            if(keyEscape)
+            {
+                keyEscape = false;
+                appendKey(c);
+            }
+            else if(c == '\\')
+            {
+                keyEscape = true;
+                appendKey(c);
+            }
+            else if(c == '"')
+            {
+                state = JsonStream_Colon;
+            }
+            else
+            {
+                appendKey(c);
+            }
+            break;
+
+        case JsonStream_Colon:
+            if(isSpace(c))
+            {
+                break;
+            }
+            if(c == ':')
+            {
+                valueFilter = memberFilter();
+                state = JsonStream_Value;
+            }
+            else
+            {
+                fail();
+            }
+            break;
+
+        case JsonStream_Next:
+            if(isSpace(c))
+            {
+                break;
+            }
+            if(c == ',')
+            {
+                if(levels[depth - 1].array)
+                {
+                    valueFilter = levels[depth - 1].filter;
+                    state = JsonStream_Value;
+                }
+                else
+                {
+                    state = JsonStream_Member;
+                }
+            }
+            else if(c == '}' || c == ']')
+            {
+                closeContainer(c);
+            }
+            else
+            {
+                fail();
+            }
+            break;
+
+        case JsonStream_Raw:
+            raw(c);
+            break;
+
+        default:
+            // anything after the end, or after an error, is ignored
+            break;
+    }
+}
+
+// the first character says what the value is, objects and arrays the filter
+// looks inside are walked, anything else it allows is copied whole
+void JsonStreamFilter::startValue(char c)
+{
+    bool selectObject = c == '{' && valueFilter.is<JsonObjectConst>();
+    bool selectArray = c == '[' && valueFilter.is<JsonArrayConst>();
+    bool copy = !valueFilter.is<JsonObjectConst>() && !valueFilter.is<JsonArrayConst>();
+
+    if(!isAllowed(valueFilter) || (!selectObject && !selectArray && !copy))
+    {
+        startRaw(c, false);
+        return;
+    }
+
+    if(depth > 0)
+    {
+        JsonStreamFilterLevel* parent = &levels[depth - 1];
+
+        if(parent->needComma)
+        {
+            emit(',');
+        }
+        parent->needComma = true;
+
+        if(!parent->array)
+        {
+            emitKey();
+        }
+    }
+
+    if(copy)
+    {
+        startRaw(c, true);
+        return;
+    }
+
+    if(depth == JSON_STREAM_FILTER_DEPTH)
+    {
+        fail();
+        return;
+    }
+
+    // arrays keep the filter for their elements
+    JsonStreamFilterLevel* level = &levels[depth++];
+    level->array = selectArray;
+    level->filter = selectArray ? valueFilter[0] : valueFilter;
+    level->needComma = false;
+
+    emit(c);
+
+    if(selectArray)
+    {
+        valueFilter = level->filter;
+        state = JsonStream_Value;
+    }
+    else
+    {
+        state = JsonStream_Member;
+    }
+}
+
+void JsonStreamFilter::endValue()
+{
+    state = depth == 0 ? JsonStream_Done : JsonStream_Next;
+}
+
+void JsonStreamFilter::closeContainer(char c)
+{
+    if((c == ']') != levels[depth - 1].array)
+    {
+        fail();
+        return;
+    }
+
+    emit(c);
+    depth--;
+    endValue();
+}
+
+void JsonStreamFilter::startRaw(char c, bool copy)
+{
+    rawCopy = copy;
+    rawDepth = 0;
+    rawString = false;
+    rawEscape = false;
+    state = JsonStream_Raw;
+
+    raw(c);
+}
+
+// a scalar ends on the character after it, which belongs to the level above
+void JsonStreamFilter::raw(char c)
+{
+    if(rawString)
+    {
+        if(rawCopy)
+        {
+            emit(c);
+        }
+
+        if(rawEscape)
+        {
+            rawEscape = false;
+        }
+        else if(c == '\\')
+        {
+            rawEscape = true;
+        }
+        else if(c == '"')
+        {
+            rawString = false;
+            if(rawDepth == 0)
+            {
+                endValue();
+            }
+        }
+        return;
+    }
+
+    if(isSpace(c))
+    {
+        if(rawDepth == 0)
+        {
+            endValue();
+        }
+        return;
+    }
+
+    if(rawDepth == 0 && (c == ',' || c == '}' || c == ']'))
+    {
+        endValue();
+        process(c);
+        return;
+    }
+
+    if(rawCopy)
+    {
+        emit(c);
+    }
+
+    if(c == '"')
+    {
+        rawString = true;
+    }
+    else if(c == '{' || c == '[')
+    {
+        rawDepth++;
+    }
+    else if(c == '}' || c == ']')
+    {
+        if(--rawDepth == 0)
+        {
+            endValue();
+        }
+    }
+}
+
+void JsonStreamFilter::appendKey(char c)
+{
+    if(keyLength + 1 < JSON_STREAM_FILTER_KEY)
+    {
+        key[keyLength++] = c;
+    }
+    else
+    {
+        keyTooLong = true;
+    }
+}
+
+JsonVariantConst JsonStreamFilter::memberFilter()
+{
+    if(keyTooLong)
+    {
+        return JsonVariantConst();
+    }
+
+    key[keyLength] = 0;
+    return levels[depth - 1].filter[(const char*)key];
+}
+
+void JsonStreamFilter::emit(char c)
+{
+    if(state == JsonStream_Error)
+    {
+        return;
+    }
+
+    if(outputLength + 1 >= outputSize)
+    {
+        overflowed = true;
+        fail();
+        return;
+    }
+
+    output[outputLength++] = c;
+    output[outputLength] = 0;
+}
+
+void JsonStreamFilter::emitKey()
+{
+    emit('"');
+    for(size_t i=0; i<keyLength; i++)
+    {
+        emit(key[i]);
+    }
+    emit('"');
+    emit(':');
+}
+
+bool JsonStreamFilter::isAllowed(JsonVariantConst filter)
+{
+    return !filter.isNull() && !(filter.is<bool>() && !filter.as<bool>());
+}
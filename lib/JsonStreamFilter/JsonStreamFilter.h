@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define JSON_STREAM_FILTER_DEPTH    8       // nested objects and arrays the filter can select inside
+#define JSON_STREAM_FILTER_KEY      32      // bytes, longer keys don't match the filter
+
+enum JsonStreamFilterState
+{
+    JsonStream_Value,           // waiting for a value
+    JsonStream_Member,          // in an object, waiting for a key or the end
+    JsonStream_Key,
+    JsonStream_Colon,
+    JsonStream_Next,            // after a value, waiting for a comma or the end
+    JsonStream_Raw,             // in a value being copied or skipped whole
+    JsonStream_Done,
+    JsonStream_Error,           // malformed, too deep or out of space
+};
+
+typedef struct JsonStreamFilterLevel
+{
+    JsonVariantConst filter;
+    bool array;
+    bool needComma;
+} JsonStreamFilterLevel;
+
+// Filters JSON a piece at a time as it arrives, writing only what an ArduinoJson
+// filter document selects into a fixed buffer. The rest is never held, so a
+// reply of any size only needs room for the fields kept. The output is null
+// terminated JSON and can be parsed in place once isComplete().
+class JsonStreamFilter : public Print
+{
+    public:
+        JsonStreamFilter();
+
+        void setOutput(char* buffer, size_t size) { output = buffer; outputSize = size; }
+
+        // the filter document has to outlive the stream
+        void begin(JsonVariantConst filter);
+
+        // returns less than size when the kept fields don't fit the output
+        using Print::write;
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+
+        bool isComplete() { return state == JsonStream_Done; }
+        bool hasOverflowed() { return overflowed; }
+        char* getOutput() { return output; }
+        size_t length() { return outputLength; }
+
+    private:
+        void process(char c);
+        void startValue(char c);
+        void endValue();
+        void closeContainer(char c);
+        void startRaw(char c, bool copy);
+        void raw(char c);
+        void appendKey(char c);
+        JsonVariantConst memberFilter();
+        void emit(char c);
+        void emitKey();
+        void fail() { state = JsonStream_Error; }
+
+        static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+        static bool isAllowed(JsonVariantConst filter);
+
+        JsonStreamFilterState state;
+        JsonVariantConst valueFilter;       // for the value being waited for
+
+        JsonStreamFilterLevel levels[JSON_STREAM_FILTER_DEPTH];
+        int depth;
+
+        char key[JSON_STREAM_FILTER_KEY];
+        size_t keyLength;
+        bool keyTooLong;
+        bool keyEscape;
+
+        // copied or skipped values only track nesting and strings
+        bool rawCopy;
+        unsigned int rawDepth;
+        bool rawString;
+        bool rawEscape;
+
+        char* output;
+        size_t outputLength;
+        size_t outputSize;
+        bool overflowed;
+};
@@ -1,13 +1,21 @@
 // Based on work by ThingPulse Ltd., https://thingpulse.com
  
-#include <WiFiClient.h>
-#include <ESP8266WiFi.h>
-#include <ESP8266HTTPClient.h>
+#include "AsyncHttpClient.h"
 #include "OpenWeatherMapCurrent.h"
 #include <ArduinoJson.h>
+#include "JsonArena.h"
+
+// kept as a String so a request doesn't have to build one
+static const String openWeatherHost = OPEN_WEATHER_HOST;
 
 OpenWeatherMapCurrent::OpenWeatherMapCurrent()
 {
+    updatedCallback = nullptr;
+    data.validData = false;
+
+    // one request every few minutes, no point holding a socket open
+    client.setKeepAlive(false);
+    client.setBodyBuffer(body, sizeof(body));
 }
 
 OpenWeatherMapCurrentData* OpenWeatherMapCurrent::getCurrentData()
@@ -15,51 +23,74 @@ OpenWeatherMapCurrentData* OpenWeatherMapCurrent::getCurrentData()
     return &data;
 }
 
-void OpenWeatherMapCurrent::update(String appId, String location)
+void OpenWeatherMapCurrent::update(const String& appId, const String& location)
 {
-    doUpdate(buildUrl(appId, "q=" + location));
+    doUpdate(appId, "q=", location);
 }
 
-void OpenWeatherMapCurrent::updateById(String appId, String locationId)
+void OpenWeatherMapCurrent::updateById(const String& appId, const String& locationId)
 {
-    doUpdate(buildUrl(appId, "id=" + locationId));
+    doUpdate(appId, "id=", locationId);
 }
 
-String OpenWeatherMapCurrent::buildUrl(String appId, String locationParameter)
+// built in place so the uri keeps its buffer from one update to the next
+void OpenWeatherMapCurrent::buildUri(const String& appId, const char* locationKey, const String& location)
 {
-    String units = metric ? "metric" : "imperial";
     // something is caching data, don't know where, try a random param
     int randomForCache = random(2147483647);
-    return "http://api.openweathermap.org/data/2.5/weather?" + locationParameter + "&appid=" + appId + "&units=" + units + "&lang=" + language + "&nospig=" + randomForCache;
+
+    uri = "/data/2.5/weather?";
+    uri += locationKey;
+    uri += location;
+    uri += "&appid=";
+    uri += appId;
+    uri += metric ? "&units=metric" : "&units=imperial";
+    uri += "&lang=";
+    uri += language;
+    uri += "&nospig=";
+    uri += randomForCache;
 }
 
-void OpenWeatherMapCurrent::doUpdate(String url)
+// non-blocking, data is updated and the callback run once the response arrives
+void OpenWeatherMapCurrent::doUpdate(const String& appId, const char* locationKey, const String& location)
 {
-    data.validData = false;
+    // still waiting on the last one
+    if(client.isBusy())
+    {
+        return;
+    }
+
+    buildUri(appId, locationKey, location);
+    client.get(openWeatherHost, OPEN_WEATHER_PORT, uri.c_str(), "", [this](AsyncHttpClient* client, int httpCode, char* json, size_t length)
+    {
+        handleResponse(httpCode, json, length);
+    });
+}
 
-    // must be in this order
-    WiFiClient client;
-    HTTPClient http;
+void OpenWeatherMapCurrent::handleResponse(int httpCode, char* json, size_t length)
+{
+    data.validData = false;
 
-    http.begin(client, url);
-    int httpCode = http.GET();
+    if (httpCode == 200)
+    {
+        deserializeWeather(json, length);
+    }
 
-    if (httpCode > 0)
+    if(updatedCallback != nullptr)
     {
-        if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_MOVED_PERMANENTLY)
-        {
-            deserializeWeather(http.getString());
-        }        
+        updatedCallback();
     }
-    http.end();
 }
 
-void OpenWeatherMapCurrent::deserializeWeather(String json)
+void OpenWeatherMapCurrent::deserializeWeather(char* json, size_t length)
 {
     //Serial.println(json);
 
-    DynamicJsonDocument doc(1024); // size calculated with ArduinoJson assistant
-    deserializeJson(doc, json);
+    ArenaJsonDocument doc(1024); // size calculated with ArduinoJson assistant
+    if(deserializeJson(doc, json, length))
+    {
+        return;
+    }
 
     JsonObject weather_0 = doc["weather"][0];
     data.main = (const char*)weather_0["main"];
@@ -79,8 +110,8 @@ void OpenWeatherMapCurrent::deserializeWeather(String json)
     data.pressure = main["pressure"];
     data.humidity = main["humidity"];   
     
-    data.description = captaliseString(data.description);
-    data.main = captaliseString(data.main);
+    captaliseString(data.description);
+    captaliseString(data.main);
 
     JsonObject clouds = doc["clouds"];
     if(clouds.isNull())
@@ -115,7 +146,7 @@ void OpenWeatherMapCurrent::deserializeWeather(String json)
     data.validData = true;
 }
 
-String OpenWeatherMapCurrent::captaliseString(String input)
+void OpenWeatherMapCurrent::captaliseString(String& input)
 {
     char last = ' ';
 
@@ -130,6 +161,4 @@ String OpenWeatherMapCurrent::captaliseString(String input)
         }
         last = c;
     }
-
-    return input;
 }
@@ -24,6 +24,11 @@
 #pragma once
 
 #include <Arduino.h>
+#include "AsyncHttpClient.h"
+
+#define OPEN_WEATHER_HOST   "api.openweathermap.org"
+#define OPEN_WEATHER_PORT   80
+#define OPEN_WEATHER_BODY_SIZE  2048    // bytes, a current weather reply is under 1KB
 
 typedef struct OpenWeatherMapCurrentData
 {
@@ -56,8 +61,9 @@ class OpenWeatherMapCurrent
 {
     public:
         OpenWeatherMapCurrent();
-        void update(String appId, String location);
-        void updateById(String appId, String locationId);
+        void update(const String& appId, const String& location);
+        void updateById(const String& appId, const String& locationId);
+        void setUpdatedCallback(void(* callback)()) { updatedCallback = callback; }
 
         void setMetric(boolean metric) { this->metric = metric; }
         boolean isMetric() { return metric; }
@@ -70,10 +76,15 @@ class OpenWeatherMapCurrent
     private:
         boolean metric = true;
         String language;
+        String uri;
         OpenWeatherMapCurrentData data;
+        AsyncHttpClient client;
+        char body[OPEN_WEATHER_BODY_SIZE];
+        void (* updatedCallback)();
 
-        void doUpdate(String url);
-        String buildUrl(String appId, String locationParameter);
-        void deserializeWeather(String json);
-        String captaliseString(String input);
+        void doUpdate(const String& appId, const char* locationKey, const String& location);
+        void handleResponse(int httpCode, char* json, size_t length);
+        void buildUri(const String& appId, const char* locationKey, const String& location);
+        void deserializeWeather(char* json, size_t length);
+        void captaliseString(String& input);
 };
@@ -4,10 +4,71 @@
 #include "TFT_eSPI.h"
 #include <time.h>
 #include "icons/weatherIcons.h"
+#include "tempArcTable.h"
 #include "Settings.h"
+#include "Format.h"
+
+#if TEMP_ARC_TABLE_START != TEMP_ARC_START || TEMP_ARC_TABLE_SPAN != TEMP_ARC_SPAN || TEMP_ARC_TABLE_DEGREE_PER_SEG != TEMP_ARC_DEGREE_PER_SEG \
+    || TEMP_ARC_TABLE_RADIUS != TEMP_ARC_RADIUS || TEMP_ARC_TABLE_WIDTH != TEMP_ARC_WIDTH
+#error "tempArcTable.h is out of date, run arcTable.py"
+#endif
 
 const char daysOfTheWeek[7][12] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 
+// weather values arrive as floats, formatted as tenths
+static long tenths(float value)
+{
+    return lroundf(value * 10);
+}
+
+#define STRINGIFY(x)        #x
+#define TEMP_TEXT(x)        STRINGIFY(x) "C"
+
+// constant text, widths come from the text layout's cache by address so each
+// piece of text must only be defined once
+static const char WIDEST_CLOCK[] = "11:59pm";
+static const char WIDEST_DAY[] = "Wed";
+static const char WIDEST_DATE[] = "31/12/99";
+
+static const char LABEL_TOOL[] = "Tool";
+static const char LABEL_BED[] = "Bed";
+static const char LABEL_ESTIMATED_TIME[] = "Estimated time: ";
+static const char LABEL_PRINT_TIME[] = "Print time: ";
+static const char LABEL_REMAINING_TIME[] = "Remaining time: ";
+static const char LABEL_FILAMENT[] = "Filament: ";
+static const char LABEL_FILE[] = "File:";
+static const char WIDEST_TOOL_TEMP[] = TEMP_TEXT(TOOL_TEMP_MAX);
+static const char WIDEST_BED_TEMP[] = TEMP_TEXT(BED_TEMP_MAX);
+static const char WIDEST_TIME[] = "999:59:59";
+static const char WIDEST_FILAMENT[] = "9999.9m";
+static const char WIDEST_PERCENT[] = "100%";
+
+// print monitor page text by font, measured when the page is entered
+static const char* const PRINT_INFO_TEXT[] = {
+    LABEL_TOOL, LABEL_BED, LABEL_ESTIMATED_TIME, LABEL_PRINT_TIME, LABEL_REMAINING_TIME, LABEL_FILAMENT,
+    LABEL_FILE, WIDEST_TOOL_TEMP, WIDEST_BED_TEMP, WIDEST_TIME, WIDEST_FILAMENT, WIDEST_PERCENT,
+};
+static const char* const PRINT_INFO_LARGE_TEXT[] = {WIDEST_TOOL_TEMP, WIDEST_BED_TEMP};
+
+// OpenWeather icon codes to our images, not all have their own
+typedef struct WeatherIcon
+{
+    const char* id;
+    const uint16_t* data;
+} WeatherIcon;
+
+const WeatherIcon weatherIcons[] = {
+    {"01d", icon_01d_rle}, {"02d", icon_02d_rle}, {"03d", icon_03d_rle}, {"04d", icon_03d_rle},
+    {"09d", icon_09d_rle}, {"10d", icon_10d_rle}, {"11d", icon_11d_rle}, {"13d", icon_13d_rle},
+    {"50d", icon_50d_rle}, {"01n", icon_01n_rle}, {"02n", icon_02n_rle}, {"03n", icon_03d_rle},
+    {"04n", icon_03d_rle}, {"09n", icon_09n_rle}, {"10n", icon_09n_rle}, {"11n", icon_11n_rle},
+    {"13n", icon_13n_rle}, {"50n", icon_50d_rle},
+};
+
+// area of one full temperature gauge, skipped when its segment count is unchanged
+const int TEMP_ARC_PIXELS = (TEMP_ARC_SPAN / 360.0f) * PI *
+    ((TEMP_ARC_RADIUS * TEMP_ARC_RADIUS) - ((TEMP_ARC_RADIUS - TEMP_ARC_WIDTH) * (TEMP_ARC_RADIUS - TEMP_ARC_WIDTH)));
+
 DisplayTFT::DisplayTFT()
 {
     tft = new TFT_eSPI();
@@ -18,6 +79,9 @@ DisplayTFT::DisplayTFT()
     // Swap the colour byte order when rendering for images
     tft->setSwapBytes(true);
 
+    textLayout.init(tft);
+    createSprite();
+
     // if dimming is setup, TODO
     analogWrite(BRIGHTNESS_PIN, brightness);
     tft->writecommand(0x11);
@@ -25,6 +89,7 @@ DisplayTFT::DisplayTFT()
     showingPrintInfo = false;
     showingNoPrintInfo = false;
     showingNotEnabled = false;
+    invalidateWidgets();
 }
  
 void DisplayTFT::setDisplayBrightness(int percent)
@@ -46,14 +111,29 @@ void DisplayTFT::drawStartupDisplay()
 void DisplayTFT::clearDisplay()
 {
     tft->fillScreen(BACKGROUND_COLOUR);
+
+    showingPrintInfo = false;
+    showingNoPrintInfo = false;
+    showingNotEnabled = false;
+    invalidateWidgets();
 }
 
 void DisplayTFT::setDisplayMode(DisplayMode mode)
 {
+    // moving between printers keeps the page, only widgets that differ get drawn
+    bool keepPage = mode == DisplayMode_PrintMonitor && getDisplayMode() == DisplayMode_PrintMonitor;
+
     DisplayBase::setDisplayMode(mode);
 
+    if(keepPage)
+    {
+        return;
+    }
+
     showingPrintInfo = false;
     showingNoPrintInfo = false;
+    showingNotEnabled = false;
+    invalidateWidgets();
 
     tft->fillRect(0, 0, tft->width(), TIME_Y - 1, BACKGROUND_COLOUR);
 
@@ -136,35 +216,24 @@ int DisplayTFT::drawCurrentWeather(OpenWeatherMapCurrentData* currentWeather, in
         tft->setTextFont(4);
         tft->setTextColor(TEMPERATURE_COLOUR); 
 
-        String tempString = String(currentWeather->temp, 1);
+        char tempString[16];
+        char description[64];
         int x = tft->width()/2 - 40;
         int widthTemp;
 
+        FormatBuffer(tempString, sizeof(tempString)).fixed(tenths(currentWeather->temp), 1).text(getTempPostfix());
         tft->setTextDatum(TR_DATUM);
-        tft->drawString(tempString + getTempPostfix(), x , y + 40);    
-        widthTemp = tft->textWidth(tempString + getTempPostfix());
-
-        String description = currentWeather->description;
-
-        bool truncatedDescription = false;
+        tft->drawString(tempString, x , y + 40);    
+        widthTemp = tft->textWidth(tempString);
 
         tft->setTextFont(2);
         tft->setTextColor(CURRENT_WEATHER_CONDITIONS_COLOUR); 
         tft->setTextDatum(TL_DATUM);
 
-        while(tft->textWidth(description) > (tft->width() - (x - widthTemp)))
-        {
-            truncatedDescription = true;
-            description = description.substring(0, description.length()-1);
-        }
-
-        if(truncatedDescription)
-        {
-            description = description + "...";
-        }
+        textLayout.truncate(description, sizeof(description), currentWeather->description.c_str(), tft->width() - (x - widthTemp));
         tft->drawString(description, x - widthTemp, y + 82);    
 
-        tft->pushImage(160, y+30, WEATHER_ICON_WIDTH, WEATHER_ICON_HEIGHT, getIconData(currentWeather->icon));
+        drawIcon(160, y+30, getIconData(currentWeather->icon));
 
         return x - widthTemp;
     }
@@ -188,24 +257,24 @@ void DisplayTFT::drawTimeDisplay(unsigned long epochTime, int y)
 
     tft->setTextDatum(BR_DATUM);
    
-    formatClockString(buffer, timeInfo);
-    tft->setTextPadding(tft->textWidth("11:59pm"));
+    formatClockString(buffer, sizeof(buffer), timeInfo);
+    tft->setTextPadding(textLayout.constantWidth(WIDEST_CLOCK));
     tft->drawString(buffer, tft->width()/2-35, y); 
 
     tft->setTextDatum(BC_DATUM);
-    tft->setTextPadding(tft->textWidth(daysOfTheWeek[3]));  // Wed longest?
+    tft->setTextPadding(textLayout.constantWidth(WIDEST_DAY));
     tft->drawString(daysOfTheWeek[timeInfo->tm_wday], tft->width()/2, y); 
 
     tft->setTextDatum(BL_DATUM);
-    tft->setTextPadding(tft->textWidth("31/12/99"));
+    tft->setTextPadding(textLayout.constantWidth(WIDEST_DATE));
 
     switch(getDateFormat())
     {
         case DateFormat_DDMMYY:
-            sprintf(buffer, "%d/%d/%02d", timeInfo->tm_mday, timeInfo->tm_mon+1, (timeInfo->tm_year+1900) % 100);
+            FormatBuffer(buffer, sizeof(buffer)).date(timeInfo->tm_mday, timeInfo->tm_mon+1, timeInfo->tm_year+1900);
             break;
         case DateFormat_MMDDYY:
-            sprintf(buffer, "%d/%d/%02d", timeInfo->tm_mon+1, timeInfo->tm_mday, (timeInfo->tm_year+1900) % 100);
+            FormatBuffer(buffer, sizeof(buffer)).date(timeInfo->tm_mon+1, timeInfo->tm_mday, timeInfo->tm_year+1900);
             break;        
     }
     
@@ -235,24 +304,25 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
         tft->setTextDatum(TL_DATUM);
 
         // min and max temps
-        sprintf(buffer, "Min | Max: ");
+        strlcpy(buffer, "Min | Max: ", sizeof(buffer));
         width = tft->textWidth(buffer);
         tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
         tft->drawString(buffer, x, y);    
 
-        sprintf(buffer, "%.1f%s | Max: %.1f%s", currentWeather->tempMin, getTempPostfix(), currentWeather->tempMax, getTempPostfix());
+        FormatBuffer(buffer, sizeof(buffer)).fixed(tenths(currentWeather->tempMin), 1).text(getTempPostfix())
+            .text(" | Max: ").fixed(tenths(currentWeather->tempMax), 1).text(getTempPostfix());
         tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
         tft->drawString(buffer, x + width, y);    
 
         y += tft->fontHeight();
 
         // humidity
-        sprintf(buffer, "Humidity: ");
+        strlcpy(buffer, "Humidity: ", sizeof(buffer));
         width = tft->textWidth(buffer);
         tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
         tft->drawString(buffer, x, y);    
         
-        sprintf(buffer, "%d%%", currentWeather->humidity);
+        FormatBuffer(buffer, sizeof(buffer)).number(currentWeather->humidity).character('%');
         tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
         tft->drawString(buffer, x + width, y);    
         
@@ -260,17 +330,17 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
 
         // pressure
         tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
-        sprintf(buffer, "Pressure: ");
+        strlcpy(buffer, "Pressure: ", sizeof(buffer));
         width = tft->textWidth(buffer);
         tft->drawString(buffer, x, y);    
 
         if(getDisplayMetric())
         {
-            sprintf(buffer, "%d hpa", currentWeather->pressure);
+            FormatBuffer(buffer, sizeof(buffer)).number(currentWeather->pressure).text(" hpa");
         }
         else
         {     
-            sprintf(buffer, "%d mb", currentWeather->pressure);
+            FormatBuffer(buffer, sizeof(buffer)).number(currentWeather->pressure).text(" mb");
         }
         tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
         tft->drawString(buffer, x + width, y);    
@@ -279,17 +349,19 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
 
         // wind
         tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
-        sprintf(buffer, "Wind: ");
+        strlcpy(buffer, "Wind: ", sizeof(buffer));
         width = tft->textWidth(buffer);
         tft->drawString(buffer, x, y);    
 
         if(getDisplayMetric())
         {
-            sprintf(buffer, "%.1fm/s from %.0f degress", currentWeather->windSpeed, currentWeather->windDeg);
+            FormatBuffer(buffer, sizeof(buffer)).fixed(tenths(currentWeather->windSpeed), 1).text("m/s from ")
+                .number(lroundf(currentWeather->windDeg)).text(" degress");
         }
         else
         {
-            sprintf(buffer, "%.1fmph from %.0f degress", currentWeather->windSpeed, currentWeather->windDeg);
+            FormatBuffer(buffer, sizeof(buffer)).fixed(tenths(currentWeather->windSpeed), 1).text("mph from ")
+                .number(lroundf(currentWeather->windDeg)).text(" degress");
         }
         
         tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
@@ -301,11 +373,11 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
         if(currentWeather->cloudPercentage > -1)
         {
             tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
-            sprintf(buffer, "Clouds: ");
+            strlcpy(buffer, "Clouds: ", sizeof(buffer));
             width = tft->textWidth(buffer);
             tft->drawString(buffer, x, y);    
 
-            sprintf(buffer, "%d%%", currentWeather->cloudPercentage);
+            FormatBuffer(buffer, sizeof(buffer)).number(currentWeather->cloudPercentage).character('%');
             tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
             tft->drawString(buffer, x + width, y);    
             y += tft->fontHeight();
@@ -315,11 +387,12 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
         if(currentWeather->rainOneHour > -1)
         {
             tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
-            sprintf(buffer, "Rain: ");
+            strlcpy(buffer, "Rain: ", sizeof(buffer));
             width = tft->textWidth(buffer);
             tft->drawString(buffer, x, y);    
 
-            sprintf(buffer, "1h %dmm, 3h %dmm", currentWeather->rainOneHour, currentWeather->rainThreeHour);
+            FormatBuffer(buffer, sizeof(buffer)).text("1h ").number(currentWeather->rainOneHour).text("mm, 3h ")
+                .number(currentWeather->rainThreeHour).text("mm");
             tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
             tft->drawString(buffer, x + width, y);    
   
@@ -331,11 +404,11 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
         timeInfo = gmtime(&time);
 
         tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
-        sprintf(buffer, "Sunrise: ");
+        strlcpy(buffer, "Sunrise: ", sizeof(buffer));
         width = tft->textWidth(buffer);
         tft->drawString(buffer, x, y);    
 
-        formatClockString(buffer, timeInfo);
+        formatClockString(buffer, sizeof(buffer), timeInfo);
         tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
         tft->drawString(buffer, x + width, y);   
         y += tft->fontHeight();
@@ -345,11 +418,11 @@ void DisplayTFT::drawDetailedCurrentWeather(OpenWeatherMapCurrentData* currentWe
         timeInfo = gmtime(&time);
 
         tft->setTextColor(DETAILED_WEATHER_DESCRIPTION_COLOUR); 
-        sprintf(buffer, "Sunset: ");
+        strlcpy(buffer, "Sunset: ", sizeof(buffer));
         width = tft->textWidth(buffer);
         tft->drawString(buffer, x, y);    
 
-        formatClockString(buffer, timeInfo);
+        formatClockString(buffer, sizeof(buffer), timeInfo);
         tft->setTextColor(DETAILED_WEATHER_INFO_COLOUR); 
         tft->drawString(buffer, x + width, y);   
         y += tft->fontHeight();
@@ -372,7 +445,7 @@ void DisplayTFT::drawWeatherNotEnabled()
  * 
 ****************************************************************************************/
 
-void DisplayTFT::drawOctoPrintStatus(OctoPrintMonitorData* printData, String printerName, bool enabled)
+void DisplayTFT::drawOctoPrintStatus(OctoPrintMonitorData* printData, const String& printerName, bool enabled)
 {
     if(getDisplayMode() != DisplayMode_PrintMonitor)
     {
@@ -409,6 +482,7 @@ void DisplayTFT::drawOctoPrintStatus(OctoPrintMonitorData* printData, String pri
             if(!showingPrintInfo)
             {
                 tft->fillRect(0, 0, tft->width(), TIME_Y-1, BACKGROUND_COLOUR);
+                invalidateWidgets();
                 showingPrintInfo = true;
             }
             drawPrintInfo(printData, printerName);
@@ -416,7 +490,7 @@ void DisplayTFT::drawOctoPrintStatus(OctoPrintMonitorData* printData, String pri
     }
 }
 
-void DisplayTFT::drawInvalidPrintData(String printerName)
+void DisplayTFT::drawInvalidPrintData(const String& printerName)
 {
     tft->setTextDatum(MC_DATUM);
     tft->setTextFont(2);
@@ -429,7 +503,7 @@ void DisplayTFT::drawInvalidPrintData(String printerName)
     tft->drawString(printerName, tft->width()/2, TOOL_TEMP_DISPLAY_Y - 88);  
 }
 
-void DisplayTFT::drawPrinterNotEnabled(String printerName)
+void DisplayTFT::drawPrinterNotEnabled(const String& printerName)
 {
     tft->setTextDatum(TC_DATUM);
     tft->setTextColor(PRINT_MONITOR_PRINTER_NAME_COLOUR, BACKGROUND_COLOUR); 
@@ -453,30 +527,40 @@ void DisplayTFT::drawNotSetupDisplay()
     y += tft->fontHeight();
     tft->drawString("add a printer", tft->width()/2, y);  
     y += tft->fontHeight() * 2;
-    sprintf(buffer, "IP Address: %s", WiFi.localIP().toString().c_str());
+    FormatBuffer(buffer, sizeof(buffer)).text("IP Address: ").text(WiFi.localIP().toString().c_str());
     tft->drawString(buffer, tft->width()/2, y); 
 }
 
-void DisplayTFT::drawPrintInfo(OctoPrintMonitorData* printData, String printerName)
+void DisplayTFT::drawPrintInfo(OctoPrintMonitorData* printData, const String& printerName)
 {
+    renderStats.frames++;
+    renderStats.pixelsDrawn = 0;
+    renderStats.pixelsSaved = 0;
+
+    if(!widgets.labelsDrawn)
+    {
+        textLayout.precompute(PRINT_INFO_TEXT, sizeof(PRINT_INFO_TEXT) / sizeof(PRINT_INFO_TEXT[0]), 2);
+        textLayout.precompute(PRINT_INFO_LARGE_TEXT, sizeof(PRINT_INFO_LARGE_TEXT) / sizeof(PRINT_INFO_LARGE_TEXT[0]), 4);
+    }
+
     tft->setTextFont(2);
     tft->setTextDatum(TC_DATUM);
     tft->setTextColor(PRINT_MONITOR_PRINTER_NAME_COLOUR, BACKGROUND_COLOUR); 
-    tft->setTextPadding(tft->width());  
 
-    String printer = printerName;
-    if(printer == "")
-    {
-        printer = "Printer";
-    }
+    const char* printer = printerName.length() > 0 ? printerName.c_str() : "Printer";
+    char title[WIDGET_LINE_SIZE];
      
-    String title = getPrintInfoTitle(printer, printData->printerFlags);
-    tft->drawString(title, tft->width()/2, TOOL_TEMP_DISPLAY_Y - 88); 
+    getPrintInfoTitle(title, sizeof(title), printer, printData->printerFlags);
+    drawTextWidget(widgets.title, sizeof(widgets.title), title, tft->width()/2, TOOL_TEMP_DISPLAY_Y - 88, tft->width()); 
 
-    drawTempArc("Tool", printData->tool0Temp, printData->tool0Target, TOOL_TEMP_MAX, TOOL_TEMP_DISPLAY_X, TOOL_TEMP_DISPLAY_Y);
-    drawTempArc("Bed", printData->bedTemp, printData->bedTarget, BED_TEMP_MAX, BED_TEMP_DISPLAY_X, BED_TEMP_DISPLAY_Y);
+    drawTempArc(LABEL_TOOL, WIDEST_TOOL_TEMP, printData->tool0Temp, printData->tool0Target, TOOL_TEMP_MAX, TOOL_TEMP_DISPLAY_X, TOOL_TEMP_DISPLAY_Y, &widgets.tool);
+    drawTempArc(LABEL_BED, WIDEST_BED_TEMP, printData->bedTemp, printData->bedTarget, BED_TEMP_MAX, BED_TEMP_DISPLAY_X, BED_TEMP_DISPLAY_Y, &widgets.bed);
 
-    tft->drawLine(0, PRINT_INFO_SECTION_DIVIDER_Y, tft->width(), PRINT_INFO_SECTION_DIVIDER_Y, SECTION_HEADER_LINE_COLOUR);
+    if(!widgets.labelsDrawn)
+    {
+        tft->drawLine(0, PRINT_INFO_SECTION_DIVIDER_Y, tft->width(), PRINT_INFO_SECTION_DIVIDER_Y, SECTION_HEADER_LINE_COLOUR);
+        widgets.labelsDrawn = true;
+    }
 
     if(printData->jobLoaded)
     {
@@ -484,22 +568,37 @@ void DisplayTFT::drawPrintInfo(OctoPrintMonitorData* printData, String printerNa
     }
     else
     {
-        tft->fillRect(0, PRINT_INFO_SECTION_DIVIDER_Y + 1, tft->width(), TIME_Y - PRINT_INFO_SECTION_DIVIDER_Y - 1, BACKGROUND_COLOUR);
+        int jobArea = tft->width() * (TIME_Y - PRINT_INFO_SECTION_DIVIDER_Y - 1);
+
+        if(widgets.jobShown)
+        {
+            tft->fillRect(0, PRINT_INFO_SECTION_DIVIDER_Y + 1, tft->width(), TIME_Y - PRINT_INFO_SECTION_DIVIDER_Y - 1, BACKGROUND_COLOUR);
+            clearJobWidgets();
+            renderStats.pixelsDrawn += jobArea;
+        }
+        else
+        {
+            renderStats.pixelsSaved += jobArea;
+        }
     }   
+
+    renderStats.totalPixelsSaved += renderStats.pixelsSaved;
 }
 
 void DisplayTFT::drawJobInfo(OctoPrintMonitorData* printData, int y)
 {
     int x;
-    char estimatedTimeBuffer[32];
     char buffer[128];
     char timeBuffer[32];
     int infoX, elapsedPadding;
+    bool drawLabels = !widgets.jobShown;
+
+    widgets.jobShown = true;
     
     x = (tft->width() / 2) - (PRINT_PROGRESS_BAR_WIDTH / 2);
     y += 15;
     
-    drawProgressBar(printData->percentComplete, x, y, PRINT_PROGRESS_BAR_WIDTH, PRINT_PROGRESS_BAR_HEIGHT, 
+    drawProgressBar(printData->progress, x, y, PRINT_PROGRESS_BAR_WIDTH, PRINT_PROGRESS_BAR_HEIGHT, 
         PRINT_MONITOR_PROGRESS_BAR_COLOUR, PRINT_MONITOR_PROGRESS_BAR_BACKGROUND_COLOUR);
 
     y += PRINT_PROGRESS_BAR_HEIGHT;
@@ -511,500 +610,484 @@ void DisplayTFT::drawJobInfo(OctoPrintMonitorData* printData, int y)
 
     // estimated time
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_HEADING_COLOUR, BACKGROUND_COLOUR); 
-    infoX = x + tft->drawString("Estimated time: ", x, y);        
+    infoX = x + drawLabel(LABEL_ESTIMATED_TIME, x, y, drawLabels);        
     
-    sprintf(buffer, "999:59:59");
-    tft->setTextPadding(tft->textWidth(buffer));
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_COLOUR, BACKGROUND_COLOUR); 
-    formatSeconds(estimatedTimeBuffer, (int)printData->estimatedPrintTime);
-    sprintf(buffer, "%s", estimatedTimeBuffer);
-    elapsedPadding = tft->textWidth(estimatedTimeBuffer);
-    tft->drawString(buffer, infoX, y);    
+    FormatBuffer(timeBuffer, sizeof(timeBuffer)).duration(printData->estimatedPrintTime);
+    elapsedPadding = textLayout.textWidth(timeBuffer, tft->textfont);
+    drawTextWidget(widgets.estimatedTime, sizeof(widgets.estimatedTime), timeBuffer, infoX, y, textLayout.constantWidth(WIDEST_TIME));    
     y += tft->fontHeight();
 
     // elapsed print time
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_HEADING_COLOUR, BACKGROUND_COLOUR); 
-    infoX = x + tft->drawString("Print time: ", x, y);    
+    infoX = x + drawLabel(LABEL_PRINT_TIME, x, y, drawLabels);    
 
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_COLOUR, BACKGROUND_COLOUR); 
-    tft->setTextPadding(elapsedPadding);
 
-    if(printData->printTimeElapsed > 0.0f)
+    if(printData->printTimeElapsed > 0)
     {
-        formatSeconds(timeBuffer, (int)printData->printTimeElapsed);
-        tft->drawString(timeBuffer, infoX, y);
+        FormatBuffer(timeBuffer, sizeof(timeBuffer)).duration(printData->printTimeElapsed);
     }
     else
     {
-        tft->drawString("-", infoX, y);    
+        strlcpy(timeBuffer, "-", sizeof(timeBuffer));
     }    
+    drawTextWidget(widgets.printTime, sizeof(widgets.printTime), timeBuffer, infoX, y, elapsedPadding);
     y += tft->fontHeight();
 
     // remaining
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_HEADING_COLOUR, BACKGROUND_COLOUR); 
-    infoX = x + tft->drawString("Remaining time: ", x, y);    
+    infoX = x + drawLabel(LABEL_REMAINING_TIME, x, y, drawLabels);    
 
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_COLOUR, BACKGROUND_COLOUR); 
 
-    if(printData->printTimeElapsed > 0.0f)
+    if(printData->printTimeElapsed > 0)
     {
-        float remaining = printData->printTimeRemaining;
-        remaining = max(0.0f, remaining);
-        formatSeconds(timeBuffer, (int)remaining);
-        tft->drawString(timeBuffer, infoX, y);
+        FormatBuffer(timeBuffer, sizeof(timeBuffer)).duration(printData->printTimeRemaining);
     }
     else
     {
-        tft->drawString("-", infoX, y);    
+        strlcpy(timeBuffer, "-", sizeof(timeBuffer));
     }
+    drawTextWidget(widgets.remainingTime, sizeof(widgets.remainingTime), timeBuffer, infoX, y, elapsedPadding);
     y += tft->fontHeight();
 
     // filament length
-    int padding;
-    
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_HEADING_COLOUR, BACKGROUND_COLOUR); 
-    infoX = x + tft->drawString("Filament: ", x, y);    
+    infoX = x + drawLabel(LABEL_FILAMENT, x, y, drawLabels);    
 
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_COLOUR, BACKGROUND_COLOUR); 
 
-    sprintf(buffer, "9999.9m");
-    padding = tft->textWidth(buffer);
-    tft->setTextPadding(padding);
-
-    sprintf(buffer, "%.02fm", printData->filamentLength / 1000.0f);
-    tft->drawString(buffer, infoX, y);
+    // millimetres to the nearest centimetre
+    FormatBuffer(buffer, sizeof(buffer)).fixed((printData->filamentLength + 5) / 10, 2).character('m');
+    drawTextWidget(widgets.filament, sizeof(widgets.filament), buffer, infoX, y, textLayout.constantWidth(WIDEST_FILAMENT));
 
     // file name
     y += tft->fontHeight();
 
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_HEADING_COLOUR, BACKGROUND_COLOUR); 
-    tft->drawString("File:", x, y);
+    drawLabel(LABEL_FILE, x, y, drawLabels);
     y += tft->fontHeight();
 
     tft->setTextColor(PRINT_MONITOR_JOB_INFO_COLOUR, BACKGROUND_COLOUR); 
 
-    String file = printData->fileName;
-    bool truncatedDescription = false;
-
-    while(tft->textWidth(file) > (tft->width() - x - 20))
-    {
-        truncatedDescription = true;
-        file = file.substring(0, file.length()-1);
-    }
-
-    if(truncatedDescription)
-    {
-        file = file + "...";
-    }
-
-    tft->setTextPadding(tft->width() - x);
-    tft->drawString(file, x, y); 
-}
-
-void DisplayTFT::formatSeconds(char* buffer, int seconds)
-{
-    int hours, minutes;
-
-    hours = seconds / 3600;
-    seconds = seconds % 3600;
-    minutes = seconds / 60;
-    seconds = seconds % 60;
-    seconds = seconds;
-
-    sprintf(buffer, "%02d:%02d:%02d", hours, minutes, seconds);    
+    textLayout.truncate(buffer, sizeof(buffer), printData->fileName.c_str(), tft->width() - x - 20);
+    drawTextWidget(widgets.fileName, sizeof(widgets.fileName), buffer, x, y, tft->width() - x); 
 }
 
-void DisplayTFT::drawProgressBar(float percent, int x, int y, int width, int height, uint32_t barColour, uint32_t backgroundColour)
+// progress in basis points
+void DisplayTFT::drawProgressBar(uint16_t progress, int x, int y, int width, int height, uint32_t barColour, uint32_t backgroundColour)
 {
     int completedWidth;
     char buffer[16];
     int barX;
 
-    percent = min(percent, 100.0f);
-    percent = max(0.0f, percent);
+    progress = min(progress, (uint16_t)PROGRESS_COMPLETE);
     barX = x + 10;  // space for text
 
-    completedWidth = (PRINT_PROGRESS_BAR_WIDTH * percent) / 100.0f;
-    tft->fillRect(barX, y, completedWidth, 10, barColour);
-    tft->fillRect(barX + completedWidth, y, PRINT_PROGRESS_BAR_WIDTH - completedWidth, height, backgroundColour);
-    tft->drawRect(barX -1, y -1, PRINT_PROGRESS_BAR_WIDTH + 2, height + 2, PRINT_MONITOR_PROGRESS_BAR_OUTLINE_COLOUR);
+    completedWidth = getProgressWidth(progress);
+    if(completedWidth != widgets.progressWidth)
+    {
+        if(widgets.progressWidth == -1)
+        {
+            tft->drawRect(barX -1, y -1, PRINT_PROGRESS_BAR_WIDTH + 2, height + 2, PRINT_MONITOR_PROGRESS_BAR_OUTLINE_COLOUR);
+        }
+
+        tft->fillRect(barX, y, completedWidth, 10, barColour);
+        tft->fillRect(barX + completedWidth, y, PRINT_PROGRESS_BAR_WIDTH - completedWidth, height, backgroundColour);
+        widgets.progressWidth = completedWidth;
+        renderStats.pixelsDrawn += PRINT_PROGRESS_BAR_WIDTH * height;
+    }
+    else
+    {
+        renderStats.pixelsSaved += PRINT_PROGRESS_BAR_WIDTH * height;
+    }
 
     tft->setTextFont(2);
     tft->setTextColor(PRINT_MONITOR_PROGRESS_COLOUR, BACKGROUND_COLOUR); 
     tft->setTextDatum(CR_DATUM);
-    tft->setTextPadding(tft->textWidth("100%"));
 
-    sprintf(buffer, "%d%%", (int)percent);
-    tft->drawString(buffer, x, y + (height / 2));
+    FormatBuffer(buffer, sizeof(buffer)).number(progress / BASIS_POINTS_PER_PERCENT).character('%');
+    drawTextWidget(widgets.progress, sizeof(widgets.progress), buffer, x, y + (height / 2), textLayout.constantWidth(WIDEST_PERCENT));
+}
+
+// pixels of the bar filled, truncated like the float code it replaced
+int DisplayTFT::getProgressWidth(uint16_t progress)
+{
+    progress = min(progress, (uint16_t)PROGRESS_COMPLETE);
+
+    return ((int32_t)PRINT_PROGRESS_BAR_WIDTH * progress) / PROGRESS_COMPLETE;
 }
 
-String DisplayTFT::getPrintInfoTitle(String printerName, uint16_t flags)
+void DisplayTFT::getPrintInfoTitle(char* title, size_t size, const char* printerName, uint16_t flags)
 {
-    String title;
+    const char* state = nullptr;
 
     if((flags & PRINT_STATE_CLOSED_OR_ERROR) || (flags & PRINT_STATE_ERROR))
     {
-        title = printerName + " - Error";
+        state = "Error";
     }
     else if(flags & PRINT_STATE_CANCELLING)
     {
-        title = printerName + " - Cancelling";
+        state = "Cancelling";
     }
     else if(flags & PRINT_STATE_FINISHING)
     {
-        title = printerName + " - Finishing";
+        state = "Finishing";
     }
     else if(flags & PRINT_STATE_PAUSING)
     {
-        title = printerName + " - Pausing";
+        state = "Pausing";
     }
     else if(flags & PRINT_STATE_PAUSED)
     {
-        title = printerName + " - Paused";
+        state = "Paused";
     }    
     else if(flags & PRINT_STATE_RESUMING)
     {
-        title = printerName + " - Resuming";
+        state = "Resuming";
     }
     else if(flags & PRINT_STATE_PRINTING)
     {
-        title = printerName + " - Printing";
+        state = "Printing";
     }
     else if(flags & PRINT_STATE_READY)
     {
-        title = printerName + " - Ready";
+        state = "Ready";
+    }
+
+    if(state != nullptr)
+    {
+        FormatBuffer(title, size).text(printerName).text(" - ").text(state);
     }
     else
     {
-        title = printerName;
+        strlcpy(title, printerName, size);
     }
+}
 
-    return title;
+// whole degrees, halves round away from zero
+void DisplayTFT::formatTemperature(char* buffer, size_t size, int16_t deciDegrees)
+{
+    FormatBuffer(buffer, size).rounded(deciDegrees, 1).character('C');
 }
 
-void DisplayTFT::drawTempArc(String title, float value, float target, float max, int x, int y)
+// segments lit for a temperature in deci-degrees, max in degrees
+int DisplayTFT::getArcSegments(int16_t deciDegrees, int max)
 {
-    char buffer[64];
-    int endAngle;
-    int padding;
+    int32_t maxDeciDegrees = max * DECI_DEGREES_PER_DEGREE;
+    int32_t temp = min((int32_t)deciDegrees, maxDeciDegrees);
+    int segments = (temp * TEMP_ARC_SPAN) / (maxDeciDegrees * TEMP_ARC_DEGREE_PER_SEG);
+
+    return constrain(segments, 0, TEMP_ARC_SEGMENTS);
+}
+
+// temperatures in deci-degrees, max in degrees
+void DisplayTFT::drawTempArc(const char* title, const char* widest, int16_t value, int16_t target, int max, int x, int y, TempArcWidget* widget)
+{
+    char buffer[WIDGET_VALUE_SIZE];
 
     tft->setTextFont(2);
     tft->setTextColor(PRINT_MONITOR_TEMP_HEADING_COLOUR, BACKGROUND_COLOUR); 
     tft->setTextDatum(BC_DATUM);
-    padding = tft->textWidth(title);
-    tft->setTextPadding(padding);
-    tft->drawString(title, x, y - 50);
+    drawLabel(title, x, y - 50, !widgets.labelsDrawn);
 
     tft->setTextFont(4);
     tft->setTextColor(PRINT_MONITOR_ACTUAL_TEMP_COLOUR, BACKGROUND_COLOUR); 
-    sprintf(buffer, "%.0fC", max);
-    padding = tft->textWidth(buffer);
-    tft->setTextPadding(padding);
     tft->setTextDatum(TC_DATUM);
 
-    sprintf(buffer, "%.0fC", value);
-    tft->drawString(buffer, x, y + 20);
+    formatTemperature(buffer, sizeof(buffer), value);
+    drawTextWidget(widget->actual, sizeof(widget->actual), buffer, x, y + 20, textLayout.constantWidth(widest));
 
     tft->setTextFont(2);
     tft->setTextColor(PRINT_MONITOR_TARGET_TEMP_COLOUR, BACKGROUND_COLOUR); 
-    sprintf(buffer, "%.0fC", max);
-    padding = tft->textWidth(buffer);
     tft->setTextDatum(BC_DATUM);
-    sprintf(buffer, "%.0fC", target);
-    tft->drawString(buffer, x, y);
+    formatTemperature(buffer, sizeof(buffer), target);
+    drawTextWidget(widget->target, sizeof(widget->target), buffer, x, y, textLayout.constantWidth(widest));
 
-    float temp = min(value, max);
-    float segments = ((temp / max) * TEMP_ARC_SPAN) / TEMP_ARC_DEGREE_PER_SEG;
-    endAngle = fillArc(x, y, TEMP_ARC_START, (int)segments, 40, 40, 8, PRINT_MONITOR_ARC_COLOUR);
+    int segments = getArcSegments(value, max);
+    int changed;
 
-    segments = (max - temp) / max;
-    segments = (segments * TEMP_ARC_SPAN) / TEMP_ARC_DEGREE_PER_SEG;
-    fillArc(x, y, endAngle, (int)segments, 40, 40, 8, PRINT_MONITOR_ARC_BACKGROUND_COLOUR);
-}
-
-/****************************************************************************************
- * 
- *  Misc
- * 
- * 
-****************************************************************************************/
-
-void DisplayTFT::formatClockString(char* buffer, tm* timeInfo)
-{
-    switch(getClockFormat())
+    if(segments == widget->segments)
     {
-        case ClockFormat_24h:
-            sprintf(buffer, "%02d:%02d", timeInfo->tm_hour, timeInfo->tm_min);
-            break;
-        case ClockFormat_AmPm:
-            String termination = "am";
-            int hours;
-            hours = timeInfo->tm_hour;
-
-            if(hours == 0)
-            {
-                hours = 12;
-            }
-            else if(hours == 12)
-            {
-                termination = "pm";
-            }
-            if(hours > 12)
-            {
-                hours -= 12;
-                termination = "pm";
-            }
-            sprintf(buffer, "%d:%02d%s", hours, timeInfo->tm_min, termination.c_str());
-            break;
+        renderStats.pixelsSaved += TEMP_ARC_PIXELS;
+        return;
     }
-}
 
-char* DisplayTFT::getTempPostfix()
-{
-    static char postFix[2];
-
-    if(getDisplayMetric())
+    // only the segments between the old and new temperature change colour
+    if(widget->segments == -1)
     {
-        sprintf(postFix, "C");
+        fillArc(x, y, 0, segments, PRINT_MONITOR_ARC_COLOUR);
+        fillArc(x, y, segments, TEMP_ARC_SEGMENTS - segments, PRINT_MONITOR_ARC_BACKGROUND_COLOUR);
+        changed = TEMP_ARC_SEGMENTS;
     }
-    else
+    else if(segments > widget->segments)
     {
-        sprintf(postFix, "F");
-    }
-    return postFix;
-}
+        fillArc(x, y, widget->segments, segments - widget->segments, PRINT_MONITOR_ARC_COLOUR);
+        changed = segments - widget->segments;
 
-const unsigned short* DisplayTFT::getIconData(String iconId)
-{    
-    // convert icon code from weather to our image, not all handled
-    if(iconId == "01d")
-    {
-        return icon_01d;
-    }
-    if(iconId == "02d")
-    {
-        return icon_02d;
-    }
-    if(iconId == "03d")
-    {
-        return icon_03d;
-    }
-    if(iconId == "04d")
-    {
-        return icon_03d;
-    }
-    if(iconId == "09d")
-    {
-        return icon_09d;
+        // neighbouring segments share an edge, a full draw leaves it the background colour
+        if(segments < TEMP_ARC_SEGMENTS)
+        {
+            fillArc(x, y, segments, 1, PRINT_MONITOR_ARC_BACKGROUND_COLOUR);
+            changed++;
+        }
     }
-    if(iconId == "10d")
+    else
     {
-        return icon_10d;
+        fillArc(x, y, segments, widget->segments - segments, PRINT_MONITOR_ARC_BACKGROUND_COLOUR);
+        changed = widget->segments - segments;
     }
-    if(iconId == "11d")
+
+    widget->segments = segments;
+    renderStats.pixelsDrawn += (TEMP_ARC_PIXELS * changed) / TEMP_ARC_SEGMENTS;
+    renderStats.pixelsSaved += (TEMP_ARC_PIXELS * (TEMP_ARC_SEGMENTS - changed)) / TEMP_ARC_SEGMENTS;
+}
+
+// the text is only drawn when it differs from what the widget shows, padding
+// covers whatever was there before so nothing needs clearing first
+void DisplayTFT::drawTextWidget(char* shown, size_t size, const char* text, int x, int y, int padding)
+{
+    int area = padding * tft->fontHeight();
+
+    if(strcmp(text, shown) == 0)
     {
-        return icon_11d;
+        renderStats.pixelsSaved += area;
+        return;
     }
-    if(iconId == "13d")
+
+    if(!drawTextSprite(text, x, y, padding))
     {
-        return icon_13d;
+        tft->setTextPadding(padding);
+        tft->drawString(text, x, y);
     }
-    if(iconId == "50d")
+    strlcpy(shown, text, size);
+    renderStats.pixelsDrawn += area;
+}
+
+
+// draws the padded text into a sprite with the current font, colours and datum
+// and pushes it in one block, so the old value is never seen half erased. Text
+// wider than the sprite, like the title, goes in strips of the sprite's width.
+// Returns false when sprites are off or the sprite wasn't made at start up.
+bool DisplayTFT::drawTextSprite(const char* text, int x, int y, int padding)
+{
+    uint8_t datum = tft->getTextDatum();
+    int height = tft->fontHeight();
+    int left = x;
+    int top = y;
+
+    if(!DISPLAY_USE_SPRITES)
     {
-        return icon_50d;
+        return false;
     }
-    if(iconId == "01n")
+
+    if(sprite == nullptr || datum > BR_DATUM || height > sprite->height())
     {
-        return icon_01n;
+        renderStats.spriteFallbacks++;
+        return false;
     }
-    if(iconId == "02n")
+
+    // datums run left, centre, right for top, middle then bottom
+    switch(datum % 3)
     {
-        return icon_02n;
+        case 1:
+            left -= padding / 2;
+            break;
+        case 2:
+            left -= padding;
+            break;
     }
-    if(iconId == "03n")
+    switch(datum / 3)
     {
-        return icon_03d;
+        case 1:
+            top -= height / 2;
+            break;
+        case 2:
+            top -= height;
+            break;
     }
-    if(iconId == "04n")
+
+    sprite->setTextFont(tft->textfont);
+    sprite->setTextColor(tft->textcolor, tft->textbgcolor);
+    sprite->setTextDatum(datum);
+
+    // composed in the sprite's top left corner and only that area is pushed, the
+    // sprite clips whatever falls outside the strip
+    for(int strip = 0; strip < padding; strip += sprite->width())
     {
-        return icon_03d;
+        int stripWidth = min(padding - strip, (int)sprite->width());
+
+        sprite->fillRect(0, 0, stripWidth, height, tft->textbgcolor);
+        sprite->drawString(text, x - left - strip, y - top);
+        sprite->pushSprite(left + strip, top, 0, 0, stripWidth, height);
     }
-    if(iconId == "09n")
+
+    return true;
+}
+
+// one sprite for every widget, as tall as the largest font and as wide as
+// SPRITE_MAX_BYTES allows, made once so drawing never allocates
+void DisplayTFT::createSprite()
+{
+    int height = tft->fontHeight(4);
+    int width = min((int)tft->width(), (int)(SPRITE_MAX_BYTES / (2 * height)));
+
+    sprite = nullptr;
+
+    if(!DISPLAY_USE_SPRITES)
     {
-        return icon_09n;
+        return;
     }
-    if(iconId == "10n")
+
+    if(ESP.getFreeHeap() < SPRITE_MAX_BYTES + SPRITE_HEAP_RESERVE)
     {
-        return icon_09n;
+        Serial.println("Not enough heap for the display sprite, drawing directly");
+        return;
     }
-    if(iconId == "11n")
+
+    sprite = new TFT_eSprite(tft);
+    sprite->setColorDepth(16);
+
+    if(sprite->createSprite(width, height) == nullptr)
     {
-        return icon_11n;
+        Serial.println("Display sprite not created, drawing directly");
+        delete sprite;
+        sprite = nullptr;
     }
-    if(iconId == "13n")
+}
+
+// static text, only drawn when the page is entered, returns the width either way
+int DisplayTFT::drawLabel(const char* label, int x, int y, bool draw)
+{
+    int width = textLayout.constantWidth(label);
+
+    if(draw)
     {
-        return icon_13n;
+        tft->setTextPadding(0);
+        tft->drawString(label, x, y);
+        renderStats.pixelsDrawn += width * tft->fontHeight();
     }
-    if(iconId == "50n")
+    else
     {
-        return icon_50d;
+        renderStats.pixelsSaved += width * tft->fontHeight();
     }
 
-    Serial.println("Icon: " + iconId + " not handled.");
+    return width;
+}
 
-    return icon_01d;
+// call whenever the print info area has been cleared
+void DisplayTFT::invalidateWidgets()
+{
+    widgets.labelsDrawn = false;
+    widgets.title[0] = 0;
+    widgets.tool.segments = -1;
+    widgets.tool.actual[0] = 0;
+    widgets.tool.target[0] = 0;
+    widgets.bed.segments = -1;
+    widgets.bed.actual[0] = 0;
+    widgets.bed.target[0] = 0;
+
+    clearJobWidgets();
+}
+
+void DisplayTFT::clearJobWidgets()
+{
+    widgets.jobShown = false;
+    widgets.progressWidth = -1;
+    widgets.progress[0] = 0;
+    widgets.estimatedTime[0] = 0;
+    widgets.printTime[0] = 0;
+    widgets.remainingTime[0] = 0;
+    widgets.filament[0] = 0;
+    widgets.fileName[0] = 0;
 }
 
 /****************************************************************************************
  * 
- *  Screen server routines
- *  From TFT-eSPI library
+ *  Misc
+ * 
  * 
 ****************************************************************************************/
 
-void DisplayTFT::serveScreenShot()
+void DisplayTFT::formatClockString(char* buffer, size_t size, tm* timeInfo)
 {
-    screenServer();
+    FormatBuffer(buffer, size).clock(timeInfo->tm_hour, timeInfo->tm_min, getClockFormat() == ClockFormat_AmPm);
 }
 
-boolean DisplayTFT::screenServer(void)
-{
-    // With no filename the screenshot will be saved with a default name e.g. tft_screen_#.xxx
-    // where # is a number 0-9 and xxx is a file type specified below
-    return screenServer(DEFAULT_FILENAME);
-}
-
-//====================================================================================
-//                           Screen server call with filename
-//====================================================================================
-// Start a screen dump server (serial or network) - filename specified
-boolean DisplayTFT::screenServer(String filename)
+char* DisplayTFT::getTempPostfix()
 {
-    boolean result = serialScreenServer(filename); // Screenshot serial port server
-    delay(0); // Equivalent to yield() for ESP8266;
+    static char postFix[2];
 
-    return result;
+    postFix[0] = getDisplayMetric() ? 'C' : 'F';
+    postFix[1] = 0;
+    return postFix;
 }
 
-//====================================================================================
-//                Serial server function that sends the data to the client
-//====================================================================================
-boolean DisplayTFT::serialScreenServer(String filename)
-{
-    // Precautionary receive buffer garbage flush for 50ms
-    uint32_t clearTime = millis() + 50;
-    while (millis() < clearTime && Serial.read() >= 0)
-        delay(0); // Equivalent to yield() for ESP8266;
-
-    boolean wait = true;
-    uint32_t lastCmdTime = millis(); // Initialise start of command time-out
-
-    // Wait for the starting flag with a start time-out
-    while (wait)
+const uint16_t* DisplayTFT::getIconData(const String& iconId)
+{    
+    for(unsigned int i=0; i<sizeof(weatherIcons) / sizeof(WeatherIcon); i++)
     {
-        delay(0); // Equivalent to yield() for ESP8266;
-        // Check serial buffer
-        if (Serial.available() > 0)
+        if(iconId == weatherIcons[i].id)
         {
-            // Read the command byte
-            uint8_t cmd = Serial.read();
-            // If it is 'S' (start command) then clear the serial buffer for 100ms and stop waiting
-            if (cmd == 'S')
-            {
-                // Precautionary receive buffer garbage flush for 50ms
-                clearTime = millis() + 50;
-                while (millis() < clearTime && Serial.read() >= 0)
-                    delay(0); // Equivalent to yield() for ESP8266;
-
-                wait = false;           // No need to wait anymore
-                lastCmdTime = millis(); // Set last received command time
-
-                // Send screen size etc using a simple header with delimiters for client checks
-                sendParameters(filename);
-            }
-        }
-        else
-        {
-            // Check for time-out
-            if (millis() > lastCmdTime + START_TIMEOUT)
-                return false;
+            return weatherIcons[i].data;
         }
     }
 
-    uint8_t color[3 * NPIXELS]; // RGB and 565 format color buffer for N pixels
+    Serial.println("Icon: " + iconId + " not handled.");
+
+    return icon_01d_rle;
+}
+
+// decodes a weatherIconsRle.h icon a scanline at a time, runs and literal blocks
+// carry on across lines
+void DisplayTFT::drawIcon(int x, int y, const uint16_t* icon)
+{
+    uint16_t line[WEATHER_ICON_WIDTH];
+    uint16_t count = 0;
+    uint16_t colour = 0;
+    bool run = false;
+    int position = 0;
 
-    // Send all the pixels on the whole screen
-    for (int16_t y = 0; y < tft->height(); y++)
+    for(int row=0; row<WEATHER_ICON_HEIGHT; row++)
     {
-        // Increment x by NPIXELS as we send NPIXELS for every byte received
-        for (int16_t x = 0; x < tft->width(); x += NPIXELS)
+        for(int column=0; column<WEATHER_ICON_WIDTH; column++)
         {
-            delay(0); // Equivalent to yield() for ESP8266;
-
-            // Wait here for serial data to arrive or a time-out elapses
-            while (Serial.available() == 0)
+            if(count == 0)
             {
-                if (millis() > lastCmdTime + PIXEL_TIMEOUT)
-                    return false;
-                delay(0); // Equivalent to yield() for ESP8266;
+                uint16_t word = pgm_read_word(&icon[position++]);
+
+                run = word & ICON_RLE_RUN_FLAG;
+                count = word & ICON_RLE_COUNT_MASK;
+                if(run)
+                {
+                    colour = pgm_read_word(&icon[position++]);
+                }
             }
 
-            // Serial data must be available to get here, read 1 byte and
-            // respond with N pixels, i.e. N x 3 RGB bytes or N x 2 565 format bytes
-            if (Serial.read() == 'X')
-            {
-                // X command byte means abort, so clear the buffer and return
-                clearTime = millis() + 50;
-                while (millis() < clearTime && Serial.read() >= 0)
-                    delay(0); // Equivalent to yield() for ESP8266;
-                return false;
-            }
-            // Save arrival time of the read command (for later time-out check)
-            lastCmdTime = millis();
-
-#if defined BITS_PER_PIXEL && BITS_PER_PIXEL >= 24
-            // Fetch N RGB pixels from x,y and put in buffer
-            tft.readRectRGB(x, y, NPIXELS, 1, color);
-            // Send buffer to client
-            Serial.write(color, 3 * NPIXELS); // Write all pixels in the buffer
-#else
-            // Fetch N 565 format pixels from x,y and put in buffer
-            tft->readRect(x, y, NPIXELS, 1, (uint16_t *)color);
-            // Send buffer to client
-            Serial.write(color, 2 * NPIXELS); // Write all pixels in the buffer
-#endif
+            line[column] = run ? colour : pgm_read_word(&icon[position++]);
+            count--;
         }
-    }
 
-    Serial.flush(); // Make sure all pixel bytes have been despatched
-
-    return true;
+        tft->pushImage(x, y + row, WEATHER_ICON_WIDTH, 1, line);
+    }
 }
 
-//====================================================================================
-//    Send screen size etc using a simple header with delimiters for client checks
-//====================================================================================
-void DisplayTFT::sendParameters(String filename)
-{
-    Serial.write('W'); // Width
-    Serial.write(tft->width() >> 8);
-    Serial.write(tft->width() & 0xFF);
-
-    Serial.write('H'); // Height
-    Serial.write(tft->height() >> 8);
-    Serial.write(tft->height() & 0xFF);
-
-    Serial.write('Y'); // Bits per pixel (16 or 24)
-    Serial.write(BITS_PER_PIXEL);
-
-    Serial.write('?'); // Filename next
-    Serial.print(filename);
-
-    Serial.write('.'); // End of filename marker
+/****************************************************************************************
+ * 
+ *  Screenshots
+ * 
+****************************************************************************************/
 
-    Serial.write(FILE_EXT); // Filename extension identifier
+// one row as RGB565 values, readRect hands the bytes back swapped to suit pushRect
+void DisplayTFT::readScreenRow(int y, uint16_t* pixels)
+{
+    tft->readRect(0, y, tft->width(), 1, pixels);
 
-    Serial.write(*FILE_TYPE); // First character defines file type j,b,p,t
+    for(int x=0; x<tft->width(); x++)
+    {
+        pixels[x] = (pixels[x] >> 8) | (pixels[x] << 8);
+    }
 }
 
 /****************************************************************************************
@@ -1014,53 +1097,29 @@ void DisplayTFT::sendParameters(String filename)
 ****************************************************************************************/
 
 // #########################################################################
-// Draw a circular or elliptical arc with a defined thickness
+// Draw an arc of the temperature gauge with a defined thickness
 // #########################################################################
 
 // x,y == coords of centre of arc
-// start_angle = 0 - 359
-// seg_count = number of 6 degree segments to draw (60 => 360 degree arc)
-// rx = x axis outer radius
-// ry = y axis outer radius
-// w  = width (thickness) of arc in pixels
+// startSegment = first segment, 0 is at TEMP_ARC_START
+// segmentCount = number of TEMP_ARC_DEGREE_PER_SEG degree segments to draw
 // colour = 16 bit colour value
-// Note if rx and ry are the same then an arc of a circle is drawn
 
-int DisplayTFT::fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour)
+// segment vertices come from the table generated by arcTable.py, two triangles
+// per segment
+void DisplayTFT::fillArc(int x, int y, int startSegment, int segmentCount, unsigned int colour)
 {
-    byte seg = TEMP_ARC_DEGREE_PER_SEG; // Segments are 3 degrees wide = 120 segments for 360 degrees
-    byte inc = TEMP_ARC_DEGREE_PER_SEG; // Draw segments every 3 degrees, increase to 6 for segmented ring
-
-    // Calculate first pair of coordinates for segment start
-    float sx = cos((start_angle - 90) * DEG2RAD);
-    float sy = sin((start_angle - 90) * DEG2RAD);
-    uint16_t x0 = sx * (rx - w) + x;
-    uint16_t y0 = sy * (ry - w) + y;
-    uint16_t x1 = sx * rx + x;
-    uint16_t y1 = sy * ry + y;
-
-    // Draw colour blocks every inc degrees
-    int i;
-    for (i = start_angle; i < start_angle + seg * seg_count; i += inc)
+    ArcVertex start, end;
+
+    memcpy_P(&start, &tempArcVertices[startSegment], sizeof(ArcVertex));
+
+    for(int i = startSegment + 1; i <= startSegment + segmentCount; i++)
     {
+        memcpy_P(&end, &tempArcVertices[i], sizeof(ArcVertex));
 
-        // Calculate pair of coordinates for segment end
-        float sx2 = cos((i + seg - 90) * DEG2RAD);
-        float sy2 = sin((i + seg - 90) * DEG2RAD);
-        int x2 = sx2 * (rx - w) + x;
-        int y2 = sy2 * (ry - w) + y;
-        int x3 = sx2 * rx + x;
-        int y3 = sy2 * ry + y;
-
-        tft->fillTriangle(x0, y0, x1, y1, x2, y2, colour);
-        tft->fillTriangle(x1, y1, x2, y2, x3, y3, colour);
-
-        // Copy segment end to sgement start for next segment
-        x0 = x2;
-        y0 = y2;
-        x1 = x3;
-        y1 = y3;
-    }
+        tft->fillTriangle(x + start.innerX, y + start.innerY, x + start.outerX, y + start.outerY, x + end.innerX, y + end.innerY, colour);
+        tft->fillTriangle(x + start.outerX, y + start.outerY, x + end.innerX, y + end.innerY, x + end.outerX, y + end.outerY, colour);
 
-    return i;
+        start = end;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include <Arduino.h>
+#include "HeapMetrics.h"
+#include "JsonArena.h"
+#include "Settings.h"
+
+HeapSubsystemStats HeapMetrics::stats[HeapSubsystem_Count] = {};
+HeapSnapshot HeapMetrics::lowest = {UINT32_MAX, UINT32_MAX, 0};
+HeapSubsystem HeapMetrics::active = HeapSubsystem_Count;
+bool HeapMetrics::counting = false;
+unsigned long HeapMetrics::reportedAllocations = 0;
+
+static const char* const SUBSYSTEM_NAMES[HeapSubsystem_Count] =
+{
+    "time",
+    "weather",
+    "wifi",
+    "printMonitor",
+    "display",
+    "webServer",
+};
+
+void HeapMetrics::sample(HeapSnapshot* snapshot)
+{
+    snapshot->freeHeap = ESP.getFreeHeap();
+    snapshot->maxFreeBlock = ESP.getMaxFreeBlockSize();
+    snapshot->fragmentation = ESP.getHeapFragmentation();
+}
+
+void HeapMetrics::record(HeapSubsystem subsystem, const HeapSnapshot* before)
+{
+    HeapSubsystemStats* subsystemStats = &stats[subsystem];
+    HeapSnapshot after;
+    int32_t retained;
+
+    sample(&after);
+    retained = (int32_t)before->freeHeap - (int32_t)after.freeHeap;
+
+    if(subsystemStats->calls == 0)
+    {
+        subsystemStats->minFreeHeap = after.freeHeap;
+        subsystemStats->minMaxFreeBlock = after.maxFreeBlock;
+        subsystemStats->maxFragmentation = after.fragmentation;
+        subsystemStats->maxRetained = retained;
+    }
+    else
+    {
+        subsystemStats->minFreeHeap = min(subsystemStats->minFreeHeap, after.freeHeap);
+        subsystemStats->minMaxFreeBlock = min(subsystemStats->minMaxFreeBlock, after.maxFreeBlock);
+        subsystemStats->maxFragmentation = max(subsystemStats->maxFragmentation, after.fragmentation);
+        subsystemStats->maxRetained = max(subsystemStats->maxRetained, retained);
+    }
+    subsystemStats->calls++;
+
+    lowest.freeHeap = min(lowest.freeHeap, after.freeHeap);
+    lowest.maxFreeBlock = min(lowest.maxFreeBlock, after.maxFreeBlock);
+    lowest.fragmentation = max(lowest.fragmentation, after.fragmentation);
+}
+
+HeapSubsystem HeapMetrics::enter(HeapSubsystem subsystem)
+{
+    HeapSubsystem previous = active;
+
+    active = subsystem;
+    return previous;
+}
+
+// called from inside malloc, must not allocate or print
+void IRAM_ATTR HeapMetrics::countAllocation(size_t size)
+{
+    if(counting && active != HeapSubsystem_Count)
+    {
+        stats[active].allocations++;
+        stats[active].lastAllocationSize = size;
+    }
+}
+
+// run periodically, starts counting once warmed up and reports any new allocations
+void HeapMetrics::checkAllocations()
+{
+    unsigned long allocations = 0;
+
+    if(!STATIC_ALLOCATION_MODE)
+    {
+        return;
+    }
+
+    if(!counting)
+    {
+        if(millis() >= STATIC_ALLOCATION_WARMUP)
+        {
+            Serial.println("Warmed up, counting heap allocations");
+            counting = true;
+        }
+        return;
+    }
+
+    for(int i=0; i<HeapSubsystem_Count; i++)
+    {
+        allocations += stats[i].allocations;
+    }
+
+    if(allocations == reportedAllocations)
+    {
+        return;
+    }
+
+    Serial.printf("Steady state heap allocations: %lu\n", allocations);
+    for(int i=0; i<HeapSubsystem_Count; i++)
+    {
+        if(stats[i].allocations > 0)
+        {
+            Serial.printf("  %s %lu, last %u bytes\n", SUBSYSTEM_NAMES[i], stats[i].allocations, stats[i].lastAllocationSize);
+        }
+    }
+    reportedAllocations = allocations;
+}
+
+const char* HeapMetrics::getName(HeapSubsystem subsystem)
+{
+    return SUBSYSTEM_NAMES[subsystem];
+}
+
+void HeapMetrics::toJson(JsonObject metrics)
+{
+    HeapSnapshot current;
+
+    sample(&current);
+
+    metrics["uptime"] = millis() / 1000;
+
+    JsonObject heap = metrics.createNestedObject("heap");
+    heap["free"] = current.freeHeap;
+    heap["maxFreeBlock"] = current.maxFreeBlock;
+    heap["fragmentation"] = current.fragmentation;
+    heap["minFree"] = min(lowest.freeHeap, current.freeHeap);
+    heap["minMaxFreeBlock"] = min(lowest.maxFreeBlock, current.maxFreeBlock);
+    heap["maxFragmentation"] = max(lowest.fragmentation, current.fragmentation);
+
+    JsonObject allocations = metrics.createNestedObject("staticAllocation");
+    allocations["enabled"] = STATIC_ALLOCATION_MODE;
+    allocations["counting"] = counting;
+
+    JsonArenaStats* arenaStats = JsonArena::getStats();
+    JsonObject arena = metrics.createNestedObject("jsonArena");
+    arena["size"] = JSON_ARENA_SIZE;
+    arena["leases"] = arenaStats->leases;
+    arena["fallbacks"] = arenaStats->fallbacks;
+    arena["highWater"] = arenaStats->highWater;
+
+    JsonObject subsystems = metrics.createNestedObject("subsystems");
+    for(int i=0; i<HeapSubsystem_Count; i++)
+    {
+        JsonObject subsystem = subsystems.createNestedObject(SUBSYSTEM_NAMES[i]);
+
+        subsystem["calls"] = stats[i].calls;
+        subsystem["minFree"] = stats[i].minFreeHeap;
+        subsystem["minMaxFreeBlock"] = stats[i].minMaxFreeBlock;
+        subsystem["maxFragmentation"] = stats[i].maxFragmentation;
+        subsystem["maxRetained"] = stats[i].maxRetained;
+        subsystem["allocations"] = stats[i].allocations;
+    }
+}
+
+/**** malloc wrappers, linked in with -Wl,--wrap by the static environments ****/
+
+#if STATIC_ALLOCATION_MODE
+
+extern "C"
+{
+    void* __real_malloc(size_t size);
+    void* __real_calloc(size_t count, size_t size);
+    void* __real_realloc(void* pointer, size_t size);
+
+    void* IRAM_ATTR __wrap_malloc(size_t size)
+    {
+        HeapMetrics::countAllocation(size);
+        return __real_malloc(size);
+    }
+
+    void* IRAM_ATTR __wrap_calloc(size_t count, size_t size)
+    {
+        HeapMetrics::countAllocation(count * size);
+        return __real_calloc(count, size);
+    }
+
+    // freeing through realloc isn't an allocation
+    void* IRAM_ATTR __wrap_realloc(void* pointer, size_t size)
+    {
+        if(size > 0)
+        {
+            HeapMetrics::countAllocation(size);
+        }
+        return __real_realloc(pointer, size);
+    }
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include <Arduino.h>
+#include "OctoPrintConnectionPool.h"
+
+OctoPrintConnectionPool::OctoPrintConnectionPool()
+{
+    stats.requests = 0;
+    stats.reused = 0;
+    stats.reconnects = 0;
+    stats.evicted = 0;
+
+    for(int i=0; i<OCTOPRINT_CONNECTION_POOL_SIZE; i++)
+    {
+        connections[i].setTimeout(OCTOPRINT_HTTP_TIMEOUT);
+        bodyFilters[i].setOutput(bodies[i], OCTOPRINT_HTTP_BODY_SIZE);
+        connections[i].setBodyStream(&bodyFilters[i]);
+    }
+}
+
+// returns an idle connection, preferring one already open to this printer,
+// or nullptr if every connection is busy
+AsyncHttpClient* OctoPrintConnectionPool::acquire(const String& host, int port)
+{
+    AsyncHttpClient* oldest = nullptr;
+
+    evictIdle();
+
+    for(int i=0; i<OCTOPRINT_CONNECTION_POOL_SIZE; i++)
+    {
+        AsyncHttpClient* connection = &connections[i];
+
+        if(connection->isBusy())
+        {
+            continue;
+        }
+        if(connection->isConnectedTo(host, port))
+        {
+            return connection;
+        }
+        if(oldest == nullptr || connection->getLastUsed() < oldest->getLastUsed())
+        {
+            oldest = connection;
+        }
+    }
+
+    if(oldest != nullptr && oldest->isConnected())
+    {
+        // least recently used socket is dropped and handed over to this printer
+        stats.evicted++;
+    }
+
+    return oldest;
+}
+
+// the filter a connection's replies are written through, set it up before each request
+JsonStreamFilter* OctoPrintConnectionPool::getBodyFilter(AsyncHttpClient* connection)
+{
+    return &bodyFilters[connection - connections];
+}
+
+void OctoPrintConnectionPool::evictIdle()
+{
+    unsigned long now = millis();
+
+    for(int i=0; i<OCTOPRINT_CONNECTION_POOL_SIZE; i++)
+    {
+        AsyncHttpClient* connection = &connections[i];
+
+        if(!connection->isBusy() && connection->isConnected() && now - connection->getLastUsed() > OCTOPRINT_CONNECTION_IDLE_TIMEOUT)
+        {
+            stats.evicted++;
+            connection->close();
+        }
+    }
+}
+
+ConnectionPoolStats* OctoPrintConnectionPool::getStats()
+{
+    stats.requests = 0;
+    stats.reused = 0;
+    stats.reconnects = 0;
+
+    for(int i=0; i<OCTOPRINT_CONNECTION_POOL_SIZE; i++)
+    {
+        AsyncHttpStats* connectionStats = connections[i].getStats();
+
+        stats.requests += connectionStats->requests;
+        stats.reused += connectionStats->reused;
+        stats.reconnects += connectionStats->reconnects;
+    }
+
+    return &stats;
+}
@@ -1,175 +1,598 @@
-#include <WiFiClient.h>
-#include <ESP8266WiFi.h>
-#include <ESP8266HTTPClient.h>
+#include <Arduino.h>
+#include <base64.h>
 #include <ArduinoJson.h>
+#include "JsonArena.h"
+#include "AsyncHttpClient.h"
 #include "OctoPrintMonitor.h"
+#include "OctoPrintConnectionPool.h"
+#include "SettingsManager.h"
+#include "HeapMetrics.h"
 
-const int JOB_DECODE_SIZE   = 1024;   // TODO
-const int PRINT_DECODE_SIZE = 2048;   // TODO
+// responses are filtered as they arrive and parsed in place, so these only need
+// to hold the fields we use, strings point back into the filtered body
+const int JOB_DECODE_SIZE       = 512;
+const int PRINT_DECODE_SIZE     = 512;
+const int PUSH_DECODE_SIZE      = 768;
+const int PUSH_FILTER_DECODE_SIZE = 512;
 
-void OctoPrintMonitor::setCurrentPrinter(String server, int port, String apiKey, String userName, String password)
+OctoPrintMonitor::OctoPrintMonitor()
 {
-    this->apiKey = apiKey;
-    this->server = server;
-    this->userName = userName;
-    this->password = password;
-    this->port = port;
+    settingsManager = nullptr;
+    printerUpdatedCallback = nullptr;
+    generation = 0;
+    pushPrinter = -1;
+    pushActive = false;
+    lastPushAttempt = 0;
+
+    createJobFilter(jobFilter);
+    createPrinterFilter(printerFilter);
+
+#if OCTOPRINT_PUSH_MODE
+    pushClient.setMessageCallback([this](char* message, size_t length)
+        {
+            handlePushMessage(message, length);
+        });
+#endif
+
+    resetPrinterData();
+}
+
+void OctoPrintMonitor::init(SettingsManager* settingsManager)
+{
+    this->settingsManager = settingsManager;
 }
 
+void OctoPrintMonitor::setPrinterUpdatedCallback(void(* callback)(int printerId))
+{
+    printerUpdatedCallback = callback;
+}
+
+void OctoPrintMonitor::resetPrinterData()
+{
+    // anything still in flight belongs to the old printer list and is dropped
+    generation++;
+    closePush();
+    pushPrinter = -1;
+
+    for(int i=0; i<MAX_PRINTERS; i++)
+    {
+        OctoPrintPrinterState* state = &printers[i];
+
+        state->pendingRequests = 0;
+        state->inFlight = false;
+        state->data.validJobData = false;
+        state->data.validPrintData = false;
+        state->data.jobLoaded = false;
+        state->data.printerFlags = 0;
+
+        state->data.fileName.reserve(OCTOPRINT_FILE_NAME_RESERVE);
+        state->data.jobState.reserve(OCTOPRINT_STATE_RESERVE);
+        state->data.printState.reserve(OCTOPRINT_STATE_RESERVE);
+    }
+}
+
+// a printer's address or credentials may have changed, headers are rebuilt on next use
+void OctoPrintMonitor::printersChanged()
+{
+    for(int i=0; i<MAX_PRINTERS; i++)
+    {
+        printers[i].headers = "";
+    }
+}
+
+// start a refresh round, every enabled printer is queued and as many requests
+// as the pool allows go out at once
 void OctoPrintMonitor::update()
 {
-    updateJobStatus();
-    updatePrinterStatus();
+    for(int i=0; i<settingsManager->getNumPrinters(); i++)
+    {
+        OctoPrinterData* printer = settingsManager->getPrinterData(i);
+        OctoPrintPrinterState* state = &printers[i];
+
+        if(!printer->enabled)
+        {
+            state->pendingRequests = 0;
+            printerUpdated(i);
+            continue;
+        }
+
+        // a slow printer still answering the last round is left alone, the
+        // printer on the push socket doesn't need polling at all
+        if(state->pendingRequests == 0 && !state->inFlight && !(i == pushPrinter && pushActive))
+        {
+            state->pendingRequests = OCTOPRINT_REQUEST_JOB | OCTOPRINT_REQUEST_PRINTER;
+        }
+    }
+
+    sendRequests();
 }
 
-void OctoPrintMonitor::updateJobStatus()
+// call from loop(), runs the push socket and falls back to polling when it drops
+void OctoPrintMonitor::poll()
 {
-    String result;
-    int httpCode;
-    
-    httpCode = performAPIGet(OCTOPRINT_JOB, result);
-    
-    if(httpCode == 200)
+#if OCTOPRINT_PUSH_MODE
+    pushClient.poll();
+
+    if(pushPrinter == -1)
     {
-        data.validJobData = true;
-        deserialiseJob(result);
+        return;
     }
-    else
+
+    if(!settingsManager->getPrinterData(pushPrinter)->enabled)
+    {
+        closePush();
+        pushPrinter = -1;
+        return;
+    }
+
+    if(!pushClient.isClosed())
+    {
+        return;
+    }
+
+    if(pushActive)
+    {
+        Serial.println("OctoPrint push socket closed, polling");
+        pushActive = false;
+
+        // catch up on whatever was missed while the socket was going down
+        printers[pushPrinter].pendingRequests = OCTOPRINT_REQUEST_JOB | OCTOPRINT_REQUEST_PRINTER;
+        sendRequests();
+    }
+
+    if(millis() - lastPushAttempt > OCTOPRINT_PUSH_RETRY_INTERVAL)
+    {
+        subscribePush();
+    }
+#endif
+}
+
+// the push socket follows the printer on display, -1 leaves it on the last one
+void OctoPrintMonitor::setPushPrinter(int printerId)
+{
+#if OCTOPRINT_PUSH_MODE
+    if(printerId == -1)
+    {
+        return;
+    }
+
+    OctoPrinterData* printer = settingsManager->getPrinterData(printerId);
+
+    if(!printer->enabled)
+    {
+        return;
+    }
+
+    if(printerId != pushPrinter || !pushClient.isSubscribedTo(printer->address, printer->port))
     {
-        data.validJobData = false;
+        closePush();
+        pushPrinter = printerId;
+        subscribePush();
     }
+#endif
 }
 
-void OctoPrintMonitor::updatePrinterStatus()
+#if OCTOPRINT_PUSH_MODE
+void OctoPrintMonitor::subscribePush()
 {
-    String result;
-    int httpCode;
+    OctoPrinterData* printer = settingsManager->getPrinterData(pushPrinter);
 
-    httpCode = performAPIGet(OCTOPRINT_PRINTER, result);
-    
-     if(httpCode == 200)
+    lastPushAttempt = millis();
+    pushClient.subscribe(printer->address, printer->port, getHeaders(pushPrinter));
+}
+#endif
+
+void OctoPrintMonitor::closePush()
+{
+#if OCTOPRINT_PUSH_MODE
+    pushClient.close();
+#endif
+    pushActive = false;
+}
+
+void OctoPrintMonitor::sendRequests()
+{
+    for(int i=0; i<settingsManager->getNumPrinters(); i++)
     {
-        data.validPrintData = true;
-        deserialisePrint(result);
+        OctoPrintPrinterState* state = &printers[i];
+
+        if(state->pendingRequests != 0 && !state->inFlight)
+        {
+            if(!sendRequest(i))
+            {
+                // pool exhausted, the rest go out as connections free up
+                break;
+            }
+        }
+    }
+}
+
+bool OctoPrintMonitor::sendRequest(int printerId)
+{
+    OctoPrinterData* printer = settingsManager->getPrinterData(printerId);
+    OctoPrintPrinterState* state = &printers[printerId];
+    AsyncHttpClient* connection;
+    unsigned int requestGeneration = generation;
+    uint8_t request;
+    const char* uri;
+
+    connection = connectionPool.acquire(printer->address, printer->port);
+    if(connection == nullptr)
+    {
+        return false;
+    }
+
+    if(state->pendingRequests & OCTOPRINT_REQUEST_JOB)
+    {
+        request = OCTOPRINT_REQUEST_JOB;
+        uri = OCTOPRINT_JOB;
     }
     else
     {
-        data.validPrintData = false;
+        request = OCTOPRINT_REQUEST_PRINTER;
+        uri = OCTOPRINT_PRINTER;
     }
+
+    state->pendingRequests &= ~request;
+    state->inFlight = true;
+
+    const String& headers = getHeaders(printerId);
+
+    connectionPool.getBodyFilter(connection)->begin(request == OCTOPRINT_REQUEST_JOB ? jobFilter.as<JsonVariantConst>() : printerFilter.as<JsonVariantConst>());
+
+    // the socket and its buffers belong to the network stack
+    HeapUntracked untracked;
+
+    connection->get(printer->address, printer->port, uri, headers,
+        [this, printerId, request, requestGeneration](AsyncHttpClient* client, int httpCode, char* body, size_t length)
+        {
+            handleResponse(printerId, request, requestGeneration, httpCode, connectionPool.getBodyFilter(client));
+        });
+
+    return true;
 }
 
-int OctoPrintMonitor::performAPIGet(String apiCall, String& payload)
+const String& OctoPrintMonitor::getHeaders(int printerId)
 {
-    // must be in this order
-    WiFiClient client;
-    HTTPClient http;
+    OctoPrinterData* printer = settingsManager->getPrinterData(printerId);
+    String& headers = printers[printerId].headers;
+
+    if(headers.length() != 0)
+    {
+        return headers;
+    }
 
-    http.begin(client, this->server, this->port, apiCall);
-    http.setTimeout(2000);
-    http.addHeader("X-Api-Key", this->apiKey);
+    headers = "X-Api-Key: " + printer->apiKey + "\r\n";
 
-    if(this->userName != "")
+    if(printer->username != "")
     {
-        http.setAuthorization(this->userName.c_str(), this->password.c_str());
+        headers += "Authorization: Basic " + base64::encode(printer->username + ":" + printer->password) + "\r\n";
     }
 
-    int httpCode = http.GET();
+    return headers;
+}
+
+void OctoPrintMonitor::handleResponse(int printerId, uint8_t request, unsigned int requestGeneration, int httpCode, JsonStreamFilter* body)
+{
+    HeapProbe probe(HeapSubsystem_PrintMonitor);
+
+    if(requestGeneration != generation)
+    {
+        sendRequests();
+        return;
+    }
+
+    OctoPrintPrinterState* state = &printers[printerId];
+    bool valid = httpCode == 200 && body->isComplete();
+
+    state->inFlight = false;
 
     //Serial.print("HTTP CODE: ");
     //Serial.println(httpCode);
 
-    if (httpCode > 0)
+    if(request == OCTOPRINT_REQUEST_JOB)
     {
-        if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_MOVED_PERMANENTLY)
-        {            
-            payload = http.getString();
-        }        
+        ArenaJsonDocument doc(JOB_DECODE_SIZE);
+
+        if(valid)
+        {
+            valid = !deserializeJson(doc, body->getOutput(), body->length());
+        }
+
+        state->data.validJobData = valid;
+        if(valid)
+        {
+            deserialiseJob(&state->data, doc);
+        }
+    }
+    else
+    {
+        ArenaJsonDocument doc(PRINT_DECODE_SIZE);
+
+        if(valid)
+        {
+            valid = !deserializeJson(doc, body->getOutput(), body->length());
+        }
+
+        state->data.validPrintData = valid;
+        if(valid)
+        {
+            deserialisePrint(&state->data, doc);
+        }
+    }
+
+    if(state->pendingRequests == 0)
+    {
+        printerUpdated(printerId);
+    }
+
+    sendRequests();
+}
+
+void OctoPrintMonitor::printerUpdated(int printerId)
+{
+    if(printerUpdatedCallback != nullptr)
+    {
+        printerUpdatedCallback(printerId);
     }
-    
-    return httpCode;
 }
 
-void OctoPrintMonitor::deserialiseJob(String payload)
+#if OCTOPRINT_PUSH_MODE
+void OctoPrintMonitor::handlePushMessage(char* message, size_t length)
 {
-    DynamicJsonDocument doc(JOB_DECODE_SIZE);
-    deserializeJson(doc, payload);
+    HeapProbe probe(HeapSubsystem_PrintMonitor);
+
+    // the document is released before the update callback so it can use the JSON arena
+    {
+        ArenaJsonDocument doc(PUSH_DECODE_SIZE);
+        StaticJsonDocument<JSON_CAPACITY(PUSH_FILTER_DECODE_SIZE)> filter;
+
+        createPushFilter(filter);
+        if(deserializeJson(doc, message, length, DeserializationOption::Filter(filter)))
+        {
+            return;
+        }
+
+        // connected, history, event and plugin messages are ignored
+        JsonObject current = doc["current"];
+        if(current.isNull())
+        {
+            return;
+        }
+
+        pushActive = true;
+        deserialisePush(&printers[pushPrinter].data, current);
+    }
+
+    printerUpdated(pushPrinter);
+}
+#endif
+
+// filters, only the fields used in OctoPrintMonitorData are kept when parsing
+
+void OctoPrintMonitor::createJobFilter(JsonDocument& filter)
+{
+    filter["state"] = true;
+
+    JsonObject job = filter.createNestedObject("job");
+    job["file"]["display"] = true;
+    job["estimatedPrintTime"] = true;
+    job["filament"]["tool0"]["length"] = true;
+
+    JsonObject progress = filter.createNestedObject("progress");
+    progress["completion"] = true;
+    progress["printTime"] = true;
+    progress["printTimeLeft"] = true;
+}
+
+void OctoPrintMonitor::createPrinterFilter(JsonDocument& filter)
+{
+    JsonObject temperature = filter.createNestedObject("temperature");
+    temperature["tool0"]["actual"] = true;
+    temperature["tool0"]["target"] = true;
+    temperature["bed"]["actual"] = true;
+    temperature["bed"]["target"] = true;
+
+    JsonObject state = filter.createNestedObject("state");
+    state["text"] = true;
+    state["flags"] = true;
+}
+
+#if OCTOPRINT_PUSH_MODE
+void OctoPrintMonitor::createPushFilter(JsonDocument& filter)
+{
+    JsonObject current = filter.createNestedObject("current");
+
+    JsonObject state = current.createNestedObject("state");
+    state["text"] = true;
+    state["flags"] = true;
+
+    JsonObject job = current.createNestedObject("job");
+    job["file"]["display"] = true;
+    job["estimatedPrintTime"] = true;
+    job["filament"]["tool0"]["length"] = true;
 
-    data.jobState = (const char*)doc["state"];
+    JsonObject progress = current.createNestedObject("progress");
+    progress["completion"] = true;
+    progress["printTime"] = true;
+    progress["printTimeLeft"] = true;
+
+    // applies to every sample in the array
+    JsonObject temps = current.createNestedArray("temps").createNestedObject();
+    temps["tool0"]["actual"] = true;
+    temps["tool0"]["target"] = true;
+    temps["bed"]["actual"] = true;
+    temps["bed"]["target"] = true;
+}
+#endif
+
+void OctoPrintMonitor::deserialiseJob(OctoPrintMonitorData* data, JsonDocument& doc)
+{
+    data->jobState = (const char*)doc["state"];
 
     if(doc["job"]["file"]["display"] != nullptr)
     {
-        data.jobLoaded = true;
-        data.estimatedPrintTime = doc["job"]["estimatedPrintTime"];
-        data.filamentLength = doc["job"]["filament"]["tool0"]["length"];
-        data.fileName = (const char*)doc["job"]["file"]["display"];
+        data->jobLoaded = true;
+        data->estimatedPrintTime = doc["job"]["estimatedPrintTime"];
+        data->filamentLength = doc["job"]["filament"]["tool0"]["length"];
+        data->fileName = (const char*)doc["job"]["file"]["display"];
         
-        data.percentComplete = doc["progress"]["completion"];
-        data.printTimeElapsed = doc["progress"]["printTime"];
-        data.printTimeRemaining = doc["progress"]["printTimeLeft"];
+        data->progress = toBasisPoints(doc["progress"]["completion"]);
+        data->printTimeElapsed = doc["progress"]["printTime"];
+        data->printTimeRemaining = doc["progress"]["printTimeLeft"];
     }
     else
     {
-        data.jobLoaded = false;
+        data->jobLoaded = false;
     }
 }
 
-void OctoPrintMonitor::deserialisePrint(String payload)
+void OctoPrintMonitor::deserialisePrint(OctoPrintMonitorData* data, JsonDocument& doc)
+{
+    data->tool0Temp = toDeciDegrees(doc["temperature"]["tool0"]["actual"]);
+    data->tool0Target = toDeciDegrees(doc["temperature"]["tool0"]["target"]);
+
+    data->bedTemp = toDeciDegrees(doc["temperature"]["bed"]["actual"]);
+    data->bedTarget = toDeciDegrees(doc["temperature"]["bed"]["target"]);
+
+    data->printState = (const char*)doc["state"]["text"];
+    data->printerFlags = getPrinterFlags(doc["state"]["flags"]);
+}
+
+#if OCTOPRINT_PUSH_MODE
+// updates only carry the parts that changed, anything missing keeps its last value
+void OctoPrintMonitor::deserialisePush(OctoPrintMonitorData* data, JsonObject current)
 {
-    DynamicJsonDocument doc(PRINT_DECODE_SIZE);
-    deserializeJson(doc, payload);
+    JsonObject state = current["state"];
+    JsonObject job = current["job"];
+    JsonObject progress = current["progress"];
+    JsonArray temps = current["temps"];
+
+    if(!state.isNull())
+    {
+        data->printState = (const char*)state["text"];
+        data->jobState = data->printState;
+        data->printerFlags = getPrinterFlags(state["flags"]);
+        data->validPrintData = true;
+    }
+
+    if(!job.isNull())
+    {
+        data->validJobData = true;
+
+        if(job["file"]["display"] != nullptr)
+        {
+            data->jobLoaded = true;
+            data->estimatedPrintTime = job["estimatedPrintTime"];
+            data->filamentLength = job["filament"]["tool0"]["length"];
+            data->fileName = (const char*)job["file"]["display"];
+        }
+        else
+        {
+            data->jobLoaded = false;
+        }
+    }
+
+    if(!progress.isNull())
+    {
+        data->progress = toBasisPoints(progress["completion"]);
+        data->printTimeElapsed = progress["printTime"];
+        data->printTimeRemaining = progress["printTimeLeft"];
+    }
+
+    // temps holds the samples since the last message, newest last
+    if(temps.size() > 0)
+    {
+        JsonObject latest = temps[temps.size() - 1];
 
-    data.tool0Temp = doc["temperature"]["tool0"]["actual"];
-    data.tool0Target= doc["temperature"]["tool0"]["target"];
+        data->tool0Temp = toDeciDegrees(latest["tool0"]["actual"]);
+        data->tool0Target = toDeciDegrees(latest["tool0"]["target"]);
+        data->bedTemp = toDeciDegrees(latest["bed"]["actual"]);
+        data->bedTarget = toDeciDegrees(latest["bed"]["target"]);
+    }
+}
+#endif
 
-    data.bedTemp = doc["temperature"]["bed"]["actual"];
-    data.bedTarget = doc["temperature"]["bed"]["target"];
+uint16_t OctoPrintMonitor::getPrinterFlags(JsonObject flags)
+{
+    uint16_t printerFlags = 0;
 
-    data.printState = (const char*)doc["state"]["text"];
-    data.printerFlags = 0;
-    
-    if(doc["state"]["flags"]["cancelling"])
+    if(flags["cancelling"])
+    {
+        printerFlags |= PRINT_STATE_CANCELLING;
+    }
+    if(flags["closedOrError"])
     {
-        data.printerFlags |= PRINT_STATE_CANCELLING;
+        printerFlags |= PRINT_STATE_CLOSED_OR_ERROR;
     }
-    if(doc["state"]["flags"]["closedOrError"])
+    if(flags["error"])
     {
-        data.printerFlags |= PRINT_STATE_CLOSED_OR_ERROR;
+        printerFlags |= PRINT_STATE_ERROR;
     }
-    if(doc["state"]["flags"]["error"])
+    if(flags["finishing"])
     {
-        data.printerFlags |= PRINT_STATE_ERROR;
+        printerFlags |= PRINT_STATE_FINISHING;
     }
-    if(doc["state"]["flags"]["finishing"])
+    if(flags["operational"])
     {
-        data.printerFlags |= PRINT_STATE_FINISHING;
+        printerFlags |= PRINT_STATE_OPERATIONAL;
     }
-    if(doc["state"]["flags"]["operational"])
+    if(flags["paused"])
     {
-        data.printerFlags |= PRINT_STATE_OPERATIONAL;
+        printerFlags |= PRINT_STATE_PAUSED;
     }
-    if(doc["state"]["flags"]["paused"])
+    if(flags["pausing"])
     {
-        data.printerFlags |= PRINT_STATE_PAUSED;
+        printerFlags |= PRINT_STATE_PAUSING;
     }
-    if(doc["state"]["flags"]["pausing"])
+    if(flags["printing"])
     {
-        data.printerFlags |= PRINT_STATE_PAUSING;
+        printerFlags |= PRINT_STATE_PRINTING;
     }
-    if(doc["state"]["flags"]["printing"])
+    if(flags["ready"])
     {
-        data.printerFlags |= PRINT_STATE_PRINTING;
+        printerFlags |= PRINT_STATE_READY;
     }
-    if(doc["state"]["flags"]["ready"])
+    if(flags["resuming"])
     {
-        data.printerFlags |= PRINT_STATE_READY;
+        printerFlags |= PRINT_STATE_RESUMING;
     }
-    if(doc["state"]["flags"]["resuming"])
+    if(flags["sdReady"])
     {
-        data.printerFlags |= PRINT_STATE_RESUMING;
+        printerFlags |= PRINT_STATE_SD_READY;
     }
-    if(doc["state"]["flags"]["sdReady"])
+
+    return printerFlags;
+}
+
+// whole numbers, targets mostly, convert without touching the float emulation.
+// Fractions truncate, rounding here would round again when the whole degree is
+// drawn and show 214.46 as 215C. They are rounded to the next place first as
+// 16.88 is 16.8799 in a float
+int16_t OctoPrintMonitor::toDeciDegrees(JsonVariant value)
+{
+    if(value.is<long>())
     {
-        data.printerFlags |= PRINT_STATE_SD_READY;
+        return value.as<long>() * DECI_DEGREES_PER_DEGREE;
     }
+
+    return lroundf(value.as<float>() * DECI_DEGREES_PER_DEGREE * 10) / 10;
 }
 
+// completion is a percentage, null before a job starts. Truncated like the
+// degrees so the bar and whole percent match the float code
+uint16_t OctoPrintMonitor::toBasisPoints(JsonVariant value)
+{
+    long basisPoints;
+
+    if(value.is<long>())
+    {
+        basisPoints = value.as<long>() * BASIS_POINTS_PER_PERCENT;
+    }
+    else
+    {
+        basisPoints = lroundf(value.as<float>() * BASIS_POINTS_PER_PERCENT * 10) / 10;
+    }
+
+    return constrain(basisPoints, 0, PROGRESS_COMPLETE);
+}
@@ -0,0 +1,514 @@
+#include <Arduino.h>
+#include <base64.h>
+#include <ArduinoJson.h>
+#include "JsonArena.h"
+#include "OctoPrintPushClient.h"
+
+const int LOGIN_DECODE_SIZE     = 256;
+const int MASKED_BLOCK_SIZE     = 64;
+
+OctoPrintPushClient::OctoPrintPushClient()
+{
+    state = OctoPrintPush_Closed;
+    callback = nullptr;
+    port = 0;
+    messageLength = 0;
+    messageReady = false;
+    pongPending = false;
+    authPending = false;
+    closePending = false;
+    stateTime = 0;
+    lastMessage = 0;
+
+    stats.subscribes = 0;
+    stats.messages = 0;
+    stats.dropped = 0;
+
+    loginClient.setKeepAlive(false);
+    loginClient.setTimeout(OCTOPRINT_HTTP_TIMEOUT);
+
+    // the login reply is handled before the socket opens, so it can borrow the message buffer
+    loginClient.setBodyBuffer(message, sizeof(message));
+
+    // socket callbacks run in the network context, they only collect data
+    client.onConnect([](void* arg, AsyncClient* c) { ((OctoPrintPushClient*)arg)->handleConnect(); }, this);
+    client.onData([](void* arg, AsyncClient* c, void* data, size_t len) { ((OctoPrintPushClient*)arg)->handleData((uint8_t*)data, len); }, this);
+    client.onDisconnect([](void* arg, AsyncClient* c) { ((OctoPrintPushClient*)arg)->handleDisconnect(); }, this);
+    client.onError([](void* arg, AsyncClient* c, int8_t error) { ((OctoPrintPushClient*)arg)->handleDisconnect(); }, this);
+}
+
+OctoPrintPushClient::~OctoPrintPushClient()
+{
+    close();
+}
+
+void OctoPrintPushClient::subscribe(const String& host, int port, const String& headers)
+{
+    close();
+
+    this->host = host;
+    this->port = port;
+    this->headers = headers;
+
+    stats.subscribes++;
+    state = OctoPrintPush_LoggingIn;
+    stateTime = millis();
+
+    // passive login only checks the API key and hands back a session for the socket
+    if(!loginClient.post(host, port, OCTOPRINT_LOGIN, headers, "application/json", "{\"passive\":true}",
+        [this](AsyncHttpClient* client, int httpCode, char* body, size_t length)
+        {
+            handleLogin(httpCode, body, length);
+        }))
+    {
+        state = OctoPrintPush_Closed;
+    }
+}
+
+bool OctoPrintPushClient::isSubscribedTo(const String& host, int port)
+{
+    return state != OctoPrintPush_Closed && this->port == port && this->host == host;
+}
+
+void OctoPrintPushClient::close()
+{
+    // state is closed first so the disconnect callback is ignored
+    state = OctoPrintPush_Closed;
+    client.close(true);
+
+    messageReady = false;
+    pongPending = false;
+    authPending = false;
+    closePending = false;
+}
+
+void OctoPrintPushClient::poll()
+{
+    unsigned long now = millis();
+
+    if(closePending)
+    {
+        close();
+        return;
+    }
+
+    switch(state)
+    {
+        case OctoPrintPush_Connecting:
+        case OctoPrintPush_Upgrading:
+            if(now - stateTime > OCTOPRINT_PUSH_CONNECT_TIMEOUT)
+            {
+                Serial.println("OctoPrint push socket connect timed out");
+                close();
+            }
+            break;
+
+        case OctoPrintPush_Open:
+            if(now - lastMessage > OCTOPRINT_PUSH_SILENCE_TIMEOUT)
+            {
+                Serial.println("OctoPrint push socket silent, closing");
+                close();
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if(state != OctoPrintPush_Open)
+    {
+        return;
+    }
+
+    if(authPending)
+    {
+        authPending = false;
+        sendAuth();
+    }
+
+    if(pongPending)
+    {
+        pongPending = false;
+        sendFrame(WEBSOCKET_OPCODE_PONG, control, controlLength);
+    }
+
+    if(messageReady)
+    {
+        stats.messages++;
+        lastMessage = now;
+
+        if(callback)
+        {
+            callback(message, messageLength);
+        }
+
+        // the socket keeps dropping messages until this one is handled
+        messageReady = false;
+    }
+}
+
+void OctoPrintPushClient::handleLogin(int httpCode, char* body, size_t length)
+{
+    if(state != OctoPrintPush_LoggingIn)
+    {
+        return;
+    }
+
+    StaticJsonDocument<JSON_CAPACITY(LOGIN_DECODE_SIZE)> doc;
+    StaticJsonDocument<JSON_CAPACITY(64)> filter;
+
+    filter["name"] = true;
+    filter["session"] = true;
+
+    if(httpCode != 200 || deserializeJson(doc, body, length, DeserializationOption::Filter(filter)) || doc["session"].isNull())
+    {
+        Serial.print("OctoPrint push login failed, HTTP CODE: ");
+        Serial.println(httpCode);
+        state = OctoPrintPush_Closed;
+        return;
+    }
+
+    session = (const char*)doc["name"];
+    session += ":";
+    session += (const char*)doc["session"];
+
+    connect();
+}
+
+void OctoPrintPushClient::connect()
+{
+    state = OctoPrintPush_Connecting;
+    stateTime = millis();
+
+    if(!client.connect(host.c_str(), port))
+    {
+        close();
+    }
+}
+
+void OctoPrintPushClient::sendAuth()
+{
+    String text;
+
+    text = "{\"auth\":\"" + session + "\"}";
+    sendFrame(WEBSOCKET_OPCODE_TEXT, text.c_str(), text.length());
+
+    text = "{\"throttle\":" + String(OCTOPRINT_PUSH_THROTTLE) + "}";
+    sendFrame(WEBSOCKET_OPCODE_TEXT, text.c_str(), text.length());
+
+    // logs and terminal messages are by far the biggest part of each update, older
+    // versions of OctoPrint ignore this and those messages get dropped for size
+    text = "{\"subscribe\":{\"state\":{\"logs\":false,\"messages\":false},\"events\":false,\"plugins\":false}}";
+    sendFrame(WEBSOCKET_OPCODE_TEXT, text.c_str(), text.length());
+}
+
+// client frames always have to be masked
+bool OctoPrintPushClient::sendFrame(uint8_t opcode, const char* payload, size_t length)
+{
+    uint8_t header[8];
+    uint8_t* mask;
+    size_t headerLength = 0;
+    char masked[MASKED_BLOCK_SIZE];
+
+    header[headerLength++] = 0x80 | opcode;
+    if(length < 126)
+    {
+        header[headerLength++] = 0x80 | length;
+    }
+    else
+    {
+        header[headerLength++] = 0x80 | 126;
+        header[headerLength++] = (length >> 8) & 0xff;
+        header[headerLength++] = length & 0xff;
+    }
+
+    mask = &header[headerLength];
+    for(int i=0; i<4; i++)
+    {
+        header[headerLength++] = random(256);
+    }
+
+    if(client.space() < headerLength + length)
+    {
+        return false;
+    }
+
+    client.add((const char*)header, headerLength);
+
+    for(size_t i=0; i<length; i+=MASKED_BLOCK_SIZE)
+    {
+        size_t count = min((size_t)MASKED_BLOCK_SIZE, length - i);
+
+        for(size_t j=0; j<count; j++)
+        {
+            masked[j] = payload[i + j] ^ mask[(i + j) & 3];
+        }
+        client.add(masked, count);
+    }
+
+    return client.send();
+}
+
+/****************************************************************************************
+ *
+ *  Socket callbacks
+ *
+****************************************************************************************/
+
+void OctoPrintPushClient::handleConnect()
+{
+    if(state != OctoPrintPush_Connecting)
+    {
+        return;
+    }
+
+    uint8_t key[16];
+    String request;
+
+    for(int i=0; i<16; i++)
+    {
+        key[i] = random(256);
+    }
+
+    request = "GET " OCTOPRINT_PUSH_SOCKET " HTTP/1.1\r\n";
+    request += "Host: " + host + ":" + String(port) + "\r\n";
+    request += "Upgrade: websocket\r\n";
+    request += "Connection: Upgrade\r\n";
+    request += "Sec-WebSocket-Key: " + base64::encode(key, sizeof(key), false) + "\r\n";
+    request += "Sec-WebSocket-Version: 13\r\n";
+    request += headers;
+    request += "\r\n";
+
+    handshakeLength = 0;
+    statusRead = false;
+    state = OctoPrintPush_Upgrading;
+    client.write(request.c_str(), request.length());
+}
+
+void OctoPrintPushClient::handleData(uint8_t* data, size_t len)
+{
+    if(state == OctoPrintPush_Upgrading)
+    {
+        size_t used = readHandshake(data, len);
+        data += used;
+        len -= used;
+    }
+
+    while(state == OctoPrintPush_Open && !closePending && len > 0)
+    {
+        size_t used = readFrame(data, len);
+        data += used;
+        len -= used;
+    }
+}
+
+void OctoPrintPushClient::handleDisconnect()
+{
+    if(state == OctoPrintPush_Connecting || state == OctoPrintPush_Upgrading || state == OctoPrintPush_Open)
+    {
+        closePending = true;
+    }
+}
+
+/****************************************************************************************
+ *
+ *  Websocket parsing
+ *
+****************************************************************************************/
+
+// the accept key is not checked, a 101 from the push socket path is enough here
+size_t OctoPrintPushClient::readHandshake(uint8_t* data, size_t len)
+{
+    size_t i;
+
+    for(i=0; i<len && state == OctoPrintPush_Upgrading; i++)
+    {
+        char c = data[i];
+
+        if(c == '\r')
+        {
+            continue;
+        }
+        if(c != '\n')
+        {
+            if(handshakeLength < sizeof(handshakeLine) - 1)
+            {
+                handshakeLine[handshakeLength++] = c;
+            }
+            continue;
+        }
+
+        handshakeLine[handshakeLength] = 0;
+
+        if(!statusRead)
+        {
+            if(strncmp(handshakeLine, "HTTP/1.1 101", 12) != 0)
+            {
+                closePending = true;
+                return len;
+            }
+            statusRead = true;
+        }
+        else if(handshakeLength == 0)
+        {
+            // blank line, end of the headers
+            state = OctoPrintPush_Open;
+            frameState = OctoPrintFrame_Header;
+            headerLength = 0;
+            messageLength = 0;
+            discardMessage = true;
+            authPending = true;
+            lastMessage = millis();
+        }
+
+        handshakeLength = 0;
+    }
+
+    return i;
+}
+
+size_t OctoPrintPushClient::readFrame(uint8_t* data, size_t len)
+{
+    size_t count;
+
+    switch(frameState)
+    {
+        case OctoPrintFrame_Header:
+            if(headerLength == 0)
+            {
+                frameFinal = *data & 0x80;
+                frameOpcode = *data & 0x0f;
+                headerLength = 1;
+                return 1;
+            }
+
+            // second header byte, server frames are never masked
+            headerLength = 0;
+            if(*data & 0x80)
+            {
+                closePending = true;
+                return len;
+            }
+
+            payloadRemaining = *data & 0x7f;
+            if(payloadRemaining == 126)
+            {
+                lengthBytes = 2;
+                payloadRemaining = 0;
+                frameState = OctoPrintFrame_Length;
+            }
+            else if(payloadRemaining == 127)
+            {
+                lengthBytes = 8;
+                payloadRemaining = 0;
+                frameState = OctoPrintFrame_Length;
+            }
+            else
+            {
+                startPayload();
+            }
+            return 1;
+
+        case OctoPrintFrame_Length:
+            payloadRemaining = (payloadRemaining << 8) | *data;
+            if(--lengthBytes == 0)
+            {
+                startPayload();
+            }
+            return 1;
+
+        case OctoPrintFrame_Payload:
+            count = min((size_t)payloadRemaining, len);
+            readPayload(data, count);
+            payloadRemaining -= count;
+            if(payloadRemaining == 0)
+            {
+                endFrame();
+            }
+            return count;
+    }
+
+    return len;
+}
+
+void OctoPrintPushClient::startPayload()
+{
+    frameState = OctoPrintFrame_Payload;
+
+    if(frameOpcode >= WEBSOCKET_OPCODE_CLOSE)
+    {
+        if(payloadRemaining > WEBSOCKET_MAX_CONTROL_PAYLOAD)
+        {
+            closePending = true;
+            return;
+        }
+        controlLength = 0;
+    }
+    else if(frameOpcode != WEBSOCKET_OPCODE_CONTINUATION)
+    {
+        // a new message, skipped if the last one hasn't been handled yet
+        messageLength = 0;
+        discardMessage = messageReady || frameOpcode != WEBSOCKET_OPCODE_TEXT;
+    }
+
+    if(payloadRemaining == 0)
+    {
+        endFrame();
+    }
+}
+
+void OctoPrintPushClient::readPayload(uint8_t* data, size_t len)
+{
+    if(frameOpcode >= WEBSOCKET_OPCODE_CLOSE)
+    {
+        memcpy(&control[controlLength], data, len);
+        controlLength += len;
+    }
+    else if(!discardMessage)
+    {
+        if(messageLength + len > OCTOPRINT_PUSH_MAX_MESSAGE)
+        {
+            discardMessage = true;
+        }
+        else
+        {
+            memcpy(&message[messageLength], data, len);
+            messageLength += len;
+        }
+    }
+}
+
+void OctoPrintPushClient::endFrame()
+{
+    frameState = OctoPrintFrame_Header;
+
+    switch(frameOpcode)
+    {
+        case WEBSOCKET_OPCODE_CLOSE:
+            closePending = true;
+            break;
+
+        case WEBSOCKET_OPCODE_PING:
+            pongPending = true;
+            break;
+
+        case WEBSOCKET_OPCODE_PONG:
+            break;
+
+        default:
+            if(frameFinal)
+            {
+                if(discardMessage)
+                {
+                    stats.dropped++;
+                }
+                else
+                {
+                    message[messageLength] = '\0';
+                    messageReady = true;
+                }
+                discardMessage = true;
+            }
+            break;
+    }
+}
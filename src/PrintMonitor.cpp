@@ -1,10 +1,12 @@
 #include <Arduino.h>
 #include <ArduinoOTA.h>
+// start delays for the task profiler, must be set before the scheduler is included
+#define _TASK_TIMECRITICAL
 #include <TaskScheduler.h>
 #include <NTPClient.h>
 #include <ESP8266WiFi.h>
 #include <WiFiUdp.h>
-#include <ESPAsyncWifiManager.h>
+#include <ESPAsyncWiFiManager.h>
 #include "OpenWeatherMapCurrent.h"
 #include "SettingsManager.h"
 #include "Settings.h"
@@ -12,6 +14,9 @@
 #include "DisplayTFT.h"
 #include "WebServer.h"
 #include "OctoPrintMonitor.h"
+#include "AsyncHttpClient.h"
+#include "HeapMetrics.h"
+#include "TaskProfiler.h"
 #include <FS.h>
 
 // globals
@@ -31,9 +36,9 @@ Task connectWifi(0, TASK_ONCE, &connectWifiCallback);
 Task getTime(TIME_FETCH_INTERVAL, TASK_FOREVER, &getTimeCallback);
 Task getCurrentWeather(60*SECONDS_MULT, TASK_FOREVER, &getCurrentWeatherCallback);
 Task updateWiFiStrength(WIFI_STRENGTH_INTERVAL, TASK_FOREVER, &updateWifiStrengthCallback);
-Task checkScreenGrabRequested(SCREENGRAB_INTERVAL, TASK_FOREVER, &checkScreenGrabCallback);
 Task octoPrintUpdate(5*MINUTES_MULT, TASK_FOREVER, &updatePrinterMonitorCallback);
-Task cycleDisplay(30*SECONDS_MULT, TASK_FOREVER, &cycleDisplayCallback);     
+Task cycleDisplay(30*SECONDS_MULT, TASK_FOREVER, &cycleDisplayCallback);
+Task reportMetrics(METRICS_INTERVAL, TASK_FOREVER, &reportMetricsCallback);     
 
 // task callbacks
 
@@ -41,7 +46,14 @@ Task cycleDisplay(30*SECONDS_MULT, TASK_FOREVER, &cycleDisplayCallback);
 
 void getTimeCallback()
 {
-    timeClient.update();
+    TaskTimer timer(ProfiledTask_Time, getTime.getStartDelay());
+    HeapProbe probe(HeapSubsystem_Time);
+
+    {
+        // NTP packets are allocated by the network stack
+        HeapUntracked untracked;
+        timeClient.update();
+    }
     display->drawCurrentTime(timeClient.getEpochTime());
 }
 
@@ -49,11 +61,27 @@ void getTimeCallback()
 
 void getCurrentWeatherCallback()
 {
+    TaskTimer timer(ProfiledTask_Weather, getCurrentWeather.getStartDelay());
+    HeapProbe probe(HeapSubsystem_Weather);
+
     if(settingsManager.getWeatherEnabled())
     {
+        // drawn from currentWeatherUpdatedCallback once the response arrives, the
+        // request opens a new socket each time
+        HeapUntracked untracked;
         currentWeatherClient.updateById(settingsManager.getOpenWeatherApiKey(), settingsManager.getOpenWeatherlocationID());
-        webServer.updateCurrentWeather(currentWeatherClient.getCurrentData());
     }
+    else
+    {
+        display->drawCurrentWeather(currentWeatherClient.getCurrentData(), false);
+    }
+}
+
+void currentWeatherUpdatedCallback()
+{
+    webServer.updateCurrentWeather(currentWeatherClient.getCurrentData());
+
+    HeapProbe probe(HeapSubsystem_Display);
     display->drawCurrentWeather(currentWeatherClient.getCurrentData(), settingsManager.getWeatherEnabled());
 }
 
@@ -61,18 +89,61 @@ void getCurrentWeatherCallback()
 
 void updatePrinterMonitorCallback()
 {
-    OctoPrinterData* printerData = settingsManager.getPrinterData(currentPrinter);
+    TaskTimer timer(ProfiledTask_PrintMonitor, octoPrintUpdate.getStartDelay());
+    HeapProbe probe(HeapSubsystem_PrintMonitor);
+
+    // all enabled printers are polled, results arrive through printerUpdatedCallback
+    octoPrintMonitor.update();
+
+#if POLL_STATS_LOGGING
+    ConnectionPoolStats* stats = octoPrintMonitor.getConnectionStats();
+    Serial.printf("updatePrinterMonitorCallback, requests %lu reused %lu reconnects %lu\n", stats->requests, stats->reused, stats->reconnects);
+#if OCTOPRINT_PUSH_MODE
+    OctoPrintPushStats* pushStats = octoPrintMonitor.getPushStats();
+    Serial.printf("push subscribes %lu messages %lu dropped %lu\n", pushStats->subscribes, pushStats->messages, pushStats->dropped);
+#endif
+
+    DisplayRenderStats* renderStats = display->getRenderStats();
+    Serial.printf("display frames %lu, last frame pixels drawn %lu saved %lu, total saved %lu, sprite fallbacks %lu\n", renderStats->frames,
+        renderStats->pixelsDrawn, renderStats->pixelsSaved, renderStats->totalPixelsSaved, renderStats->spriteFallbacks);
+#endif
+}
 
-    if(printerData->enabled)
+void printerUpdatedCallback(int printerId)
+{
+    OctoPrinterData* printerData = settingsManager.getPrinterData(printerId);
+    OctoPrintMonitorData* monitorData = octoPrintMonitor.getPrinterData(printerId);
+
+    webServer.updatePrintMonitorInfo(printerId, monitorData, printerData->displayName, printerData->enabled);
+
+    if(printerId == currentPrinter)
     {
-        octoPrintMonitor.setCurrentPrinter(printerData->address, printerData->port, printerData->apiKey, printerData->username, printerData->password);
-        octoPrintMonitor.update();
+        HeapProbe probe(HeapSubsystem_Display);
+        display->drawOctoPrintStatus(monitorData, printerData->displayName, printerData->enabled);
     }
-    
-    display->drawOctoPrintStatus(octoPrintMonitor.getCurrentData(), printerData->displayName, printerData->enabled);
-    webServer.updatePrintMonitorInfo(octoPrintMonitor.getCurrentData(), printerData->displayName, printerData->enabled);
+}
 
-    Serial.println("updatePrinterMonitorCallback");
+void drawCurrentPrinter()
+{
+    HeapProbe probe(HeapSubsystem_Display);
+
+    if(currentPrinter != -1)
+    {
+        OctoPrinterData* printerData = settingsManager.getPrinterData(currentPrinter);
+
+        octoPrintMonitor.setPushPrinter(currentPrinter);
+        display->drawOctoPrintStatus(octoPrintMonitor.getPrinterData(currentPrinter), printerData->displayName, printerData->enabled);
+    }
+}
+
+// metrics
+
+void reportMetricsCallback()
+{
+    TaskTimer timer(ProfiledTask_Metrics, reportMetrics.getStartDelay());
+
+    webServer.updateMetrics();
+    HeapMetrics::checkAllocations();
 }
 
 // wifi
@@ -95,21 +166,29 @@ void connectWifiCallback()
 
     Serial.println(WiFi.localIP());
 
-    webServer.init(&settingsManager);
+    webServer.init(&settingsManager, display);
 
     timeClient.setTimeOffset(settingsManager.getUtcOffset());
 
     currentWeatherClient.setMetric(settingsManager.getDisplayMetric());
-    settingsManager.setSettingsChangedCallback(settingsChangedCallback);
+    currentWeatherClient.setUpdatedCallback(currentWeatherUpdatedCallback);
+    settingsManager.addListener(SettingsChange_Brightness, brightnessChanged);
+    settingsManager.addListener(SettingsChange_UtcOffset | SettingsChange_ClockFormat | SettingsChange_DateFormat, timeSettingsChanged);
+    settingsManager.addListener(SettingsChange_WeatherInterval | SettingsChange_PrintMonitorInterval | SettingsChange_DisplayCycleInterval, intervalsChanged);
+    settingsManager.addListener(SettingsChange_Metric, metricChanged);
+    settingsManager.addListener(SettingsChange_Printers, printersChanged);     // before the display redraws a printer
+    settingsManager.addListener(SettingsChange_Weather | SettingsChange_Printers | SettingsChange_CurrentDisplay, displaySettingsChanged);
     settingsManager.setPrinterDeletedCallback(printerDeletedCallback);
+    octoPrintMonitor.init(&settingsManager);
+    octoPrintMonitor.setPrinterUpdatedCallback(printerUpdatedCallback);
     delay(WIFI_CONNECTING_DELAY);
 
     taskScheduler.addTask(getTime);
     taskScheduler.addTask(getCurrentWeather);
     taskScheduler.addTask(updateWiFiStrength);
-    taskScheduler.addTask(checkScreenGrabRequested);
     taskScheduler.addTask(octoPrintUpdate);
     taskScheduler.addTask(cycleDisplay);
+    taskScheduler.addTask(reportMetrics);
 
     // timings
     getCurrentWeather.setInterval(settingsManager.getCurrentWeatherInterval());
@@ -119,8 +198,8 @@ void connectWifiCallback()
     getTime.enable();
     getCurrentWeather.enable();     // TODO
     updateWiFiStrength.enable();
-    checkScreenGrabRequested.enable();
     cycleDisplay.disable();
+    reportMetrics.enable();
 
     display->setDisplayBrightness(settingsManager.getDisplayBrightness());
     setupDisplay();
@@ -128,53 +207,85 @@ void connectWifiCallback()
 
 void updateWifiStrengthCallback()
 {
+    TaskTimer timer(ProfiledTask_WiFi, updateWiFiStrength.getStartDelay());
+    HeapProbe probe(HeapSubsystem_WiFi);
+
     long wifiStrength = WiFi.RSSI();
     display->drawWiFiStrength(wifiStrength);
 }
 
 // settings
 
-void settingsChangedCallback()
-{
-    timeClient.setTimeOffset(settingsManager.getUtcOffset());
-    currentWeatherClient.setMetric(settingsManager.getDisplayMetric());
+// settings listeners, each only redoes the work its settings affect
 
-    // best just to force a display clear when changing settings
+void brightnessChanged(SettingsChangeSet changes)
+{
     display->setDisplayBrightness(settingsManager.getDisplayBrightness());
-    display->setDisplayMetric(settingsManager.getDisplayMetric());
+}
+
+void timeSettingsChanged(SettingsChangeSet changes)
+{
+    timeClient.setTimeOffset(settingsManager.getUtcOffset());
     display->setClockFormat(settingsManager.getClockFormat());
     display->setDateFormat(settingsManager.getDateFormat());
-    display->clearDisplay();
-    setupDisplay();
+    display->drawCurrentTime(timeClient.getEpochTime());
+}
 
-    getCurrentWeather.setInterval(settingsManager.getCurrentWeatherInterval());
-    octoPrintUpdate.setInterval(settingsManager.getPrintMonitorInterval());
-    cycleDisplay.setInterval(settingsManager.getDisplayCycleInterval());
+void intervalsChanged(SettingsChangeSet changes)
+{
+    if(changes & SettingsChange_WeatherInterval)
+    {
+        getCurrentWeather.setInterval(settingsManager.getCurrentWeatherInterval());
+    }
+    if(changes & SettingsChange_PrintMonitorInterval)
+    {
+        octoPrintUpdate.setInterval(settingsManager.getPrintMonitorInterval());
+    }
+    if(changes & SettingsChange_DisplayCycleInterval)
+    {
+        cycleDisplay.setInterval(settingsManager.getDisplayCycleInterval());
+    }
+}
 
-    getTime.forceNextIteration();
+void metricChanged(SettingsChangeSet changes)
+{
+    currentWeatherClient.setMetric(settingsManager.getDisplayMetric());
+    display->setDisplayMetric(settingsManager.getDisplayMetric());
+
+    // weather comes back from the API in the new units, printer temperatures are always Celsius
     getCurrentWeather.forceNextIteration();
-    updateWiFiStrength.forceNextIteration();
-    octoPrintUpdate.forceNextIteration();
 }
 
-void printerDeletedCallback()
+void displaySettingsChanged(SettingsChangeSet changes)
 {
-    settingsManager.setSettingsChangedCallback(nullptr);
+    // what is on screen may change completely, best just to clear and redraw
+    display->clearDisplay();
+    setupDisplay();
 
-    settingsManager.setCurrentDisplay(WEATHER_DISPLAY_SETTING);
+    getTime.forceNextIteration();
+    updateWiFiStrength.forceNextIteration();
 
-    settingsManager.setSettingsChangedCallback(settingsChangedCallback);
+    if(changes & (SettingsChange_Weather | SettingsChange_CurrentDisplay))
+    {
+        getCurrentWeather.forceNextIteration();
+    }
+    if(changes & (SettingsChange_Printers | SettingsChange_CurrentDisplay))
+    {
+        octoPrintUpdate.forceNextIteration();
+    }
 }
 
-// screen grabs
+void printersChanged(SettingsChangeSet changes)
+{
+    octoPrintMonitor.printersChanged();
+}
 
-void checkScreenGrabCallback()
+void printerDeletedCallback()
 {
-    if(webServer.screenGrabRequested())
-    {
-        display->serveScreenShot();
-        webServer.clearScreenGrabRequest();
-    }
+    octoPrintMonitor.resetPrinterData();
+
+    // part of the deletion update, notified once the deletion is saved
+    settingsManager.setCurrentDisplay(WEATHER_DISPLAY_SETTING);
 }
 
 // display handling
@@ -184,9 +295,20 @@ void setupDisplay()
     if(settingsManager.getWeatherEnabled() == false && settingsManager.getNumEnabledPrinters() == 0)
     {
         display->setDisplayMode(DisplayMode_NotSetup);
+        octoPrintUpdate.disable();
         return;
     }
 
+    // printers are polled whatever is on display so cycling shows fresh data
+    if(settingsManager.getNumEnabledPrinters() > 0)
+    {
+        octoPrintUpdate.enableIfNot();
+    }
+    else
+    {
+        octoPrintUpdate.disable();
+    }
+
     switch(settingsManager.getCurrentDisplay())
     {
         case CYCLE_DISPLAY_SETTING:
@@ -194,15 +316,13 @@ void setupDisplay()
             {
                 display->setDisplayMode(DisplayMode_Weather);
                 currentPrinter = -1;
-                octoPrintUpdate.disable();
                 cycleDisplay.enableDelayed(settingsManager.getDisplayCycleInterval());    
             }
             else
             {
                 currentPrinter = getNextPrinter(-1);
-                octoPrintUpdate.enableIfNot();
-                octoPrintUpdate.forceNextIteration();
                 display->setDisplayMode(DisplayMode_PrintMonitor);
+                drawCurrentPrinter();
                 cycleDisplay.enableDelayed(settingsManager.getDisplayCycleInterval());    
             }            
             break;
@@ -210,17 +330,16 @@ void setupDisplay()
         case WEATHER_DISPLAY_SETTING:
             display->setDisplayMode(DisplayMode_Weather);
             currentPrinter = -1;
-            octoPrintUpdate.disable();
             cycleDisplay.disable();
             break;
 
         default:
             int printerId = settingsManager.getCurrentDisplay() - 1;
             currentPrinter = printerId;
-            octoPrintUpdate.enableIfNot();
             cycleDisplay.disable();
 
             display->setDisplayMode(DisplayMode_PrintMonitor);
+            drawCurrentPrinter();
             break;
     }
 }
@@ -228,6 +347,14 @@ void setupDisplay()
 // display cycling
 
 void cycleDisplayCallback()
+{
+    TaskTimer timer(ProfiledTask_CycleDisplay, cycleDisplay.getStartDelay());
+    HeapProbe probe(HeapSubsystem_Display);
+
+    showNextDisplay();
+}
+
+void showNextDisplay()
 {
     int nextPrinter;
 
@@ -235,9 +362,8 @@ void cycleDisplayCallback()
     if(nextPrinter != -1)
     {
         currentPrinter = nextPrinter;
-        octoPrintUpdate.enableIfNot();
-        octoPrintUpdate.forceNextIteration();
         display->setDisplayMode(DisplayMode_PrintMonitor);
+        drawCurrentPrinter();
     }
     else
     {
@@ -248,13 +374,12 @@ void cycleDisplayCallback()
             {
                 display->setDisplayMode(DisplayMode_Weather);
                 currentPrinter = nextPrinter;
-                octoPrintUpdate.disable();
                 display->drawCurrentWeather(currentWeatherClient.getCurrentData(), settingsManager.getWeatherEnabled());
             }
             else
             {
                 currentPrinter = -1;
-                cycleDisplayCallback();
+                showNextDisplay();
             }            
         }
     }
@@ -309,6 +434,8 @@ void setup()
 void loop() 
 {
     taskScheduler.execute();
+    AsyncHttpClient::pollAll();
+    octoPrintMonitor.poll();
     ArduinoOTA.handle();
 }
 
@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "JsonArena.h"
 #include <FS.h>
 #include "SettingsManager.h"
 
@@ -11,9 +12,11 @@ const int DISPLAY_CYCLE_INERVAL         = 30 * SECONDS_MULT;
 const int PRINTER_JSON_SIZE  = 512;           
 const int SETTINGS_JSON_SIZE = 512;
 
+SettingsRecord SettingsManager::record(SETTINGS_RECORD_VERSION);
+
 void SettingsManager::init()
 {
-    settingsChangedCallback = nullptr;
+    numSubscribers = 0;
     printerDeletedCallback = nullptr;
 
     data.numPrinters = 0;
@@ -22,20 +25,25 @@ void SettingsManager::init()
 
     for(int i=0; i<MAX_PRINTERS; i++)
     {
-        printersData[i] = new OctoPrinterData;
+        printersData[i] = &printerSlots[i];
     }
 
-    // for testing now as settings not saved to start with
-    //SPIFFS.remove(SETTINGS_FILE_NAME);
+    dirtyRecords = 0;
+    pendingChanges = 0;
+    updateDepth = 0;
 
-    if(!SPIFFS.exists(SETTINGS_FILE_NAME))
+    if(!loadSettings())
     {
-        //Serial.println("No settings found, creating.");
-        resetSettings();
-        saveSettings();
+        if(SPIFFS.exists(SETTINGS_FILE_NAME))
+        {
+            migrateJsonSettings();
+        }
+        else
+        {
+            //Serial.println("No settings found, creating.");
+            resetSettings();
+        }
     }
-    
-    loadSettings();
 }
 
 void SettingsManager::resetSettings()
@@ -59,13 +67,14 @@ void SettingsManager::resetSettings()
 
     data.currentDisplay = 0;
 
+    dirtyRecords |= SETTINGS_DIRTY_GENERAL;
     saveSettings();
 }
 
-void SettingsManager::loadSettings()
+void SettingsManager::loadJsonSettings()
 {
     File jsonSettings;
-    DynamicJsonDocument doc(SETTINGS_JSON_SIZE);
+    ArenaJsonDocument doc(SETTINGS_JSON_SIZE);
 
     jsonSettings = SPIFFS.open(SETTINGS_FILE_NAME, "r");
     deserializeJson(doc, jsonSettings);
@@ -97,18 +106,16 @@ void SettingsManager::loadSettings()
     //Serial.println();
     //serializeJson(doc, Serial);
     //Serial.println();
-
-    loadPrinters();
 }
 
-void SettingsManager::loadPrinters()
+void SettingsManager::loadJsonPrinters()
 {
     char buffer[32];
 
     for(int i=0; i<data.numPrinters; i++)
     {
         File printerSettings;
-        DynamicJsonDocument doc(PRINTER_JSON_SIZE);
+        ArenaJsonDocument doc(PRINTER_JSON_SIZE);
         sprintf(buffer, "/printer%d.json", i);
         OctoPrinterData* printer = printersData[i];
 
@@ -132,92 +139,254 @@ void SettingsManager::loadPrinters()
     }
 }
 
-void SettingsManager::saveSettings()
+// settings written by older firmware, converted once to the binary records
+void SettingsManager::migrateJsonSettings()
 {
-    File jsonSettings;
-    DynamicJsonDocument doc(SETTINGS_JSON_SIZE);   
+    char buffer[32];
 
-    doc["WeatherAPIKey"] = data.openWeatherMapAPIKey;
-    doc["WeatherLLocationID"] = data.openWeatherLocationID;
-    doc["WeatherEnabled"] = data.weatherEnabled;
-    doc["DisplayBrightness"] = data.displayBrightness;
-    doc["DisplayMetric"] = data.displayMetric;
-    doc["CurrentWeatherInterval"] = data.currentWeatherInterval;
-    doc["PrinterMonitorInterval"] = data.printMonitorInterval;
-    doc["DisplayCycleInterval"] = data.displayCycleInterval;
-    doc["utcOffset"] = data.utcOffsetSeconds;
-    doc["ClockFormat"] = (int)data.clockFormat;
-    doc["DateFormat"] = (int)data.dateFormat;
+    loadJsonSettings();
+    loadJsonPrinters();
 
-    doc["PrinterCount"] = data.numPrinters;
-    doc["CurrentDisplay"] = data.currentDisplay;
+    dirtyRecords = SETTINGS_DIRTY_ALL;
+    saveSettings();
 
-    jsonSettings = SPIFFS.open(SETTINGS_FILE_NAME, "w");
-    if(jsonSettings)
+    if(dirtyRecords == 0)
     {
-        serializeJson(doc, jsonSettings);
-        //Serial.println("Settings file saved.");
-        jsonSettings.close();
+        SPIFFS.remove(SETTINGS_FILE_NAME);
+        for(int i=0; i<data.numPrinters; i++)
+        {
+            sprintf(buffer, "/printer%d.json", i);
+            SPIFFS.remove(buffer);
+        }
     }
-    else
+}
+
+bool SettingsManager::loadSettings()
+{
+    if(!record.load(SETTINGS_RECORD_FILE))
     {
-        Serial.println("Unable to save settings file.");
+        return false;
     }
-    
-    // testing
-    //serializeJson(doc, Serial); 
-    //Serial.println();
 
-    savePrinters();
+    data.openWeatherMapAPIKey = record.getString();
+    data.openWeatherLocationID = record.getString();
+    data.weatherEnabled = record.getBool();
+
+    data.displayBrightness = record.getInt32();
+    data.displayMetric = record.getBool();
+
+    data.currentWeatherInterval = record.getInt32();
+    data.printMonitorInterval = record.getInt32();
+    data.displayCycleInterval = record.getInt32();
+
+    data.numPrinters = constrain(record.getInt32(), 0, MAX_PRINTERS);
+
+    data.utcOffsetSeconds = record.getInt32();
+    data.clockFormat = (ClockFormat)record.getUInt8();
+    data.dateFormat = (DateFormat)record.getUInt8();
+
+    data.currentDisplay = record.getInt32();
+
+    if(!record.isValid())
+    {
+        Serial.println("Settings record is corrupt.");
+        return false;
+    }
+
+    int savedPrinters = data.numPrinters;
+
+    for(int i=0; i<savedPrinters; i++)
+    {
+        if(!loadPrinter(i))
+        {
+            // keep the printers before the broken record. It and the records
+            // after it are removed once the shorter list is saved, as for a deletion
+            data.numPrinters = i;
+            dirtyRecords |= SETTINGS_DIRTY_GENERAL;
+            for(int j=i; j<savedPrinters; j++)
+            {
+                dirtyRecords |= SETTINGS_DIRTY_PRINTER(j);
+            }
+            break;
+        }
+    }
+
+    saveSettings();
+
+    return true;
 }
 
-void SettingsManager::savePrinters()
+bool SettingsManager::loadPrinter(int printerNum)
 {
-    char buffer[32];
+    OctoPrinterData* printer = printersData[printerNum];
+    char path[32];
 
-    for(int i=0; i<data.numPrinters; i++)
+    sprintf(path, PRINTER_RECORD_FILE, printerNum);
+    if(!record.load(path))
     {
-        File printerSettings;
-        DynamicJsonDocument doc(PRINTER_JSON_SIZE);
-        sprintf(buffer, "/printer%d.json", i);
-        OctoPrinterData* printer = printersData[i];
+        Serial.println("Unable to load printer.");
+        return false;
+    }
 
-        doc["Address"] = printer->address;
-        doc["Port"] = printer->port;
-        doc["Username"] = printer->username;
-        doc["Password"] = printer->password;
-        doc["APIKey"] = printer->apiKey;
-        doc["DisplayName"] = printer->displayName;
-        doc["Enabled"] = printer->enabled;
+    printer->address = record.getString();
+    printer->port = record.getInt32();
+    printer->username = record.getString();
+    printer->password = record.getString();
+    printer->apiKey = record.getString();
+    printer->displayName = record.getString();
+    printer->enabled = record.getBool();
 
-        printerSettings = SPIFFS.open(buffer, "w");
-        if(printerSettings)
-        {
-            serializeJson(doc, printerSettings);
-            //Serial.println("Printer file saved.");
-            printerSettings.close();
+    return record.isValid();
+}
+
+// writes only the records changed since the last save, a record that fails to
+// save stays dirty and is retried on the next change
+void SettingsManager::saveSettings()
+{
+    if(dirtyRecords & SETTINGS_DIRTY_GENERAL)
+    {
+        record.clear();
+        record.putString(data.openWeatherMapAPIKey);
+        record.putString(data.openWeatherLocationID);
+        record.putBool(data.weatherEnabled);
+
+        record.putInt32(data.displayBrightness);
+        record.putBool(data.displayMetric);
+
+        record.putInt32(data.currentWeatherInterval);
+        record.putInt32(data.printMonitorInterval);
+        record.putInt32(data.displayCycleInterval);
+
+        record.putInt32(data.numPrinters);
 
-            // testing
-            //serializeJson(doc, Serial); 
-            //Serial.println();
+        record.putInt32(data.utcOffsetSeconds);
+        record.putUInt8(data.clockFormat);
+        record.putUInt8(data.dateFormat);
+
+        record.putInt32(data.currentDisplay);
+
+        if(record.save(SETTINGS_RECORD_FILE))
+        {
+            dirtyRecords &= ~SETTINGS_DIRTY_GENERAL;
         }
         else
         {
-            Serial.println("Unable to save printer.");
+            Serial.println("Unable to save settings file.");
+        }
+    }
+
+    for(int i=0; i<MAX_PRINTERS; i++)
+    {
+        if(!(dirtyRecords & SETTINGS_DIRTY_PRINTER(i)))
+        {
+            continue;
+        }
+
+        if(i < data.numPrinters)
+        {
+            if(savePrinter(i))
+            {
+                dirtyRecords &= ~SETTINGS_DIRTY_PRINTER(i);
+            }
+            else
+            {
+                Serial.println("Unable to save printer.");
+            }
+        }
+        else if((dirtyRecords & (SETTINGS_DIRTY_PRINTER(data.numPrinters) - 1)) == 0)
+        {
+            // left over from a deletion, only removed once the settings and every
+            // printer that moved down a slot are safely saved
+            if(removePrinter(i))
+            {
+                dirtyRecords &= ~SETTINGS_DIRTY_PRINTER(i);
+            }
+            else
+            {
+                Serial.println("Unable to remove printer.");
+            }
         }
     }
 }
 
-void SettingsManager::updateSettings()
+bool SettingsManager::savePrinter(int printerNum)
 {
+    OctoPrinterData* printer = printersData[printerNum];
+    char path[32];
+
+    record.clear();
+    record.putString(printer->address);
+    record.putInt32(printer->port);
+    record.putString(printer->username);
+    record.putString(printer->password);
+    record.putString(printer->apiKey);
+    record.putString(printer->displayName);
+    record.putBool(printer->enabled);
+
+    sprintf(path, PRINTER_RECORD_FILE, printerNum);
+    return record.save(path);
+}
+
+bool SettingsManager::removePrinter(int printerNum)
+{
+    char path[32];
+
+    sprintf(path, PRINTER_RECORD_FILE, printerNum);
+    return SettingsRecord::remove(path);
+}
+
+void SettingsManager::updateSettings(uint32_t dirty, SettingsChangeSet changes)
+{
+    dirtyRecords |= dirty;
+    pendingChanges |= changes;
+
+    if(updateDepth == 0)
+    {
+        applyUpdate();
+    }
+}
+
+// setters called between beginUpdate and commitUpdate are saved together and
+// reported to each listener once, updates may be nested
+void SettingsManager::beginUpdate()
+{
+    updateDepth++;
+}
+
+void SettingsManager::commitUpdate()
+{
+    if(updateDepth > 0)
+    {
+        updateDepth--;
+    }
+    if(updateDepth == 0)
+    {
+        applyUpdate();
+    }
+}
+
+void SettingsManager::applyUpdate()
+{
+    SettingsChangeSet changes = pendingChanges;
+
+    if(changes == 0)
+    {
+        return;
+    }
+
+    pendingChanges = 0;
     saveSettings();
-    if(settingsChangedCallback != nullptr)
+
+    for(int i=0; i<numSubscribers; i++)
     {
-        settingsChangedCallback();
+        if(changes & subscribers[i].mask)
+        {
+            subscribers[i].listener(changes & subscribers[i].mask);
+        }
     }
 }
 
-String SettingsManager::getOpenWeatherApiKey()
+const String& SettingsManager::getOpenWeatherApiKey()
 {
     return data.openWeatherMapAPIKey;
 }
@@ -227,11 +396,11 @@ void SettingsManager::setOpenWeatherApiKey(String apiKey)
     if(apiKey != data.openWeatherMapAPIKey)
     {
         data.openWeatherMapAPIKey = apiKey;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_Weather);
     }
 }
 
-String SettingsManager::getOpenWeatherlocationID()
+const String& SettingsManager::getOpenWeatherlocationID()
 {
     return data.openWeatherLocationID;
 }
@@ -241,7 +410,7 @@ void SettingsManager::setOpenWeatherlocationID(String locationID)
     if(locationID != data.openWeatherLocationID)
     {
         data.openWeatherLocationID = locationID;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_Weather);
     }
 }
 
@@ -250,7 +419,7 @@ void SettingsManager::setWeatherEnabled(bool enabled)
     if(enabled != data.weatherEnabled)
     {
         data.weatherEnabled = enabled;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_Weather);
     }
 }
 
@@ -269,7 +438,7 @@ void SettingsManager::setDisplayMetric(bool metric)
     if(metric != data.displayMetric)
     {
         data.displayMetric = metric;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_Metric);
     }
 }
 
@@ -283,7 +452,7 @@ void SettingsManager::setCurrentWeatherInterval(int interval)
     if(data.currentWeatherInterval != interval)
     {
         data.currentWeatherInterval = interval;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_WeatherInterval);
     }
 }
 
@@ -297,7 +466,7 @@ void SettingsManager::setPrintMonitorInterval(int interval)
     if(data.printMonitorInterval != interval)
     {
         data.printMonitorInterval = interval;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_PrintMonitorInterval);
     }
 }
 
@@ -311,7 +480,7 @@ void SettingsManager::setDisplayCycleInterval(int interval)
     if(data.displayCycleInterval != interval)
     {
         data.displayCycleInterval = interval;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_DisplayCycleInterval);
     }
 }
 
@@ -353,7 +522,7 @@ void SettingsManager::addNewPrinter(String address, int port, String userName, S
     newPrinter->enabled = enabled;
     data.numPrinters++;
 
-    updateSettings();
+    updateSettings(SETTINGS_DIRTY_GENERAL | SETTINGS_DIRTY_PRINTER(data.numPrinters - 1), SettingsChange_Printers);
 }
 
 void SettingsManager::editPrinter(int printerNum, String address, int port, String userName, String password, String apiKey, String displayName, bool enabled)
@@ -368,22 +537,34 @@ void SettingsManager::editPrinter(int printerNum, String address, int port, Stri
     printer->displayName = displayName;
     printer->enabled = enabled;
 
-    updateSettings();
+    updateSettings(SETTINGS_DIRTY_PRINTER(printerNum), SettingsChange_Printers);
 }
 
 void SettingsManager::deletePrinter(int printerNum)
 {
-    for (int i = printerNum; i <= data.numPrinters ; ++i)
+    OctoPrinterData* deleted = printersData[printerNum];
+    uint32_t dirty = SETTINGS_DIRTY_GENERAL;
+
+    // later printers move down a slot, the deleted data is reused for the free slot
+    for (int i = printerNum; i < data.numPrinters - 1; ++i)
     {
         printersData[i] = printersData[i + 1];
+        dirty |= SETTINGS_DIRTY_PRINTER(i);
     }
     data.numPrinters--;
+    printersData[data.numPrinters] = deleted;
+
+    // the last record is now unused, saveSettings() removes it after the rest are saved
+    dirty |= SETTINGS_DIRTY_PRINTER(data.numPrinters);
 
+    // changes made by the callback are saved and notified with the deletion
+    beginUpdate();
     if(printerDeletedCallback != nullptr)
     {
         printerDeletedCallback();
     }
-    updateSettings();
+    updateSettings(dirty, SettingsChange_Printers);
+    commitUpdate();
 }
 
 long SettingsManager::getUtcOffset()
@@ -396,7 +577,7 @@ void SettingsManager::setUtcOffset(long utcOffset)
     if(data.utcOffsetSeconds != utcOffset)
     {
         data.utcOffsetSeconds = utcOffset;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_UtcOffset);
     }
 }
 
@@ -418,7 +599,7 @@ void SettingsManager::setDisplayBrightness(int brightnessPercent)
     if(data.displayBrightness != brightnessPercent)
     {
         data.displayBrightness = brightnessPercent;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_Brightness);
     }
 }
 
@@ -432,7 +613,7 @@ void SettingsManager::setCurrentDisplay(int currentDisplay)
     if(data.currentDisplay != currentDisplay)
     {
         data.currentDisplay = currentDisplay;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_CurrentDisplay);
     }
 }
 
@@ -446,7 +627,7 @@ void SettingsManager::setClockFormat(ClockFormat clockFormat)
     if(data.clockFormat != clockFormat)
     {
         data.clockFormat = clockFormat;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_ClockFormat);
     }
 }
 
@@ -460,13 +641,23 @@ void SettingsManager::setDateFormat(DateFormat dateFormat)
     if(data.dateFormat != dateFormat)
     {
         data.dateFormat = dateFormat;
-        updateSettings();
+        updateSettings(SETTINGS_DIRTY_GENERAL, SettingsChange_DateFormat);
     }
 }
 
-void SettingsManager::setSettingsChangedCallback(void (* callback)())
+bool SettingsManager::addListener(SettingsChangeSet mask, SettingsListener listener)
 {
-    settingsChangedCallback = callback;
+    if(numSubscribers >= MAX_SETTINGS_SUBSCRIBERS)
+    {
+        Serial.println("Too many settings listeners.");
+        return false;
+    }
+
+    subscribers[numSubscribers].mask = mask;
+    subscribers[numSubscribers].listener = listener;
+    numSubscribers++;
+
+    return true;
 }
 
 void SettingsManager::setPrinterDeletedCallback(void(* callback)())
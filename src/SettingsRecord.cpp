@@ -0,0 +1,231 @@
+#include <Arduino.h>
+#include <FS.h>
+#include "SettingsRecord.h"
+
+SettingsRecord::SettingsRecord(uint16_t version)
+{
+    currentVersion = version;
+    clear();
+}
+
+void SettingsRecord::clear()
+{
+    version = currentVersion;
+    length = 0;
+    position = 0;
+    valid = true;
+}
+
+// files newer than this build are rejected, older versions are loaded for the
+// caller to convert
+bool SettingsRecord::load(const char* path)
+{
+    String tempPath = String(path) + SETTINGS_RECORD_TEMP_SUFFIX;
+
+    if(loadFile(path))
+    {
+        return true;
+    }
+    if(loadFile(tempPath))
+    {
+        // interrupted save, the temporary copy is complete so finish the rename
+        SPIFFS.remove(path);
+        SPIFFS.rename(tempPath, path);
+        return true;
+    }
+
+    clear();
+    return false;
+}
+
+bool SettingsRecord::loadFile(const String& path)
+{
+    SettingsRecordHeader header;
+    File file;
+    bool loaded = false;
+
+    if(!SPIFFS.exists(path))
+    {
+        return false;
+    }
+
+    file = SPIFFS.open(path, "r");
+    if(!file)
+    {
+        return false;
+    }
+
+    if(file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+        header.magic == SETTINGS_RECORD_MAGIC &&
+        header.version <= currentVersion &&
+        header.length <= SETTINGS_RECORD_MAX_SIZE &&
+        file.read(payload, header.length) == header.length &&
+        crc32(payload, header.length) == header.crc)
+    {
+        version = header.version;
+        length = header.length;
+        position = 0;
+        valid = true;
+        loaded = true;
+    }
+
+    file.close();
+
+    return loaded;
+}
+
+bool SettingsRecord::save(const char* path)
+{
+    SettingsRecordHeader header;
+    String tempPath = String(path) + SETTINGS_RECORD_TEMP_SUFFIX;
+    File file;
+    bool written;
+
+    if(!valid)
+    {
+        Serial.println("Settings record too large.");
+        return false;
+    }
+
+    header.magic = SETTINGS_RECORD_MAGIC;
+    header.version = currentVersion;
+    header.length = length;
+    header.crc = crc32(payload, length);
+
+    file = SPIFFS.open(tempPath, "w");
+    if(!file)
+    {
+        Serial.println("Unable to save settings record.");
+        return false;
+    }
+
+    written = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+        file.write(payload, length) == length;
+    file.close();
+
+    if(!written)
+    {
+        Serial.println("Unable to save settings record.");
+        SPIFFS.remove(tempPath);
+        return false;
+    }
+
+    // SPIFFS can't rename over an existing file, load() recovers the temporary
+    // copy if power is lost between the two
+    SPIFFS.remove(path);
+    return SPIFFS.rename(tempPath, path);
+}
+
+// true once neither the record nor a temporary copy is left
+bool SettingsRecord::remove(const char* path)
+{
+    String tempPath = String(path) + SETTINGS_RECORD_TEMP_SUFFIX;
+
+    SPIFFS.remove(path);
+    SPIFFS.remove(tempPath);
+
+    return !SPIFFS.exists(path) && !SPIFFS.exists(tempPath);
+}
+
+/**** Fields ****/
+
+bool SettingsRecord::write(const void* data, size_t size)
+{
+    if(!valid || length + size > SETTINGS_RECORD_MAX_SIZE)
+    {
+        valid = false;
+        return false;
+    }
+
+    memcpy(&payload[length], data, size);
+    length += size;
+
+    return true;
+}
+
+bool SettingsRecord::read(void* data, size_t size)
+{
+    if(!valid || position + size > length)
+    {
+        valid = false;
+        memset(data, 0, size);
+        return false;
+    }
+
+    memcpy(data, &payload[position], size);
+    position += size;
+
+    return true;
+}
+
+void SettingsRecord::putUInt8(uint8_t value)
+{
+    write(&value, sizeof(value));
+}
+
+void SettingsRecord::putInt32(int32_t value)
+{
+    write(&value, sizeof(value));
+}
+
+void SettingsRecord::putString(const String& value)
+{
+    uint16_t size = value.length();
+
+    write(&size, sizeof(size));
+    write(value.c_str(), size);
+}
+
+uint8_t SettingsRecord::getUInt8()
+{
+    uint8_t value;
+
+    read(&value, sizeof(value));
+    return value;
+}
+
+int32_t SettingsRecord::getInt32()
+{
+    int32_t value;
+
+    read(&value, sizeof(value));
+    return value;
+}
+
+String SettingsRecord::getString()
+{
+    uint16_t size;
+    String value;
+
+    if(!read(&size, sizeof(size)) || position + size > length)
+    {
+        valid = false;
+        return value;
+    }
+
+    value.reserve(size);
+    for(int i=0; i<size; i++)
+    {
+        value += (char)payload[position + i];
+    }
+    position += size;
+
+    return value;
+}
+
+// standard reflected CRC-32, bitwise as records are only a few hundred bytes
+uint32_t SettingsRecord::crc32(const uint8_t* data, size_t length)
+{
+    uint32_t crc = 0xffffffff;
+
+    for(size_t i=0; i<length; i++)
+    {
+        crc ^= data[i];
+        for(int bit=0; bit<8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+        }
+    }
+
+    return ~crc;
+}
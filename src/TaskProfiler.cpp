@@ -0,0 +1,156 @@
+#include <Arduino.h>
+#include "TaskProfiler.h"
+
+TaskProfile TaskProfiler::profiles[ProfiledTask_Count] = {};
+
+static const char* const TASK_NAMES[ProfiledTask_Count] =
+{
+    "getTime",
+    "getCurrentWeather",
+    "updateWiFiStrength",
+    "octoPrintUpdate",
+    "cycleDisplay",
+    "reportMetrics",
+};
+
+void TaskProfiler::record(ProfiledTask task, uint32_t executionMicros, uint32_t latenessMicros)
+{
+    add(&profiles[task].execution, executionMicros);
+    add(&profiles[task].lateness, latenessMicros);
+}
+
+void TaskProfiler::add(LatencyHistogram* histogram, uint32_t micros)
+{
+    int bucket = 0;
+
+    // bucket n holds [2^n, 2^(n+1)) microseconds, bucket 0 also holds 0
+    while(bucket < TASK_PROFILE_BUCKETS - 1 && (micros >> (bucket + 1)) != 0)
+    {
+        bucket++;
+    }
+
+    if(histogram->count == 0 || micros < histogram->min)
+    {
+        histogram->min = micros;
+    }
+    if(micros > histogram->max)
+    {
+        histogram->max = micros;
+    }
+
+    histogram->count++;
+    histogram->total += micros;
+    histogram->buckets[bucket]++;
+}
+
+const char* TaskProfiler::getName(ProfiledTask task)
+{
+    return TASK_NAMES[task];
+}
+
+uint32_t TaskProfiler::getAverage(const LatencyHistogram* histogram)
+{
+    if(histogram->count == 0)
+    {
+        return 0;
+    }
+
+    return histogram->total / histogram->count;
+}
+
+// upper bound of the bucket holding the percentile, so within a factor of two
+// and never more than the largest value seen
+uint32_t TaskProfiler::getPercentile(const LatencyHistogram* histogram, int percent)
+{
+    unsigned long target = (histogram->count * percent + 99) / 100;
+    unsigned long seen = 0;
+
+    for(int i=0; i<TASK_PROFILE_BUCKETS; i++)
+    {
+        seen += histogram->buckets[i];
+        if(seen >= target && seen > 0)
+        {
+            uint32_t upper = (2UL << i) - 1;
+            return min(upper, histogram->max);
+        }
+    }
+
+    return histogram->max;
+}
+
+/**** Output ****/
+
+void TaskProfiler::histogramToJson(JsonObject json, const LatencyHistogram* histogram)
+{
+    json["count"] = histogram->count;
+    json["min"] = histogram->min;
+    json["avg"] = getAverage(histogram);
+    json["max"] = histogram->max;
+    json["p99"] = getPercentile(histogram, 99);
+}
+
+void TaskProfiler::toJson(JsonObject tasks)
+{
+    for(int i=0; i<ProfiledTask_Count; i++)
+    {
+        JsonObject task = tasks.createNestedObject(TASK_NAMES[i]);
+
+        histogramToJson(task.createNestedObject("executionMicros"), &profiles[i].execution);
+        histogramToJson(task.createNestedObject("latenessMicros"), &profiles[i].lateness);
+    }
+}
+
+// fills ProfiledTask_Count summaries, one for each task
+void TaskProfiler::summarise(TaskSummary* summaries)
+{
+    for(int i=0; i<ProfiledTask_Count; i++)
+    {
+        const LatencyHistogram* execution = &profiles[i].execution;
+        const LatencyHistogram* lateness = &profiles[i].lateness;
+
+        summaries[i].count = execution->count;
+        summaries[i].executionMin = execution->min;
+        summaries[i].executionAverage = getAverage(execution);
+        summaries[i].executionMax = execution->max;
+        summaries[i].executionP99 = getPercentile(execution, 99);
+        summaries[i].latenessAverage = getAverage(lateness);
+        summaries[i].latenessMax = lateness->max;
+        summaries[i].latenessP99 = getPercentile(lateness, 99);
+    }
+}
+
+// a row of the tasks page from the summaries, times shown in milliseconds.
+// Returns false past the last task
+bool TaskProfiler::writeRow(Print* output, const TaskSummary* summaries, int task)
+{
+    if(task >= ProfiledTask_Count)
+    {
+        return false;
+    }
+
+    const TaskSummary* summary = &summaries[task];
+
+    output->print(F("<tr><td>"));
+    output->print(TASK_NAMES[task]);
+    output->print(F("</td><td>"));
+    output->print(summary->count);
+    output->print(F("</td>"));
+
+    writeCell(output, summary->executionMin);
+    writeCell(output, summary->executionAverage);
+    writeCell(output, summary->executionMax);
+    writeCell(output, summary->executionP99);
+    writeCell(output, summary->latenessAverage);
+    writeCell(output, summary->latenessMax);
+    writeCell(output, summary->latenessP99);
+
+    output->print(F("</tr>"));
+    return true;
+}
+
+void TaskProfiler::writeCell(Print* output, uint32_t micros)
+{
+    output->print(F("<td>"));
+    output->print(micros / 1000.0f, 1);
+    output->print(F("</td>"));
+}
@@ -0,0 +1,200 @@
+#include <Arduino.h>
+#include "TextLayout.h"
+
+void TextLayout::init(TFT_eSPI* tft)
+{
+    this->tft = tft;
+    loadedFonts = 0;
+    nextCacheEntry = 0;
+    metricCount = 0;
+    nextMetric = 0;
+
+    for(int i=0; i<TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        cache[i].length = 0;
+        cache[i].font = 0;  // fonts start at 1, never matches
+    }
+}
+
+// advance of every printable glyph in the font, measured once
+const uint8_t* TextLayout::getAdvances(uint8_t font)
+{
+    uint8_t* fontAdvances = advances[font % TEXT_LAYOUT_FONTS];
+    char glyph[2] = {0, 0};
+
+    if(loadedFonts & (1 << (font % TEXT_LAYOUT_FONTS)))
+    {
+        return fontAdvances;
+    }
+
+    for(int i=0; i<TEXT_LAYOUT_GLYPHS; i++)
+    {
+        glyph[0] = TEXT_LAYOUT_FIRST_GLYPH + i;
+        fontAdvances[i] = tft->textWidth(glyph, font);
+    }
+    loadedFonts |= 1 << (font % TEXT_LAYOUT_FONTS);
+
+    return fontAdvances;
+}
+
+int TextLayout::textWidth(const char* text, uint8_t font)
+{
+    const uint8_t* fontAdvances = getAdvances(font);
+    int width = 0;
+
+    for(; *text != 0; text++)
+    {
+        uint8_t glyph = *text - TEXT_LAYOUT_FIRST_GLYPH;
+
+        if(glyph < TEXT_LAYOUT_GLYPHS)
+        {
+            width += fontAdvances[glyph];
+        }
+    }
+
+    return width;
+}
+
+int TextLayout::constantWidth(const char* text)
+{
+    return constantWidth(text, tft->textfont);
+}
+
+int TextLayout::constantWidth(const char* text, uint8_t font)
+{
+    TextMetric* metric;
+
+    for(int i=0; i<metricCount; i++)
+    {
+        if(metrics[i].text == text && metrics[i].font == font)
+        {
+            return metrics[i].width;
+        }
+    }
+
+    if(metricCount < TEXT_METRICS_CACHE_SIZE)
+    {
+        metric = &metrics[metricCount++];
+    }
+    else
+    {
+        metric = &metrics[nextMetric];
+        nextMetric = (nextMetric + 1) % TEXT_METRICS_CACHE_SIZE;
+    }
+
+    metric->text = text;
+    metric->font = font;
+    metric->width = textWidth(text, font);
+
+    return metric->width;
+}
+
+// measures a page's constant text up front, before its first frame
+void TextLayout::precompute(const char* const* texts, int count, uint8_t font)
+{
+    for(int i=0; i<count; i++)
+    {
+        constantWidth(texts[i], font);
+    }
+}
+
+// copies text into buffer, cut and ended with ... when it's wider than width in
+// the current font
+void TextLayout::truncate(char* buffer, size_t size, const char* text, int width)
+{
+    uint8_t font = tft->textfont;
+    size_t length = strlen(text);
+    uint32_t hash = hashText(text, length);
+    TextCut* cut = nullptr;
+
+    for(int i=0; i<TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        TextCut* entry = &cache[i];
+
+        if(entry->hash == hash && entry->length == length && entry->width == width && entry->font == font)
+        {
+            cut = entry;
+            break;
+        }
+    }
+
+    if(cut == nullptr)
+    {
+        cut = &cache[nextCacheEntry];
+        nextCacheEntry = (nextCacheEntry + 1) % TEXT_LAYOUT_CACHE_SIZE;
+
+        cut->hash = hash;
+        cut->length = length;
+        cut->width = width;
+        cut->font = font;
+        cut->kept = findCut(text, length, width, font);
+    }
+
+    if(cut->kept == length || size < sizeof(TEXT_LAYOUT_ELLIPSIS))
+    {
+        strlcpy(buffer, text, size);
+        return;
+    }
+
+    size_t kept = min((size_t)cut->kept, size - sizeof(TEXT_LAYOUT_ELLIPSIS));
+
+    memcpy(buffer, text, kept);
+    memcpy(buffer + kept, TEXT_LAYOUT_ELLIPSIS, sizeof(TEXT_LAYOUT_ELLIPSIS));
+}
+
+// one pass over the glyphs, the cut is the last point where the prefix still
+// leaves room for the ellipsis
+uint16_t TextLayout::findCut(const char* text, size_t length, int width, uint8_t font)
+{
+    const uint8_t* fontAdvances = getAdvances(font);
+    int available = width - textWidth(TEXT_LAYOUT_ELLIPSIS, font);
+    int prefixWidth = 0;
+    size_t cut = 0;
+    size_t i;
+
+    for(i=0; i<length; i++)
+    {
+        uint8_t glyph = text[i] - TEXT_LAYOUT_FIRST_GLYPH;
+
+        if(glyph < TEXT_LAYOUT_GLYPHS)
+        {
+            prefixWidth += fontAdvances[glyph];
+        }
+
+        if(prefixWidth <= available)
+        {
+            cut = i + 1;
+        }
+        else if(prefixWidth > width)
+        {
+            break;
+        }
+    }
+
+    if(i == length && prefixWidth <= width)
+    {
+        return length;
+    }
+
+    // don't split a UTF-8 sequence
+    while(cut > 0 && (text[cut] & 0xc0) == 0x80)
+    {
+        cut--;
+    }
+
+    return cut;
+}
+
+// FNV-1a
+uint32_t TextLayout::hashText(const char* text, size_t length)
+{
+    uint32_t hash = 2166136261u;
+
+    for(size_t i=0; i<length; i++)
+    {
+        hash ^= (uint8_t)text[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
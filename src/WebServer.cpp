@@ -1,8 +1,13 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include "JsonArena.h"
 #include <ESPAsyncWiFiManager.h>
 #include "WebServer.h"
+#include "HeapMetrics.h"
+#include "TaskProfiler.h"
+#include "Format.h"
 #include "Serverpages/AllPages.h"
+#include <memory>
 
 // globals
 AsyncWebServer server(80);
@@ -10,10 +15,10 @@ AsyncWebSocket webSocket("/ws");
 AsyncEventSource events("/events");
 
 String WebServer::currentWeatherJson = "";
-String WebServer::currentPrinterJson = "";
-bool WebServer::screenGrabRequest = false;
+String WebServer::currentPrinterJson[MAX_PRINTERS];
 
 SettingsManager* WebServer::settingsManager;    
+DisplayBase* WebServer::display;
 
 static const char NAV_BAR[] PROGMEM = 
     "<nav class='navbar navbar-expand-sm bg-dark navbar-dark fixed-top'>"
@@ -31,53 +36,51 @@ static const char NAV_BAR[] PROGMEM =
     "<li class='nav-item'>"
     "<a class='nav-link' href='screenGrab.html'>Screengrab</a>"
     "</li>"
+    "<li class='nav-item'>"
+    "<a class='nav-link' href='tasks.html'>Tasks</a>"
+    "</li>"
     "</ul>"
     "</nav>";
 
 // methods
 
-void WebServer::init(SettingsManager* settingsManager)
+void WebServer::init(SettingsManager* settingsManager, DisplayBase* display)
 {
     this->settingsManager = settingsManager;
+    this->display = display;
     
     webSocket.onEvent(onEvent);
     server.addHandler(&webSocket);
     server.addHandler(&events);
 
-// SPIFFS for reference
-//request->send(SPIFFS, "/printMonitorSettings.html", String(), false, tokenProcessor);
-
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/html", index_html, tokenProcessor);
+        sendTemplate(request, &index_html_template);
     });
 
     server.on("/index.html", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/html", index_html, tokenProcessor);
+        sendTemplate(request, &index_html_template);
     });
 
     server.on("/screenGrab.html", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/html", screenGrab_html, tokenProcessor);
+        sendTemplate(request, &screenGrab_html_template);
     });
 
     server.on("/settings.html", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/html", settings_html, tokenProcessor);
-        //request->send(SPIFFS, "/settings.html", String(), false, tokenProcessor);
+        sendTemplate(request, &settings_html_template);
     });
 
     server.on("/weatherSettings.html", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/html", weatherSettings_html, tokenProcessor); 
-        //request->send(SPIFFS, "/weatherSettings.html", String(), false, tokenProcessor);
+        sendTemplate(request, &weatherSettings_html_template);
     });
 
     server.on("/printMonitorSettings.html", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/html", printMonitorSettings_html, tokenProcessor);
-        //request->send(SPIFFS, "/printMonitorSettings.html", String(), false, tokenProcessor);
+        sendTemplate(request, &printMonitorSettings_html_template);
     });
 
     server.on("/updateWeatherSettings.html", HTTP_GET, [](AsyncWebServerRequest *request)
@@ -140,41 +143,54 @@ void WebServer::init(SettingsManager* settingsManager)
         handleForgetWiFi(request);
     });
 
-    server.on("/takeScreenGrab.html", HTTP_GET, [](AsyncWebServerRequest *request)
+    server.on("/tasks.html", HTTP_GET, [](AsyncWebServerRequest *request)
+    {
+        sendTemplate(request, &taskProfile_html_template);
+    });
+
+    server.on("/api/tasks", HTTP_GET, [](AsyncWebServerRequest *request)
+    {
+        handleTasks(request);
+    });
+
+    server.on("/api/metrics", HTTP_GET, [](AsyncWebServerRequest *request)
+    {
+        handleMetrics(request);
+    });
+
+    server.on("/screenshot.bmp", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        handleScreenGrab(request);
-        request->redirect("/screenGrab.html");
+        handleScreenshot(request);
     });
 
     server.on("/js/jquery.confirmModal.min.js", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "application/javascript", confirmModal_js);
+        sendStaticAsset(request, "application/javascript", confirmModal_js_gz, sizeof(confirmModal_js_gz), confirmModal_js_etag);
     });
 
     server.on("/js/printMonitorSettings.js", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "application/javascript", printMonitorSettings_js);
+        sendStaticAsset(request, "application/javascript", printMonitorSettings_js_gz, sizeof(printMonitorSettings_js_gz), printMonitorSettings_js_etag);
     });
 
     server.on("/js/weatherSettings.js", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "application/javascript", weatherSettings_js);
+        sendStaticAsset(request, "application/javascript", weatherSettings_js_gz, sizeof(weatherSettings_js_gz), weatherSettings_js_etag);
     });
 
     server.on("/js/settings.js", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "application/javascript", settings_js);
+        sendStaticAsset(request, "application/javascript", settings_js_gz, sizeof(settings_js_gz), settings_js_etag);
     });
     
     server.on("/js/station.js", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        //request->send(SPIFFS, "/js/station.js", String(), false, tokenProcessor);
-        request->send_P(200, "application/javascript", station_js);
+        sendStaticAsset(request, "application/javascript", station_js_gz, sizeof(station_js_gz), station_js_etag);
     });
 
     server.on("/css/station.css", HTTP_GET, [](AsyncWebServerRequest *request)
     {
-        request->send_P(200, "text/css", station_css);
+        sendStaticAsset(request, "text/css", station_css_gz, sizeof(station_css_gz), station_css_etag);
     });
 
     //server.serveStatic("/js", SPIFFS, "/js/");
@@ -189,16 +205,16 @@ AsyncWebServer* WebServer::getServer()
 
 void WebServer::updateCurrentWeather(OpenWeatherMapCurrentData* currentWeather)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
     if(!currentWeather->validData)
     {
         currentWeatherJson = "";
         return;
     }
 
-    String output;
-
     const size_t capacity = 1024;   // TODO
-    DynamicJsonDocument jsonDoc(capacity);
+    ArenaJsonDocument jsonDoc(capacity);
 
     jsonDoc["type"] = "currentWeather";
 
@@ -211,44 +227,85 @@ void WebServer::updateCurrentWeather(OpenWeatherMapCurrentData* currentWeather)
     weather["time"] = currentWeather->observationTime;
     weather["metric"] = settingsManager->getDisplayMetric();
 
-    serializeJson(jsonDoc, output);
-    currentWeatherJson = output;
+    // serialised straight into the cached copy, which keeps its buffer between updates
+    currentWeatherJson = "";
+    serializeJson(jsonDoc, currentWeatherJson);
 
     if(webSocket.count() > 0)
     {
-        webSocket.textAll(output);
+        HeapUntracked untracked;
+        webSocket.textAll(currentWeatherJson);
     }
 }
     
-void WebServer::updatePrintMonitorInfo(OctoPrintMonitorData* printerInfo, String printerName, bool enabled)
+void WebServer::updatePrintMonitorInfo(int printerId, OctoPrintMonitorData* printerInfo, const String& printerName, bool enabled)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
     const size_t capacity = 512;  
-    DynamicJsonDocument jsonDoc(capacity);
-    String output;
+    ArenaJsonDocument jsonDoc(capacity);
 
     jsonDoc["type"] = "monitorInfo";
 
+    jsonDoc["printerId"] = printerId;
     jsonDoc["enabled"] = enabled;
     jsonDoc["validJobData"] = printerInfo->validJobData;
     jsonDoc["validPrintData"] = printerInfo->validPrintData;
     jsonDoc["printState"] = printerInfo->printState;
     jsonDoc["printerName"] = printerName;
 
-    serializeJson(jsonDoc, output);
-    currentPrinterJson = output;
+    currentPrinterJson[printerId] = "";
+    serializeJson(jsonDoc, currentPrinterJson[printerId]);
 
     if(webSocket.count() > 0)
     {
-        webSocket.textAll(output);
+        HeapUntracked untracked;
+        webSocket.textAll(currentPrinterJson[printerId]);
     }
 }   
 
+void WebServer::updateMetrics()
+{
+    if(webSocket.count() == 0)
+    {
+        return;
+    }
+
+    HeapProbe probe(HeapSubsystem_WebServer);
+    static char metricsJson[METRICS_TEXT_SIZE];
+    FormatBuffer output(metricsJson, sizeof(metricsJson));
+
+    {
+        ArenaJsonDocument jsonDoc(METRICS_JSON_SIZE);
+
+        jsonDoc["type"] = "metrics";
+        HeapMetrics::toJson(jsonDoc.createNestedObject("metrics"));
+
+        if(measureJson(jsonDoc) >= sizeof(metricsJson))
+        {
+            Serial.println("Metrics too big for the websocket buffer.");
+            return;
+        }
+        serializeJson(jsonDoc, output);
+    }
+
+    HeapUntracked untracked;
+    webSocket.textAll(metricsJson, output.length());
+}
+
 void WebServer::updateClientOnConnect()
 {
     if(currentWeatherJson.length() != 0)
     {
         webSocket.textAll(currentWeatherJson);
-        webSocket.textAll(currentPrinterJson);
+    }
+
+    for(int i=0; i<settingsManager->getNumPrinters(); i++)
+    {
+        if(currentPrinterJson[i].length() != 0)
+        {
+            webSocket.textAll(currentPrinterJson[i]);
+        }
     }
 }
 
@@ -260,196 +317,299 @@ void WebServer::onEvent(AsyncWebSocket * server, AsyncWebSocketClient * client,
     }
 }
 
-String WebServer::tokenProcessor(const String& token)
+// where a page being sent has got to, kept for the whole response so each chunk
+// carries on from the last one. A token is rendered a row at a time into the
+// row buffer when the page reaches it, so each row is rendered once and a value
+// that changes while the page is sent can't shift the rest of the page
+struct TemplateState : public Print
 {
-    if(token == "NAVBAR")
-    {
-        return FPSTR(NAV_BAR);
-    }
-    if(token == "WEATHERLOCATIONKEY")    
-    {
-        return settingsManager->getOpenWeatherlocationID();
-    }
-    if(token == "WEATHERAPIKEY")    
+    TemplateState(const PageTemplate* page) : page(page), span(0), row(-1), offset(0), rowLength(0) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t length) override
     {
-        return settingsManager->getOpenWeatherApiKey();
+        // a row longer than the buffer is cut, it can't run over it
+        size_t count = min(length, TEMPLATE_ROW_SIZE - rowLength);
+
+        memcpy(&rowBuffer[rowLength], data, count);
+        rowLength += count;
+        return length;
     }
-    if(token == "DISPLAYMETRIC")
+    using Print::write;
+
+    const PageTemplate* page;
+    int span;
+    int row;                    // -1 while sending the span's literal
+    size_t offset;              // into the literal or row being sent
+    char rowBuffer[TEMPLATE_ROW_SIZE];
+    size_t rowLength;
+    std::unique_ptr<TaskSummary[]> tasks;   // only for pages with the task table
+};
+
+static bool hasToken(const PageTemplate* page, TemplateToken token)
+{
+    TemplateSpan span;
+
+    for(int i=0; i<page->spanCount; i++)
     {
-        if(settingsManager->getDisplayMetric())
+        memcpy_P(&span, &page->spans[i], sizeof(TemplateSpan));
+        if(span.token == token)
         {
-            return "Checked";
+            return true;
         }
     }
-    if(token == "CURRENTWEATHERINTERVAL")    
-    {
-        return String(settingsManager->getCurrentWeatherInterval() / SECONDS_MULT);
-    }
-    if(token == "PRINTMONITORINTERVAL")    
-    {
-        return String(settingsManager->getPrintMonitorInterval() / SECONDS_MULT);
-    }
-    if(token == "DISPLAYCYCLEINTERVAL")    
-    {
-        return String(settingsManager->getDisplayCycleInterval() / SECONDS_MULT);
-    }
-    if(token == "UTCOFFSET")
-    {
-        return String(settingsManager->getUtcOffset() / 3600.0f);
-    }
-    if(token == "BRIGHTNESS")
-    {
-        return String(settingsManager->getDisplayBrightness());
-    }
-    if(token == "PRINTERTABLE")
-    {
-       return createPrinterList();
-    }
-    if(token == "DISPLAYTABLE")
-    {
-       return createDisplayList();
-    }
-    if(token == "ADDPRINTERENABLED")
+    return false;
+}
+
+// streams a precompiled page a chunk at a time as the socket takes it, so only
+// one chunk and one table row of the page are ever in memory
+void WebServer::sendTemplate(AsyncWebServerRequest* request, const PageTemplate* page)
+{
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    std::shared_ptr<TemplateState> state = std::make_shared<TemplateState>(page);
+
+    // task times change while the page is sent, take them once for the whole page
+    if(hasToken(page, TemplateToken_TASKTABLE))
     {
-       if(settingsManager->getNumPrinters() >= MAX_PRINTERS)
-       {
-           return "disabled";
-       }
+        state->tasks.reset(new TaskSummary[ProfiledTask_Count]);
+        TaskProfiler::summarise(state->tasks.get());
     }
-    if(token == "WEATHERENABLED")
-    {
-        if(settingsManager->getWeatherEnabled() == true)
+
+    AsyncWebServerResponse* response = request->beginChunkedResponse("text/html",
+        [state](uint8_t* buffer, size_t maxLen, size_t index) -> size_t
         {
-            return "Checked";
-        }
-    }    
-    if(token == "DISPLAYCYCLEMODE")
+            return fillTemplate(state.get(), buffer, maxLen);
+        });
+
+    request->send(response);
+}
+
+// copies the page on from where the last chunk stopped. Literals and the nav
+// bar are copied straight from flash, other tokens from the row buffer
+size_t WebServer::fillTemplate(TemplateState* state, uint8_t* buffer, size_t maxLen)
+{
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    TemplateSpan span;
+    size_t length = 0;
+
+    while(length < maxLen && state->span < state->page->spanCount)
     {
-        if(settingsManager->getCurrentDisplay() == CYCLE_DISPLAY_SETTING)
+        memcpy_P(&span, &state->page->spans[state->span], sizeof(TemplateSpan));
+
+        size_t count;
+
+        if(state->row < 0)
         {
-            return "Checked";
+            count = min(maxLen - length, span.length - state->offset);
+            memcpy_P(&buffer[length], &span.literal[state->offset], count);
         }
-    }    
-    if(token == "TIME1CHECKED")
-    {
-        if(settingsManager->getClockFormat() == ClockFormat_24h)
+        else if(span.token == TemplateToken_NAVBAR)
         {
-            return "Checked";
+            count = min(maxLen - length, sizeof(NAV_BAR) - 1 - state->offset);
+            memcpy_P(&buffer[length], &NAV_BAR[state->offset], count);
         }
-    }
-    if(token == "TIME2CHECKED")
-    {
-        if(settingsManager->getClockFormat() == ClockFormat_AmPm)
+        else
         {
-            return "Checked";
+            count = min(maxLen - length, state->rowLength - state->offset);
+            memcpy(&buffer[length], &state->rowBuffer[state->offset], count);
         }
-    }
-    if(token == "DATE1CHECKED")
-    {
-        if(settingsManager->getDateFormat() == DateFormat_DDMMYY)
+
+        length += count;
+        state->offset += count;
+
+        if(length < maxLen)
         {
-            return "Checked";
+            nextTemplateRow(state, span.token);
         }
     }
-    if(token == "DATE2CHECKED")
+
+    return length;
+}
+
+// moves on to the token's next row, or to the next span once the token has no more
+void WebServer::nextTemplateRow(TemplateState* state, TemplateToken token)
+{
+    state->row++;
+    state->offset = 0;
+    state->rowLength = 0;
+
+    bool hasRow = token == TemplateToken_NAVBAR ? state->row == 0 : writeToken(state, token, state->row);
+
+    if(!hasRow)
     {
-        if(settingsManager->getDateFormat() == DateFormat_MMDDYY)
-        {
-            return "Checked";
-        }
+        state->span++;
+        state->row = -1;
     }
+}
 
-    return String();
+// writes one row of a token into the page's row buffer, tables have a row per
+// line and the other tokens just the one. Returns false when the token has no
+// row that far down
+bool WebServer::writeToken(TemplateState* output, TemplateToken token, int row)
+{
+    switch(token)
+    {
+        case TemplateToken_PRINTERTABLE:
+            return writePrinterRow(output, row);
+        case TemplateToken_DISPLAYTABLE:
+            return writeDisplayRow(output, row);
+        case TemplateToken_TASKTABLE:
+            return TaskProfiler::writeRow(output, output->tasks.get(), row);
+        default:
+            break;
+    }
+
+    if(row > 0)
+    {
+        return false;
+    }
+
+    switch(token)
+    {
+        case TemplateToken_WEATHERLOCATIONKEY:
+            output->print(settingsManager->getOpenWeatherlocationID());
+            break;
+        case TemplateToken_WEATHERAPIKEY:
+            output->print(settingsManager->getOpenWeatherApiKey());
+            break;
+        case TemplateToken_DISPLAYMETRIC:
+            writeChecked(output, settingsManager->getDisplayMetric());
+            break;
+        case TemplateToken_CURRENTWEATHERINTERVAL:
+            output->print(settingsManager->getCurrentWeatherInterval() / SECONDS_MULT);
+            break;
+        case TemplateToken_PRINTMONITORINTERVAL:
+            output->print(settingsManager->getPrintMonitorInterval() / SECONDS_MULT);
+            break;
+        case TemplateToken_DISPLAYCYCLEINTERVAL:
+            output->print(settingsManager->getDisplayCycleInterval() / SECONDS_MULT);
+            break;
+        case TemplateToken_UTCOFFSET:
+            output->print(settingsManager->getUtcOffset() / 3600.0f);
+            break;
+        case TemplateToken_BRIGHTNESS:
+            output->print(settingsManager->getDisplayBrightness());
+            break;
+        case TemplateToken_ADDPRINTERENABLED:
+            if(settingsManager->getNumPrinters() >= MAX_PRINTERS)
+            {
+                output->print(F("disabled"));
+            }
+            break;
+        case TemplateToken_WEATHERENABLED:
+            writeChecked(output, settingsManager->getWeatherEnabled());
+            break;
+        case TemplateToken_DISPLAYCYCLEMODE:
+            writeChecked(output, settingsManager->getCurrentDisplay() == CYCLE_DISPLAY_SETTING);
+            break;
+        case TemplateToken_TIME1CHECKED:
+            writeChecked(output, settingsManager->getClockFormat() == ClockFormat_24h);
+            break;
+        case TemplateToken_TIME2CHECKED:
+            writeChecked(output, settingsManager->getClockFormat() == ClockFormat_AmPm);
+            break;
+        case TemplateToken_DATE1CHECKED:
+            writeChecked(output, settingsManager->getDateFormat() == DateFormat_DDMMYY);
+            break;
+        case TemplateToken_DATE2CHECKED:
+            writeChecked(output, settingsManager->getDateFormat() == DateFormat_MMDDYY);
+            break;
+        default:
+            return false;
+    }
+
+    return true;
 }
 
-String WebServer::createPrinterList()
+void WebServer::writeChecked(Print* output, bool checked)
 {
-    int numPrinters = settingsManager->getNumPrinters();
-    String response;
+    if(checked)
+    {
+        output->print(F("Checked"));
+    }
+}
 
-    // lots of string use here, bad?
-    for(int i=0; i<numPrinters; i++)
+bool WebServer::writePrinterRow(Print* output, int row)
+{
+    if(row >= settingsManager->getNumPrinters())
     {
-        String printerRow;
-        char buffer[256];
-        OctoPrinterData* data = settingsManager->getPrinterData(i);
-        const char deleteButton[] = "<button type='button' class='btn btn-danger mr-2 confirmDeletePrinter'>Delete</button>";
-        const char editButton[] = "<button type='button' class='btn btn-primary mr-2' data-toggle='modal' data-backdrop='static' data-target='#editPrinterModal'>Edit</button>";
-        const char enabledBox[] = "<td><input type='checkbox' disabled checked></td>";
-        const char disabledBox[] = "<td><input type='checkbox' disabled></td>";
-        const char *checkbox;
+        return false;
+    }
 
-        if(data->enabled)
-        {
-            checkbox = enabledBox;
-        }
-        else
-        {
-            checkbox = disabledBox;
-        }
-        
-        sprintf(buffer, "<tr><td class='printer-id'>%d</td><td class='display-name'>%s</td><td>%s</td><td>%d</td>%s<td>%s%s</td></tr>", 
-            i+1, data->displayName.c_str(), data->address.c_str(), data->port, checkbox, editButton, deleteButton);
-        printerRow = String(buffer);
+    OctoPrinterData* data = settingsManager->getPrinterData(row);
+
+    output->print(F("<tr><td class='printer-id'>"));
+    output->print(row + 1);
+    output->print(F("</td><td class='display-name'>"));
+    output->print(data->displayName);
+    output->print(F("</td><td>"));
+    output->print(data->address);
+    output->print(F("</td><td>"));
+    output->print(data->port);
+    output->print(F("</td>"));
 
-        response += printerRow;
+    if(data->enabled)
+    {
+        output->print(F("<td><input type='checkbox' disabled checked></td>"));
+    }
+    else
+    {
+        output->print(F("<td><input type='checkbox' disabled></td>"));
     }
 
-    return response;
+    output->print(F("<td><button type='button' class='btn btn-primary mr-2' data-toggle='modal' data-backdrop='static' data-target='#editPrinterModal'>Edit</button>"
+        "<button type='button' class='btn btn-danger mr-2 confirmDeletePrinter'>Delete</button></td></tr>"));
+
+    return true;
 }
 
-String WebServer::createDisplayList()
+// the weather display first, then a row per printer
+bool WebServer::writeDisplayRow(Print* output, int row)
 {
-    int numPrinters = settingsManager->getNumPrinters();
-    String response;
-    String button;
     int currentDisplay = settingsManager->getCurrentDisplay();
-    String checked = "";
 
-    if(currentDisplay == WEATHER_DISPLAY_SETTING)
+    if(row == 0)
     {
-        checked = "checked";
+        writeDisplayButton(output, WEATHER_DISPLAY_SETTING, currentDisplay == WEATHER_DISPLAY_SETTING, "Current Weather");
+        return true;
     }
-    response += createDisplayButton(WEATHER_DISPLAY_SETTING, checked, "Current Weather");
-    
-    for(int i=0; i<numPrinters; i++)
+
+    if(row > settingsManager->getNumPrinters())
     {
-        OctoPrinterData* data = settingsManager->getPrinterData(i);
-        String id = "Printer" + i;
-        if(currentDisplay == i + 1)
-        {
-            checked = "checked";
-        }
-        else
-        {
-            checked = "";
-        }
-        
-        response += createDisplayButton(i + 1, checked, data->displayName);
+        return false;
     }
 
-    return response;
+    OctoPrinterData* data = settingsManager->getPrinterData(row - 1);
+
+    writeDisplayButton(output, row, currentDisplay == row, data->displayName.c_str());
+    return true;
 }
 
-String WebServer::createDisplayButton(int id, String checked, String title)
+void WebServer::writeDisplayButton(Print* output, int id, bool checked, const char* title)
 {
-    String button;
-    char buffer[256];
-    const char buttonHeader[] = "<div class='form-group'><div class='form-check'><label class='form-check-label'>";
-    const char buttonInfo[] = "<input type='radio' class='form-check-input' value='%d' name='optdisplay' %s>%s";
-    const char buttonFooter[] = "</label></div></div>";
-    
-    sprintf(buffer, buttonInfo, id, checked.c_str(), title.c_str());
-    
-    button += buttonHeader;
-    button += buffer;
-    button += buttonFooter;
+    output->print(F("<div class='form-group'><div class='form-check'><label class='form-check-label'>"
+        "<input type='radio' class='form-check-input' value='"));
+    output->print(id);
+    output->print(F("' name='optdisplay' "));
+
+    if(checked)
+    {
+        output->print(F("checked"));
+    }
 
-    return button;
+    output->print(F(">"));
+    output->print(title);
+    output->print(F("</label></div></div>"));
 }
 
 void WebServer::handleUpdateWeatherSettings(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    settingsManager->beginUpdate();
+
     if(request->hasParam("openWeatherLocation"))
     {
         AsyncWebParameter* p = request->getParam("openWeatherLocation");
@@ -475,11 +635,17 @@ void WebServer::handleUpdateWeatherSettings(AsyncWebServerRequest* request)
     else
     {
         settingsManager->setDisplayMetric(false);
-    }   
+    }
+
+    settingsManager->commitUpdate();
 }
 
 void WebServer::handleUpdateDisplaySettings(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    settingsManager->beginUpdate();
+
     if(request->hasParam("displayCycleMode"))
     {
         settingsManager->setCurrentDisplay(CYCLE_DISPLAY_SETTING);
@@ -495,10 +661,16 @@ void WebServer::handleUpdateDisplaySettings(AsyncWebServerRequest* request)
         AsyncWebParameter* p = request->getParam("brightness");
         settingsManager->setDisplayBrightness(p->value().toInt());
     }
+
+    settingsManager->commitUpdate();
 }
 
 void WebServer::handleUpdateTimings(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    settingsManager->beginUpdate();
+
     if(request->hasParam("currentWeatherInterval"))
     {
         AsyncWebParameter* p = request->getParam("currentWeatherInterval");
@@ -513,11 +685,17 @@ void WebServer::handleUpdateTimings(AsyncWebServerRequest* request)
     {
         AsyncWebParameter* p = request->getParam("displayCycleInterval");
         settingsManager->setDisplayCycleInterval(p->value().toInt() * SECONDS_MULT);
-    }    
+    }
+
+    settingsManager->commitUpdate();
 }
 
 void WebServer::handleUpdateClockSettings(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    settingsManager->beginUpdate();
+
     if(request->hasParam("utcOffset"))
     {
         AsyncWebParameter* p = request->getParam("utcOffset");
@@ -549,10 +727,14 @@ void WebServer::handleUpdateClockSettings(AsyncWebServerRequest* request)
             settingsManager->setDateFormat(DateFormat_MMDDYY);
         }
     }
+
+    settingsManager->commitUpdate();
 }
 
 void WebServer::handleAddNewPrinter(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
     bool enabled = false;
 
     if(request->hasParam("printerEnabled"))
@@ -573,6 +755,8 @@ void WebServer::handleAddNewPrinter(AsyncWebServerRequest* request)
 
 void WebServer::handleDeletePrinter(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
     int printerId;
 
     printerId = request->getParam("printerId")->value().toInt(); 
@@ -583,6 +767,8 @@ void WebServer::handleDeletePrinter(AsyncWebServerRequest* request)
 
 void WebServer::handleEditPrinter(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
     int printerId;
     bool enabled = false;
 
@@ -608,6 +794,8 @@ void WebServer::handleEditPrinter(AsyncWebServerRequest* request)
 
 void WebServer::handleGetPrinter(AsyncWebServerRequest* request)
 {
+    HeapProbe probe(HeapSubsystem_WebServer);
+
     AsyncWebParameter* p = request->getParam("printerId");
     int printerID;
 
@@ -617,7 +805,7 @@ void WebServer::handleGetPrinter(AsyncWebServerRequest* request)
     OctoPrinterData* printer = settingsManager->getPrinterData(printerID);
 
     const size_t capacity = 512;  
-    DynamicJsonDocument doc(capacity);
+    ArenaJsonDocument doc(capacity);
     String reponse;
 
     doc["address"] = printer->address;
@@ -633,6 +821,30 @@ void WebServer::handleGetPrinter(AsyncWebServerRequest* request)
     request->send(200, "application/json", reponse);
 }
 
+void WebServer::handleMetrics(AsyncWebServerRequest* request)
+{
+    HeapProbe probe(HeapSubsystem_WebServer);
+    AsyncResponseStream* response = request->beginResponseStream("application/json");
+    ArenaJsonDocument jsonDoc(METRICS_JSON_SIZE);
+
+    HeapMetrics::toJson(jsonDoc.to<JsonObject>());
+    serializeJson(jsonDoc, *response);
+
+    request->send(response);
+}
+
+void WebServer::handleTasks(AsyncWebServerRequest* request)
+{
+    HeapProbe probe(HeapSubsystem_WebServer);
+    AsyncResponseStream* response = request->beginResponseStream("application/json");
+    ArenaJsonDocument jsonDoc(TASKS_JSON_SIZE);
+
+    TaskProfiler::toJson(jsonDoc.to<JsonObject>());
+    serializeJson(jsonDoc, *response);
+
+    request->send(response);
+}
+
 void WebServer::handleForgetWiFi(AsyncWebServerRequest* request)
 {
     DNSServer dns;
@@ -646,17 +858,139 @@ void WebServer::handleResetSettings(AsyncWebServerRequest* request)
     settingsManager->resetSettings();
 }
 
-void WebServer::handleScreenGrab(AsyncWebServerRequest* request)
+// static assets are stored gzipped, a browser revalidating with the etag of the
+// current build gets a 304 with no body
+void WebServer::sendStaticAsset(AsyncWebServerRequest* request, const char* contentType, const uint8_t* data, size_t length, const char* etag)
 {
-    screenGrabRequest = true;
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    if(request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value().indexOf(etag) >= 0)
+    {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", STATIC_ASSET_CACHE_CONTROL);
+        request->send(response);
+        return;
+    }
+
+    AsyncWebServerResponse* response = request->beginResponse_P(200, contentType, data, length);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", STATIC_ASSET_CACHE_CONTROL);
+    request->send(response);
 }
 
-bool WebServer::screenGrabRequested()
+// streams the panel as a 16 bit BMP, rows are read from the display as the
+// response goes out so there's never more than one row in memory
+// the screen row being sent, kept for each download so two at once each read
+// their own rows
+struct ScreenshotState
+{
+    ScreenshotState(int width, int height) : width(width), height(height), row(-1) {}
+
+    int width;
+    int height;
+    int row;
+    uint16_t pixels[SCREENSHOT_MAX_WIDTH];
+};
+
+void WebServer::handleScreenshot(AsyncWebServerRequest* request)
 {
-    return screenGrabRequest;
+    HeapProbe probe(HeapSubsystem_WebServer);
+
+    int width = display->getScreenWidth();
+    int height = display->getScreenHeight();
+
+    if(width == 0 || width > SCREENSHOT_MAX_WIDTH)
+    {
+        request->send(404);
+        return;
+    }
+
+    std::shared_ptr<ScreenshotState> state = std::make_shared<ScreenshotState>(width, height);
+
+    AsyncWebServerResponse* response = request->beginResponse("image/bmp", BMP_HEADER_SIZE + (width * height * 2),
+        [state](uint8_t* buffer, size_t maxLen, size_t index) -> size_t
+        {
+            return fillScreenshot(state.get(), buffer, maxLen, index);
+        });
+
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+size_t WebServer::fillScreenshot(ScreenshotState* state, uint8_t* buffer, size_t maxLen, size_t index)
+{
+    size_t rowBytes = state->width * 2;
+    size_t imageEnd = BMP_HEADER_SIZE + (rowBytes * state->height);
+    size_t written = 0;
+
+    if(index < BMP_HEADER_SIZE)
+    {
+        uint8_t header[BMP_HEADER_SIZE];
+
+        createBmpHeader(header, state->width, state->height);
+        written = min(maxLen, BMP_HEADER_SIZE - index);
+        memcpy(buffer, &header[index], written);
+        index += written;
+    }
+
+    while(written < maxLen && index < imageEnd)
+    {
+        size_t offset = index - BMP_HEADER_SIZE;
+        int row = offset / rowBytes;
+        size_t rowOffset = offset % rowBytes;
+        size_t count = min(maxLen - written, rowBytes - rowOffset);
+
+        if(row != state->row)
+        {
+            display->readScreenRow(row, state->pixels);
+            state->row = row;
+        }
+
+        // ESP8266 is little endian, the same as BMP
+        memcpy(&buffer[written], ((uint8_t*)state->pixels) + rowOffset, count);
+        written += count;
+        index += count;
+    }
+
+    return written;
+}
+
+static void writeLittleEndian(uint8_t* buffer, uint32_t value, int bytes)
+{
+    for(int i=0; i<bytes; i++)
+    {
+        buffer[i] = (value >> (i * 8)) & 0xff;
+    }
 }
 
-void WebServer::clearScreenGrabRequest()
+// top down (negative height) RGB565 bitmap using BI_BITFIELDS
+void WebServer::createBmpHeader(uint8_t* header, int width, int height)
 {
-    screenGrabRequest = false;
+    size_t imageSize = width * height * 2;
+
+    memset(header, 0, BMP_HEADER_SIZE);
+
+    // file header
+    header[0] = 'B';
+    header[1] = 'M';
+    writeLittleEndian(&header[2], BMP_HEADER_SIZE + imageSize, 4);
+    writeLittleEndian(&header[10], BMP_HEADER_SIZE, 4);
+
+    // info header
+    writeLittleEndian(&header[14], 40, 4);
+    writeLittleEndian(&header[18], width, 4);
+    writeLittleEndian(&header[22], -height, 4);
+    writeLittleEndian(&header[26], 1, 2);
+    writeLittleEndian(&header[28], 16, 2);
+    writeLittleEndian(&header[30], 3, 4);
+    writeLittleEndian(&header[34], imageSize, 4);
+    writeLittleEndian(&header[38], 2835, 4);
+    writeLittleEndian(&header[42], 2835, 4);
+
+    // colour masks
+    writeLittleEndian(&header[54], 0xF800, 4);
+    writeLittleEndian(&header[58], 0x07E0, 4);
+    writeLittleEndian(&header[62], 0x001F, 4);
 }
@@ -0,0 +1,70 @@
+#include <Arduino.h>
+
+// same sequence on every run, tests that compare output depend on it
+static uint32_t randomState = 1;
+
+static uint32_t nextRandom()
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 1) & 0x7fffffff;
+}
+
+long random(long howBig)
+{
+    return howBig > 0 ? nextRandom() % howBig : 0;
+}
+
+long random(long howSmall, long howBig)
+{
+    return howSmall < howBig ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed)
+{
+    randomState = seed != 0 ? seed : 1;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+}
+
+int digitalRead(uint8_t pin)
+{
+    return LOW;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+}
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+
+extern "C" size_t strlcpy(char* destination, const char* source, size_t size)
+{
+    size_t length = strlen(source);
+
+    if(size > 0)
+    {
+        size_t count = min(length, size - 1);
+        memcpy(destination, source, count);
+        destination[count] = 0;
+    }
+    return length;
+}
+
+extern "C" size_t strlcat(char* destination, const char* source, size_t size)
+{
+    size_t length = strnlen(destination, size);
+
+    if(length == size)
+    {
+        return size + strlen(source);
+    }
+    return length + strlcpy(destination + length, source, size - length);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include <Arduino.h>
+#include "FakeHeap.h"
+
+EspClass ESP;
+
+uint32_t EspClass::getFreeHeap()
+{
+    long used = FakeHeap::getUsed();
+
+    return used >= FAKE_HEAP_FREE ? 0 : FAKE_HEAP_FREE - max(used, 0L);
+}
+
+// the host heap doesn't fragment the way umm_malloc does, it's one block
+uint32_t EspClass::getMaxFreeBlockSize()
+{
+    return getFreeHeap();
+}
+
+uint8_t EspClass::getHeapFragmentation()
+{
+    return 0;
+}
+
+// 80MHz
+uint32_t EspClass::getCycleCount()
+{
+    return micros() * 80;
+}
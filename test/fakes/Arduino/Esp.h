@@ -0,0 +1,22 @@
+#ifndef _fake_esp_h
+#define _fake_esp_h
+
+#include <stdint.h>
+
+// heap figures come from FakeHeap, everything the process allocates counts
+class EspClass
+{
+    public:
+        uint32_t getFreeHeap();
+        uint32_t getMaxFreeBlockSize();
+        uint8_t getHeapFragmentation();
+        uint32_t getChipId() { return 0x00c0ffee; }
+        uint32_t getCycleCount();
+        void restart() { restarts++; }
+
+        unsigned long restarts = 0;
+};
+
+extern EspClass ESP;
+
+#endif // _fake_esp_h
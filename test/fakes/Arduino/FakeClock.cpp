@@ -0,0 +1,28 @@
+#include <Arduino.h>
+#include "FakeClock.h"
+
+unsigned long long FakeClock::now = 0;
+
+unsigned long millis()
+{
+    return FakeClock::getMillis();
+}
+
+unsigned long micros()
+{
+    return FakeClock::getMicros();
+}
+
+void delay(unsigned long ms)
+{
+    FakeClock::advance(ms);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    FakeClock::advanceMicros(us);
+}
+
+void yield()
+{
+}
@@ -0,0 +1,18 @@
+#ifndef _fake_clock_h
+#define _fake_clock_h
+
+// millis() and micros() only move when a test moves them, or through delay()
+class FakeClock
+{
+    public:
+        static unsigned long getMillis() { return now / 1000; }
+        static unsigned long getMicros() { return now; }
+        static void set(unsigned long ms) { now = ms * 1000ULL; }
+        static void advance(unsigned long ms) { now += ms * 1000ULL; }
+        static void advanceMicros(unsigned long us) { now += us; }
+
+    private:
+        static unsigned long long now;  // microseconds since boot
+};
+
+#endif // _fake_clock_h
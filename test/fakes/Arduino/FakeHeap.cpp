@@ -0,0 +1,107 @@
+#include <stdint.h>
+#include <errno.h>
+#include <malloc.h>
+#include "FakeHeap.h"
+
+// glibc's own allocator stays underneath, these only keep count. Kept apart from
+// operator new in FakeNew.cpp so the static environment's --wrap sees its calls.
+
+size_t FakeHeap::inUse = 0;
+size_t FakeHeap::peak = 0;
+size_t FakeHeap::baseline = 0;
+unsigned long FakeHeap::allocations = 0;
+unsigned long FakeHeap::baseAllocations = 0;
+
+void FakeHeap::allocated(size_t size)
+{
+    inUse += size;
+    allocations++;
+
+    if(inUse > peak)
+    {
+        peak = inUse;
+    }
+}
+
+extern "C"
+{
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* pointer, size_t size);
+    void* __libc_memalign(size_t alignment, size_t size);
+    void __libc_free(void* pointer);
+
+    static void* counted(void* pointer)
+    {
+        if(pointer != nullptr)
+        {
+            FakeHeap::allocated(malloc_usable_size(pointer));
+        }
+        return pointer;
+    }
+
+    void* malloc(size_t size)
+    {
+        return counted(__libc_malloc(size));
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+        return counted(__libc_calloc(count, size));
+    }
+
+    void* realloc(void* pointer, size_t size)
+    {
+        size_t before = pointer != nullptr ? malloc_usable_size(pointer) : 0;
+        void* moved = __libc_realloc(pointer, size);
+
+        if(moved == nullptr && size > 0)
+        {
+            return nullptr;
+        }
+
+        FakeHeap::freed(before);
+        return counted(moved);
+    }
+
+    void free(void* pointer)
+    {
+        if(pointer != nullptr)
+        {
+            FakeHeap::freed(malloc_usable_size(pointer));
+            __libc_free(pointer);
+        }
+    }
+
+    void* memalign(size_t alignment, size_t size)
+    {
+        return counted(__libc_memalign(alignment, size));
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size)
+    {
+        return counted(__libc_memalign(alignment, size));
+    }
+
+    int posix_memalign(void** pointer, size_t alignment, size_t size)
+    {
+        void* aligned = counted(__libc_memalign(alignment, size));
+
+        if(aligned == nullptr)
+        {
+            return ENOMEM;
+        }
+        *pointer = aligned;
+        return 0;
+    }
+
+    void* valloc(size_t size)
+    {
+        return counted(__libc_memalign(4096, size));
+    }
+
+    void* pvalloc(size_t size)
+    {
+        return counted(__libc_memalign(4096, (size + 4095) & ~(size_t)4095));
+    }
+}
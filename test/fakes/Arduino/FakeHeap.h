@@ -0,0 +1,34 @@
+#ifndef _fake_heap_h
+#define _fake_heap_h
+
+#include <stddef.h>
+
+#define FAKE_HEAP_FREE      (48 * 1024)     // what ESP.getFreeHeap() reports with nothing allocated since the last rebase
+
+// Counts every heap allocation in the process, malloc and friends are replaced
+// in FakeHeap.cpp. Sizes are the host's, pointers and some structures are twice
+// what they are on the ESP8266, so compare figures between runs on the host
+// rather than against the device.
+class FakeHeap
+{
+    public:
+        static long getUsed() { return (long)(inUse - baseline); }
+        static long getPeak() { return (long)(peak - baseline); }
+        static unsigned long getAllocations() { return allocations - baseAllocations; }
+
+        static void resetPeak() { peak = inUse; }
+        static void rebase() { baseline = inUse; peak = inUse; baseAllocations = allocations; }
+
+        // called by the allocation functions only
+        static void allocated(size_t size);
+        static void freed(size_t size) { inUse -= size; }
+
+    private:
+        static size_t inUse;
+        static size_t peak;
+        static size_t baseline;
+        static unsigned long allocations;
+        static unsigned long baseAllocations;
+};
+
+#endif // _fake_heap_h
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include <new>
+
+// operator new goes through malloc from our own code, so heap counting and the
+// static environment's malloc wrapper see it like they do on the ESP8266
+
+void* operator new(size_t size)
+{
+    void* pointer = malloc(size);
+
+    if(pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return malloc(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t size) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void* pointer, size_t size) noexcept
+{
+    free(pointer);
+}
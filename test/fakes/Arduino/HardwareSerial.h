@@ -0,0 +1,30 @@
+#ifndef _fake_hardware_serial_h
+#define _fake_hardware_serial_h
+
+#include "Stream.h"
+
+// output goes to stdout, tests that print a lot of their own can mute it
+class HardwareSerial : public Stream
+{
+    public:
+        void begin(unsigned long baud) {}
+        void end() {}
+        void setMuted(bool muted) { this->muted = muted; }
+
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+        using Print::write;
+        int availableForWrite() override { return 128; }
+        void flush() override;
+
+        int available() override { return 0; }
+        int read() override { return -1; }
+        int peek() override { return -1; }
+
+    private:
+        bool muted = false;
+};
+
+extern HardwareSerial Serial;
+
+#endif // _fake_hardware_serial_h
@@ -0,0 +1,22 @@
+#include <Arduino.h>
+
+IPAddress::IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth)
+{
+    address = first | (second << 8) | (third << 16) | ((uint32_t)fourth << 24);
+}
+
+String IPAddress::toString() const
+{
+    char text[16];
+
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(text);
+}
+
+size_t IPAddress::printTo(Print& p) const
+{
+    char text[16];
+
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return p.print(text);
+}
@@ -0,0 +1,26 @@
+#ifndef _fake_ip_address_h
+#define _fake_ip_address_h
+
+#include <stdint.h>
+#include "WString.h"
+#include "Printable.h"
+
+class IPAddress : public Printable
+{
+    public:
+        IPAddress() : address(0) {}
+        IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth);
+        IPAddress(uint32_t address) : address(address) {}
+
+        operator uint32_t() const { return address; }
+        uint8_t operator[](int index) const { return (address >> (index * 8)) & 0xff; }
+        bool isSet() const { return address != 0; }
+
+        String toString() const;
+        size_t printTo(Print& p) const override;
+
+    private:
+        uint32_t address;   // first octet in the low byte, as lwIP keeps it
+};
+
+#endif // _fake_ip_address_h
@@ -0,0 +1,100 @@
+#include <Arduino.h>
+#include <stdarg.h>
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = 0;
+
+    while(size-- > 0 && write(*buffer++) == 1)
+    {
+        written++;
+    }
+    return written;
+}
+
+// formatted on the stack, the device core does the same
+size_t Print::printf(const char* format, ...)
+{
+    char buffer[1024];
+    va_list arguments;
+    int length;
+
+    va_start(arguments, format);
+    length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+    va_end(arguments);
+
+    if(length < 0)
+    {
+        return 0;
+    }
+    return write((const uint8_t*)buffer, std::min((size_t)length, sizeof(buffer) - 1));
+}
+
+size_t Print::printf_P(const char* format, ...)
+{
+    char buffer[1024];
+    va_list arguments;
+    int length;
+
+    va_start(arguments, format);
+    length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+    va_end(arguments);
+
+    if(length < 0)
+    {
+        return 0;
+    }
+    return write((const uint8_t*)buffer, std::min((size_t)length, sizeof(buffer) - 1));
+}
+
+size_t Print::print(long long value, int base)
+{
+    if(base == 10 && value < 0)
+    {
+        return print('-') + printNumber(0ULL - (unsigned long long)value, 10);
+    }
+    return printNumber(value, base);
+}
+
+size_t Print::print(unsigned long long value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::printNumber(unsigned long long value, uint8_t base)
+{
+    char buffer[8 * sizeof(value) + 1];
+    char* text = &buffer[sizeof(buffer) - 1];
+
+    if(base < 2)
+    {
+        base = 10;
+    }
+
+    *text = 0;
+    do
+    {
+        char digit = value % base;
+        *--text = digit < 10 ? digit + '0' : digit + 'A' - 10;
+        value /= base;
+    } while(value > 0);
+
+    return write(text);
+}
+
+size_t Print::print(double value, int digits)
+{
+    char buffer[64];
+
+    if(isnan(value))
+    {
+        return print("nan");
+    }
+    if(isinf(value))
+    {
+        return print("inf");
+    }
+
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    return print(buffer);
+}
@@ -0,0 +1,48 @@
+#ifndef _fake_print_h
+#define _fake_print_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "WString.h"
+#include "Printable.h"
+
+class Print
+{
+    public:
+        virtual ~Print() {}
+
+        virtual size_t write(uint8_t c) = 0;
+        virtual size_t write(const uint8_t* buffer, size_t size);
+        size_t write(const char* str) { return str != nullptr ? write((const uint8_t*)str, strlen(str)) : 0; }
+        size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+        size_t write_P(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+        virtual int availableForWrite() { return 0; }
+        virtual void flush() {}
+
+        size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+        size_t printf_P(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+        size_t print(const __FlashStringHelper* text) { return write(reinterpret_cast<const char*>(text)); }
+        size_t print(const String& text) { return write(text.c_str(), text.length()); }
+        size_t print(const char text[]) { return write(text); }
+        size_t print(char c) { return write((uint8_t)c); }
+        size_t print(unsigned char value, int base = 10) { return print((unsigned long long)value, base); }
+        size_t print(int value, int base = 10) { return print((long long)value, base); }
+        size_t print(unsigned int value, int base = 10) { return print((unsigned long long)value, base); }
+        size_t print(long value, int base = 10) { return print((long long)value, base); }
+        size_t print(unsigned long value, int base = 10) { return print((unsigned long long)value, base); }
+        size_t print(long long value, int base = 10);
+        size_t print(unsigned long long value, int base = 10);
+        size_t print(double value, int digits = 2);
+        size_t print(const Printable& printable) { return printable.printTo(*this); }
+
+        size_t println() { return write("\r\n"); }
+        template<typename T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+        template<typename T> size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+    private:
+        size_t printNumber(unsigned long long value, uint8_t base);
+};
+
+#endif // _fake_print_h
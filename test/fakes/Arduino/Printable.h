@@ -0,0 +1,15 @@
+#ifndef _fake_printable_h
+#define _fake_printable_h
+
+#include <stddef.h>
+
+class Print;
+
+class Printable
+{
+    public:
+        virtual ~Printable() {}
+        virtual size_t printTo(Print& p) const = 0;
+};
+
+#endif // _fake_printable_h
@@ -0,0 +1,6 @@
+#ifndef _fake_spi_h
+#define _fake_spi_h
+
+// the fake panel isn't on a bus
+
+#endif // _fake_spi_h
@@ -0,0 +1,28 @@
+#include <Arduino.h>
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+    size_t count = 0;
+
+    while(count < length)
+    {
+        int c = read();
+        if(c < 0)
+        {
+            break;
+        }
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+String Stream::readString()
+{
+    String text;
+
+    for(int c = read(); c >= 0; c = read())
+    {
+        text += (char)c;
+    }
+    return text;
+}
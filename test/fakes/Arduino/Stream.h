@@ -0,0 +1,25 @@
+#ifndef _fake_stream_h
+#define _fake_stream_h
+
+#include "Print.h"
+
+class Stream : public Print
+{
+    public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+
+        void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+        unsigned long getTimeout() const { return timeout; }
+
+        // nothing on the host arrives late, reads stop at the end of the data
+        virtual size_t readBytes(char* buffer, size_t length);
+        size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+        String readString();
+
+    protected:
+        unsigned long timeout = 1000;
+};
+
+#endif // _fake_stream_h
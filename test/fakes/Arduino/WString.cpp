@@ -0,0 +1,593 @@
+#include <Arduino.h>
+
+static char* formatInteger(char* end, unsigned long long value, unsigned char base, bool negative)
+{
+    char* start = end;
+
+    *start = 0;
+    do
+    {
+        int digit = value % base;
+        *--start = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        value /= base;
+    } while(value > 0);
+
+    if(negative)
+    {
+        *--start = '-';
+    }
+    return start;
+}
+
+static const char* formatSigned(char* end, long long value, unsigned char base)
+{
+    if(base == 10 && value < 0)
+    {
+        return formatInteger(end, 0ULL - (unsigned long long)value, base, true);
+    }
+    return formatInteger(end, (unsigned long long)value, base, false);
+}
+
+static const char* formatFloat(char* buffer, size_t size, double value, unsigned char decimalPlaces)
+{
+    snprintf(buffer, size, "%.*f", decimalPlaces, value);
+    return buffer;
+}
+
+/**** Construction ****/
+
+void String::init()
+{
+    heap = nullptr;
+    capacity = SSO_CAPACITY;
+    len = 0;
+    sso[0] = 0;
+}
+
+String::String(const char* cstr)
+{
+    init();
+    if(cstr != nullptr)
+    {
+        copy(cstr, strlen(cstr));
+    }
+}
+
+String::String(const String& other)
+{
+    init();
+    copy(other.buffer(), other.len);
+}
+
+String::String(String&& other)
+{
+    init();
+    move(other);
+}
+
+String::String(char c)
+{
+    init();
+    concat(c);
+}
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long)value, base) {}
+String::String(int value, unsigned char base) : String((long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base)
+{
+    char digits[72];
+
+    init();
+    *this = formatSigned(digits + sizeof(digits) - 1, value, base);
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+    char digits[72];
+
+    init();
+    *this = formatInteger(digits + sizeof(digits) - 1, value, base, false);
+}
+
+String::String(long long value, unsigned char base)
+{
+    char digits[72];
+
+    init();
+    *this = formatSigned(digits + sizeof(digits) - 1, value, base);
+}
+
+String::String(unsigned long long value, unsigned char base)
+{
+    char digits[72];
+
+    init();
+    *this = formatInteger(digits + sizeof(digits) - 1, value, base, false);
+}
+
+String::String(float value, unsigned char decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned char decimalPlaces)
+{
+    char digits[64];
+
+    init();
+    *this = formatFloat(digits, sizeof(digits), value, decimalPlaces);
+}
+
+String::~String()
+{
+    free(heap);
+}
+
+/**** Memory ****/
+
+bool String::reserve(unsigned int size)
+{
+    if(capacity >= size)
+    {
+        return true;
+    }
+    return changeBuffer(size);
+}
+
+bool String::changeBuffer(unsigned int maxLength)
+{
+    if(maxLength <= SSO_CAPACITY)
+    {
+        return true;
+    }
+
+    // rounded up like the ESP8266 core, the terminator included
+    size_t size = (maxLength + 16) & ~0xf;
+    char* buffer = (char*)realloc(heap, size);
+
+    if(buffer == nullptr)
+    {
+        return false;
+    }
+
+    if(isSSO())
+    {
+        memcpy(buffer, sso, len + 1);
+    }
+    heap = buffer;
+    capacity = size - 1;
+    return true;
+}
+
+String& String::copy(const char* cstr, unsigned int length)
+{
+    if(!reserve(length))
+    {
+        free(heap);
+        init();
+        return *this;
+    }
+
+    memmove(wbuffer(), cstr, length);
+    len = length;
+    wbuffer()[len] = 0;
+    return *this;
+}
+
+void String::move(String& rhs)
+{
+    if(rhs.isSSO())
+    {
+        copy(rhs.sso, rhs.len);
+    }
+    else
+    {
+        free(heap);
+        heap = rhs.heap;
+        capacity = rhs.capacity;
+        len = rhs.len;
+        rhs.init();
+    }
+    rhs.len = 0;
+    rhs.wbuffer()[0] = 0;
+}
+
+String& String::operator=(const String& rhs)
+{
+    if(this != &rhs)
+    {
+        copy(rhs.buffer(), rhs.len);
+    }
+    return *this;
+}
+
+String& String::operator=(String&& rhs)
+{
+    if(this != &rhs)
+    {
+        move(rhs);
+    }
+    return *this;
+}
+
+String& String::operator=(const char* cstr)
+{
+    return copy(cstr != nullptr ? cstr : "", cstr != nullptr ? strlen(cstr) : 0);
+}
+
+String& String::operator=(char c)
+{
+    return copy(&c, 1);
+}
+
+/**** Concatenation ****/
+
+bool String::concat(const char* cstr)
+{
+    return cstr != nullptr && concat(cstr, strlen(cstr));
+}
+
+bool String::concat(const char* cstr, unsigned int length)
+{
+    unsigned int newLength = len + length;
+
+    if(cstr == nullptr)
+    {
+        return false;
+    }
+    if(length == 0)
+    {
+        return true;
+    }
+
+    // cstr may point into this string's own buffer
+    if(cstr >= buffer() && cstr < buffer() + capacity)
+    {
+        unsigned int offset = cstr - buffer();
+        if(!reserve(newLength))
+        {
+            return false;
+        }
+        memmove(wbuffer() + len, buffer() + offset, length);
+    }
+    else
+    {
+        if(!reserve(newLength))
+        {
+            return false;
+        }
+        memmove(wbuffer() + len, cstr, length);
+    }
+
+    len = newLength;
+    wbuffer()[len] = 0;
+    return true;
+}
+
+bool String::concat(int value) { return concat((long)value); }
+bool String::concat(unsigned int value) { return concat((unsigned long)value); }
+
+bool String::concat(long value)
+{
+    char digits[72];
+    return concat(formatSigned(digits + sizeof(digits) - 1, value, 10));
+}
+
+bool String::concat(unsigned long value)
+{
+    char digits[72];
+    return concat(formatInteger(digits + sizeof(digits) - 1, value, 10, false));
+}
+
+bool String::concat(long long value)
+{
+    char digits[72];
+    return concat(formatSigned(digits + sizeof(digits) - 1, value, 10));
+}
+
+bool String::concat(unsigned long long value)
+{
+    char digits[72];
+    return concat(formatInteger(digits + sizeof(digits) - 1, value, 10, false));
+}
+
+bool String::concat(float value) { return concat((double)value); }
+
+bool String::concat(double value)
+{
+    char digits[64];
+    return concat(formatFloat(digits, sizeof(digits), value, 2));
+}
+
+String operator+(const String& lhs, const String& rhs)
+{
+    String result;
+
+    result.reserve(lhs.length() + rhs.length());
+    result += lhs;
+    result += rhs;
+    return result;
+}
+
+String operator+(const String& lhs, const char* rhs)
+{
+    String result;
+
+    result.reserve(lhs.length() + strlen(rhs));
+    result += lhs;
+    result += rhs;
+    return result;
+}
+
+String operator+(const char* lhs, const String& rhs)
+{
+    String result;
+
+    result.reserve(strlen(lhs) + rhs.length());
+    result += lhs;
+    result += rhs;
+    return result;
+}
+
+String operator+(const String& lhs, char rhs)
+{
+    String result(lhs);
+
+    result += rhs;
+    return result;
+}
+
+String operator+(String&& lhs, const String& rhs)
+{
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+String operator+(String&& lhs, const char* rhs)
+{
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+String operator+(String&& lhs, char rhs)
+{
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+/**** Comparison ****/
+
+int String::compareTo(const String& other) const
+{
+    return strcmp(buffer(), other.buffer());
+}
+
+bool String::equals(const String& other) const
+{
+    return len == other.len && memcmp(buffer(), other.buffer(), len) == 0;
+}
+
+bool String::equals(const char* cstr) const
+{
+    return cstr != nullptr ? strcmp(buffer(), cstr) == 0 : len == 0;
+}
+
+bool String::equalsIgnoreCase(const String& other) const
+{
+    return len == other.len && strcasecmp(buffer(), other.buffer()) == 0;
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const
+{
+    return offset + prefix.len <= len && strncmp(buffer() + offset, prefix.buffer(), prefix.len) == 0;
+}
+
+bool String::endsWith(const String& suffix) const
+{
+    return suffix.len <= len && strcmp(buffer() + len - suffix.len, suffix.buffer()) == 0;
+}
+
+/**** Characters ****/
+
+void String::setCharAt(unsigned int index, char c)
+{
+    if(index < len)
+    {
+        wbuffer()[index] = c;
+    }
+}
+
+char String::operator[](unsigned int index) const
+{
+    return index < len ? buffer()[index] : 0;
+}
+
+char& String::operator[](unsigned int index)
+{
+    static char dummy;
+
+    if(index >= len)
+    {
+        dummy = 0;
+        return dummy;
+    }
+    return wbuffer()[index];
+}
+
+void String::getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index) const
+{
+    unsigned int count;
+
+    if(bufsize == 0 || buf == nullptr)
+    {
+        return;
+    }
+    if(index >= len)
+    {
+        buf[0] = 0;
+        return;
+    }
+
+    count = std::min(bufsize - 1, len - index);
+    memcpy(buf, buffer() + index, count);
+    buf[count] = 0;
+}
+
+/**** Search ****/
+
+int String::indexOf(char ch, unsigned int fromIndex) const
+{
+    const char* found;
+
+    if(fromIndex >= len)
+    {
+        return -1;
+    }
+    found = strchr(buffer() + fromIndex, ch);
+    return found != nullptr ? found - buffer() : -1;
+}
+
+int String::indexOf(const char* str, unsigned int fromIndex) const
+{
+    const char* found;
+
+    if(fromIndex >= len)
+    {
+        return -1;
+    }
+    found = strstr(buffer() + fromIndex, str);
+    return found != nullptr ? found - buffer() : -1;
+}
+
+int String::lastIndexOf(char ch) const
+{
+    const char* found = strrchr(buffer(), ch);
+    return found != nullptr ? found - buffer() : -1;
+}
+
+int String::lastIndexOf(const String& str) const
+{
+    int found = -1;
+
+    for(int i = indexOf(str); i >= 0; i = indexOf(str, i + 1))
+    {
+        found = i;
+    }
+    return found;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+    String result;
+
+    if(beginIndex > endIndex)
+    {
+        std::swap(beginIndex, endIndex);
+    }
+    if(beginIndex >= len)
+    {
+        return result;
+    }
+    endIndex = std::min(endIndex, len);
+    result.copy(buffer() + beginIndex, endIndex - beginIndex);
+    return result;
+}
+
+/**** Modification ****/
+
+void String::replace(char find, char replace)
+{
+    for(char* c = wbuffer(); *c != 0; c++)
+    {
+        if(*c == find)
+        {
+            *c = replace;
+        }
+    }
+}
+
+void String::replace(const String& find, const String& replace)
+{
+    String result;
+    int from = 0;
+
+    if(find.len == 0)
+    {
+        return;
+    }
+
+    for(int found = indexOf(find); found >= 0; found = indexOf(find, found + find.len))
+    {
+        result.concat(buffer() + from, found - from);
+        result += replace;
+        from = found + find.len;
+    }
+
+    if(from > 0)
+    {
+        result.concat(buffer() + from, len - from);
+        *this = result;
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+    if(index >= len)
+    {
+        return;
+    }
+    count = std::min(count, len - index);
+    memmove(wbuffer() + index, buffer() + index + count, len - index - count + 1);
+    len -= count;
+}
+
+void String::toLowerCase()
+{
+    for(char* c = wbuffer(); *c != 0; c++)
+    {
+        *c = tolower(*c);
+    }
+}
+
+void String::toUpperCase()
+{
+    for(char* c = wbuffer(); *c != 0; c++)
+    {
+        *c = toupper(*c);
+    }
+}
+
+void String::trim()
+{
+    unsigned int start = 0;
+    unsigned int end = len;
+
+    while(start < len && isspace(buffer()[start]))
+    {
+        start++;
+    }
+    while(end > start && isspace(buffer()[end - 1]))
+    {
+        end--;
+    }
+
+    memmove(wbuffer(), buffer() + start, end - start);
+    len = end - start;
+    wbuffer()[len] = 0;
+}
+
+/**** Conversion ****/
+
+long String::toInt() const
+{
+    return atol(buffer());
+}
+
+float String::toFloat() const
+{
+    return atof(buffer());
+}
+
+double String::toDouble() const
+{
+    return atof(buffer());
+}
@@ -0,0 +1,138 @@
+#ifndef _fake_wstring_h
+#define _fake_wstring_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <utility>
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer)     (reinterpret_cast<const __FlashStringHelper*>(pstr_pointer))
+#define F(string_literal)       (FPSTR(PSTR(string_literal)))
+
+// Arduino String with the ESP8266 core's memory behaviour, short strings live in
+// the object and longer ones grow in 16 byte steps and keep their buffer when
+// assigned or cleared, so tests see the same allocations the device makes.
+class String
+{
+    public:
+        String() { init(); }
+        String(const char* cstr);
+        String(const String& other);
+        String(String&& other);
+        String(const __FlashStringHelper* pstr) : String(reinterpret_cast<const char*>(pstr)) {}
+        explicit String(char c);
+        explicit String(unsigned char value, unsigned char base = 10);
+        explicit String(int value, unsigned char base = 10);
+        explicit String(unsigned int value, unsigned char base = 10);
+        explicit String(long value, unsigned char base = 10);
+        explicit String(unsigned long value, unsigned char base = 10);
+        explicit String(long long value, unsigned char base = 10);
+        explicit String(unsigned long long value, unsigned char base = 10);
+        explicit String(float value, unsigned char decimalPlaces = 2);
+        explicit String(double value, unsigned char decimalPlaces = 2);
+        ~String();
+
+        bool reserve(unsigned int size);
+        unsigned int length() const { return len; }
+        bool isEmpty() const { return len == 0; }
+        const char* c_str() const { return buffer(); }
+        const char* begin() const { return buffer(); }
+        const char* end() const { return buffer() + len; }
+        explicit operator bool() const { return true; }
+
+        String& operator=(const String& rhs);
+        String& operator=(String&& rhs);
+        String& operator=(const char* cstr);
+        String& operator=(const __FlashStringHelper* pstr) { return operator=(reinterpret_cast<const char*>(pstr)); }
+        String& operator=(char c);
+
+        bool concat(const String& str) { return concat(str.buffer(), str.len); }
+        bool concat(const char* cstr);
+        bool concat(const char* cstr, unsigned int length);
+        bool concat(const __FlashStringHelper* pstr) { return concat(reinterpret_cast<const char*>(pstr)); }
+        bool concat(char c) { return concat(&c, 1); }
+        bool concat(unsigned char value) { return concat((unsigned int)value); }
+        bool concat(int value);
+        bool concat(unsigned int value);
+        bool concat(long value);
+        bool concat(unsigned long value);
+        bool concat(long long value);
+        bool concat(unsigned long long value);
+        bool concat(float value);
+        bool concat(double value);
+
+        template<typename T> String& operator+=(const T& rhs) { concat(rhs); return *this; }
+
+        int compareTo(const String& other) const;
+        bool equals(const String& other) const;
+        bool equals(const char* cstr) const;
+        bool equalsIgnoreCase(const String& other) const;
+        bool operator==(const String& rhs) const { return equals(rhs); }
+        bool operator==(const char* cstr) const { return equals(cstr); }
+        bool operator!=(const String& rhs) const { return !equals(rhs); }
+        bool operator!=(const char* cstr) const { return !equals(cstr); }
+        bool operator<(const String& rhs) const { return compareTo(rhs) < 0; }
+        bool operator>(const String& rhs) const { return compareTo(rhs) > 0; }
+        bool startsWith(const String& prefix) const { return startsWith(prefix, 0); }
+        bool startsWith(const String& prefix, unsigned int offset) const;
+        bool endsWith(const String& suffix) const;
+
+        char charAt(unsigned int index) const { return operator[](index); }
+        void setCharAt(unsigned int index, char c);
+        char operator[](unsigned int index) const;
+        char& operator[](unsigned int index);
+        void getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index = 0) const;
+        void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const { getBytes((unsigned char*)buf, bufsize, index); }
+
+        int indexOf(char ch, unsigned int fromIndex = 0) const;
+        int indexOf(const char* str, unsigned int fromIndex = 0) const;
+        int indexOf(const String& str, unsigned int fromIndex = 0) const { return indexOf(str.c_str(), fromIndex); }
+        int lastIndexOf(char ch) const;
+        int lastIndexOf(const String& str) const;
+        String substring(unsigned int beginIndex) const { return substring(beginIndex, len); }
+        String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+        void replace(char find, char replace);
+        void replace(const String& find, const String& replace);
+        void remove(unsigned int index) { remove(index, (unsigned int)-1); }
+        void remove(unsigned int index, unsigned int count);
+        void toLowerCase();
+        void toUpperCase();
+        void trim();
+
+        long toInt() const;
+        float toFloat() const;
+        double toDouble() const;
+
+    private:
+        static const unsigned int SSO_CAPACITY = 11;    // as on the ESP8266
+
+        void init();
+        bool isSSO() const { return heap == nullptr; }
+        const char* buffer() const { return isSSO() ? sso : heap; }
+        char* wbuffer() { return isSSO() ? sso : heap; }
+        bool changeBuffer(unsigned int maxLength);
+        String& copy(const char* cstr, unsigned int length);
+        void move(String& rhs);
+
+        char* heap;             // nullptr while the text fits in sso
+        unsigned int capacity;
+        unsigned int len;
+        char sso[SSO_CAPACITY + 1];
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+String operator+(String&& lhs, const String& rhs);
+String operator+(String&& lhs, const char* rhs);
+String operator+(String&& lhs, char rhs);
+
+template<typename T> String operator+(const String& lhs, T rhs) { String result(lhs); result.concat(rhs); return result; }
+template<typename T> String operator+(String&& lhs, T rhs) { lhs.concat(rhs); return std::move(lhs); }
+
+inline bool operator==(const char* lhs, const String& rhs) { return rhs.equals(lhs); }
+inline bool operator!=(const char* lhs, const String& rhs) { return !rhs.equals(lhs); }
+
+#endif // _fake_wstring_h
@@ -0,0 +1,33 @@
+#ifndef _fake_pgmspace_h
+#define _fake_pgmspace_h
+
+// the host has no separate flash, PROGMEM data is ordinary memory
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P               const char*
+#define PGM_VOID_P          const void*
+#define PSTR(s)             (s)
+
+#define pgm_read_byte(address)      (*(const uint8_t*)(address))
+#define pgm_read_word(address)      (*(const uint16_t*)(address))
+#define pgm_read_dword(address)     (*(const uint32_t*)(address))
+#define pgm_read_float(address)     (*(const float*)(address))
+#define pgm_read_ptr(address)       (*(const void* const*)(address))
+
+#define memcpy_P            memcpy
+#define memcmp_P            memcmp
+#define strlen_P            strlen
+#define strcpy_P            strcpy
+#define strncpy_P           strncpy
+#define strcmp_P            strcmp
+#define strncmp_P           strncmp
+#define strcasecmp_P        strcasecmp
+#define strstr_P            strstr
+#define sprintf_P           sprintf
+#define snprintf_P          snprintf
+#define vsnprintf_P         vsnprintf
+
+#endif // _fake_pgmspace_h
@@ -0,0 +1,45 @@
+#include "base64.h"
+
+static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+String base64::encode(const uint8_t* data, size_t length, bool doNewLines)
+{
+    String encoded;
+    size_t column = 0;
+
+    encoded.reserve(((length + 2) / 3) * 4 + (doNewLines ? length / 54 + 1 : 0));
+
+    for(size_t i=0; i<length; i+=3)
+    {
+        uint32_t block = data[i] << 16;
+        int count = min(length - i, (size_t)3);
+
+        if(count > 1)
+        {
+            block |= data[i + 1] << 8;
+        }
+        if(count > 2)
+        {
+            block |= data[i + 2];
+        }
+
+        for(int j=0; j<4; j++)
+        {
+            encoded += j <= count ? ALPHABET[(block >> (18 - j * 6)) & 0x3f] : '=';
+        }
+
+        column += 4;
+        if(doNewLines && column >= 72)
+        {
+            encoded += '\n';
+            column = 0;
+        }
+    }
+
+    return encoded;
+}
+
+String base64::encode(const String& text, bool doNewLines)
+{
+    return encode((const uint8_t*)text.c_str(), text.length(), doNewLines);
+}
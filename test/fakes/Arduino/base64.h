@@ -0,0 +1,14 @@
+#ifndef _fake_base64_h
+#define _fake_base64_h
+
+#include <Arduino.h>
+
+// the ESP8266 core's encoder, lines are broken every 72 characters unless doNewLines is false
+class base64
+{
+    public:
+        static String encode(const uint8_t* data, size_t length, bool doNewLines = true);
+        static String encode(const String& text, bool doNewLines = true);
+};
+
+#endif // _fake_base64_h
@@ -0,0 +1,57 @@
+#ifndef _fake_arduino_ota_h
+#define _fake_arduino_ota_h
+
+// no updates arrive on the host, the callbacks are kept so a test can run them
+
+#include <Arduino.h>
+#include <functional>
+
+#define U_FLASH     0
+#define U_FS        100
+#define U_SPIFFS    100
+
+typedef enum
+{
+    OTA_AUTH_ERROR,
+    OTA_BEGIN_ERROR,
+    OTA_CONNECT_ERROR,
+    OTA_RECEIVE_ERROR,
+    OTA_END_ERROR
+} ota_error_t;
+
+class ArduinoOTAClass
+{
+    public:
+        typedef std::function<void(void)> THandlerFunction;
+        typedef std::function<void(ota_error_t)> THandlerFunction_Error;
+        typedef std::function<void(unsigned int, unsigned int)> THandlerFunction_Progress;
+
+        void setPort(uint16_t port) {}
+        void setHostname(const char* hostname) {}
+        void setPassword(const char* password) {}
+        void setPasswordHash(const char* password) {}
+        void setRebootOnSuccess(bool reboot) {}
+
+        void onStart(THandlerFunction fn) { startCallback = fn; }
+        void onEnd(THandlerFunction fn) { endCallback = fn; }
+        void onError(THandlerFunction_Error fn) { errorCallback = fn; }
+        void onProgress(THandlerFunction_Progress fn) { progressCallback = fn; }
+
+        void begin(bool useMDNS = true) { started = true; }
+        void handle() {}
+        int getCommand() { return command; }
+
+        bool isStarted() const { return started; }
+        THandlerFunction startCallback;
+        THandlerFunction endCallback;
+        THandlerFunction_Error errorCallback;
+        THandlerFunction_Progress progressCallback;
+        int command = U_FLASH;
+
+    private:
+        bool started = false;
+};
+
+extern ArduinoOTAClass ArduinoOTA;
+
+#endif // _fake_arduino_ota_h
@@ -0,0 +1,27 @@
+#ifndef _fake_esp8266_wifi_h
+#define _fake_esp8266_wifi_h
+
+#include <Arduino.h>
+
+// always connected, tests set the address and signal they want to see
+class ESP8266WiFiClass
+{
+    public:
+        IPAddress localIP() { return address; }
+        int32_t RSSI() { return rssi; }
+        bool hostname(const char* name) { hostName = name; return true; }
+        const String& hostname() { return hostName; }
+        bool isConnected() { return true; }
+
+        void setLocalIP(IPAddress address) { this->address = address; }
+        void setRSSI(int32_t rssi) { this->rssi = rssi; }
+
+    private:
+        IPAddress address = IPAddress(192, 168, 1, 50);
+        int32_t rssi = -60;
+        String hostName;
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif // _fake_esp8266_wifi_h
@@ -0,0 +1,14 @@
+#ifndef _fake_wifi_udp_h
+#define _fake_wifi_udp_h
+
+#include <Arduino.h>
+
+// only ever handed to NTPClient, which is faked as well
+class WiFiUDP
+{
+    public:
+        uint8_t begin(uint16_t port) { return 1; }
+        void stop() {}
+};
+
+#endif // _fake_wifi_udp_h
@@ -0,0 +1,177 @@
+#include "ESPAsyncTCP.h"
+
+AsyncClient::~AsyncClient()
+{
+    close(true);
+}
+
+// hosts resolve when something is listening on them, anything else fails the
+// lookup with the error the real library reports
+bool AsyncClient::connect(const char* host, uint16_t port)
+{
+    if(state != FakeTcp_Closed)
+    {
+        return false;
+    }
+
+    strlcpy(this->host, host, sizeof(this->host));
+    this->port = port;
+    server = FakeNetwork::find(host, port);
+    pendingLength = 0;
+    unacked = 0;
+
+    if(server == nullptr)
+    {
+        state = FakeTcp_Resolving;
+        FakeNetwork::queue(FakeNetwork_Error, this, nullptr, nullptr, 0, FAKE_NETWORK_DNS_ERROR);
+        return true;
+    }
+
+    state = FakeTcp_Connecting;
+    FakeNetwork::queue(FakeNetwork_Connected, this, server);
+    return true;
+}
+
+bool AsyncClient::connect(IPAddress ip, uint16_t port)
+{
+    return connect(ip.toString().c_str(), port);
+}
+
+// with a socket, open or still connecting, the disconnect callback runs before
+// this returns
+void AsyncClient::close(bool now)
+{
+    bool hadSocket = state == FakeTcp_Connecting || state == FakeTcp_Connected;
+
+    FakeNetwork::cancel(this);
+
+    if(state == FakeTcp_Closed)
+    {
+        return;
+    }
+
+    state = FakeTcp_Closed;
+    pendingLength = 0;
+
+    if(hadSocket)
+    {
+        FakeNetwork::queue(FakeNetwork_ClientClosed, this, server);
+        disconnect();
+    }
+}
+
+int8_t AsyncClient::abort()
+{
+    close(true);
+    return -13;     // ERR_ABRT
+}
+
+size_t AsyncClient::space()
+{
+    if(state != FakeTcp_Connected)
+    {
+        return 0;
+    }
+    return FAKE_TCP_SEND_BUFFER - unacked - pendingLength;
+}
+
+size_t AsyncClient::add(const char* data, size_t size, uint8_t apiflags)
+{
+    size_t count = min(space(), size);
+
+    memcpy(pending + pendingLength, data, count);
+    pendingLength += count;
+    return count;
+}
+
+bool AsyncClient::send()
+{
+    if(state != FakeTcp_Connected)
+    {
+        return false;
+    }
+
+    if(pendingLength > 0)
+    {
+        FakeNetwork::queue(FakeNetwork_Received, this, server, pending, pendingLength);
+        unacked += pendingLength;
+        pendingLength = 0;
+    }
+    return true;
+}
+
+size_t AsyncClient::write(const char* data)
+{
+    return data != nullptr ? write(data, strlen(data)) : 0;
+}
+
+size_t AsyncClient::write(const char* data, size_t size, uint8_t apiflags)
+{
+    size_t count = add(data, size, apiflags);
+
+    if(count == 0 || !send())
+    {
+        return 0;
+    }
+    return count;
+}
+
+/**** from FakeNetwork::run() ****/
+
+void AsyncClient::handleConnected()
+{
+    if(state != FakeTcp_Connecting)
+    {
+        return;
+    }
+
+    state = FakeTcp_Connected;
+    if(connectCallback)
+    {
+        connectCallback(connectArg, this);
+    }
+}
+
+void AsyncClient::handleData(uint8_t* data, size_t length)
+{
+    if(state == FakeTcp_Connected && dataCallback)
+    {
+        dataCallback(dataArg, this, data, length);
+    }
+}
+
+void AsyncClient::handleClosed()
+{
+    if(state == FakeTcp_Closed)
+    {
+        return;
+    }
+
+    FakeNetwork::cancel(this);
+    state = FakeTcp_Closed;
+    pendingLength = 0;
+    disconnect();
+}
+
+// a failed lookup never had a socket, so there's no disconnect to follow
+void AsyncClient::handleError(int8_t error)
+{
+    if(state != FakeTcp_Resolving)
+    {
+        return;
+    }
+
+    state = FakeTcp_Closed;
+    if(errorCallback)
+    {
+        errorCallback(errorArg, this, error);
+    }
+}
+
+void AsyncClient::disconnect()
+{
+    if(disconnectCallback)
+    {
+        disconnectCallback(disconnectArg, this);
+    }
+}
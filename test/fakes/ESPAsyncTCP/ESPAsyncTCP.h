@@ -0,0 +1,92 @@
+#ifndef _fake_esp_async_tcp_h
+#define _fake_esp_async_tcp_h
+
+#include <Arduino.h>
+#include <functional>
+
+#define FAKE_TCP_SEND_BUFFER    1072    // lwIP's TCP_SND_BUF on the ESP8266, two segments
+
+class AsyncClient;
+
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void*, AsyncClient*, int8_t error)> AcErrorHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+typedef std::function<void(void*, AsyncClient*, uint32_t time)> AcTimeoutHandler;
+
+enum FakeTcpState
+{
+    FakeTcp_Closed,
+    FakeTcp_Resolving,      // host lookup queued, no socket yet
+    FakeTcp_Connecting,
+    FakeTcp_Connected,
+};
+
+// ESPAsyncTCP client on top of FakeNetwork. Callbacks run from
+// FakeNetwork::run(), except close() which reports the disconnect straight
+// away when there is a socket, as the real library does.
+class AsyncClient
+{
+    public:
+        AsyncClient() {}
+        ~AsyncClient();
+
+        bool connect(const char* host, uint16_t port);
+        bool connect(IPAddress ip, uint16_t port);
+        void close(bool now = false);
+        void stop() { close(false); }
+        int8_t abort();
+
+        bool connected() { return state == FakeTcp_Connected; }
+        bool connecting() { return state == FakeTcp_Connecting || state == FakeTcp_Resolving; }
+        bool disconnected() { return state == FakeTcp_Closed; }
+        bool freeable() { return state == FakeTcp_Closed; }
+
+        size_t space();
+        bool canSend() { return space() > 0; }
+        size_t add(const char* data, size_t size, uint8_t apiflags = 0);
+        bool send();
+        size_t write(const char* data);
+        size_t write(const char* data, size_t size, uint8_t apiflags = 0);
+
+        void onConnect(AcConnectHandler callback, void* arg = nullptr) { connectCallback = callback; connectArg = arg; }
+        void onDisconnect(AcConnectHandler callback, void* arg = nullptr) { disconnectCallback = callback; disconnectArg = arg; }
+        void onAck(AcAckHandler callback, void* arg = nullptr) {}
+        void onError(AcErrorHandler callback, void* arg = nullptr) { errorCallback = callback; errorArg = arg; }
+        void onData(AcDataHandler callback, void* arg = nullptr) { dataCallback = callback; dataArg = arg; }
+        void onTimeout(AcTimeoutHandler callback, void* arg = nullptr) {}
+        void onPoll(AcConnectHandler callback, void* arg = nullptr) {}
+        void setRxTimeout(uint32_t timeout) {}
+        void setNoDelay(bool noDelay) {}
+
+    private:
+        friend class FakeNetwork;
+
+        void handleConnected();
+        void handleData(uint8_t* data, size_t length);
+        void handleClosed();
+        void handleError(int8_t error);
+        void disconnect();
+
+        FakeTcpState state = FakeTcp_Closed;
+        char host[64];
+        uint16_t port = 0;
+        class FakeServer* server = nullptr;
+
+        uint8_t pending[FAKE_TCP_SEND_BUFFER];  // added but not sent
+        size_t pendingLength = 0;
+        size_t unacked = 0;                     // sent but not yet read by the server
+
+        AcConnectHandler connectCallback;
+        void* connectArg = nullptr;
+        AcConnectHandler disconnectCallback;
+        void* disconnectArg = nullptr;
+        AcErrorHandler errorCallback;
+        void* errorArg = nullptr;
+        AcDataHandler dataCallback;
+        void* dataArg = nullptr;
+};
+
+#include "FakeNetwork.h"
+
+#endif // _fake_esp_async_tcp_h
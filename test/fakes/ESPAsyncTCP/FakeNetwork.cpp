@@ -0,0 +1,174 @@
+#include "ESPAsyncTCP.h"
+#include "FakeNetwork.h"
+
+FakeNetwork::Listener FakeNetwork::listeners[FAKE_NETWORK_SERVERS];
+FakeNetworkEvent FakeNetwork::events[FAKE_NETWORK_EVENTS];
+int FakeNetwork::first = 0;
+int FakeNetwork::count = 0;
+
+void FakeNetwork::listen(const char* host, uint16_t port, FakeServer* server)
+{
+    for(int i=0; i<FAKE_NETWORK_SERVERS; i++)
+    {
+        Listener* listener = &listeners[i];
+
+        if(listener->server == nullptr || (listener->port == port && strcmp(listener->host, host) == 0))
+        {
+            strlcpy(listener->host, host, sizeof(listener->host));
+            listener->port = port;
+            listener->server = server;
+            return;
+        }
+    }
+
+    fprintf(stderr, "FakeNetwork: too many servers, raise FAKE_NETWORK_SERVERS\n");
+    abort();
+}
+
+void FakeNetwork::unlisten(FakeServer* server)
+{
+    for(int i=0; i<FAKE_NETWORK_SERVERS; i++)
+    {
+        if(listeners[i].server == server)
+        {
+            listeners[i].server = nullptr;
+        }
+    }
+}
+
+// forgets the servers and anything still queued, sockets are left as they are
+void FakeNetwork::reset()
+{
+    for(int i=0; i<FAKE_NETWORK_SERVERS; i++)
+    {
+        listeners[i].server = nullptr;
+    }
+    first = 0;
+    count = 0;
+}
+
+FakeServer* FakeNetwork::find(const char* host, uint16_t port)
+{
+    for(int i=0; i<FAKE_NETWORK_SERVERS; i++)
+    {
+        Listener* listener = &listeners[i];
+
+        if(listener->server != nullptr && listener->port == port && strcmp(listener->host, host) == 0)
+        {
+            return listener->server;
+        }
+    }
+    return nullptr;
+}
+
+void FakeNetwork::queue(FakeNetworkEventType type, AsyncClient* client, FakeServer* server, const uint8_t* data, size_t length, int8_t error)
+{
+    if(count == FAKE_NETWORK_EVENTS)
+    {
+        fprintf(stderr, "FakeNetwork: event queue full, raise FAKE_NETWORK_EVENTS\n");
+        abort();
+    }
+
+    FakeNetworkEvent* event = &events[(first + count) % FAKE_NETWORK_EVENTS];
+
+    event->type = type;
+    event->client = client;
+    event->server = server;
+    event->error = error;
+    event->length = length;
+    if(length > 0)
+    {
+        memcpy(event->data, data, length);
+    }
+    count++;
+}
+
+// a closed socket hears nothing more, whatever it had in flight is lost
+void FakeNetwork::cancel(AsyncClient* client)
+{
+    for(int i=0; i<count; i++)
+    {
+        FakeNetworkEvent* event = &events[(first + i) % FAKE_NETWORK_EVENTS];
+
+        if(event->client == client && event->type != FakeNetwork_ClientClosed)
+        {
+            event->client = nullptr;
+        }
+    }
+}
+
+int FakeNetwork::run()
+{
+    static FakeNetworkEvent event;
+    int delivered = 0;
+
+    while(count > 0)
+    {
+        // copied out first, delivering it may queue more
+        memcpy(&event, &events[first], sizeof(event));
+        first = (first + 1) % FAKE_NETWORK_EVENTS;
+        count--;
+
+        if(event.client != nullptr)
+        {
+            deliver(&event);
+            delivered++;
+        }
+    }
+
+    return delivered;
+}
+
+void FakeNetwork::deliver(FakeNetworkEvent* event)
+{
+    AsyncClient* client = event->client;
+
+    switch(event->type)
+    {
+        case FakeNetwork_Connected:
+            event->server->onAccept(client);
+            client->handleConnected();
+            break;
+
+        case FakeNetwork_Data:
+            client->handleData(event->data, event->length);
+            break;
+
+        case FakeNetwork_Closed:
+            client->handleClosed();
+            break;
+
+        case FakeNetwork_Error:
+            client->handleError(event->error);
+            break;
+
+        case FakeNetwork_Received:
+            client->unacked -= min(client->unacked, event->length);
+            event->server->onReceive(client, event->data, event->length);
+            break;
+
+        case FakeNetwork_ClientClosed:
+            event->server->onClose(client);
+            break;
+    }
+}
+
+void FakeNetwork::reply(AsyncClient* client, const uint8_t* data, size_t length, size_t segment)
+{
+    segment = constrain(segment, (size_t)1, (size_t)FAKE_NETWORK_SEGMENT);
+
+    for(size_t i=0; i<length; i+=segment)
+    {
+        queue(FakeNetwork_Data, client, client->server, data + i, min(segment, length - i));
+    }
+}
+
+void FakeNetwork::reply(AsyncClient* client, const char* text, size_t segment)
+{
+    reply(client, (const uint8_t*)text, strlen(text), segment);
+}
+
+void FakeNetwork::hangUp(AsyncClient* client)
+{
+    queue(FakeNetwork_Closed, client, client->server);
+}
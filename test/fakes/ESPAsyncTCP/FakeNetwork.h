@@ -0,0 +1,85 @@
+#ifndef _fake_network_h
+#define _fake_network_h
+
+#include <Arduino.h>
+
+#define FAKE_NETWORK_SEGMENT    1460    // largest TCP segment, replies are split into pieces no bigger
+#define FAKE_NETWORK_EVENTS     512     // queued at once
+#define FAKE_NETWORK_SERVERS    8
+#define FAKE_NETWORK_DNS_ERROR  -55     // what ESPAsyncTCP reports when a host doesn't resolve
+
+class AsyncClient;
+
+// something listening on a host and port, the client socket stands in for the
+// connection on the server's side too
+class FakeServer
+{
+    public:
+        virtual ~FakeServer() {}
+        virtual void onAccept(AsyncClient* client) {}
+        virtual void onReceive(AsyncClient* client, const uint8_t* data, size_t length) = 0;
+        virtual void onClose(AsyncClient* client) {}
+};
+
+enum FakeNetworkEventType
+{
+    FakeNetwork_Connected,
+    FakeNetwork_Data,           // server to client
+    FakeNetwork_Closed,         // server hung up
+    FakeNetwork_Error,
+    FakeNetwork_Received,       // client to server
+    FakeNetwork_ClientClosed,
+};
+
+typedef struct FakeNetworkEvent
+{
+    FakeNetworkEventType type;
+    AsyncClient* client;
+    FakeServer* server;
+    int8_t error;
+    size_t length;
+    uint8_t data[FAKE_NETWORK_SEGMENT];
+} FakeNetworkEvent;
+
+// Everything the fake sockets do is queued here and only happens when a test
+// calls run(), so firmware callbacks land between loop() calls as they would
+// from lwIP. The queue and its buffers are fixed, nothing on the firmware's side
+// of a socket touches the heap.
+class FakeNetwork
+{
+    public:
+        static void listen(const char* host, uint16_t port, FakeServer* server);
+        static void unlisten(FakeServer* server);
+        static void reset();
+
+        // delivers every event, including those queued while delivering, returns how many
+        static int run();
+        static int getPending() { return count; }
+
+        // server side
+        static void reply(AsyncClient* client, const uint8_t* data, size_t length, size_t segment = FAKE_NETWORK_SEGMENT);
+        static void reply(AsyncClient* client, const char* text, size_t segment = FAKE_NETWORK_SEGMENT);
+        static void hangUp(AsyncClient* client);
+
+        // client side, for AsyncClient
+        static FakeServer* find(const char* host, uint16_t port);
+        static void queue(FakeNetworkEventType type, AsyncClient* client, FakeServer* server, const uint8_t* data = nullptr, size_t length = 0, int8_t error = 0);
+        static void cancel(AsyncClient* client);
+
+    private:
+        static void deliver(FakeNetworkEvent* event);
+
+        typedef struct Listener
+        {
+            char host[64];
+            uint16_t port;
+            FakeServer* server;
+        } Listener;
+
+        static Listener listeners[FAKE_NETWORK_SERVERS];
+        static FakeNetworkEvent events[FAKE_NETWORK_EVENTS];
+        static int first;
+        static int count;
+};
+
+#endif // _fake_network_h
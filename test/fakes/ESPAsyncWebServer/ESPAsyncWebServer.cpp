@@ -0,0 +1,406 @@
+#include <ESPAsyncWebServer.h>
+
+static int fromHex(char c)
+{
+    if(c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    c = tolower(c);
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+static String urlDecode(const char* text, size_t length)
+{
+    String decoded;
+
+    for(size_t i = 0; i < length; i++)
+    {
+        if(text[i] == '+')
+        {
+            decoded += ' ';
+        }
+        else if(text[i] == '%' && i + 2 < length && fromHex(text[i + 1]) >= 0 && fromHex(text[i + 2]) >= 0)
+        {
+            decoded += (char)(fromHex(text[i + 1]) * 16 + fromHex(text[i + 2]));
+            i += 2;
+        }
+        else
+        {
+            decoded += text[i];
+        }
+    }
+    return decoded;
+}
+
+const String* FakeWebReply::getHeader(const char* name) const
+{
+    for(int i = 0; i < headerCount; i++)
+    {
+        if(headers[i].name().equalsIgnoreCase(name))
+        {
+            return &headers[i].value();
+        }
+    }
+    return nullptr;
+}
+
+/**** Responses ****/
+
+AsyncWebServerResponse::AsyncWebServerResponse(int code, const String& contentType)
+{
+    _code = code;
+    _contentType = contentType;
+    headerCount = 0;
+}
+
+void AsyncWebServerResponse::addHeader(const String& name, const String& value)
+{
+    if(headerCount < FAKE_WEB_HEADERS)
+    {
+        headers[headerCount++] = AsyncWebHeader(name, value);
+    }
+}
+
+void AsyncWebServerResponse::finish(FakeWebReply& reply)
+{
+    reply.code = _code;
+    reply.contentType = _contentType;
+    reply.headerCount = headerCount;
+    for(int i = 0; i < headerCount; i++)
+    {
+        reply.headers[i] = headers[i];
+    }
+    reply.body = "";
+    onChunk = reply.onChunk;
+    fillBody(reply.body);
+}
+
+void AsyncCallbackResponse::fillBody(String& body)
+{
+    uint8_t chunk[FAKE_WEB_CHUNK_SIZE];
+    size_t index = 0;
+
+    while(index < length)
+    {
+        size_t filled = filler(chunk, std::min((size_t)FAKE_WEB_CHUNK_SIZE, length - index), index);
+
+        if(filled == 0)
+        {
+            break;
+        }
+        body.concat((const char*)chunk, filled);
+        index += filled;
+    }
+}
+
+void AsyncChunkedResponse::fillBody(String& body)
+{
+    size_t index = 0;
+
+    while(true)
+    {
+        uint8_t* chunk = (uint8_t*)malloc(FAKE_WEB_CHUNK_SIZE);
+        size_t filled = filler(chunk, FAKE_WEB_CHUNK_SIZE, index);
+
+        body.concat((const char*)chunk, filled);
+        free(chunk);
+
+        if(filled == 0)
+        {
+            break;
+        }
+        index += filled;
+
+        if(onChunk)
+        {
+            onChunk(index);
+        }
+    }
+}
+
+AsyncResponseStream::AsyncResponseStream(const String& contentType, size_t bufferSize) : AsyncWebServerResponse(200, contentType)
+{
+    content.reserve(bufferSize);
+}
+
+/**** Requests ****/
+
+AsyncWebServerRequest::AsyncWebServerRequest(const char* url, const char* headers)
+{
+    const char* query = strchr(url, '?');
+
+    _url = query != nullptr ? urlDecode(url, query - url) : String(url);
+    paramCount = 0;
+    headerCount = 0;
+    response = nullptr;
+
+    for(const char* field = query; field != nullptr && paramCount < FAKE_WEB_PARAMS; )
+    {
+        const char* start = field + 1;
+        const char* end = strchr(start, '&');
+        const char* equals = strchr(start, '=');
+        size_t length = end != nullptr ? end - start : strlen(start);
+
+        if(length > 0)
+        {
+            if(equals == nullptr || equals >= start + length)
+            {
+                paramList[paramCount++] = AsyncWebParameter(urlDecode(start, length), String());
+            }
+            else
+            {
+                paramList[paramCount++] = AsyncWebParameter(urlDecode(start, equals - start),
+                    urlDecode(equals + 1, start + length - equals - 1));
+            }
+        }
+        field = end;
+    }
+
+    for(const char* line = headers; line != nullptr && *line != 0 && headerCount < FAKE_WEB_HEADERS; )
+    {
+        const char* end = strchr(line, '\n');
+        const char* colon = strchr(line, ':');
+        size_t length = end != nullptr ? end - line : strlen(line);
+
+        if(colon != nullptr && colon < line + length)
+        {
+            String value;
+            const char* valueStart = colon + 1;
+
+            while(*valueStart == ' ')
+            {
+                valueStart++;
+            }
+            value.concat(valueStart, line + length - valueStart);
+            value.trim();
+
+            String name;
+            name.concat(line, colon - line);
+            headerList[headerCount++] = AsyncWebHeader(name, value);
+        }
+        line = end != nullptr ? end + 1 : nullptr;
+    }
+}
+
+AsyncWebServerRequest::~AsyncWebServerRequest()
+{
+    delete response;
+}
+
+bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const
+{
+    return getParam(name, post, file) != nullptr;
+}
+
+// query parameters only, every fake request is a GET
+AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool file) const
+{
+    for(size_t i = 0; i < paramCount; i++)
+    {
+        if(paramList[i].name() == name && paramList[i].isPost() == post && paramList[i].isFile() == file)
+        {
+            return const_cast<AsyncWebParameter*>(&paramList[i]);
+        }
+    }
+    return nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(size_t index) const
+{
+    return index < paramCount ? const_cast<AsyncWebParameter*>(&paramList[index]) : nullptr;
+}
+
+bool AsyncWebServerRequest::hasHeader(const String& name) const
+{
+    return getHeader(name) != nullptr;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const
+{
+    for(size_t i = 0; i < headerCount; i++)
+    {
+        if(headerList[i].name().equalsIgnoreCase(name))
+        {
+            return const_cast<AsyncWebHeader*>(&headerList[i]);
+        }
+    }
+    return nullptr;
+}
+
+// like the real server only the first response counts, later ones are dropped
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response)
+{
+    if(this->response != nullptr)
+    {
+        delete response;
+        return;
+    }
+    this->response = response;
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content)
+{
+    send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::redirect(const String& url)
+{
+    AsyncWebServerResponse* response = beginResponse(302);
+
+    response->addHeader("Location", url);
+    send(response);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType, const String& content)
+{
+    return new AsyncBasicResponse(code, contentType, content);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(const String& contentType, size_t length, AwsResponseFiller filler)
+{
+    return new AsyncCallbackResponse(contentType, length, filler);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const String& contentType, AwsResponseFiller filler)
+{
+    return new AsyncChunkedResponse(contentType, filler);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t length)
+{
+    return new AsyncProgmemResponse(code, contentType, content, length);
+}
+
+AsyncResponseStream* AsyncWebServerRequest::beginResponseStream(const String& contentType, size_t bufferSize)
+{
+    return new AsyncResponseStream(contentType, bufferSize);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::takeResponse()
+{
+    AsyncWebServerResponse* taken = response;
+
+    response = nullptr;
+    return taken;
+}
+
+/**** WebSocket ****/
+
+// the text is kept for the test instead of being queued for each client
+void AsyncWebSocket::textAll(const char* message, size_t length)
+{
+    if(clients == 0)
+    {
+        return;
+    }
+
+    lastLength = std::min(length, sizeof(lastMessage) - 1);
+    memcpy(lastMessage, message, lastLength);
+    lastMessage[lastLength] = 0;
+    messages++;
+}
+
+void AsyncWebSocket::connectFakeClient()
+{
+    AsyncWebSocketClient client(nextId++);
+
+    clients++;
+    if(eventHandler)
+    {
+        eventHandler(this, &client, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    }
+}
+
+void AsyncWebSocket::disconnectFakeClient()
+{
+    AsyncWebSocketClient client(nextId - 1);
+
+    if(clients == 0)
+    {
+        return;
+    }
+    clients--;
+    if(eventHandler)
+    {
+        eventHandler(this, &client, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+    }
+}
+
+/**** Server ****/
+
+void AsyncWebServer::reset()
+{
+    for(int i = 0; i < routeCount; i++)
+    {
+        routes[i] = AsyncCallbackWebHandler();
+    }
+    routeCount = 0;
+    handlerCount = 0;
+    notFound = nullptr;
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest)
+{
+    if(routeCount >= FAKE_WEB_ROUTES)
+    {
+        fprintf(stderr, "AsyncWebServer: more than %d routes\n", FAKE_WEB_ROUTES);
+        abort();
+    }
+
+    AsyncCallbackWebHandler& route = routes[routeCount++];
+    route.uri = uri;
+    route.method = method;
+    route.onRequest = onRequest;
+    return route;
+}
+
+AsyncWebHandler& AsyncWebServer::addHandler(AsyncWebHandler* handler)
+{
+    if(handlerCount >= FAKE_WEB_HANDLERS)
+    {
+        fprintf(stderr, "AsyncWebServer: more than %d handlers\n", FAKE_WEB_HANDLERS);
+        abort();
+    }
+    handlers[handlerCount++] = handler;
+    return *handler;
+}
+
+void AsyncWebServer::handleFakeRequest(const char* url, FakeWebReply& reply, const char* headers)
+{
+    AsyncWebServerRequest request(url, headers);
+    AsyncWebServerResponse* response;
+    bool handled = false;
+
+    reply.code = 0;
+    reply.contentType = "";
+    reply.body = "";
+    reply.headerCount = 0;
+
+    for(int i = 0; i < routeCount && !handled; i++)
+    {
+        if(routes[i].uri == request.url() && (routes[i].method & HTTP_GET) != 0)
+        {
+            routes[i].onRequest(&request);
+            handled = true;
+        }
+    }
+    if(!handled)
+    {
+        if(notFound)
+        {
+            notFound(&request);
+        }
+        else
+        {
+            request.send(404);
+        }
+    }
+
+    response = request.takeResponse();
+    if(response != nullptr)
+    {
+        response->finish(reply);
+        delete response;
+    }
+}
@@ -0,0 +1,346 @@
+#ifndef _fake_esp_async_web_server_h
+#define _fake_esp_async_web_server_h
+
+// ESPAsyncWebServer without sockets. Tests hand a GET to the server with
+// handleFakeRequest() and get the finished reply back, websocket clients are
+// counted connections that keep the last text sent to them.
+
+#include <Arduino.h>
+#include <functional>
+// the real header brings these in on the ESP8266
+#include <ESP8266WiFi.h>
+#include <ESPAsyncTCP.h>
+
+#define FAKE_WEB_ROUTES             48
+#define FAKE_WEB_PARAMS             16
+#define FAKE_WEB_HEADERS            8
+#define FAKE_WEB_HANDLERS           4
+#define FAKE_WEB_CHUNK_SIZE         1460
+#define FAKE_WS_MESSAGE_SIZE        4096
+
+typedef enum
+{
+    HTTP_GET     = 0b00000001,
+    HTTP_POST    = 0b00000010,
+    HTTP_DELETE  = 0b00000100,
+    HTTP_PUT     = 0b00001000,
+    HTTP_PATCH   = 0b00010000,
+    HTTP_HEAD    = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY     = 0b01111111,
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class AsyncWebServerResponse;
+class AsyncWebSocket;
+class AsyncWebSocketClient;
+
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncWebParameter
+{
+    public:
+        AsyncWebParameter() : _size(0), _isForm(false), _isFile(false) {}
+        AsyncWebParameter(const String& name, const String& value, bool form = false, bool file = false, size_t size = 0) :
+            _name(name), _value(value), _size(size), _isForm(form), _isFile(file) {}
+
+        const String& name() const { return _name; }
+        const String& value() const { return _value; }
+        size_t size() const { return _size; }
+        bool isPost() const { return _isForm; }
+        bool isFile() const { return _isFile; }
+
+    private:
+        String _name;
+        String _value;
+        size_t _size;
+        bool _isForm;
+        bool _isFile;
+};
+
+class AsyncWebHeader
+{
+    public:
+        AsyncWebHeader() {}
+        AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+
+        const String& name() const { return _name; }
+        const String& value() const { return _value; }
+
+    private:
+        String _name;
+        String _value;
+};
+
+// what a fake request came back with
+struct FakeWebReply
+{
+    int code;
+    String contentType;
+    String body;
+    AsyncWebHeader headers[FAKE_WEB_HEADERS];
+    int headerCount;
+    std::function<void(size_t index)> onChunk;     // called after each chunk of a chunked response
+
+    const String* getHeader(const char* name) const;
+};
+
+/**** Responses ****/
+
+class AsyncWebServerResponse
+{
+    public:
+        AsyncWebServerResponse(int code, const String& contentType);
+        virtual ~AsyncWebServerResponse() {}
+
+        void addHeader(const String& name, const String& value);
+        void setCode(int code) { _code = code; }
+        void setContentType(const String& type) { _contentType = type; }
+
+        void finish(FakeWebReply& reply);
+
+    protected:
+        virtual void fillBody(String& body) {}
+
+        int _code;
+        String _contentType;
+        AsyncWebHeader headers[FAKE_WEB_HEADERS];
+        int headerCount;
+        std::function<void(size_t index)> onChunk;
+};
+
+class AsyncBasicResponse : public AsyncWebServerResponse
+{
+    public:
+        AsyncBasicResponse(int code, const String& contentType = String(), const String& content = String()) :
+            AsyncWebServerResponse(code, contentType), content(content) {}
+
+    protected:
+        void fillBody(String& body) override { body = content; }
+
+    private:
+        String content;
+};
+
+class AsyncProgmemResponse : public AsyncWebServerResponse
+{
+    public:
+        AsyncProgmemResponse(int code, const String& contentType, const uint8_t* content, size_t length) :
+            AsyncWebServerResponse(code, contentType), content(content), length(length) {}
+
+    protected:
+        void fillBody(String& body) override { body.concat((const char*)content, length); }
+
+    private:
+        const uint8_t* content;
+        size_t length;
+};
+
+// asks the filler for the body a TCP segment at a time, as the server sends it
+class AsyncCallbackResponse : public AsyncWebServerResponse
+{
+    public:
+        AsyncCallbackResponse(const String& contentType, size_t length, AwsResponseFiller filler) :
+            AsyncWebServerResponse(200, contentType), length(length), filler(filler) {}
+
+    protected:
+        void fillBody(String& body) override;
+
+    private:
+        size_t length;
+        AwsResponseFiller filler;
+};
+
+// asks the filler for the body until it returns 0. Each chunk buffer is taken
+// from the heap while it's filled, as the real server does
+class AsyncChunkedResponse : public AsyncWebServerResponse
+{
+    public:
+        AsyncChunkedResponse(const String& contentType, AwsResponseFiller filler) :
+            AsyncWebServerResponse(200, contentType), filler(filler) {}
+
+    protected:
+        void fillBody(String& body) override;
+
+    private:
+        AwsResponseFiller filler;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print
+{
+    public:
+        AsyncResponseStream(const String& contentType, size_t bufferSize);
+
+        size_t write(uint8_t c) override { content.concat((char)c); return 1; }
+        size_t write(const uint8_t* buffer, size_t size) override { content.concat((const char*)buffer, size); return size; }
+        using Print::write;
+
+    protected:
+        void fillBody(String& body) override { body = content; }
+
+    private:
+        String content;
+};
+
+/**** Requests ****/
+
+class AsyncWebServerRequest
+{
+    public:
+        AsyncWebServerRequest(const char* url, const char* headers);
+        ~AsyncWebServerRequest();
+
+        const String& url() const { return _url; }
+        WebRequestMethodComposite method() const { return HTTP_GET; }
+
+        size_t params() const { return paramCount; }
+        bool hasParam(const String& name, bool post = false, bool file = false) const;
+        AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const;
+        AsyncWebParameter* getParam(size_t index) const;
+        size_t headers() const { return headerCount; }
+        bool hasHeader(const String& name) const;
+        AsyncWebHeader* getHeader(const String& name) const;
+
+        void send(AsyncWebServerResponse* response);
+        void send(int code, const String& contentType = String(), const String& content = String());
+        void redirect(const String& url);
+
+        AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(), const String& content = String());
+        AsyncWebServerResponse* beginResponse(const String& contentType, size_t length, AwsResponseFiller filler);
+        AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller filler);
+        AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t length);
+        AsyncResponseStream* beginResponseStream(const String& contentType, size_t bufferSize = 1460);
+
+        AsyncWebServerResponse* takeResponse();
+
+    private:
+        String _url;
+        AsyncWebParameter paramList[FAKE_WEB_PARAMS];
+        size_t paramCount;
+        AsyncWebHeader headerList[FAKE_WEB_HEADERS];
+        size_t headerCount;
+        AsyncWebServerResponse* response;
+};
+
+/**** Handlers ****/
+
+class AsyncWebHandler
+{
+    public:
+        virtual ~AsyncWebHandler() {}
+};
+
+class AsyncCallbackWebHandler
+{
+    public:
+        AsyncCallbackWebHandler() : method(0) {}
+
+        String uri;
+        WebRequestMethodComposite method;
+        ArRequestHandlerFunction onRequest;
+};
+
+typedef enum
+{
+    WS_EVT_CONNECT,
+    WS_EVT_DISCONNECT,
+    WS_EVT_PONG,
+    WS_EVT_ERROR,
+    WS_EVT_DATA
+} AwsEventType;
+
+typedef std::function<void(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocketClient
+{
+    public:
+        explicit AsyncWebSocketClient(uint32_t id) : _id(id) {}
+        uint32_t id() const { return _id; }
+
+    private:
+        uint32_t _id;
+};
+
+class AsyncWebSocket : public AsyncWebHandler
+{
+    public:
+        explicit AsyncWebSocket(const String& url) : _url(url), clients(0), nextId(1), messages(0), lastLength(0) { lastMessage[0] = 0; }
+
+        const String& url() const { return _url; }
+        void onEvent(AwsEventHandler handler) { eventHandler = handler; }
+        size_t count() const { return clients; }
+        void cleanupClients() {}
+
+        void textAll(const char* message, size_t length);
+        void textAll(const char* message) { textAll(message, strlen(message)); }
+        void textAll(const String& message) { textAll(message.c_str(), message.length()); }
+
+        // a browser opening the socket, or leaving
+        void connectFakeClient();
+        void disconnectFakeClient();
+
+        // texts sent since the last reset and the newest of them
+        unsigned long getMessageCount() const { return messages; }
+        const char* getLastMessage() const { return lastMessage; }
+        size_t getLastLength() const { return lastLength; }
+        void resetMessages() { messages = 0; lastLength = 0; lastMessage[0] = 0; }
+
+    private:
+        String _url;
+        AwsEventHandler eventHandler;
+        size_t clients;
+        uint32_t nextId;
+        unsigned long messages;
+        char lastMessage[FAKE_WS_MESSAGE_SIZE];
+        size_t lastLength;
+};
+
+class AsyncEventSource : public AsyncWebHandler
+{
+    public:
+        explicit AsyncEventSource(const String& url) : _url(url) {}
+
+        size_t count() const { return 0; }
+        void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {}
+
+    private:
+        String _url;
+};
+
+/**** Server ****/
+
+class AsyncWebServer
+{
+    public:
+        explicit AsyncWebServer(uint16_t port) : port(port), routeCount(0), handlerCount(0), running(false) {}
+
+        void begin() { running = true; }
+        void end() { running = false; }
+        void reset();
+
+        AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+        AsyncCallbackWebHandler& on(const char* uri, ArRequestHandlerFunction onRequest) { return on(uri, HTTP_ANY, onRequest); }
+        void onNotFound(ArRequestHandlerFunction fn) { notFound = fn; }
+        AsyncWebHandler& addHandler(AsyncWebHandler* handler);
+
+        bool isRunning() const { return running; }
+
+        // a GET for url, query included, with extra "Name: value" lines in headers.
+        // Answers 404 as the real server does when nothing handles it.
+        void handleFakeRequest(const char* url, FakeWebReply& reply, const char* headers = nullptr);
+
+    private:
+        uint16_t port;
+        AsyncCallbackWebHandler routes[FAKE_WEB_ROUTES];
+        int routeCount;
+        AsyncWebHandler* handlers[FAKE_WEB_HANDLERS];
+        int handlerCount;
+        ArRequestHandlerFunction notFound;
+        bool running;
+};
+
+#endif // _fake_esp_async_web_server_h
@@ -0,0 +1,15 @@
+#ifndef _fake_dns_server_h
+#define _fake_dns_server_h
+
+#include <Arduino.h>
+
+// the captive portal's DNS, never started on the host
+class DNSServer
+{
+    public:
+        bool start(uint16_t port, const String& domainName, const IPAddress& resolvedIP) { return true; }
+        void stop() {}
+        void processNextRequest() {}
+};
+
+#endif // _fake_dns_server_h
@@ -0,0 +1,4 @@
+#include <ESPAsyncWiFiManager.h>
+
+unsigned long AsyncWiFiManager::connects = 0;
+unsigned long AsyncWiFiManager::resets = 0;
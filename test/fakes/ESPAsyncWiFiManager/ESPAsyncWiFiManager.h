@@ -0,0 +1,32 @@
+#ifndef _fake_esp_async_wifi_manager_h
+#define _fake_esp_async_wifi_manager_h
+
+// connects straight away to the fake network, no portal is ever shown
+
+#include <Arduino.h>
+#include <functional>
+#include <ESPAsyncWebServer.h>
+#include <DNSServer.h>
+
+class AsyncWiFiManager
+{
+    public:
+        AsyncWiFiManager(AsyncWebServer* server, DNSServer* dns) {}
+
+        bool autoConnect(const char* apName = "", const char* apPassword = nullptr, unsigned long maxConnectRetries = 1,
+            unsigned long retryDelayMs = 1000) { connects++; return true; }
+        bool startConfigPortal(const char* apName, const char* apPassword = nullptr) { return true; }
+        void resetSettings() { resets++; }
+
+        void setConnectTimeout(unsigned long seconds) {}
+        void setConfigPortalTimeout(unsigned long seconds) {}
+        void setDebugOutput(bool debug) {}
+        void setAPCallback(std::function<void(AsyncWiFiManager*)> callback) {}
+        void setSaveConfigCallback(std::function<void()> callback) {}
+
+        // how often the firmware connected and forgot the network
+        static unsigned long connects;
+        static unsigned long resets;
+};
+
+#endif // _fake_esp_async_wifi_manager_h
@@ -0,0 +1,201 @@
+#include <FS.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace fs
+{
+
+/**** File ****/
+
+File::File(const File& other)
+{
+    fd = other.fd >= 0 ? dup(other.fd) : -1;
+}
+
+File& File::operator=(const File& other)
+{
+    if(this != &other)
+    {
+        close();
+        fd = other.fd >= 0 ? dup(other.fd) : -1;
+    }
+    return *this;
+}
+
+size_t File::write(const uint8_t* buffer, size_t size)
+{
+    ssize_t written = fd >= 0 ? ::write(fd, buffer, size) : -1;
+    return written > 0 ? written : 0;
+}
+
+int File::available()
+{
+    return fd >= 0 ? size() - position() : 0;
+}
+
+size_t File::read(uint8_t* buffer, size_t size)
+{
+    ssize_t count = fd >= 0 ? ::read(fd, buffer, size) : -1;
+    return count > 0 ? count : 0;
+}
+
+int File::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek()
+{
+    int c = read();
+
+    if(c >= 0)
+    {
+        lseek(fd, -1, SEEK_CUR);
+    }
+    return c;
+}
+
+bool File::seek(uint32_t position, SeekMode mode)
+{
+    static const int whence[] = {SEEK_SET, SEEK_CUR, SEEK_END};
+    return fd >= 0 && lseek(fd, position, whence[mode]) >= 0;
+}
+
+size_t File::position() const
+{
+    off_t offset = fd >= 0 ? lseek(fd, 0, SEEK_CUR) : -1;
+    return offset > 0 ? offset : 0;
+}
+
+size_t File::size() const
+{
+    struct stat status;
+    return fd >= 0 && fstat(fd, &status) == 0 ? status.st_size : 0;
+}
+
+void File::close()
+{
+    if(fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+/**** FS ****/
+
+bool FS::begin()
+{
+    if(root[0] == 0)
+    {
+        strlcpy(root, "/tmp/spiffsXXXXXX", sizeof(root));
+        if(mkdtemp(root) == nullptr)
+        {
+            root[0] = 0;
+            return false;
+        }
+    }
+    return mkdir(root, 0700) == 0 || errno == EEXIST;
+}
+
+// SPIFFS is flat, the directory holds nothing but files
+bool FS::format()
+{
+    DIR* directory = opendir(root);
+    struct dirent* entry;
+    char path[FAKE_FS_PATH_LENGTH + sizeof(entry->d_name)];
+
+    if(root[0] == 0 || directory == nullptr)
+    {
+        return false;
+    }
+    while((entry = readdir(directory)) != nullptr)
+    {
+        if(entry->d_name[0] != '.')
+        {
+            snprintf(path, sizeof(path), "%s/%s", root, entry->d_name);
+            unlink(path);
+        }
+    }
+    closedir(directory);
+    return true;
+}
+
+// names keep their slashes on SPIFFS, they are escaped to stay in the one directory
+bool FS::hostPath(const char* path, char* buffer, size_t size)
+{
+    size_t length = snprintf(buffer, size, "%s/", root);
+
+    if(root[0] == 0 || path == nullptr || path[0] != '/')
+    {
+        return false;
+    }
+    for(path++; *path != 0 && length + 2 < size; path++)
+    {
+        buffer[length++] = *path == '/' ? '%' : *path;
+    }
+    buffer[length] = 0;
+    return *path == 0;
+}
+
+File FS::open(const char* path, const char* mode)
+{
+    char name[FAKE_FS_PATH_LENGTH * 2];
+    int flags;
+
+    if(!hostPath(path, name, sizeof(name)))
+    {
+        return File();
+    }
+
+    switch(mode[0])
+    {
+        case 'w':
+            flags = O_CREAT | O_TRUNC | (mode[1] == '+' ? O_RDWR : O_WRONLY);
+            break;
+        case 'a':
+            flags = O_CREAT | O_APPEND | (mode[1] == '+' ? O_RDWR : O_WRONLY);
+            break;
+        default:
+            flags = mode[1] == '+' ? O_RDWR : O_RDONLY;
+            break;
+    }
+    return File(::open(name, flags, 0600));
+}
+
+bool FS::exists(const char* path)
+{
+    char name[FAKE_FS_PATH_LENGTH * 2];
+    return hostPath(path, name, sizeof(name)) && access(name, F_OK) == 0;
+}
+
+bool FS::remove(const char* path)
+{
+    char name[FAKE_FS_PATH_LENGTH * 2];
+    return hostPath(path, name, sizeof(name)) && unlink(name) == 0;
+}
+
+// as SPIFFS, renaming onto an existing file fails
+bool FS::rename(const char* pathFrom, const char* pathTo)
+{
+    char from[FAKE_FS_PATH_LENGTH * 2];
+    char to[FAKE_FS_PATH_LENGTH * 2];
+
+    if(!hostPath(pathFrom, from, sizeof(from)) || !hostPath(pathTo, to, sizeof(to)))
+    {
+        return false;
+    }
+    if(access(to, F_OK) == 0)
+    {
+        return false;
+    }
+    return ::rename(from, to) == 0;
+}
+
+} // namespace fs
+
+fs::FS SPIFFS;
@@ -0,0 +1,89 @@
+#ifndef _fake_fs_h
+#define _fake_fs_h
+
+// SPIFFS kept in a directory on the host, a new one under /tmp for every run
+// unless a test gives it one. Files are plain descriptors so reading and
+// writing them costs no heap, as on the device.
+
+#include <Arduino.h>
+
+#define FAKE_FS_PATH_LENGTH     128
+
+namespace fs
+{
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class File : public Stream
+{
+    public:
+        File() : fd(-1) {}
+        explicit File(int fd) : fd(fd) {}
+        File(const File& other);
+        File& operator=(const File& other);
+        ~File() { close(); }
+
+        size_t write(uint8_t c) override { return write(&c, 1); }
+        size_t write(const uint8_t* buffer, size_t size) override;
+        using Print::write;
+        int available() override;
+        int read() override;
+        int peek() override;
+        size_t readBytes(char* buffer, size_t length) override { return read((uint8_t*)buffer, length); }
+        size_t read(uint8_t* buffer, size_t size);
+        void flush() override {}
+
+        bool seek(uint32_t position, SeekMode mode = SeekSet);
+        size_t position() const;
+        size_t size() const;
+        void close();
+        operator bool() const { return fd >= 0; }
+
+    private:
+        int fd;
+};
+
+class FS
+{
+    public:
+        FS() { root[0] = 0; }
+
+        bool begin();
+        void end() {}
+        bool format();
+        File open(const char* path, const char* mode);
+        File open(const String& path, const char* mode) { return open(path.c_str(), mode); }
+        bool exists(const char* path);
+        bool exists(const String& path) { return exists(path.c_str()); }
+        bool remove(const char* path);
+        bool remove(const String& path) { return remove(path.c_str()); }
+        bool rename(const char* pathFrom, const char* pathTo);
+        bool rename(const String& pathFrom, const String& pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+
+        // where the files are kept on the host, set before begin() to use another
+        void setRoot(const char* directory) { strlcpy(root, directory, sizeof(root)); }
+        const char* getRoot() const { return root; }
+
+    private:
+        bool hostPath(const char* path, char* buffer, size_t size);
+
+        char root[FAKE_FS_PATH_LENGTH];
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+extern fs::FS SPIFFS;
+
+#endif // _fake_fs_h
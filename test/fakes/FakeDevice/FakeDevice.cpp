@@ -0,0 +1,36 @@
+#include "FakeDevice.h"
+#include "FakeClock.h"
+#include "FakeNetwork.h"
+
+bool FakeDevice::booted = false;
+unsigned long FakeDevice::loops = 0;
+
+void FakeDevice::boot()
+{
+    if(booted)
+    {
+        return;
+    }
+    booted = true;
+
+    setup();
+
+    // the first loop connects and brings up the web server and tasks
+    runLoops(1);
+}
+
+void FakeDevice::run(unsigned long ms, unsigned long step)
+{
+    runLoops((ms + step - 1) / step, step);
+}
+
+void FakeDevice::runLoops(unsigned long count, unsigned long step)
+{
+    for(unsigned long i=0; i<count; i++)
+    {
+        loop();
+        FakeNetwork::run();
+        FakeClock::advance(step);
+        loops++;
+    }
+}
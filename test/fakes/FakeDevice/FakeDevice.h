@@ -0,0 +1,30 @@
+#ifndef _fake_device_h
+#define _fake_device_h
+
+#include <Arduino.h>
+
+#define FAKE_DEVICE_STEP        10      // ms the clock moves between loop() calls
+
+// the firmware, from src/PrintMonitor.cpp
+void setup();
+void loop();
+
+// Runs the firmware on the fakes. Its globals are set up once per test program,
+// so tests in one program share a device and boot() only starts it the first time.
+class FakeDevice
+{
+    public:
+        static void boot();
+        static bool isBooted() { return booted; }
+
+        // loop() every step, socket events delivered after each call and the clock moved on
+        static void run(unsigned long ms, unsigned long step = FAKE_DEVICE_STEP);
+        static void runLoops(unsigned long count, unsigned long step = FAKE_DEVICE_STEP);
+        static unsigned long getLoops() { return loops; }
+
+    private:
+        static bool booted;
+        static unsigned long loops;
+};
+
+#endif // _fake_device_h
@@ -0,0 +1,489 @@
+#include "FakeHttpServer.h"
+#include "Fixtures.h"
+
+FakeHttpServer::FakeHttpServer(const char* host, uint16_t port)
+{
+    routeCount = 0;
+    segment = FAKE_NETWORK_SEGMENT;
+    keepAlive = true;
+    silent = false;
+    webSocketPath[0] = 0;
+    requests = 0;
+    connections = 0;
+    socketMessages = 0;
+    lastRequest[0] = 0;
+    lastSocketMessage[0] = 0;
+
+    for(int i=0; i<FAKE_HTTP_CONNECTIONS; i++)
+    {
+        connectionList[i].client = nullptr;
+    }
+
+    FakeNetwork::listen(host, port, this);
+}
+
+FakeHttpServer::~FakeHttpServer()
+{
+    FakeNetwork::unlisten(this);
+}
+
+/**** Routes ****/
+
+// replaces the reply for the same method and path
+bool FakeHttpServer::route(const char* method, const char* path, const char* response)
+{
+    FakeHttpRoute* route = nullptr;
+    const char* headEnd = strstr(response, "\n\n");
+    const char* crlfEnd = strstr(response, "\r\n\r\n");
+    const char* body;
+    bool chunked = false;
+    bool hasLength = false;
+
+    for(int i=0; i<routeCount; i++)
+    {
+        if(strcmp(routes[i].method, method) == 0 && strcmp(routes[i].path, path) == 0)
+        {
+            route = &routes[i];
+        }
+    }
+    if(route == nullptr)
+    {
+        if(routeCount == FAKE_HTTP_ROUTES)
+        {
+            fprintf(stderr, "FakeHttpServer: too many routes\n");
+            return false;
+        }
+        route = &routes[routeCount++];
+        route->hits = 0;
+    }
+
+    strlcpy(route->method, method, sizeof(route->method));
+    strlcpy(route->path, path, sizeof(route->path));
+
+    if(crlfEnd != nullptr && (headEnd == nullptr || crlfEnd < headEnd))
+    {
+        headEnd = crlfEnd + 2;
+        body = crlfEnd + 4;
+    }
+    else if(headEnd != nullptr)
+    {
+        body = headEnd + 2;
+    }
+    else
+    {
+        headEnd = response + strlen(response);
+        body = headEnd;
+    }
+
+    // head lines end in CRLF whatever the fixture used
+    route->headLength = 0;
+    for(const char* line = response; line < headEnd; )
+    {
+        const char* end = (const char*)memchr(line, '\n', headEnd - line);
+        size_t length = (end != nullptr ? end : headEnd) - line;
+
+        if(length > 0 && line[length - 1] == '\r')
+        {
+            length--;
+        }
+        if(length > 0)
+        {
+            if(route->headLength + length + 2 >= sizeof(route->head))
+            {
+                fprintf(stderr, "FakeHttpServer: reply head too long\n");
+                return false;
+            }
+            memcpy(&route->head[route->headLength], line, length);
+            route->headLength += length;
+            route->head[route->headLength++] = '\r';
+            route->head[route->headLength++] = '\n';
+            route->head[route->headLength] = 0;
+
+            if(strncasecmp(line, "Transfer-Encoding:", 18) == 0 && strcasestr(line, "chunked") != nullptr)
+            {
+                chunked = true;
+            }
+            if(strncasecmp(line, "Content-Length:", 15) == 0)
+            {
+                hasLength = true;
+            }
+        }
+        line = end != nullptr ? end + 1 : headEnd;
+    }
+
+    size_t bodyLength = strlen(body);
+    route->bodyLength = 0;
+
+    if(chunked)
+    {
+        for(size_t i=0; i<bodyLength; i+=FAKE_HTTP_CHUNK_SIZE)
+        {
+            size_t count = min((size_t)FAKE_HTTP_CHUNK_SIZE, bodyLength - i);
+
+            if(route->bodyLength + count + 16 >= sizeof(route->body))
+            {
+                fprintf(stderr, "FakeHttpServer: reply body too long\n");
+                return false;
+            }
+            route->bodyLength += snprintf(&route->body[route->bodyLength], 16, "%zx\r\n", count);
+            memcpy(&route->body[route->bodyLength], &body[i], count);
+            route->bodyLength += count;
+            memcpy(&route->body[route->bodyLength], "\r\n", 2);
+            route->bodyLength += 2;
+        }
+        memcpy(&route->body[route->bodyLength], "0\r\n\r\n", 5);
+        route->bodyLength += 5;
+    }
+    else
+    {
+        if(bodyLength >= sizeof(route->body))
+        {
+            fprintf(stderr, "FakeHttpServer: reply body too long\n");
+            return false;
+        }
+        memcpy(route->body, body, bodyLength);
+        route->bodyLength = bodyLength;
+
+        if(!hasLength)
+        {
+            route->headLength += snprintf(&route->head[route->headLength], sizeof(route->head) - route->headLength,
+                "Content-Length: %zu\r\n", bodyLength);
+        }
+    }
+
+    return true;
+}
+
+bool FakeHttpServer::routeFixture(const char* method, const char* path, const char* fixture)
+{
+    static char response[FAKE_HTTP_HEAD_SIZE + FAKE_HTTP_BODY_SIZE];
+
+    return Fixtures::load(fixture, response, sizeof(response)) > 0 && route(method, path, response);
+}
+
+FakeHttpRoute* FakeHttpServer::match(const char* method, const char* target)
+{
+    for(int i=0; i<routeCount; i++)
+    {
+        FakeHttpRoute* route = &routes[i];
+        size_t length = strlen(route->path);
+
+        if(strcmp(route->method, method) != 0)
+        {
+            continue;
+        }
+        if(length > 0 && route->path[length - 1] == '*' ? strncmp(route->path, target, length - 1) == 0 : strcmp(route->path, target) == 0)
+        {
+            return route;
+        }
+    }
+    return nullptr;
+}
+
+unsigned long FakeHttpServer::getHits(const char* method, const char* path)
+{
+    for(int i=0; i<routeCount; i++)
+    {
+        if(strcmp(routes[i].method, method) == 0 && strcmp(routes[i].path, path) == 0)
+        {
+            return routes[i].hits;
+        }
+    }
+    return 0;
+}
+
+/**** Connections ****/
+
+FakeHttpConnection* FakeHttpServer::find(AsyncClient* client)
+{
+    for(int i=0; i<FAKE_HTTP_CONNECTIONS; i++)
+    {
+        if(connectionList[i].client == client)
+        {
+            return &connectionList[i];
+        }
+    }
+    return nullptr;
+}
+
+void FakeHttpServer::onAccept(AsyncClient* client)
+{
+    FakeHttpConnection* connection = find(client);
+
+    if(connection == nullptr)
+    {
+        connection = find(nullptr);
+    }
+    if(connection == nullptr)
+    {
+        fprintf(stderr, "FakeHttpServer: too many connections\n");
+        abort();
+    }
+
+    connection->client = client;
+    connection->webSocket = false;
+    connection->length = 0;
+    connections++;
+}
+
+void FakeHttpServer::onClose(AsyncClient* client)
+{
+    FakeHttpConnection* connection = find(client);
+
+    if(connection != nullptr)
+    {
+        connection->client = nullptr;
+    }
+}
+
+void FakeHttpServer::onReceive(AsyncClient* client, const uint8_t* data, size_t length)
+{
+    FakeHttpConnection* connection = find(client);
+    size_t used;
+
+    if(connection == nullptr)
+    {
+        return;
+    }
+    if(connection->length + length > sizeof(connection->request))
+    {
+        fprintf(stderr, "FakeHttpServer: request too long\n");
+        abort();
+    }
+
+    memcpy(&connection->request[connection->length], data, length);
+    connection->length += length;
+
+    do
+    {
+        used = connection->webSocket ? handleFrame(connection) : handleRequest(connection);
+        if(used > 0 && connection->client != nullptr)
+        {
+            memmove(connection->request, &connection->request[used], connection->length - used);
+            connection->length -= used;
+        }
+    } while(used > 0 && connection->client != nullptr && connection->length > 0);
+}
+
+void FakeHttpServer::hangUpAll()
+{
+    for(int i=0; i<FAKE_HTTP_CONNECTIONS; i++)
+    {
+        if(connectionList[i].client != nullptr)
+        {
+            FakeNetwork::hangUp(connectionList[i].client);
+            connectionList[i].client = nullptr;
+        }
+    }
+}
+
+// bytes used by a complete request, 0 until all of it has arrived
+size_t FakeHttpServer::handleRequest(FakeHttpConnection* connection)
+{
+    char method[8];
+    char target[FAKE_HTTP_PATH_SIZE];
+    char* request = connection->request;
+    const char* headEnd;
+    const char* contentLength;
+    size_t headLength;
+    size_t length;
+    bool close;
+    FakeHttpRoute* route;
+
+    request[connection->length < sizeof(connection->request) ? connection->length : sizeof(connection->request) - 1] = 0;
+    headEnd = strstr(request, "\r\n\r\n");
+    if(headEnd == nullptr)
+    {
+        return 0;
+    }
+
+    headLength = headEnd + 4 - request;
+    contentLength = strcasestr(request, "\r\nContent-Length:");
+    length = headLength + (contentLength != nullptr && contentLength < headEnd ? atol(contentLength + 17) : 0);
+    if(connection->length < length)
+    {
+        return 0;
+    }
+
+    requests++;
+    memcpy(lastRequest, request, min(headLength, sizeof(lastRequest) - 1));
+    lastRequest[min(headLength, sizeof(lastRequest) - 1)] = 0;
+
+    if(sscanf(request, "%7s %127s", method, target) != 2)
+    {
+        FakeNetwork::reply(connection->client, "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n", segment);
+        FakeNetwork::hangUp(connection->client);
+        connection->client = nullptr;
+        return length;
+    }
+
+    if(webSocketPath[0] != 0 && strcmp(target, webSocketPath) == 0 && strcasestr(lastRequest, "\r\nUpgrade: websocket") != nullptr)
+    {
+        upgrade(connection);
+        return length;
+    }
+
+    if(silent)
+    {
+        return length;
+    }
+
+    close = !keepAlive || strcasestr(lastRequest, "\r\nConnection: close") != nullptr;
+    route = match(method, target);
+
+    if(route == nullptr)
+    {
+        FakeNetwork::reply(connection->client, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n", segment);
+    }
+    else
+    {
+        route->hits++;
+        FakeNetwork::reply(connection->client, (const uint8_t*)route->head, route->headLength, segment);
+    }
+    FakeNetwork::reply(connection->client, close ? "Connection: close\r\n\r\n" : "\r\n", segment);
+    if(route != nullptr && route->bodyLength > 0)
+    {
+        FakeNetwork::reply(connection->client, (const uint8_t*)route->body, route->bodyLength, segment);
+    }
+
+    if(close)
+    {
+        FakeNetwork::hangUp(connection->client);
+        connection->client = nullptr;
+    }
+    return length;
+}
+
+/**** WebSocket ****/
+
+// the client doesn't check the accept key, so it isn't worked out
+void FakeHttpServer::upgrade(FakeHttpConnection* connection)
+{
+    FakeNetwork::reply(connection->client,
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n"
+        "\r\n", segment);
+    connection->webSocket = true;
+}
+
+// one client frame, always masked, 0 until all of it has arrived
+size_t FakeHttpServer::handleFrame(FakeHttpConnection* connection)
+{
+    uint8_t* data = (uint8_t*)connection->request;
+    size_t header = 2;
+    size_t length;
+    uint8_t opcode;
+    uint8_t* mask;
+
+    if(connection->length < 2)
+    {
+        return 0;
+    }
+
+    opcode = data[0] & 0x0f;
+    length = data[1] & 0x7f;
+    if(length == 126)
+    {
+        if(connection->length < 4)
+        {
+            return 0;
+        }
+        length = (data[2] << 8) | data[3];
+        header = 4;
+    }
+    else if(length == 127)
+    {
+        fprintf(stderr, "FakeHttpServer: client frame too long\n");
+        abort();
+    }
+
+    if((data[1] & 0x80) == 0)
+    {
+        fprintf(stderr, "FakeHttpServer: client frame not masked\n");
+        abort();
+    }
+    mask = &data[header];
+    header += 4;
+
+    if(connection->length < header + length)
+    {
+        return 0;
+    }
+
+    for(size_t i=0; i<length; i++)
+    {
+        data[header + i] ^= mask[i & 3];
+    }
+
+    if(opcode == 0x1)
+    {
+        size_t kept = min(length, (size_t)FAKE_WEBSOCKET_MESSAGE);
+
+        memcpy(lastSocketMessage, &data[header], kept);
+        lastSocketMessage[kept] = 0;
+        socketMessages++;
+    }
+    else if(opcode == 0x8)
+    {
+        FakeNetwork::hangUp(connection->client);
+        connection->client = nullptr;
+    }
+
+    return header + length;
+}
+
+int FakeHttpServer::pushFrame(uint8_t opcode, const char* payload, size_t length, bool final)
+{
+    uint8_t header[10];
+    size_t headerLength = 0;
+    int pushed = 0;
+
+    header[headerLength++] = (final ? 0x80 : 0) | opcode;
+    if(length < 126)
+    {
+        header[headerLength++] = length;
+    }
+    else if(length < 65536)
+    {
+        header[headerLength++] = 126;
+        header[headerLength++] = length >> 8;
+        header[headerLength++] = length & 0xff;
+    }
+    else
+    {
+        header[headerLength++] = 127;
+        for(int i=7; i>=0; i--)
+        {
+            header[headerLength++] = ((uint64_t)length >> (i * 8)) & 0xff;
+        }
+    }
+
+    for(int i=0; i<FAKE_HTTP_CONNECTIONS; i++)
+    {
+        FakeHttpConnection* connection = &connectionList[i];
+
+        if(connection->client != nullptr && connection->webSocket)
+        {
+            FakeNetwork::reply(connection->client, header, headerLength, segment);
+            FakeNetwork::reply(connection->client, (const uint8_t*)payload, length, segment);
+            pushed++;
+        }
+    }
+    return pushed;
+}
+
+int FakeHttpServer::getOpenSockets()
+{
+    int open = 0;
+
+    for(int i=0; i<FAKE_HTTP_CONNECTIONS; i++)
+    {
+        if(connectionList[i].client != nullptr && connectionList[i].webSocket)
+        {
+            open++;
+        }
+    }
+    return open;
+}
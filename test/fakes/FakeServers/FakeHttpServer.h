@@ -0,0 +1,96 @@
+#ifndef _fake_http_server_h
+#define _fake_http_server_h
+
+#include <Arduino.h>
+#include <ESPAsyncTCP.h>
+
+#define FAKE_HTTP_ROUTES            8
+#define FAKE_HTTP_CONNECTIONS       8
+#define FAKE_HTTP_PATH_SIZE         128
+#define FAKE_HTTP_HEAD_SIZE         512
+#define FAKE_HTTP_BODY_SIZE         16384
+#define FAKE_HTTP_REQUEST_SIZE      2048
+#define FAKE_HTTP_CHUNK_SIZE        256     // chunked fixtures are sent in chunks this big
+#define FAKE_WEBSOCKET_MESSAGE      512     // longest client message kept
+
+typedef struct FakeHttpRoute
+{
+    char method[8];
+    char path[FAKE_HTTP_PATH_SIZE];     // a trailing * matches any rest, query included
+    char head[FAKE_HTTP_HEAD_SIZE];     // status line and headers, each ending in CRLF
+    size_t headLength;
+    char body[FAKE_HTTP_BODY_SIZE];     // as sent, already chunked if the head says so
+    size_t bodyLength;
+    unsigned long hits;
+} FakeHttpRoute;
+
+typedef struct FakeHttpConnection
+{
+    AsyncClient* client;
+    bool webSocket;
+    char request[FAKE_HTTP_REQUEST_SIZE];
+    size_t length;
+} FakeHttpConnection;
+
+// HTTP/1.1 server for the fake network answering each request with the reply
+// routed for its method and path, 404 otherwise. Replies are copied in when
+// routed and served from fixed buffers, so serving costs no heap and doesn't
+// show up in heap figures. One path can be a websocket for OctoPrint's push
+// socket, server frames are pushed to every socket open on it.
+class FakeHttpServer : public FakeServer
+{
+    public:
+        FakeHttpServer(const char* host, uint16_t port);
+        ~FakeHttpServer();
+
+        // response holds the status line, headers and body with LF or CRLF line ends.
+        // Content-Length is added, or the body is chunked for Transfer-Encoding: chunked
+        bool route(const char* method, const char* path, const char* response);
+        bool routeFixture(const char* method, const char* path, const char* fixture);
+        void clearRoutes() { routeCount = 0; }
+
+        void setSegmentSize(size_t segment) { this->segment = segment; }
+        void setKeepAlive(bool keepAlive) { this->keepAlive = keepAlive; }
+        void setSilent(bool silent) { this->silent = silent; }      // takes requests without answering
+
+        void setWebSocket(const char* path) { strlcpy(webSocketPath, path, sizeof(webSocketPath)); }
+        int pushFrame(uint8_t opcode, const char* payload, size_t length, bool final = true);
+        int pushText(const char* text) { return pushFrame(0x1, text, strlen(text)); }
+        int getOpenSockets();
+        unsigned long getSocketMessages() { return socketMessages; }
+        const char* getLastSocketMessage() { return lastSocketMessage; }
+
+        unsigned long getRequests() { return requests; }
+        unsigned long getConnections() { return connections; }
+        unsigned long getHits(const char* method, const char* path);
+        const char* getLastRequest() { return lastRequest; }   // request line and headers
+        void hangUpAll();
+
+        void onAccept(AsyncClient* client) override;
+        void onReceive(AsyncClient* client, const uint8_t* data, size_t length) override;
+        void onClose(AsyncClient* client) override;
+
+    private:
+        FakeHttpConnection* find(AsyncClient* client);
+        size_t handleRequest(FakeHttpConnection* connection);
+        size_t handleFrame(FakeHttpConnection* connection);
+        void upgrade(FakeHttpConnection* connection);
+        FakeHttpRoute* match(const char* method, const char* target);
+
+        FakeHttpRoute routes[FAKE_HTTP_ROUTES];
+        int routeCount;
+        FakeHttpConnection connectionList[FAKE_HTTP_CONNECTIONS];
+
+        size_t segment;
+        bool keepAlive;
+        bool silent;
+        char webSocketPath[FAKE_HTTP_PATH_SIZE];
+
+        unsigned long requests;
+        unsigned long connections;
+        unsigned long socketMessages;
+        char lastRequest[FAKE_HTTP_REQUEST_SIZE];
+        char lastSocketMessage[FAKE_WEBSOCKET_MESSAGE + 1];
+};
+
+#endif // _fake_http_server_h
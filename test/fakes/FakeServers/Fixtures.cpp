@@ -0,0 +1,29 @@
+#include <stdio.h>
+#include "Fixtures.h"
+
+size_t Fixtures::load(const char* name, char* buffer, size_t size)
+{
+    char path[256];
+    FILE* file;
+    size_t length;
+
+    snprintf(path, sizeof(path), "%s/%s", FAKE_FIXTURES_DIR, name);
+    file = fopen(path, "rb");
+    if(file == nullptr)
+    {
+        fprintf(stderr, "Fixtures: can't open %s\n", path);
+        return 0;
+    }
+
+    length = fread(buffer, 1, size, file);
+    fclose(file);
+
+    if(length >= size)
+    {
+        fprintf(stderr, "Fixtures: %s is bigger than %zu bytes\n", path, size - 1);
+        return 0;
+    }
+
+    buffer[length] = 0;
+    return length;
+}
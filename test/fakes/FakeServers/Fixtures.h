@@ -0,0 +1,18 @@
+#ifndef _fixtures_h
+#define _fixtures_h
+
+#include <stddef.h>
+
+// recorded replies and payloads under test/fixtures, pio runs tests from the project
+#ifndef FAKE_FIXTURES_DIR
+#define FAKE_FIXTURES_DIR       "test/fixtures"
+#endif
+
+class Fixtures
+{
+    public:
+        // the whole file null terminated, 0 if it is missing or doesn't fit
+        static size_t load(const char* name, char* buffer, size_t size);
+};
+
+#endif // _fixtures_h
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <TFT_eSPI.h>
+#include "Goldens.h"
+
+int Goldens::firstX = -1;
+int Goldens::firstY = -1;
+
+static void put16(uint8_t* buffer, uint16_t value)
+{
+    buffer[0] = value;
+    buffer[1] = value >> 8;
+}
+
+static void put32(uint8_t* buffer, uint32_t value)
+{
+    put16(buffer, value);
+    put16(buffer + 2, value >> 16);
+}
+
+// a top down BI_BITFIELDS bitmap, rows of 16 bit pixels need no padding for even widths
+static void makeHeader(uint8_t* header, int width, int height)
+{
+    uint32_t imageSize = width * height * 2;
+
+    memset(header, 0, GOLDEN_HEADER_SIZE);
+    header[0] = 'B';
+    header[1] = 'M';
+    put32(header + 2, GOLDEN_HEADER_SIZE + imageSize);
+    put32(header + 10, GOLDEN_HEADER_SIZE);
+    put32(header + 14, 40);
+    put32(header + 18, width);
+    put32(header + 22, -height);
+    put16(header + 26, 1);
+    put16(header + 28, 16);
+    put32(header + 30, 3);
+    put32(header + 34, imageSize);
+    put32(header + 38, 2835);       // 72 dpi
+    put32(header + 42, 2835);
+    put32(header + 54, 0xF800);
+    put32(header + 58, 0x07E0);
+    put32(header + 62, 0x001F);
+}
+
+bool Goldens::save(const char* path, const uint16_t* frame, int width, int height)
+{
+    uint8_t header[GOLDEN_HEADER_SIZE];
+    uint8_t row[TFT_HEIGHT * 2];
+    FILE* file = fopen(path, "wb");
+
+    if(file == nullptr || width > TFT_HEIGHT)
+    {
+        fprintf(stderr, "Goldens: can't write %s\n", path);
+        if(file != nullptr)
+        {
+            fclose(file);
+        }
+        return false;
+    }
+
+    makeHeader(header, width, height);
+    fwrite(header, 1, sizeof(header), file);
+
+    for(int y=0; y<height; y++)
+    {
+        for(int x=0; x<width; x++)
+        {
+            put16(&row[x * 2], frame[y * width + x]);
+        }
+        fwrite(row, 2, width, file);
+    }
+
+    return fclose(file) == 0;
+}
+
+bool Goldens::load(const char* path, uint16_t* frame, int width, int height)
+{
+    uint8_t expected[GOLDEN_HEADER_SIZE];
+    uint8_t header[GOLDEN_HEADER_SIZE];
+    uint8_t row[TFT_HEIGHT * 2];
+    FILE* file = fopen(path, "rb");
+
+    if(file == nullptr)
+    {
+        return false;
+    }
+
+    // only what save() writes is read back, a golden in any other shape is a failure
+    makeHeader(expected, width, height);
+    bool valid = width <= TFT_HEIGHT && fread(header, 1, sizeof(header), file) == sizeof(header) && memcmp(header, expected, sizeof(header)) == 0;
+
+    for(int y=0; valid && y<height; y++)
+    {
+        valid = fread(row, 2, width, file) == (size_t)width;
+        for(int x=0; valid && x<width; x++)
+        {
+            frame[y * width + x] = row[x * 2] | (row[x * 2 + 1] << 8);
+        }
+    }
+
+    fclose(file);
+    if(!valid)
+    {
+        fprintf(stderr, "Goldens: %s isn't a %dx%d RGB565 bitmap\n", path, width, height);
+    }
+    return valid;
+}
+
+long Goldens::compare(const char* name)
+{
+    static uint16_t golden[TFT_WIDTH * TFT_HEIGHT];
+    const uint16_t* frame = FakePanel::getFrame();
+    int width = FakePanel::getWidth();
+    int height = FakePanel::getHeight();
+    char path[256];
+    long differences = 0;
+
+    firstX = firstY = -1;
+
+    snprintf(path, sizeof(path), "%s/%s.bmp", FAKE_GOLDENS_DIR, name);
+    if(getenv("UPDATE_GOLDENS") != nullptr)
+    {
+        return save(path, frame, width, height) ? 0 : -1;
+    }
+    if(!load(path, golden, width, height))
+    {
+        fprintf(stderr, "Goldens: no golden %s, run with UPDATE_GOLDENS=1 to make it\n", path);
+        return -1;
+    }
+
+    for(int i=0; i<width * height; i++)
+    {
+        if(frame[i] != golden[i])
+        {
+            if(differences++ == 0)
+            {
+                firstX = i % width;
+                firstY = i / width;
+            }
+        }
+    }
+
+    if(differences > 0)
+    {
+        snprintf(path, sizeof(path), "%s/%s.actual.bmp", FAKE_GOLDENS_DIR, name);
+        save(path, frame, width, height);
+    }
+    return differences;
+}
@@ -0,0 +1,33 @@
+#ifndef _goldens_h
+#define _goldens_h
+
+#include <Arduino.h>
+
+// reference screens under test/goldens, pio runs tests from the project
+#ifndef FAKE_GOLDENS_DIR
+#define FAKE_GOLDENS_DIR        "test/goldens"
+#endif
+
+#define GOLDEN_HEADER_SIZE      66      // file header, info header and the RGB565 masks
+
+// Compares the fake panel with a golden image, a 16 bit RGB565 BMP any viewer
+// opens. A screen that differs is written next to it as <name>.actual.bmp.
+// Run with UPDATE_GOLDENS=1 in the environment to write the goldens instead,
+// after checking the change to the screen is meant.
+class Goldens
+{
+    public:
+        // pixels that differ, -1 if there is no golden to compare with
+        static long compare(const char* name);
+        static int getFirstX() { return firstX; }
+        static int getFirstY() { return firstY; }
+
+        static bool save(const char* path, const uint16_t* frame, int width, int height);
+        static bool load(const char* path, uint16_t* frame, int width, int height);
+
+    private:
+        static int firstX;
+        static int firstY;
+};
+
+#endif // _goldens_h
@@ -0,0 +1,3 @@
+#include <NTPClient.h>
+
+unsigned long NTPClient::startEpoch = FAKE_NTP_EPOCH;
@@ -0,0 +1,43 @@
+#ifndef _fake_ntp_client_h
+#define _fake_ntp_client_h
+
+// network time without the network, the epoch follows millis() from a start
+// a test can set
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#define FAKE_NTP_EPOCH      1609459200UL    // 2021-01-01 00:00:00 UTC, at millis() 0
+
+class NTPClient
+{
+    public:
+        NTPClient(WiFiUDP& udp, const char* poolServerName, long timeOffset = 0, unsigned long updateInterval = 60000) :
+            timeOffset(timeOffset), updates(0) {}
+
+        void begin() {}
+        void end() {}
+        bool update() { updates++; return true; }
+        bool forceUpdate() { return update(); }
+        void setTimeOffset(int timeOffset) { this->timeOffset = timeOffset; }
+        void setUpdateInterval(unsigned long updateInterval) {}
+
+        unsigned long getEpochTime() const { return startEpoch + timeOffset + millis() / 1000; }
+        int getDay() const { return ((getEpochTime() / 86400L) + 4) % 7; }
+        int getHours() const { return (getEpochTime() % 86400L) / 3600; }
+        int getMinutes() const { return (getEpochTime() % 3600) / 60; }
+        int getSeconds() const { return getEpochTime() % 60; }
+
+        unsigned long getUpdates() const { return updates; }
+
+        // UTC time at millis() 0
+        static void setFakeEpoch(unsigned long epoch) { startEpoch = epoch; }
+
+    private:
+        long timeOffset;
+        unsigned long updates;
+
+        static unsigned long startEpoch;
+};
+
+#endif // _fake_ntp_client_h
@@ -0,0 +1,657 @@
+#include "TFT_eSPI.h"
+
+// the panel isn't on the ESP heap, only sprites are
+static uint16_t panelFrame[TFT_WIDTH * TFT_HEIGHT];
+
+TFT_eSPI* FakePanel::panel = nullptr;
+
+static uint16_t swap16(uint16_t colour)
+{
+    return (colour >> 8) | (colour << 8);
+}
+
+TFT_eSPI::TFT_eSPI(int16_t width, int16_t height)
+{
+    frame = nullptr;
+    _init_width = _width = width;
+    _init_height = _height = height;
+    rotation = 0;
+    swapBytes = false;
+    padX = 0;
+    cursor_x = cursor_y = 0;
+    pixelsWritten = 0;
+    trianglesDrawn = 0;
+
+    textfont = 1;
+    textsize = 1;
+    textdatum = TL_DATUM;
+    textcolor = textbgcolor = TFT_WHITE;
+}
+
+void TFT_eSPI::init(uint8_t tabColour)
+{
+    frame = panelFrame;
+    FakePanel::panel = this;
+}
+
+void TFT_eSPI::setRotation(uint8_t rotation)
+{
+    this->rotation = rotation % 4;
+    _width = this->rotation & 1 ? _init_height : _init_width;
+    _height = this->rotation & 1 ? _init_width : _init_height;
+}
+
+/**** Pixels ****/
+
+void TFT_eSPI::plot(int32_t x, int32_t y, uint16_t colour)
+{
+    if(frame == nullptr || x < 0 || y < 0 || x >= _width || y >= _height)
+    {
+        return;
+    }
+    frame[y * _width + x] = colour;
+    pixelsWritten++;
+}
+
+void TFT_eSPI::span(int32_t x, int32_t y, int32_t w, uint16_t colour)
+{
+    if(frame == nullptr || y < 0 || y >= _height)
+    {
+        return;
+    }
+    if(x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if(x + w > _width)
+    {
+        w = _width - x;
+    }
+    for(int32_t i = 0; i < w; i++)
+    {
+        frame[y * _width + x + i] = colour;
+    }
+    pixelsWritten += w > 0 ? w : 0;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t colour)
+{
+    plot(x, y, colour);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y)
+{
+    if(frame == nullptr || x < 0 || y < 0 || x >= _width || y >= _height)
+    {
+        return 0;
+    }
+    return frame[y * _width + x];
+}
+
+void TFT_eSPI::fillScreen(uint32_t colour)
+{
+    fillRect(0, 0, _width, _height, colour);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour)
+{
+    for(int32_t row = 0; row < h; row++)
+    {
+        span(x, y + row, w, colour);
+    }
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour)
+{
+    drawFastHLine(x, y, w, colour);
+    drawFastHLine(x, y + h - 1, w, colour);
+    drawFastVLine(x, y + 1, h - 2, colour);
+    drawFastVLine(x + w - 1, y + 1, h - 2, colour);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t colour)
+{
+    span(x, y, w, colour);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t colour)
+{
+    for(int32_t row = 0; row < h; row++)
+    {
+        plot(x, y + row, colour);
+    }
+}
+
+// Bresenham, as the real library
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t colour)
+{
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+
+    if(steep)
+    {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if(x0 > x1)
+    {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    int32_t dx = x1 - x0;
+    int32_t dy = abs(y1 - y0);
+    int32_t err = dx >> 1;
+    int32_t ystep = y0 < y1 ? 1 : -1;
+
+    for(; x0 <= x1; x0++)
+    {
+        if(steep)
+        {
+            plot(y0, x0, colour);
+        }
+        else
+        {
+            plot(x0, y0, colour);
+        }
+        err -= dy;
+        if(err < 0)
+        {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour)
+{
+    drawLine(x0, y0, x1, y1, colour);
+    drawLine(x1, y1, x2, y2, colour);
+    drawLine(x2, y2, x0, y0, colour);
+}
+
+// the real library's scanline fill, so arcs cover the same pixels
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour)
+{
+    int32_t a, b, y, last;
+
+    trianglesDrawn++;
+
+    if(y0 > y1)
+    {
+        std::swap(y0, y1);
+        std::swap(x0, x1);
+    }
+    if(y1 > y2)
+    {
+        std::swap(y2, y1);
+        std::swap(x2, x1);
+    }
+    if(y0 > y1)
+    {
+        std::swap(y0, y1);
+        std::swap(x0, x1);
+    }
+
+    if(y0 == y2)
+    {
+        a = b = x0;
+        a = std::min(a, std::min(x1, x2));
+        b = std::max(b, std::max(x1, x2));
+        span(a, y0, b - a + 1, colour);
+        return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+
+    last = y1 == y2 ? y1 : y1 - 1;
+
+    for(y = y0; y <= last; y++)
+    {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if(a > b)
+        {
+            std::swap(a, b);
+        }
+        span(a, y, b - a + 1, colour);
+    }
+
+    sa = dx12 * (y - y1);
+    sb = dx02 * (y - y0);
+    for(; y <= y2; y++)
+    {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if(a > b)
+        {
+            std::swap(a, b);
+        }
+        span(a, y, b - a + 1, colour);
+    }
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t colour)
+{
+    int32_t x = 0, y = r, f = 1 - r;
+
+    while(x <= y)
+    {
+        plot(x0 + x, y0 + y, colour);
+        plot(x0 - x, y0 + y, colour);
+        plot(x0 + x, y0 - y, colour);
+        plot(x0 - x, y0 - y, colour);
+        plot(x0 + y, y0 + x, colour);
+        plot(x0 - y, y0 + x, colour);
+        plot(x0 + y, y0 - x, colour);
+        plot(x0 - y, y0 - x, colour);
+        x++;
+        if(f < 0)
+        {
+            f += 2 * x + 1;
+        }
+        else
+        {
+            y--;
+            f += 2 * (x - y) + 1;
+        }
+    }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t colour)
+{
+    for(int32_t y = -r; y <= r; y++)
+    {
+        int32_t x = (int32_t)sqrt((double)(r * r - y * y));
+        span(x0 - x, y0 + y, 2 * x + 1, colour);
+    }
+}
+
+/**** Images ****/
+
+// with swapped bytes the data holds the colours themselves, else it is sent as
+// it lies in memory and the panel sees every colour with its bytes swapped
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data)
+{
+    for(int32_t row = 0; row < h; row++)
+    {
+        for(int32_t column = 0; column < w; column++)
+        {
+            uint16_t colour = data[row * w + column];
+            plot(x + column, y + row, swapBytes ? colour : swap16(colour));
+        }
+    }
+}
+
+void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data)
+{
+    bool swap = swapBytes;
+
+    swapBytes = false;
+    pushImage(x, y, w, h, data);
+    swapBytes = swap;
+}
+
+// the panel hands back its bytes in the order pushRect() takes them
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data)
+{
+    for(int32_t row = 0; row < h; row++)
+    {
+        for(int32_t column = 0; column < w; column++)
+        {
+            data[row * w + column] = swap16(readPixel(x + column, y + row));
+        }
+    }
+}
+
+/**** Text ****/
+
+static const FakeFontInfo& fontInfo(uint8_t font)
+{
+    return fakeFonts[font < FAKE_FONTS ? font : 2];
+}
+
+// first and last columns of a glyph with any pixels in them
+static void glyphColumns(uint8_t c, bool proportional, int& first, int& last)
+{
+    const uint8_t* columns = fakeGlyphs[c - ' '];
+
+    first = 0;
+    last = FAKE_FONT_COLUMNS - 1;
+    if(!proportional)
+    {
+        return;
+    }
+    while(first < last && columns[first] == 0)
+    {
+        first++;
+    }
+    while(last > first && columns[last] == 0)
+    {
+        last--;
+    }
+}
+
+int16_t TFT_eSPI::glyphAdvance(uint8_t c, uint8_t font)
+{
+    const FakeFontInfo& info = fontInfo(font);
+    int first, last;
+
+    if(c == ' ')
+    {
+        return info.spaceAdvance * textsize;
+    }
+    if(c < ' ' || c > '~')
+    {
+        return 0;   // no glyph, as the real fonts
+    }
+    if(!info.proportional)
+    {
+        return 6 * info.scaleX * textsize;
+    }
+
+    glyphColumns(c, true, first, last);
+    return (last - first + 2) * info.scaleX * textsize;
+}
+
+void TFT_eSPI::drawGlyph(uint8_t c, int32_t x, int32_t y, uint8_t font, bool fillBackground)
+{
+    const FakeFontInfo& info = fontInfo(font);
+    int16_t advance = glyphAdvance(c, font);
+    int sx = info.scaleX * textsize;
+    int sy = info.scaleY * textsize;
+    int first, last;
+
+    if(advance == 0)
+    {
+        return;
+    }
+    if(fillBackground)
+    {
+        fillRect(x, y, advance, fontHeight(font), textbgcolor);
+    }
+    if(c == ' ')
+    {
+        return;
+    }
+
+    glyphColumns(c, info.proportional, first, last);
+    for(int column = first; column <= last; column++)
+    {
+        uint8_t bits = fakeGlyphs[c - ' '][column];
+
+        for(int row = 0; row < FAKE_FONT_ROWS; row++)
+        {
+            if(bits & (1 << row))
+            {
+                fillRect(x + (column - first) * sx, y + (info.top + row) * sy, sx, sy, textcolor);
+            }
+        }
+    }
+}
+
+int16_t TFT_eSPI::textWidth(const char* string, uint8_t font)
+{
+    int16_t width = 0;
+
+    for(; *string != 0; string++)
+    {
+        width += glyphAdvance(*string, font);
+    }
+    return width;
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font)
+{
+    return fontInfo(font).height * textsize;
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t c, int32_t x, int32_t y, uint8_t font)
+{
+    drawGlyph(c, x, y, font, textcolor != textbgcolor);
+    return glyphAdvance(c, font);
+}
+
+int16_t TFT_eSPI::drawString(const char* string, int32_t x, int32_t y, uint8_t font)
+{
+    int16_t width = textWidth(string, font);
+    int16_t height = fontHeight(font);
+    bool fillBackground = textcolor != textbgcolor;
+    uint8_t datum = textdatum;
+
+    if(datum >= L_BASELINE)
+    {
+        y -= (fontInfo(font).top + 7) * fontInfo(font).scaleY * textsize;
+        datum -= L_BASELINE;
+    }
+    else if(datum >= BL_DATUM)
+    {
+        y -= height;
+    }
+    else if(datum >= ML_DATUM)
+    {
+        y -= height / 2;
+    }
+
+    // left, centre or right
+    if(datum % 3 == 1)
+    {
+        x -= width / 2;
+    }
+    else if(datum % 3 == 2)
+    {
+        x -= width;
+    }
+
+    for(const char* c = string; *c != 0; c++)
+    {
+        drawGlyph(*c, x, y, font, fillBackground);
+        x += glyphAdvance(*c, font);
+    }
+    x -= width;
+
+    // padding clears what longer text drew before, on the side away from the datum
+    if(padX > width && fillBackground)
+    {
+        int16_t pad = padX - width;
+
+        if(datum % 3 == 0)
+        {
+            fillRect(x + width, y, pad, height, textbgcolor);
+        }
+        else if(datum % 3 == 1)
+        {
+            fillRect(x - pad / 2, y, pad / 2, height, textbgcolor);
+            fillRect(x + width, y, pad - pad / 2, height, textbgcolor);
+        }
+        else
+        {
+            fillRect(x - pad, y, pad, height, textbgcolor);
+        }
+    }
+
+    return width;
+}
+
+int16_t TFT_eSPI::drawCentreString(const char* string, int32_t x, int32_t y, uint8_t font)
+{
+    uint8_t datum = textdatum;
+    int16_t width;
+
+    textdatum = TC_DATUM;
+    width = drawString(string, x, y, font);
+    textdatum = datum;
+    return width;
+}
+
+int16_t TFT_eSPI::drawRightString(const char* string, int32_t x, int32_t y, uint8_t font)
+{
+    uint8_t datum = textdatum;
+    int16_t width;
+
+    textdatum = TR_DATUM;
+    width = drawString(string, x, y, font);
+    textdatum = datum;
+    return width;
+}
+
+int16_t TFT_eSPI::drawNumber(long value, int32_t x, int32_t y, uint8_t font)
+{
+    char digits[24];
+
+    snprintf(digits, sizeof(digits), "%ld", value);
+    return drawString(digits, x, y, font);
+}
+
+size_t TFT_eSPI::write(uint8_t c)
+{
+    if(c == '\n')
+    {
+        cursor_x = 0;
+        cursor_y += fontHeight();
+    }
+    else if(c != '\r')
+    {
+        cursor_x += drawChar(c, cursor_x, cursor_y, textfont);
+    }
+    return 1;
+}
+
+/**** Sprite ****/
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0)
+{
+    this->tft = tft;
+    colourDepth = 16;
+}
+
+TFT_eSprite::~TFT_eSprite()
+{
+    deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t width, int16_t height, uint8_t frames)
+{
+    if(frame != nullptr)
+    {
+        return frame;
+    }
+
+    frame = (uint16_t*)calloc(width * height + 1, sizeof(uint16_t));
+    if(frame == nullptr)
+    {
+        return nullptr;
+    }
+
+    _init_width = _width = width;
+    _init_height = _height = height;
+    return frame;
+}
+
+void TFT_eSprite::deleteSprite()
+{
+    free(frame);
+    frame = nullptr;
+    _width = _height = 0;
+}
+
+void* TFT_eSprite::setColorDepth(int8_t bits)
+{
+    int16_t width = _width;
+    int16_t height = _height;
+
+    // only 16 bit sprites are drawn, the firmware uses no others
+    colourDepth = bits;
+    if(frame == nullptr)
+    {
+        return nullptr;
+    }
+    deleteSprite();
+    return createSprite(width, height);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+    pushSprite(x, y, 0, 0, _width, _height);
+}
+
+// the window sx, sy, sw, sh of the sprite goes to x, y on the display
+bool TFT_eSprite::pushSprite(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+    if(frame == nullptr || sx < 0 || sy < 0 || sx + sw > _width || sy + sh > _height)
+    {
+        return false;
+    }
+
+    for(int32_t row = 0; row < sh; row++)
+    {
+        for(int32_t column = 0; column < sw; column++)
+        {
+            tft->drawPixel(x + column, y + row, frame[(sy + row) * _width + sx + column]);
+        }
+    }
+    return true;
+}
+
+/**** Test access ****/
+
+int16_t FakePanel::getWidth()
+{
+    return panel != nullptr ? panel->width() : TFT_WIDTH;
+}
+
+int16_t FakePanel::getHeight()
+{
+    return panel != nullptr ? panel->height() : TFT_HEIGHT;
+}
+
+uint16_t FakePanel::getPixel(int16_t x, int16_t y)
+{
+    return panel != nullptr ? panel->readPixel(x, y) : 0;
+}
+
+const uint16_t* FakePanel::getFrame()
+{
+    return panelFrame;
+}
+
+unsigned long FakePanel::getPixelsWritten()
+{
+    return panel != nullptr ? panel->getPixelsWritten() : 0;
+}
+
+void FakePanel::resetPixelsWritten()
+{
+    if(panel != nullptr)
+    {
+        panel->resetPixelsWritten();
+    }
+}
+
+unsigned long FakePanel::getTrianglesDrawn()
+{
+    return panel != nullptr ? panel->getTrianglesDrawn() : 0;
+}
+
+void FakePanel::resetTrianglesDrawn()
+{
+    if(panel != nullptr)
+    {
+        panel->resetTrianglesDrawn();
+    }
+}
+
+void FakePanel::clear(uint16_t colour)
+{
+    for(size_t i = 0; i < sizeof(panelFrame) / sizeof(panelFrame[0]); i++)
+    {
+        panelFrame[i] = colour;
+    }
+}
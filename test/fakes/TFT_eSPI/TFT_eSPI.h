@@ -0,0 +1,221 @@
+#ifndef _fake_tft_espi_h
+#define _fake_tft_espi_h
+
+// TFT_eSPI drawn into memory instead of a panel. The panel is a static RGB565
+// framebuffer tests can read back through FakePanel, sprites keep their own
+// buffer on the heap like the real library. Text is drawn from one 5x8 font
+// scaled to the height of each TFT_eSPI font.
+
+#include <Arduino.h>
+
+#define TFT_WIDTH               240
+#define TFT_HEIGHT              320
+
+#define TFT_BLACK               0x0000
+#define TFT_NAVY                0x000F
+#define TFT_DARKGREEN           0x03E0
+#define TFT_DARKCYAN            0x03EF
+#define TFT_MAROON              0x7800
+#define TFT_PURPLE              0x780F
+#define TFT_OLIVE               0x7BE0
+#define TFT_LIGHTGREY           0xD69A
+#define TFT_DARKGREY            0x7BEF
+#define TFT_BLUE                0x001F
+#define TFT_GREEN               0x07E0
+#define TFT_CYAN                0x07FF
+#define TFT_RED                 0xF800
+#define TFT_MAGENTA             0xF81F
+#define TFT_YELLOW              0xFFE0
+#define TFT_WHITE               0xFFFF
+#define TFT_ORANGE              0xFDA0
+#define TFT_GREENYELLOW         0xB7E0
+#define TFT_PINK                0xFE19
+#define TFT_BROWN               0x9A60
+#define TFT_GOLD                0xFEA0
+#define TFT_SILVER              0xC618
+#define TFT_SKYBLUE             0x867D
+#define TFT_VIOLET              0x915C
+
+#define TL_DATUM                0
+#define TC_DATUM                1
+#define TR_DATUM                2
+#define ML_DATUM                3
+#define CL_DATUM                3
+#define MC_DATUM                4
+#define CC_DATUM                4
+#define MR_DATUM                5
+#define CR_DATUM                5
+#define BL_DATUM                6
+#define BC_DATUM                7
+#define BR_DATUM                8
+#define L_BASELINE              9
+#define C_BASELINE              10
+#define R_BASELINE              11
+
+#define TFT_DISPON              0x29
+#define TFT_DISPOFF             0x28
+
+#define FAKE_FONTS              9
+#define FAKE_FONT_GLYPHS        95      // ' ' to '~'
+#define FAKE_FONT_COLUMNS       5
+#define FAKE_FONT_ROWS          8
+
+struct FakeFontInfo
+{
+    uint8_t scaleX;
+    uint8_t scaleY;
+    uint8_t height;             // what fontHeight() reports
+    uint8_t top;                // blank rows above the glyphs
+    uint8_t spaceAdvance;
+    bool proportional;          // advance follows the glyph's columns, else 6 columns
+};
+
+extern const uint8_t fakeGlyphs[FAKE_FONT_GLYPHS][FAKE_FONT_COLUMNS];
+extern const FakeFontInfo fakeFonts[FAKE_FONTS];
+
+class TFT_eSPI : public Print
+{
+    public:
+        TFT_eSPI(int16_t width = TFT_WIDTH, int16_t height = TFT_HEIGHT);
+        virtual ~TFT_eSPI() {}
+
+        void init(uint8_t tabColour = 0);
+        void begin(uint8_t tabColour = 0) { init(tabColour); }
+        void setRotation(uint8_t rotation);
+        uint8_t getRotation() { return rotation; }
+        void writecommand(uint8_t command) {}
+        void writedata(uint8_t data) {}
+        void invertDisplay(bool invert) {}
+
+        int16_t width() { return _width; }
+        int16_t height() { return _height; }
+
+        void setSwapBytes(bool swap) { swapBytes = swap; }
+        bool getSwapBytes() { return swapBytes; }
+
+        void drawPixel(int32_t x, int32_t y, uint32_t colour);
+        uint16_t readPixel(int32_t x, int32_t y);
+        void fillScreen(uint32_t colour);
+        void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour);
+        void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour);
+        void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t colour);
+        void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t colour);
+        void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t colour);
+        void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour);
+        void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour);
+        void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t colour);
+        void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t colour);
+
+        void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+        void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) { pushImage(x, y, w, h, (const uint16_t*)data); }
+        void pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+        void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+
+        void setTextColor(uint16_t colour) { textcolor = textbgcolor = colour; }
+        void setTextColor(uint16_t colour, uint16_t background) { textcolor = colour; textbgcolor = background; }
+        void setTextFont(uint8_t font) { textfont = font < FAKE_FONTS && font > 0 ? font : 1; }
+        void setTextSize(uint8_t size) { textsize = size > 0 ? size : 1; }
+        void setTextDatum(uint8_t datum) { textdatum = datum; }
+        uint8_t getTextDatum() { return textdatum; }
+        void setTextPadding(uint16_t width) { padX = width; }
+        uint16_t getTextPadding() { return padX; }
+        void setTextWrap(bool wrapX, bool wrapY = false) {}
+        void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+        void setCursor(int16_t x, int16_t y, uint8_t font) { setTextFont(font); setCursor(x, y); }
+        int16_t getCursorX() { return cursor_x; }
+        int16_t getCursorY() { return cursor_y; }
+
+        int16_t textWidth(const char* string) { return textWidth(string, textfont); }
+        int16_t textWidth(const char* string, uint8_t font);
+        int16_t textWidth(const String& string) { return textWidth(string.c_str(), textfont); }
+        int16_t textWidth(const String& string, uint8_t font) { return textWidth(string.c_str(), font); }
+        int16_t fontHeight() { return fontHeight(textfont); }
+        int16_t fontHeight(int16_t font);
+
+        int16_t drawString(const char* string, int32_t x, int32_t y) { return drawString(string, x, y, textfont); }
+        int16_t drawString(const char* string, int32_t x, int32_t y, uint8_t font);
+        int16_t drawString(const String& string, int32_t x, int32_t y) { return drawString(string.c_str(), x, y, textfont); }
+        int16_t drawString(const String& string, int32_t x, int32_t y, uint8_t font) { return drawString(string.c_str(), x, y, font); }
+        int16_t drawCentreString(const char* string, int32_t x, int32_t y, uint8_t font);
+        int16_t drawRightString(const char* string, int32_t x, int32_t y, uint8_t font);
+        int16_t drawChar(uint16_t c, int32_t x, int32_t y) { return drawChar(c, x, y, textfont); }
+        int16_t drawChar(uint16_t c, int32_t x, int32_t y, uint8_t font);
+        int16_t drawNumber(long value, int32_t x, int32_t y) { return drawNumber(value, x, y, textfont); }
+        int16_t drawNumber(long value, int32_t x, int32_t y, uint8_t font);
+
+        size_t write(uint8_t c) override;
+        using Print::write;
+
+        // pixels this display or sprite has had drawn, the cost of a redraw
+        unsigned long getPixelsWritten() { return pixelsWritten; }
+        void resetPixelsWritten() { pixelsWritten = 0; }
+        unsigned long getTrianglesDrawn() { return trianglesDrawn; }
+        void resetTrianglesDrawn() { trianglesDrawn = 0; }
+
+        uint8_t textfont;
+        uint8_t textsize;
+        uint8_t textdatum;
+        uint32_t textcolor;
+        uint32_t textbgcolor;
+
+    protected:
+        void plot(int32_t x, int32_t y, uint16_t colour);
+        void span(int32_t x, int32_t y, int32_t w, uint16_t colour);
+        int16_t glyphAdvance(uint8_t c, uint8_t font);
+        void drawGlyph(uint8_t c, int32_t x, int32_t y, uint8_t font, bool fillBackground);
+
+        uint16_t* frame;        // _width by _height, row by row, nullptr until there is one
+        int32_t _init_width;
+        int32_t _init_height;
+        int32_t _width;
+        int32_t _height;
+        uint8_t rotation;
+        bool swapBytes;
+        uint16_t padX;
+        int16_t cursor_x;
+        int16_t cursor_y;
+        unsigned long pixelsWritten;
+        unsigned long trianglesDrawn;
+};
+
+class TFT_eSprite : public TFT_eSPI
+{
+    public:
+        explicit TFT_eSprite(TFT_eSPI* tft);
+        ~TFT_eSprite();
+
+        void* createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+        void deleteSprite();
+        bool created() { return frame != nullptr; }
+        void* setColorDepth(int8_t bits);
+        int8_t getColorDepth() { return colourDepth; }
+        void fillSprite(uint32_t colour) { fillScreen(colour); }
+        void pushSprite(int32_t x, int32_t y);
+        bool pushSprite(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+    private:
+        TFT_eSPI* tft;
+        int8_t colourDepth;
+};
+
+// what the panel shows, for tests
+class FakePanel
+{
+    public:
+        static TFT_eSPI* getPanel() { return panel; }     // the display drawing to it, nullptr before init
+        static int16_t getWidth();
+        static int16_t getHeight();
+        static uint16_t getPixel(int16_t x, int16_t y);
+        static const uint16_t* getFrame();
+        static unsigned long getPixelsWritten();
+        static void resetPixelsWritten();
+        static unsigned long getTrianglesDrawn();
+        static void resetTrianglesDrawn();
+        static void clear(uint16_t colour = TFT_BLACK);
+
+    private:
+        friend class TFT_eSPI;
+        static TFT_eSPI* panel;
+};
+
+#endif // _fake_tft_espi_h
@@ -0,0 +1,258 @@
+#ifndef _fake_task_scheduler_h
+#define _fake_task_scheduler_h
+
+// The parts of TaskScheduler the firmware uses, with its timing rules so tasks
+// run on the same millis() as on the device. Header only like the real library.
+
+#include <Arduino.h>
+
+#define TASK_IMMEDIATE      0
+#define TASK_FOREVER        (-1)
+#define TASK_ONCE           1
+
+#define TASK_SECOND         1000UL
+#define TASK_MINUTE         60000UL
+#define TASK_HOUR           3600000UL
+
+class Scheduler;
+
+typedef void (*TaskCallback)();
+typedef bool (*TaskOnEnable)();
+typedef void (*TaskOnDisable)();
+
+class Task
+{
+    public:
+        Task(unsigned long interval = 0, long iterations = 0, TaskCallback callback = nullptr, Scheduler* scheduler = nullptr,
+            bool enable = false, TaskOnEnable onEnable = nullptr, TaskOnDisable onDisable = nullptr);
+
+        void enable()
+        {
+            enabled = true;
+            previousMillis = millis() - (delay = interval);
+        }
+
+        bool enableIfNot()
+        {
+            bool previous = enabled;
+
+            if(!enabled)
+            {
+                enable();
+            }
+            return previous;
+        }
+
+        void enableDelayed(unsigned long delay = 0)
+        {
+            enabled = true;
+            previousMillis = millis();
+            this->delay = delay > 0 ? delay : interval;
+        }
+
+        bool disable()
+        {
+            bool previous = enabled;
+
+            enabled = false;
+            return previous;
+        }
+
+        void restart()
+        {
+            iterations = initialIterations;
+            enable();
+        }
+
+        void restartDelayed(unsigned long delay = 0)
+        {
+            iterations = initialIterations;
+            enableDelayed(delay);
+        }
+
+        void forceNextIteration()
+        {
+            previousMillis = millis() - (delay = interval);
+        }
+
+        // starts a new period now, as the real library does
+        void setInterval(unsigned long interval)
+        {
+            this->interval = interval;
+            delay = interval;
+            previousMillis = millis();
+        }
+
+        void setIterations(long iterations) { this->iterations = initialIterations = iterations; }
+        void setCallback(TaskCallback callback) { this->callback = callback; }
+
+        bool isEnabled() const { return enabled; }
+        unsigned long getInterval() const { return interval; }
+        long getIterations() const { return iterations; }
+        unsigned long getRunCounter() const { return runCounter; }
+        long getOverrun() const { return overrun; }
+        long getStartDelay() const { return startDelay; }
+        bool isFirstIteration() const { return runCounter <= 1; }
+        bool isLastIteration() const { return iterations == 0; }
+
+    private:
+        friend class Scheduler;
+
+        bool execute(unsigned long now);
+
+        unsigned long interval;
+        unsigned long delay;
+        unsigned long previousMillis;
+        long iterations;
+        long initialIterations;
+        unsigned long runCounter;
+        long overrun;
+        long startDelay;
+        bool enabled;
+        TaskCallback callback;
+        TaskOnEnable onEnable;
+        TaskOnDisable onDisable;
+        Task* next;
+};
+
+class Scheduler
+{
+    public:
+        Scheduler() : first(nullptr), last(nullptr) {}
+
+        void init() { first = last = nullptr; }
+
+        void addTask(Task& task)
+        {
+            for(Task* t = first; t != nullptr; t = t->next)
+            {
+                if(t == &task)
+                {
+                    return;
+                }
+            }
+            task.next = nullptr;
+            if(last != nullptr)
+            {
+                last->next = &task;
+            }
+            else
+            {
+                first = &task;
+            }
+            last = &task;
+        }
+
+        void deleteTask(Task& task)
+        {
+            Task* previous = nullptr;
+
+            for(Task* t = first; t != nullptr; previous = t, t = t->next)
+            {
+                if(t == &task)
+                {
+                    (previous != nullptr ? previous->next : first) = t->next;
+                    if(last == t)
+                    {
+                        last = previous;
+                    }
+                    t->next = nullptr;
+                    return;
+                }
+            }
+        }
+
+        void startNow()
+        {
+            for(Task* t = first; t != nullptr; t = t->next)
+            {
+                if(t->enabled)
+                {
+                    t->previousMillis = millis() - (t->delay = t->interval);
+                }
+            }
+        }
+
+        void enableAll() { for(Task* t = first; t != nullptr; t = t->next) t->enable(); }
+        void disableAll() { for(Task* t = first; t != nullptr; t = t->next) t->disable(); }
+
+        // true when nothing ran, the real library then sleeps
+        bool execute()
+        {
+            bool idle = true;
+
+            for(Task* t = first; t != nullptr; t = t->next)
+            {
+                if(t->execute(millis()))
+                {
+                    idle = false;
+                }
+            }
+            return idle;
+        }
+
+    private:
+        Task* first;
+        Task* last;
+};
+
+inline Task::Task(unsigned long interval, long iterations, TaskCallback callback, Scheduler* scheduler,
+    bool enable, TaskOnEnable onEnable, TaskOnDisable onDisable)
+{
+    this->interval = delay = interval;
+    previousMillis = 0;
+    this->iterations = initialIterations = iterations;
+    runCounter = 0;
+    overrun = 0;
+    startDelay = 0;
+    enabled = false;
+    this->callback = callback;
+    this->onEnable = onEnable;
+    this->onDisable = onDisable;
+    next = nullptr;
+
+    if(scheduler != nullptr)
+    {
+        scheduler->addTask(*this);
+    }
+    if(enable)
+    {
+        this->enable();
+    }
+}
+
+// runs the task if it is due, true if it did
+inline bool Task::execute(unsigned long now)
+{
+    if(!enabled)
+    {
+        return false;
+    }
+    if(iterations == 0)
+    {
+        disable();
+        return false;
+    }
+    if(now - previousMillis < delay)
+    {
+        return false;
+    }
+
+    if(iterations > 0)
+    {
+        iterations--;
+    }
+    runCounter++;
+    previousMillis += delay;
+    overrun = (long)(previousMillis + interval - now);
+    startDelay = (long)(now - previousMillis);
+    delay = interval;
+
+    if(callback != nullptr)
+    {
+        callback();
+    }
+    return true;
+}
+
+#endif // _fake_task_scheduler_h
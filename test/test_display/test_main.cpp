@@ -0,0 +1,274 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <TFT_eSPI.h>
+#include "Goldens.h"
+#include "DisplayTFT.h"
+
+// Draws each page through DisplayTFT into the fake panel, compares it with its
+// golden and reports the pixels each call pushed to the panel. Rendering changes
+// that aren't meant to change the screen must leave the goldens matching.
+
+#define GOLDEN_EPOCH        1609502400      // Fri 1 Jan 2021 12:00:00
+
+static DisplayTFT* display = nullptr;
+static uint16_t saved[TFT_WIDTH * TFT_HEIGHT];
+
+static OctoPrintMonitorData printing;
+static OpenWeatherMapCurrentData weather;
+
+static void makePrinting(OctoPrintMonitorData* data)
+{
+    data->fileName = "benchy_0.2mm_PLA.gcode";
+    data->estimatedPrintTime = 8436;
+    data->filamentLength = 4127;
+    data->jobState = "Printing";
+    data->progress = 4237;
+    data->printTimeElapsed = 3512;
+    data->printTimeRemaining = 4810;
+    data->jobLoaded = true;
+    data->tool0Temp = 2146;
+    data->tool0Target = 2150;
+    data->bedTemp = 599;
+    data->bedTarget = 600;
+    data->printState = "Printing";
+    data->printerFlags = PRINT_STATE_OPERATIONAL | PRINT_STATE_PRINTING;
+    data->validJobData = true;
+    data->validPrintData = true;
+}
+
+static void makeWeather(OpenWeatherMapCurrentData* data)
+{
+    data->main = "Rain";
+    data->description = "Light Rain";
+    data->icon = "10d";
+    data->location = "London";
+    data->temp = 8.41f;
+    data->tempMin = 7.22f;
+    data->tempMax = 9.44f;
+    data->pressure = 1012;
+    data->humidity = 87;
+    data->windSpeed = 4.12f;
+    data->windDeg = 230;
+    data->observationTime = GOLDEN_EPOCH;
+    data->sunRise = 1609488281;
+    data->sunSet = 1609516597;
+    data->timeZone = 0;
+    data->cloudPercentage = 75;
+    data->rainOneHour = 0;
+    data->rainThreeHour = -1;
+    data->validData = true;
+}
+
+// pixels pushed to the panel since the last call
+static unsigned long drawn(const char* call)
+{
+    char message[96];
+    unsigned long pixels = FakePanel::getPixelsWritten();
+
+    snprintf(message, sizeof(message), "%s: %lu pixels", call, pixels);
+    TEST_MESSAGE(message);
+    FakePanel::resetPixelsWritten();
+    return pixels;
+}
+
+static void assertGolden(const char* name)
+{
+    char message[128];
+    long differences = Goldens::compare(name);
+
+    snprintf(message, sizeof(message), "%s: %ld pixels differ, first at %d,%d", name, differences, Goldens::getFirstX(), Goldens::getFirstY());
+    TEST_ASSERT_EQUAL_MESSAGE(0, differences, message);
+}
+
+static void saveFrame()
+{
+    memcpy(saved, FakePanel::getFrame(), sizeof(saved));
+}
+
+static bool frameSaved()
+{
+    return memcmp(saved, FakePanel::getFrame(), sizeof(saved)) == 0;
+}
+
+void setUp()
+{
+    if(display == nullptr)
+    {
+        display = new DisplayTFT();
+    }
+
+    display->setDisplayMetric(true);
+    display->setClockFormat(ClockFormat_AmPm);
+    display->setDateFormat(DateFormat_DDMMYY);
+    display->setDisplayMode(DisplayMode_Weather);
+    display->clearDisplay();
+
+    makePrinting(&printing);
+    makeWeather(&weather);
+    FakePanel::resetPixelsWritten();
+}
+
+void tearDown()
+{
+}
+
+void test_weather_page()
+{
+    display->drawCurrentWeather(&weather, true);
+    drawn("drawCurrentWeather");
+    display->drawCurrentTime(GOLDEN_EPOCH);
+    drawn("drawCurrentTime");
+    display->drawWiFiStrength(-60);
+    drawn("drawWiFiStrength");
+
+    assertGolden("weather_page");
+}
+
+void test_weather_not_enabled()
+{
+    display->drawCurrentWeather(&weather, false);
+    drawn("drawCurrentWeather, not enabled");
+
+    assertGolden("weather_not_enabled");
+}
+
+// the same minute drawn again leaves the screen as it was
+void test_time_redraw()
+{
+    display->drawCurrentTime(GOLDEN_EPOCH);
+    drawn("drawCurrentTime");
+    saveFrame();
+
+    display->drawCurrentTime(GOLDEN_EPOCH + 59);
+    drawn("drawCurrentTime, same minute");
+    TEST_ASSERT_TRUE(frameSaved());
+
+    display->setClockFormat(ClockFormat_24h);
+    display->drawCurrentTime(GOLDEN_EPOCH);
+    drawn("drawCurrentTime, 24 hour");
+    TEST_ASSERT_FALSE(frameSaved());
+}
+
+void test_print_monitor_page()
+{
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    drawn("setDisplayMode");
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    drawn("drawOctoPrintStatus");
+    display->drawCurrentTime(GOLDEN_EPOCH);
+    drawn("drawCurrentTime");
+
+    assertGolden("print_monitor_page");
+
+#if DISPLAY_USE_SPRITES
+    // every widget, the title too, went through the sprite
+    TEST_ASSERT_EQUAL(0, display->getRenderStats()->spriteFallbacks);
+#endif
+
+    // nothing changed, nothing is pushed
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    TEST_ASSERT_EQUAL(0, drawn("drawOctoPrintStatus, unchanged"));
+}
+
+// an update only redraws what changed, and ends up as a full draw of the new data would
+void test_print_monitor_update_matches_full_draw()
+{
+    unsigned long updated;
+    unsigned long full;
+
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    FakePanel::resetPixelsWritten();
+
+    printing.progress = 4519;
+    printing.printTimeElapsed = 3752;
+    printing.printTimeRemaining = 4570;
+    printing.tool0Temp = 2151;
+    printing.bedTemp = 601;
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    updated = drawn("drawOctoPrintStatus, update");
+    saveFrame();
+
+    display->clearDisplay();
+    FakePanel::resetPixelsWritten();
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    full = drawn("drawOctoPrintStatus, full");
+
+    TEST_ASSERT_TRUE(frameSaved());
+    TEST_ASSERT_LESS_THAN(full, updated);
+}
+
+// moving to another printer keeps the page and only draws what differs
+void test_print_monitor_next_printer()
+{
+    OctoPrintMonitorData idle;
+
+    makePrinting(&idle);
+    idle.jobLoaded = false;
+    idle.jobState = "Operational";
+    idle.printState = "Operational";
+    idle.printerFlags = PRINT_STATE_OPERATIONAL | PRINT_STATE_READY;
+    idle.progress = 0;
+    idle.tool0Temp = 221;
+    idle.tool0Target = 0;
+    idle.bedTemp = 219;
+    idle.bedTarget = 0;
+
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->drawOctoPrintStatus(&idle, "Prusa Mini", true);
+    FakePanel::resetPixelsWritten();
+    saveFrame();
+
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    drawn("drawOctoPrintStatus, next printer");
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->drawOctoPrintStatus(&idle, "Prusa Mini", true);
+    drawn("drawOctoPrintStatus, back again");
+
+    TEST_ASSERT_TRUE(frameSaved());
+}
+
+void test_print_monitor_no_data()
+{
+    printing.validPrintData = false;
+    printing.validJobData = false;
+
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->drawOctoPrintStatus(&printing, "Ender 3", true);
+    drawn("drawOctoPrintStatus, no data");
+
+    assertGolden("print_monitor_no_data");
+}
+
+void test_print_monitor_not_enabled()
+{
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->drawOctoPrintStatus(&printing, "Ender 3", false);
+    drawn("drawOctoPrintStatus, not enabled");
+
+    assertGolden("print_monitor_not_enabled");
+}
+
+void test_not_setup()
+{
+    display->setDisplayMode(DisplayMode_NotSetup);
+    drawn("setDisplayMode, not setup");
+
+    assertGolden("not_setup");
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_weather_page);
+    RUN_TEST(test_weather_not_enabled);
+    RUN_TEST(test_time_redraw);
+    RUN_TEST(test_print_monitor_page);
+    RUN_TEST(test_print_monitor_update_matches_full_draw);
+    RUN_TEST(test_print_monitor_next_printer);
+    RUN_TEST(test_print_monitor_no_data);
+    RUN_TEST(test_print_monitor_not_enabled);
+    RUN_TEST(test_not_setup);
+    return UNITY_END();
+}
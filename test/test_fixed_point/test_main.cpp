@@ -0,0 +1,284 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <time.h>
+#include <ArduinoJson.h>
+#include "Format.h"
+#include "DisplayTFT.h"
+#include "tempArcTable.h"
+#include "OctoPrintMonitor.h"
+
+// Feeds readings through the JSON parse into deci-degrees and basis points and
+// checks the text, arc segments and progress bar the print monitor draws from
+// them match what the float code put on screen for the same reading, then
+// times the conversions one drawPrintInfo makes against the float ones.
+// OctoPrint reports temperatures to two places, completion to many more.
+
+#define TEMP_LOWEST         -2000   // hundredths of a degree
+#define TEMP_HIGHEST        30000
+#define PROGRESS_STEPS      100000  // thousandths of a percent
+#define BENCHMARK_DRAWS     20000
+
+static StaticJsonDocument<64> doc;
+
+static unsigned long nanos()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ul + now.tv_nsec;
+}
+
+// a reading as it arrives in OctoPrint's JSON
+static JsonVariant parse(const char* json)
+{
+    char text[48];
+
+    snprintf(text, sizeof(text), "{\"value\":%s}", json);
+    TEST_ASSERT_EQUAL(DeserializationError::Ok, deserializeJson(doc, text).code());
+    return doc["value"];
+}
+
+static JsonVariant parseHundredths(int hundredths)
+{
+    char text[16];
+
+    snprintf(text, sizeof(text), "%s%d.%02d", hundredths < 0 ? "-" : "", abs(hundredths) / 100, abs(hundredths) % 100);
+    return parse(text);
+}
+
+// the float code drawTempArc and drawProgressBar had
+static int oldArcSegments(float value, float max)
+{
+    float temp = min(value, max);
+    int segments = ((temp / max) * TEMP_ARC_SPAN) / TEMP_ARC_DEGREE_PER_SEG;
+
+    return constrain(segments, 0, TEMP_ARC_SEGMENTS);
+}
+
+static int oldProgressWidth(float percent)
+{
+    percent = min(percent, 100.0f);
+    percent = max(0.0f, percent);
+
+    return (PRINT_PROGRESS_BAR_WIDTH * percent) / 100.0f;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+// %.0f took halves to the even degree and printed -0C, halves round away from zero now
+void test_temperature_text()
+{
+    char message[96];
+    char old[WIDGET_VALUE_SIZE];
+    char text[WIDGET_VALUE_SIZE];
+    int halves = 0;
+    int negativeZeros = 0;
+
+    for(int hundredths = TEMP_LOWEST; hundredths <= TEMP_HIGHEST; hundredths++)
+    {
+        JsonVariant value = parseHundredths(hundredths);
+
+        snprintf(old, sizeof(old), "%.0fC", value.as<float>());
+        DisplayTFT::formatTemperature(text, sizeof(text), OctoPrintMonitor::toDeciDegrees(value));
+
+        if(strcmp(old, text) == 0)
+        {
+            continue;
+        }
+
+        if(abs(hundredths) % 100 == 50)
+        {
+            halves++;
+        }
+        else
+        {
+            negativeZeros++;
+            TEST_ASSERT_EQUAL_STRING("-0C", old);
+            TEST_ASSERT_EQUAL_STRING("0C", text);
+        }
+    }
+
+    snprintf(message, sizeof(message), "%d readings: %d exact halves and %d -0C drawn differently",
+        TEMP_HIGHEST - TEMP_LOWEST + 1, halves, negativeZeros);
+    TEST_MESSAGE(message);
+}
+
+// segments for a reading in hundredths worked out exactly
+static int exactArcSegments(long hundredths, int max)
+{
+    hundredths = constrain(hundredths, 0, max * 100L);
+
+    return (hundredths * TEMP_ARC_SPAN) / (max * 100L * TEMP_ARC_DEGREE_PER_SEG);
+}
+
+static void assertArcSegments(const char* gauge, int max)
+{
+    char message[128];
+    int floatErrors = 0;
+    int tenths = 0;
+
+    for(int hundredths = TEMP_LOWEST; hundredths <= TEMP_HIGHEST; hundredths++)
+    {
+        JsonVariant value = parseHundredths(hundredths);
+        int old = oldArcSegments(value.as<float>(), max);
+        int segments = DisplayTFT::getArcSegments(OctoPrintMonitor::toDeciDegrees(value), max);
+
+        // exact for the reading cut to a tenth
+        TEST_ASSERT_EQUAL(exactArcSegments(hundredths / 10 * 10, max), segments);
+
+        if(segments != old)
+        {
+            if(segments == exactArcSegments(hundredths, max))
+            {
+                floatErrors++;
+            }
+            else
+            {
+                tenths++;
+            }
+        }
+    }
+
+    snprintf(message, sizeof(message), "%s gauge, %d readings: %d the float maths fell short on, %d a segment short within a tenth",
+        gauge, TEMP_HIGHEST - TEMP_LOWEST + 1, floatErrors, tenths);
+    TEST_MESSAGE(message);
+}
+
+// a tool segment is 3.125 degrees and a bed one 1.25, where one ends between
+// two tenths the reading is a segment short until the next tenth
+void test_arc_segments()
+{
+    assertArcSegments("tool", TOOL_TEMP_MAX);
+    assertArcSegments("bed", BED_TEMP_MAX);
+}
+
+// a pixel of the bar is 0.625%, where one ends between two basis points the
+// bar is a pixel short until the next one. The whole percent shown is exact
+void test_progress()
+{
+    char message[128];
+    char text[48];
+    char old[WIDGET_VALUE_SIZE];
+    char buffer[WIDGET_VALUE_SIZE];
+    int floatErrors = 0;
+    int basisPoints = 0;
+
+    for(long thousandths = 0; thousandths <= PROGRESS_STEPS; thousandths++)
+    {
+        snprintf(text, sizeof(text), "%ld.%03ld", thousandths / 1000, thousandths % 1000);
+        JsonVariant value = parse(text);
+        float percent = value.as<float>();
+        uint16_t progress = OctoPrintMonitor::toBasisPoints(value);
+        int width = DisplayTFT::getProgressWidth(progress);
+
+        snprintf(old, sizeof(old), "%d%%", (int)percent);
+        FormatBuffer(buffer, sizeof(buffer)).number(progress / BASIS_POINTS_PER_PERCENT).character('%');
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(old, buffer, text);
+
+        // exact for the completion cut to a basis point
+        TEST_ASSERT_EQUAL_MESSAGE(thousandths / 10 * PRINT_PROGRESS_BAR_WIDTH / PROGRESS_COMPLETE, width, text);
+
+        if(width != oldProgressWidth(percent))
+        {
+            if(width == thousandths * PRINT_PROGRESS_BAR_WIDTH / (PROGRESS_COMPLETE * 10L))
+            {
+                floatErrors++;
+            }
+            else
+            {
+                basisPoints++;
+            }
+        }
+    }
+
+    snprintf(message, sizeof(message), "bar, %d completions: %d the float maths fell short on, %d a pixel short within a basis point",
+        PROGRESS_STEPS + 1, floatErrors, basisPoints);
+    TEST_MESSAGE(message);
+}
+
+// whole numbers, targets and finished jobs, take the integer path
+void test_whole_numbers()
+{
+    char text[16];
+    char old[WIDGET_VALUE_SIZE];
+    char buffer[WIDGET_VALUE_SIZE];
+
+    for(int degrees = -20; degrees <= 300; degrees++)
+    {
+        snprintf(text, sizeof(text), "%d", degrees);
+        JsonVariant value = parse(text);
+        int16_t deciDegrees = OctoPrintMonitor::toDeciDegrees(value);
+
+        TEST_ASSERT_EQUAL(degrees * DECI_DEGREES_PER_DEGREE, deciDegrees);
+
+        snprintf(old, sizeof(old), "%.0fC", (float)degrees);
+        DisplayTFT::formatTemperature(buffer, sizeof(buffer), deciDegrees);
+        TEST_ASSERT_EQUAL_STRING(old, buffer);
+        TEST_ASSERT_EQUAL(oldArcSegments(degrees, TOOL_TEMP_MAX), DisplayTFT::getArcSegments(deciDegrees, TOOL_TEMP_MAX));
+        TEST_ASSERT_EQUAL(oldArcSegments(degrees, BED_TEMP_MAX), DisplayTFT::getArcSegments(deciDegrees, BED_TEMP_MAX));
+    }
+
+    TEST_ASSERT_EQUAL(PROGRESS_COMPLETE, OctoPrintMonitor::toBasisPoints(parse("100")));
+    TEST_ASSERT_EQUAL(0, OctoPrintMonitor::toBasisPoints(parse("null")));
+}
+
+// host time for the values one drawPrintInfo shows, the ESP8266 does the float
+// side in software so it only understates the saving there
+void test_benchmark()
+{
+    char message[128];
+    char buffer[WIDGET_VALUE_SIZE];
+    volatile int sink = 0;
+    float temps[4] = { 214.53f, 215.0f, 60.21f, 60.0f };
+    int16_t deciDegrees[4] = { 2145, 2150, 602, 600 };
+    float percent = 42.81f;
+    uint16_t progress = 4281;
+
+    unsigned long start = nanos();
+    for(int i=0; i<BENCHMARK_DRAWS; i++)
+    {
+        for(int j=0; j<4; j++)
+        {
+            snprintf(buffer, sizeof(buffer), "%.0fC", temps[j]);
+        }
+        sink += oldArcSegments(temps[0], TOOL_TEMP_MAX) + oldArcSegments(temps[2], BED_TEMP_MAX);
+        sink += oldProgressWidth(percent);
+        snprintf(buffer, sizeof(buffer), "%d%%", (int)percent);
+        temps[0] += 0.01f;
+    }
+    unsigned long old = (nanos() - start) / BENCHMARK_DRAWS;
+
+    start = nanos();
+    for(int i=0; i<BENCHMARK_DRAWS; i++)
+    {
+        for(int j=0; j<4; j++)
+        {
+            DisplayTFT::formatTemperature(buffer, sizeof(buffer), deciDegrees[j]);
+        }
+        sink += DisplayTFT::getArcSegments(deciDegrees[0], TOOL_TEMP_MAX) + DisplayTFT::getArcSegments(deciDegrees[2], BED_TEMP_MAX);
+        sink += DisplayTFT::getProgressWidth(progress);
+        FormatBuffer(buffer, sizeof(buffer)).number(progress / BASIS_POINTS_PER_PERCENT).character('%');
+        deciDegrees[0]++;
+    }
+    unsigned long fixed = (nanos() - start) / BENCHMARK_DRAWS;
+
+    snprintf(message, sizeof(message), "a drawPrintInfo's values: float %lu ns, fixed point %lu ns, host time", old, fixed);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_temperature_text);
+    RUN_TEST(test_arc_segments);
+    RUN_TEST(test_progress);
+    RUN_TEST(test_whole_numbers);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
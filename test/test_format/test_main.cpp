@@ -0,0 +1,243 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <time.h>
+#include <limits.h>
+#include "Format.h"
+
+// Checks FormatBuffer against snprintf for the formats the display uses, at
+// the ends of long's range and where the buffer runs out, and times the two
+// on the display's values.
+
+#define SWEEP_LIMIT         100000
+#define BENCHMARK_FORMATS   20000
+
+static char buffer[32];
+static char expected[32];
+
+static unsigned long nanos()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ul + now.tv_nsec;
+}
+
+void setUp()
+{
+    memset(buffer, 'x', sizeof(buffer));
+}
+
+void tearDown()
+{
+}
+
+void test_number()
+{
+    TEST_ASSERT_EQUAL_STRING("0", FormatBuffer(buffer, sizeof(buffer)).number(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("42", FormatBuffer(buffer, sizeof(buffer)).number(42).c_str());
+    TEST_ASSERT_EQUAL_STRING("-7", FormatBuffer(buffer, sizeof(buffer)).number(-7).c_str());
+    TEST_ASSERT_EQUAL_STRING("007", FormatBuffer(buffer, sizeof(buffer)).number(7, 3).c_str());
+    TEST_ASSERT_EQUAL_STRING("-07", FormatBuffer(buffer, sizeof(buffer)).number(-7, 2).c_str());
+    TEST_ASSERT_EQUAL_STRING("1234", FormatBuffer(buffer, sizeof(buffer)).number(1234, 2).c_str());
+}
+
+// the magnitude of LONG_MIN doesn't fit a long
+void test_number_limits()
+{
+    snprintf(expected, sizeof(expected), "%ld", LONG_MAX);
+    TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).number(LONG_MAX).c_str());
+
+    snprintf(expected, sizeof(expected), "%ld", LONG_MIN);
+    TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).number(LONG_MIN).c_str());
+}
+
+void test_fixed()
+{
+    TEST_ASSERT_EQUAL_STRING("123.4", FormatBuffer(buffer, sizeof(buffer)).fixed(1234, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("0.005", FormatBuffer(buffer, sizeof(buffer)).fixed(5, 3).c_str());
+    TEST_ASSERT_EQUAL_STRING("12", FormatBuffer(buffer, sizeof(buffer)).fixed(12, 0).c_str());
+    TEST_ASSERT_EQUAL_STRING("-0.5", FormatBuffer(buffer, sizeof(buffer)).fixed(-5, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("-12.34", FormatBuffer(buffer, sizeof(buffer)).fixed(-1234, 2).c_str());
+}
+
+// the sign is kept when the whole part is zero, snprintf of the same value
+void test_fixed_negative()
+{
+    for(long value = -SWEEP_LIMIT; value <= SWEEP_LIMIT; value++)
+    {
+        snprintf(expected, sizeof(expected), "%s%ld.%02ld", value < 0 ? "-" : "", labs(value) / 100, labs(value) % 100);
+        TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).fixed(value, 2).c_str());
+    }
+}
+
+void test_fixed_limits()
+{
+    snprintf(expected, sizeof(expected), "%ld.%02ld", LONG_MAX / 100, LONG_MAX % 100);
+    TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).fixed(LONG_MAX, 2).c_str());
+
+    snprintf(expected, sizeof(expected), "-%ld.%02ld", -(LONG_MIN / 100), -(LONG_MIN % 100));
+    TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).fixed(LONG_MIN, 2).c_str());
+}
+
+void test_rounded()
+{
+    TEST_ASSERT_EQUAL_STRING("214", FormatBuffer(buffer, sizeof(buffer)).rounded(2144, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("215", FormatBuffer(buffer, sizeof(buffer)).rounded(2145, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("0", FormatBuffer(buffer, sizeof(buffer)).rounded(0, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("7", FormatBuffer(buffer, sizeof(buffer)).rounded(7, 0).c_str());
+    TEST_ASSERT_EQUAL_STRING("3", FormatBuffer(buffer, sizeof(buffer)).rounded(2500, 3).c_str());
+}
+
+// halves round away from zero and nothing that rounds to zero keeps its sign
+void test_rounded_negative()
+{
+    TEST_ASSERT_EQUAL_STRING("-215", FormatBuffer(buffer, sizeof(buffer)).rounded(-2145, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("-214", FormatBuffer(buffer, sizeof(buffer)).rounded(-2144, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("0", FormatBuffer(buffer, sizeof(buffer)).rounded(-4, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("-1", FormatBuffer(buffer, sizeof(buffer)).rounded(-5, 1).c_str());
+
+    for(long value = -SWEEP_LIMIT; value <= SWEEP_LIMIT; value++)
+    {
+        long whole = (labs(value) + 5) / 10;
+
+        snprintf(expected, sizeof(expected), "%ld", value < 0 ? -whole : whole);
+        TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).rounded(value, 1).c_str());
+    }
+}
+
+void test_rounded_limits()
+{
+    snprintf(expected, sizeof(expected), "%ld", LONG_MAX / 10 + 1);
+    TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).rounded(LONG_MAX, 1).c_str());
+
+    snprintf(expected, sizeof(expected), "%ld", LONG_MIN / 10 - 1);
+    TEST_ASSERT_EQUAL_STRING(expected, FormatBuffer(buffer, sizeof(buffer)).rounded(LONG_MIN, 1).c_str());
+}
+
+// what doesn't fit is dropped and the text is still terminated
+void test_truncation()
+{
+    char small[6];
+
+    FormatBuffer format(small, sizeof(small));
+    format.text("Hello world");
+    TEST_ASSERT_EQUAL_STRING("Hello", small);
+    TEST_ASSERT_EQUAL(5, format.length());
+
+    format.character('!').number(42);
+    TEST_ASSERT_EQUAL_STRING("Hello", small);
+    TEST_ASSERT_EQUAL(0, format.write('!'));
+
+    TEST_ASSERT_EQUAL_STRING("-1234", FormatBuffer(small, sizeof(small)).number(-123456).c_str());
+    TEST_ASSERT_EQUAL_STRING("12.34", FormatBuffer(small, sizeof(small)).fixed(12345, 3).c_str());
+    TEST_ASSERT_EQUAL_STRING("00:00", FormatBuffer(small, sizeof(small)).duration(0).c_str());
+
+    FormatBuffer printed(small, sizeof(small));
+    TEST_ASSERT_EQUAL(3, printed.print("abc"));
+    TEST_ASSERT_EQUAL(2, printed.print("defg"));
+    TEST_ASSERT_EQUAL_STRING("abcde", small);
+}
+
+// a buffer of one holds only the terminator, one of none isn't touched
+void test_tiny_buffers()
+{
+    TEST_ASSERT_EQUAL_STRING("", FormatBuffer(buffer, 1).text("abc").number(7).c_str());
+    TEST_ASSERT_EQUAL('x', buffer[1]);
+
+    memset(buffer, 'x', sizeof(buffer));
+    FormatBuffer(buffer, 0).text("abc").rounded(2145, 1);
+    TEST_ASSERT_EQUAL('x', buffer[0]);
+}
+
+void test_duration()
+{
+    TEST_ASSERT_EQUAL_STRING("00:00:00", FormatBuffer(buffer, sizeof(buffer)).duration(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("01:01:01", FormatBuffer(buffer, sizeof(buffer)).duration(3661).c_str());
+    TEST_ASSERT_EQUAL_STRING("23:59:59", FormatBuffer(buffer, sizeof(buffer)).duration(86399).c_str());
+    TEST_ASSERT_EQUAL_STRING("100:00:00", FormatBuffer(buffer, sizeof(buffer)).duration(360000).c_str());
+}
+
+void test_clock()
+{
+    TEST_ASSERT_EQUAL_STRING("00:05", FormatBuffer(buffer, sizeof(buffer)).clock(0, 5, false).c_str());
+    TEST_ASSERT_EQUAL_STRING("12:00", FormatBuffer(buffer, sizeof(buffer)).clock(12, 0, false).c_str());
+    TEST_ASSERT_EQUAL_STRING("23:59", FormatBuffer(buffer, sizeof(buffer)).clock(23, 59, false).c_str());
+    TEST_ASSERT_EQUAL_STRING("1:05pm", FormatBuffer(buffer, sizeof(buffer)).clock(13, 5, true).c_str());
+    TEST_ASSERT_EQUAL_STRING("11:59am", FormatBuffer(buffer, sizeof(buffer)).clock(11, 59, true).c_str());
+}
+
+// midnight is 12am and noon 12pm, never 0
+void test_clock_midnight_and_noon()
+{
+    TEST_ASSERT_EQUAL_STRING("12:00am", FormatBuffer(buffer, sizeof(buffer)).clock(0, 0, true).c_str());
+    TEST_ASSERT_EQUAL_STRING("12:30am", FormatBuffer(buffer, sizeof(buffer)).clock(0, 30, true).c_str());
+    TEST_ASSERT_EQUAL_STRING("12:00pm", FormatBuffer(buffer, sizeof(buffer)).clock(12, 0, true).c_str());
+    TEST_ASSERT_EQUAL_STRING("12:59pm", FormatBuffer(buffer, sizeof(buffer)).clock(12, 59, true).c_str());
+}
+
+void test_date()
+{
+    TEST_ASSERT_EQUAL_STRING("17/10/26", FormatBuffer(buffer, sizeof(buffer)).date(17, 10, 2026).c_str());
+    TEST_ASSERT_EQUAL_STRING("1/2/05", FormatBuffer(buffer, sizeof(buffer)).date(1, 2, 2005).c_str());
+    TEST_ASSERT_EQUAL_STRING("12/31/00", FormatBuffer(buffer, sizeof(buffer)).date(12, 31, 2000).c_str());
+}
+
+// host time for the strings the print monitor and clock draw, snprintf with
+// the formats the display used before
+void test_benchmark()
+{
+    char message[128];
+    int16_t deciDegrees = 2145;
+    unsigned long seconds = 3540;
+
+    unsigned long start = nanos();
+    for(int i=0; i<BENCHMARK_FORMATS; i++)
+    {
+        snprintf(buffer, sizeof(buffer), "%.0fC", deciDegrees / 10.0f);
+        snprintf(buffer, sizeof(buffer), "%02lu:%02lu:%02lu", seconds / 3600, (seconds % 3600) / 60, seconds % 60);
+        snprintf(buffer, sizeof(buffer), "%d%%", i % 100);
+        snprintf(buffer, sizeof(buffer), "%d:%02d%s", i % 12 + 1, i % 60, "pm");
+        deciDegrees++;
+        seconds++;
+    }
+    unsigned long printed = (nanos() - start) / BENCHMARK_FORMATS;
+
+    deciDegrees = 2145;
+    seconds = 3540;
+    start = nanos();
+    for(int i=0; i<BENCHMARK_FORMATS; i++)
+    {
+        FormatBuffer(buffer, sizeof(buffer)).rounded(deciDegrees, 1).character('C');
+        FormatBuffer(buffer, sizeof(buffer)).duration(seconds);
+        FormatBuffer(buffer, sizeof(buffer)).number(i % 100).character('%');
+        FormatBuffer(buffer, sizeof(buffer)).clock(i % 12 + 13, i % 60, true);
+        deciDegrees++;
+        seconds++;
+    }
+    unsigned long formatted = (nanos() - start) / BENCHMARK_FORMATS;
+
+    snprintf(message, sizeof(message), "temperature, duration, percent and clock: snprintf %lu ns, FormatBuffer %lu ns, host time",
+        printed, formatted);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_number);
+    RUN_TEST(test_number_limits);
+    RUN_TEST(test_fixed);
+    RUN_TEST(test_fixed_negative);
+    RUN_TEST(test_fixed_limits);
+    RUN_TEST(test_rounded);
+    RUN_TEST(test_rounded_negative);
+    RUN_TEST(test_rounded_limits);
+    RUN_TEST(test_truncation);
+    RUN_TEST(test_tiny_buffers);
+    RUN_TEST(test_duration);
+    RUN_TEST(test_clock);
+    RUN_TEST(test_clock_midnight_and_noon);
+    RUN_TEST(test_date);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
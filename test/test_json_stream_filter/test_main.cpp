@@ -0,0 +1,207 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <ArduinoJson.h>
+#include "JsonStreamFilter.h"
+
+// Feeds the stream filter an OctoPrint style reply whole, split at every byte
+// and cut short, and checks what it keeps against ArduinoJson's own filter.
+// The kept fields hold escaped strings, the dropped ones nested arrays and
+// objects with brackets inside strings.
+
+#define OUTPUT_SIZE         256
+#define DOCUMENT_SIZE       1024
+#define SMALL_OUTPUT_SIZE   24
+
+static const char FILTER[] =
+    "{\"state\":{\"text\":true,\"flags\":{\"printing\":true}},"
+    "\"job\":{\"file\":{\"name\":true},\"estimatedPrintTime\":true},"
+    "\"progress\":{\"completion\":true},"
+    "\"temps\":[{\"actual\":true}]}";
+
+static const char REPLY[] =
+    "{\"state\": {\"text\": \"Printing \\\"benchy\\\" \\u0041\\u00e9 \\\\ \\/\",\n"
+    "  \"flags\": {\"printing\": true, \"ready\": false, \"skip\\\"ped\": [1, {\"a\": \"]}\"}]}},\n"
+    "\"skipped\": [[1, 2, {\"a\": [3, \"]}\\\"\"]}], {\"b\": {\"c\": \"{[\"}}, [[[[[[[[[[0]]]]]]]]]]],\n"
+    "\"job\": {\"file\": {\"name\": \"benchy.gcode\", \"size\": 1234}, \"estimatedPrintTime\": 5400.5,\n"
+    "  \"filament\": {\"tool0\": {\"length\": 10}}},\n"
+    "\"progress\": {\"completion\": 42.5, \"printTime\": null},\n"
+    "\"temps\": [{\"actual\": 210.1, \"target\": 210}, {\"actual\": 60, \"target\": 60}]}";
+
+static const char EXPECTED[] =
+    "{\"state\":{\"text\":\"Printing \\\"benchy\\\" \\u0041\\u00e9 \\\\ \\/\",\"flags\":{\"printing\":true}},"
+    "\"job\":{\"file\":{\"name\":\"benchy.gcode\"},\"estimatedPrintTime\":5400.5},"
+    "\"progress\":{\"completion\":42.5},"
+    "\"temps\":[{\"actual\":210.1},{\"actual\":60}]}";
+
+static DynamicJsonDocument filter(DOCUMENT_SIZE);
+static JsonStreamFilter stream;
+static char output[OUTPUT_SIZE];
+
+static void begin()
+{
+    memset(output, 'x', sizeof(output));
+    stream.setOutput(output, sizeof(output));
+    stream.begin(filter.as<JsonVariantConst>());
+}
+
+static void writeSplit(size_t split)
+{
+    size_t length = strlen(REPLY);
+
+    TEST_ASSERT_EQUAL(split, stream.write((const uint8_t*)REPLY, split));
+    TEST_ASSERT_EQUAL(length - split, stream.write((const uint8_t*)&REPLY[split], length - split));
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_filter_whole_reply()
+{
+    begin();
+    writeSplit(strlen(REPLY));
+
+    TEST_ASSERT_TRUE(stream.isComplete());
+    TEST_ASSERT_FALSE(stream.hasOverflowed());
+    TEST_ASSERT_EQUAL_STRING(EXPECTED, stream.getOutput());
+    TEST_ASSERT_EQUAL(strlen(EXPECTED), stream.length());
+}
+
+// the filter has no idea where the network splits the reply
+void test_split_at_every_byte()
+{
+    char message[32];
+
+    for(size_t split=0; split<=strlen(REPLY); split++)
+    {
+        snprintf(message, sizeof(message), "split at %u", (unsigned int)split);
+
+        begin();
+        writeSplit(split);
+
+        TEST_ASSERT_TRUE_MESSAGE(stream.isComplete(), message);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(EXPECTED, stream.getOutput(), message);
+    }
+}
+
+void test_byte_at_a_time()
+{
+    begin();
+    for(size_t i=0; i<strlen(REPLY); i++)
+    {
+        TEST_ASSERT_EQUAL(1, stream.write((uint8_t)REPLY[i]));
+    }
+
+    TEST_ASSERT_TRUE(stream.isComplete());
+    TEST_ASSERT_EQUAL_STRING(EXPECTED, stream.getOutput());
+}
+
+// escapes are copied as they are and decoded by the parser, an escaped quote
+// doesn't end the string and an escaped backslash doesn't escape the quote after it
+void test_string_escapes()
+{
+    DynamicJsonDocument document(DOCUMENT_SIZE);
+
+    begin();
+    writeSplit(strlen(REPLY));
+
+    TEST_ASSERT_EQUAL(DeserializationError::Ok, deserializeJson(document, stream.getOutput()).code());
+    TEST_ASSERT_EQUAL_STRING("Printing \"benchy\" A\xc3\xa9 \\ /", document["state"]["text"].as<const char*>());
+}
+
+// dropped arrays and objects can nest deeper than the filter can select and
+// hold brackets and quotes in strings, none of it reaches the output
+void test_skipped_nested_values()
+{
+    begin();
+    writeSplit(strlen(REPLY));
+
+    TEST_ASSERT_TRUE(stream.isComplete());
+    TEST_ASSERT_NULL(strstr(stream.getOutput(), "skip"));
+    TEST_ASSERT_NULL(strstr(stream.getOutput(), "ready"));
+    TEST_ASSERT_NULL(strstr(stream.getOutput(), "filament"));
+    TEST_ASSERT_NULL(strstr(stream.getOutput(), "target"));
+    TEST_ASSERT_NULL(strstr(stream.getOutput(), "[["));
+}
+
+// the write stops where the output runs out, what was kept stays terminated
+// inside the buffer and the stream never reports complete
+void test_output_overflow()
+{
+    char small[SMALL_OUTPUT_SIZE + 1];
+
+    memset(small, 'x', sizeof(small));
+    stream.setOutput(small, SMALL_OUTPUT_SIZE);
+    stream.begin(filter.as<JsonVariantConst>());
+
+    size_t taken = stream.write((const uint8_t*)REPLY, strlen(REPLY));
+
+    TEST_ASSERT_LESS_THAN(strlen(REPLY), taken);
+    TEST_ASSERT_TRUE(stream.hasOverflowed());
+    TEST_ASSERT_FALSE(stream.isComplete());
+    TEST_ASSERT_EQUAL(0, stream.write((const uint8_t*)REPLY, strlen(REPLY)));
+
+    TEST_ASSERT_LESS_THAN(SMALL_OUTPUT_SIZE, stream.length());
+    TEST_ASSERT_EQUAL(stream.length(), strlen(small));
+    TEST_ASSERT_EQUAL_MEMORY(EXPECTED, small, stream.length());
+    TEST_ASSERT_EQUAL('x', small[SMALL_OUTPUT_SIZE]);
+}
+
+// a reply cut off anywhere is never complete, what was kept is a terminated
+// start of the full output
+void test_truncated_input()
+{
+    char message[32];
+
+    for(size_t length=0; length<strlen(REPLY); length++)
+    {
+        snprintf(message, sizeof(message), "cut at %u", (unsigned int)length);
+
+        begin();
+        TEST_ASSERT_EQUAL(length, stream.write((const uint8_t*)REPLY, length));
+
+        TEST_ASSERT_FALSE_MESSAGE(stream.isComplete(), message);
+        TEST_ASSERT_FALSE_MESSAGE(stream.hasOverflowed(), message);
+        TEST_ASSERT_EQUAL_MESSAGE(stream.length(), strlen(stream.getOutput()), message);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(EXPECTED, stream.getOutput(), stream.length(), message);
+    }
+}
+
+// the output parses to what ArduinoJson's filter keeps from the whole reply
+void test_output_matches_arduino_json()
+{
+    DynamicJsonDocument kept(DOCUMENT_SIZE);
+    DynamicJsonDocument reference(DOCUMENT_SIZE);
+    String keptJson;
+    String referenceJson;
+
+    begin();
+    writeSplit(strlen(REPLY));
+
+    TEST_ASSERT_EQUAL(DeserializationError::Ok, deserializeJson(kept, stream.getOutput()).code());
+    TEST_ASSERT_EQUAL(DeserializationError::Ok, deserializeJson(reference, REPLY, DeserializationOption::Filter(filter)).code());
+
+    serializeJson(kept, keptJson);
+    serializeJson(reference, referenceJson);
+    TEST_ASSERT_EQUAL_STRING(referenceJson.c_str(), keptJson.c_str());
+}
+
+int main(int argc, char** argv)
+{
+    deserializeJson(filter, FILTER);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_filter_whole_reply);
+    RUN_TEST(test_split_at_every_byte);
+    RUN_TEST(test_byte_at_a_time);
+    RUN_TEST(test_string_escapes);
+    RUN_TEST(test_skipped_nested_values);
+    RUN_TEST(test_output_overflow);
+    RUN_TEST(test_truncated_input);
+    RUN_TEST(test_output_matches_arduino_json);
+    return UNITY_END();
+}
@@ -0,0 +1,92 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <TFT_eSPI.h>
+#include "FakeDevice.h"
+#include "FakeHttpServer.h"
+#include "SettingsManager.h"
+#include "OctoPrintMonitor.h"
+#include "OpenWeatherMapCurrent.h"
+
+// the firmware's globals
+extern SettingsManager settingsManager;
+extern OctoPrintMonitor octoPrintMonitor;
+extern OpenWeatherMapCurrent currentWeatherClient;
+
+static FakeHttpServer weatherServer(OPEN_WEATHER_HOST, OPEN_WEATHER_PORT);
+static FakeHttpServer octoPrintServer("octopi.local", 80);
+
+void setUp()
+{
+    FakeDevice::boot();
+}
+
+void tearDown()
+{
+}
+
+// the first boot has no settings, it comes up asking to be set up
+void test_boots_and_draws()
+{
+    TEST_ASSERT_EQUAL(0, settingsManager.getNumPrinters());
+    TEST_ASSERT_FALSE(settingsManager.getWeatherEnabled());
+    TEST_ASSERT_GREATER_THAN(0, FakePanel::getPixelsWritten());
+}
+
+void test_polls_printer_and_weather()
+{
+    settingsManager.beginUpdate();
+    settingsManager.setOpenWeatherApiKey("0123456789abcdef");
+    settingsManager.setOpenWeatherlocationID("2643743");
+    settingsManager.setWeatherEnabled(true);
+    settingsManager.addNewPrinter("octopi.local", 80, "", "", "B4D5E6F7", "Ender 3", true);
+    settingsManager.setCurrentDisplay(1);
+    settingsManager.commitUpdate();
+
+    FakeDevice::run(5 * SECONDS_MULT);
+
+    TEST_ASSERT_EQUAL(1, octoPrintServer.getHits("GET", OCTOPRINT_JOB));
+    TEST_ASSERT_EQUAL(1, octoPrintServer.getHits("GET", OCTOPRINT_PRINTER));
+    TEST_ASSERT_EQUAL(1, weatherServer.getHits("GET", "/data/2.5/weather?*"));
+    TEST_ASSERT_NOT_NULL(strstr(octoPrintServer.getLastRequest(), "X-Api-Key: B4D5E6F7\r\n"));
+
+    OctoPrintMonitorData* printer = octoPrintMonitor.getPrinterData(0);
+    TEST_ASSERT_TRUE(printer->validJobData);
+    TEST_ASSERT_TRUE(printer->validPrintData);
+    TEST_ASSERT_EQUAL_STRING("benchy_0.2mm_PLA.gcode", printer->fileName.c_str());
+    TEST_ASSERT_EQUAL(4237, printer->progress);
+    TEST_ASSERT_EQUAL(2146, printer->tool0Temp);
+    TEST_ASSERT_EQUAL(600, printer->bedTarget);
+    TEST_ASSERT_EQUAL_STRING("Printing", printer->printState.c_str());
+
+    OpenWeatherMapCurrentData* weather = currentWeatherClient.getCurrentData();
+    TEST_ASSERT_TRUE(weather->validData);
+    TEST_ASSERT_EQUAL_STRING("London", weather->location.c_str());
+    TEST_ASSERT_EQUAL_STRING("Light Rain", weather->description.c_str());
+}
+
+// polls again once the interval is up, on the connection kept from the first
+void test_polls_again_on_interval()
+{
+    unsigned long connections = octoPrintServer.getConnections();
+
+    FakeDevice::run(settingsManager.getPrintMonitorInterval());
+
+    TEST_ASSERT_EQUAL(2, octoPrintServer.getHits("GET", OCTOPRINT_JOB));
+    TEST_ASSERT_EQUAL(2, octoPrintServer.getHits("GET", OCTOPRINT_PRINTER));
+    TEST_ASSERT_EQUAL(connections, octoPrintServer.getConnections());
+}
+
+int main(int argc, char** argv)
+{
+    weatherServer.routeFixture("GET", "/data/2.5/weather?*", "openweather_current.http");
+    octoPrintServer.routeFixture("GET", OCTOPRINT_JOB, "octoprint_job_printing.http");
+    octoPrintServer.routeFixture("GET", OCTOPRINT_PRINTER, "octoprint_printer_printing.http");
+    octoPrintServer.routeFixture("POST", OCTOPRINT_LOGIN, "octoprint_login.http");
+    octoPrintServer.setWebSocket(OCTOPRINT_PUSH_SOCKET);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_boots_and_draws);
+    RUN_TEST(test_polls_printer_and_weather);
+    RUN_TEST(test_polls_again_on_interval);
+    return UNITY_END();
+}
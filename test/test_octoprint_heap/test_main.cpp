@@ -0,0 +1,212 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <FS.h>
+#include "FakeClock.h"
+#include "FakeHeap.h"
+#include "FakeHttpServer.h"
+#include "Fixtures.h"
+#include "AsyncHttpClient.h"
+#include "JsonArena.h"
+#include "SettingsManager.h"
+#include "OctoPrintMonitor.h"
+
+// Feeds recorded OctoPrint replies through OctoPrintMonitor and checks the
+// heap. Replies are filtered into the connection's body buffer as they arrive
+// and parsed in place into the JSON arena, so once a printer has been polled a poll shouldn't need the heap
+// for anything near the size of a reply or a document.
+
+#define FARM_HOST           "octopi-farm.local"
+#define POLL_PEAK_LIMIT     256     // bytes, a reply or document on the heap is several KB
+#define POLL_TIMEOUT        (5 * SECONDS_MULT)
+
+// the farm printer reply is bigger than any buffer the firmware has for it
+#define FARM_REPLY_MIN      8192
+// filtered printer document, two members at the top, two in temperature, tool0,
+// bed and state and eleven flags. Strings stay in the body, only slots are used
+#define FARM_PRINTER_DOCUMENT   JSON_OBJECT_SIZE(2 + 2 + 2 + 2 + 2 + 11)
+
+static SettingsManager settings;
+static OctoPrintMonitor monitor;
+static FakeHttpServer farm(FARM_HOST, 80);
+static int updates = 0;
+
+static void printerUpdated(int printerId)
+{
+    updates++;
+}
+
+// one round of polling, finished once the printer has been updated
+static void poll()
+{
+    int expected = updates + 1;
+
+    monitor.update();
+    for(unsigned long waited = 0; updates < expected && waited < POLL_TIMEOUT; waited++)
+    {
+        AsyncHttpClient::pollAll();
+        monitor.poll();
+        FakeNetwork::run();
+        FakeClock::advance(1);
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(expected, updates, "printer wasn't updated");
+}
+
+// the recorded printer reply sent chunked instead
+static void routeChunked(const char* method, const char* path, const char* fixture)
+{
+    static char recorded[FAKE_HTTP_BODY_SIZE];
+    static char response[FAKE_HTTP_HEAD_SIZE + FAKE_HTTP_BODY_SIZE];
+
+    TEST_ASSERT_GREATER_THAN(0, Fixtures::load(fixture, recorded, sizeof(recorded)));
+    const char* body = strstr(recorded, "\n\n");
+    TEST_ASSERT_NOT_NULL(body);
+
+    snprintf(response, sizeof(response), "HTTP/1.1 200 OK\nContent-Type: application/json\nTransfer-Encoding: chunked\n\n%s", body + 2);
+    TEST_ASSERT_TRUE(farm.route(method, path, response));
+}
+
+static void reportPeak(const char* poll)
+{
+    char message[96];
+
+    snprintf(message, sizeof(message), "%s: peak %ld bytes, retained %ld, %lu allocations", poll,
+        FakeHeap::getPeak(), FakeHeap::getUsed(), FakeHeap::getAllocations());
+    TEST_MESSAGE(message);
+}
+
+void setUp()
+{
+    farm.setSegmentSize(FAKE_NETWORK_SEGMENT);
+    TEST_ASSERT_TRUE(farm.routeFixture("GET", OCTOPRINT_JOB, "octoprint_job_farm.http"));
+    TEST_ASSERT_TRUE(farm.routeFixture("GET", OCTOPRINT_PRINTER, "octoprint_printer_farm.http"));
+}
+
+void tearDown()
+{
+}
+
+// a printer with five tools, a chamber and thirty temperature history samples
+void test_farm_printer_parses()
+{
+    static char recorded[FAKE_HTTP_BODY_SIZE];
+    const char* body;
+
+    TEST_ASSERT_GREATER_THAN(0, Fixtures::load("octoprint_printer_farm.http", recorded, sizeof(recorded)));
+    body = strstr(recorded, "\n\n");
+    TEST_ASSERT_NOT_NULL(body);
+    TEST_ASSERT_GREATER_OR_EQUAL(FARM_REPLY_MIN, strlen(body + 2));
+    TEST_ASSERT_GREATER_THAN(OCTOPRINT_HTTP_BODY_SIZE, strlen(body + 2));
+
+    poll();
+
+    OctoPrintMonitorData* data = monitor.getPrinterData(0);
+    TEST_ASSERT_TRUE(data->validPrintData);
+    TEST_ASSERT_TRUE(data->validJobData);
+    TEST_ASSERT_EQUAL(2497, data->tool0Temp);
+    TEST_ASSERT_EQUAL(2500, data->tool0Target);
+    TEST_ASSERT_EQUAL(849, data->bedTemp);
+    TEST_ASSERT_EQUAL(850, data->bedTarget);
+    TEST_ASSERT_EQUAL_STRING("Printing", data->printState.c_str());
+    TEST_ASSERT_EQUAL(PRINT_STATE_OPERATIONAL | PRINT_STATE_PRINTING | PRINT_STATE_SD_READY, data->printerFlags);
+
+    TEST_ASSERT_TRUE(data->jobLoaded);
+    TEST_ASSERT_EQUAL_STRING("Enclosure side panel left (PETG, 0.28mm, 4 walls, support).gcode", data->fileName.c_str());
+    TEST_ASSERT_EQUAL(6708, data->progress);
+    TEST_ASSERT_EQUAL(31877, data->estimatedPrintTime);
+    TEST_ASSERT_EQUAL(18234, data->filamentLength);
+    TEST_ASSERT_EQUAL(20466, data->printTimeElapsed);
+    TEST_ASSERT_EQUAL(10245, data->printTimeRemaining);
+
+    // parsed in the arena, never a document on the heap. The job document is
+    // smaller so the high water is the printer document
+    JsonArenaStats* arena = JsonArena::getStats();
+    TEST_ASSERT_EQUAL(0, arena->fallbacks);
+    TEST_ASSERT_GREATER_THAN(0, arena->highWater);
+    TEST_ASSERT_LESS_OR_EQUAL(FARM_PRINTER_DOCUMENT, arena->highWater);
+}
+
+void test_poll_peak_heap()
+{
+    FakeHeap::rebase();
+    poll();
+    reportPeak("poll");
+
+    TEST_ASSERT_LESS_OR_EQUAL(POLL_PEAK_LIMIT, FakeHeap::getPeak());
+    TEST_ASSERT_EQUAL(0, FakeHeap::getUsed());
+}
+
+// arriving in small segments and chunks changes nothing, each segment goes
+// through the filter as it comes
+void test_chunked_reply_peak_heap()
+{
+    routeChunked("GET", OCTOPRINT_PRINTER, "octoprint_printer_farm.http");
+    farm.setSegmentSize(64);
+
+    FakeHeap::rebase();
+    poll();
+    reportPeak("chunked poll");
+
+    TEST_ASSERT_LESS_OR_EQUAL(POLL_PEAK_LIMIT, FakeHeap::getPeak());
+    TEST_ASSERT_EQUAL(0, FakeHeap::getUsed());
+
+    OctoPrintMonitorData* data = monitor.getPrinterData(0);
+    TEST_ASSERT_TRUE(data->validPrintData);
+    TEST_ASSERT_EQUAL(2497, data->tool0Temp);
+    TEST_ASSERT_EQUAL(849, data->bedTemp);
+}
+
+// a reply that doesn't parse marks the data invalid without touching the heap
+void test_truncated_reply_peak_heap()
+{
+    TEST_ASSERT_TRUE(farm.route("GET", OCTOPRINT_PRINTER, "HTTP/1.1 200 OK\nContent-Type: application/json\n\n"
+        "{\"state\":{\"flags\":{\"operational\":true},\"text\":\"Operational\"},\"temperature\":{\"bed\":{\"actual\":2"));
+
+    FakeHeap::rebase();
+    poll();
+    reportPeak("truncated poll");
+
+    TEST_ASSERT_LESS_OR_EQUAL(POLL_PEAK_LIMIT, FakeHeap::getPeak());
+    TEST_ASSERT_EQUAL(0, FakeHeap::getUsed());
+    TEST_ASSERT_FALSE(monitor.getPrinterData(0)->validPrintData);
+}
+
+// a header line longer than the client's line buffer fails the request rather
+// than growing a string on the heap
+void test_long_header_line()
+{
+    static char padding[ASYNC_HTTP_LINE_SIZE + 1];
+    static char response[FAKE_HTTP_HEAD_SIZE];
+
+    memset(padding, 'a', ASYNC_HTTP_LINE_SIZE);
+    padding[ASYNC_HTTP_LINE_SIZE] = 0;
+    snprintf(response, sizeof(response), "HTTP/1.1 200 OK\nContent-Type: application/json\nX-Padding: %s\n\n"
+        "{\"state\":{\"flags\":{\"operational\":true},\"text\":\"Operational\"}}", padding);
+    TEST_ASSERT_TRUE(farm.route("GET", OCTOPRINT_PRINTER, response));
+
+    FakeHeap::rebase();
+    poll();
+    reportPeak("long header poll");
+
+    TEST_ASSERT_LESS_OR_EQUAL(POLL_PEAK_LIMIT, FakeHeap::getPeak());
+    TEST_ASSERT_EQUAL(0, FakeHeap::getUsed());
+    TEST_ASSERT_FALSE(monitor.getPrinterData(0)->validPrintData);
+}
+
+int main(int argc, char** argv)
+{
+    SPIFFS.begin();
+    SPIFFS.format();
+
+    settings.init();
+    settings.addNewPrinter(FARM_HOST, 80, "", "", "B4D5E6F7", "Farm 1", true);
+    monitor.init(&settings);
+    monitor.setPrinterUpdatedCallback(printerUpdated);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_farm_printer_parses);
+    RUN_TEST(test_poll_peak_heap);
+    RUN_TEST(test_chunked_reply_peak_heap);
+    RUN_TEST(test_truncated_reply_peak_heap);
+    RUN_TEST(test_long_header_line);
+    return UNITY_END();
+}
@@ -0,0 +1,240 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <FS.h>
+#include "FakeClock.h"
+#include "FakeHeap.h"
+#include "FakeHttpServer.h"
+#include "Fixtures.h"
+#include "AsyncHttpClient.h"
+#include "SettingsManager.h"
+#include "OctoPrintMonitor.h"
+
+// Replays a push stream recorded from OctoPrint 1.5 through a stand in server
+// and checks OctoPrintMonitor keeps the printer up to date from it, catches the
+// pause between two polls and goes back to polling when the socket drops. Needs
+// OCTOPRINT_PUSH_MODE, run with pio test -e native_push.
+
+#define PRINTER_HOST        "octopi.local"
+#define PUSH_STREAM         "octoprint_push_printing.txt"
+#define PUSH_STREAM_SIZE    32768
+#define PUSH_MESSAGES       16
+#define MESSAGE_STEPS       10      // loop passes given to each message
+#define OPEN_TIMEOUT        (5 * SECONDS_MULT)
+
+static SettingsManager settings;
+static OctoPrintMonitor monitor;
+static FakeHttpServer octoPrint(PRINTER_HOST, 80);
+
+static char stream[PUSH_STREAM_SIZE];
+static char* messages[PUSH_MESSAGES];
+static int messageCount = 0;
+
+// the state of each update, in order
+static int updates = 0;
+static uint16_t updateFlags[PUSH_MESSAGES];
+
+static void printerUpdated(int printerId)
+{
+    if(updates < PUSH_MESSAGES)
+    {
+        updateFlags[updates] = monitor.getPrinterData(printerId)->printerFlags;
+    }
+    updates++;
+}
+
+// one pass of the firmware's loop, as far as the monitor is concerned
+static void step()
+{
+    AsyncHttpClient::pollAll();
+    monitor.poll();
+    FakeNetwork::run();
+    FakeClock::advance(1);
+}
+
+// the recording holds one message per line
+void test_stream_loads()
+{
+    TEST_ASSERT_GREATER_THAN(0, Fixtures::load(PUSH_STREAM, stream, sizeof(stream)));
+
+    for(char* line = strtok(stream, "\n"); line != nullptr && messageCount < PUSH_MESSAGES; line = strtok(nullptr, "\n"))
+    {
+        messages[messageCount++] = line;
+    }
+    TEST_ASSERT_EQUAL(12, messageCount);
+}
+
+// the client keeps one message, the recording is sent a message per pass like OctoPrint's throttled socket
+static void replay(int first, int last)
+{
+    for(int i=first; i<=last; i++)
+    {
+        TEST_ASSERT_EQUAL(1, octoPrint.pushText(messages[i]));
+        for(int j=0; j<MESSAGE_STEPS; j++)
+        {
+            step();
+        }
+    }
+}
+
+static bool sawFlags(uint16_t flags)
+{
+    for(int i=0; i<updates && i<PUSH_MESSAGES; i++)
+    {
+        if(updateFlags[i] & flags)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+// logs in passively, upgrades and authenticates the socket with the session
+void test_subscribes()
+{
+    monitor.setPushPrinter(0);
+    for(unsigned long waited = 0; octoPrint.getOpenSockets() == 0 && waited < OPEN_TIMEOUT; waited++)
+    {
+        step();
+    }
+    step();
+
+    TEST_ASSERT_EQUAL(1, octoPrint.getOpenSockets());
+    TEST_ASSERT_EQUAL(1, octoPrint.getHits("POST", OCTOPRINT_LOGIN));
+    TEST_ASSERT_EQUAL(1, monitor.getPushStats()->subscribes);
+
+    // auth, throttle and the subscription
+    TEST_ASSERT_EQUAL(3, octoPrint.getSocketMessages());
+    TEST_ASSERT_NOT_NULL(strstr(octoPrint.getLastSocketMessage(), "\"subscribe\""));
+}
+
+// connected and history come first, history is too big to keep and is dropped
+void test_connect_messages()
+{
+    replay(0, 1);
+
+    TEST_ASSERT_EQUAL(1, monitor.getPushStats()->messages);
+    TEST_ASSERT_EQUAL(1, monitor.getPushStats()->dropped);
+    TEST_ASSERT_EQUAL(0, updates);
+    TEST_ASSERT_FALSE(monitor.getPrinterData(0)->validPrintData);
+}
+
+void test_current_messages_update_printer()
+{
+    FakeHeap::rebase();
+    replay(2, 4);
+
+    // the plugin message between them is ignored
+    TEST_ASSERT_EQUAL(2, updates);
+
+    OctoPrintMonitorData* data = monitor.getPrinterData(0);
+    TEST_ASSERT_TRUE(data->validPrintData);
+    TEST_ASSERT_TRUE(data->validJobData);
+    TEST_ASSERT_TRUE(data->jobLoaded);
+    TEST_ASSERT_EQUAL_STRING("benchy_0.2mm_PLA.gcode", data->fileName.c_str());
+    TEST_ASSERT_EQUAL_STRING("Printing", data->printState.c_str());
+    TEST_ASSERT_EQUAL(PRINT_STATE_OPERATIONAL | PRINT_STATE_PRINTING | PRINT_STATE_SD_READY, data->printerFlags);
+    TEST_ASSERT_EQUAL(4281, data->progress);
+    TEST_ASSERT_EQUAL(3540, data->printTimeElapsed);
+    TEST_ASSERT_EQUAL(4781, data->printTimeRemaining);
+    TEST_ASSERT_EQUAL(8436, data->estimatedPrintTime);
+    TEST_ASSERT_EQUAL(4127, data->filamentLength);
+
+    // newest of the samples sent with the message
+    TEST_ASSERT_EQUAL(2151, data->tool0Temp);
+    TEST_ASSERT_EQUAL(2150, data->tool0Target);
+    TEST_ASSERT_EQUAL(601, data->bedTemp);
+    TEST_ASSERT_EQUAL(600, data->bedTarget);
+
+    // parsed in place from the socket's buffer, nothing is left on the heap
+    TEST_ASSERT_EQUAL(0, FakeHeap::getUsed());
+}
+
+// the printer on the socket isn't polled while messages arrive
+void test_not_polled_while_pushing()
+{
+    monitor.update();
+    for(int i=0; i<MESSAGE_STEPS; i++)
+    {
+        step();
+    }
+
+    TEST_ASSERT_EQUAL(0, octoPrint.getHits("GET", OCTOPRINT_JOB));
+    TEST_ASSERT_EQUAL(0, octoPrint.getHits("GET", OCTOPRINT_PRINTER));
+}
+
+// a pause and resume within one poll interval, polling would only see it still printing
+void test_pause_is_captured()
+{
+    replay(5, messageCount - 1);
+
+    TEST_ASSERT_EQUAL(7, updates);
+    TEST_ASSERT_TRUE(sawFlags(PRINT_STATE_PAUSING));
+    TEST_ASSERT_TRUE(sawFlags(PRINT_STATE_PAUSED));
+    TEST_ASSERT_TRUE(sawFlags(PRINT_STATE_RESUMING));
+    TEST_ASSERT_EQUAL(1, monitor.getPushStats()->dropped);
+
+    OctoPrintMonitorData* data = monitor.getPrinterData(0);
+    TEST_ASSERT_EQUAL_STRING("Printing", data->printState.c_str());
+    TEST_ASSERT_EQUAL(4305, data->progress);
+    TEST_ASSERT_EQUAL(2151, data->tool0Temp);
+    TEST_ASSERT_EQUAL(600, data->bedTemp);
+}
+
+// the printer is polled as soon as the socket drops and subscribed again after the retry interval
+void test_falls_back_to_polling()
+{
+    int expected = updates + 1;
+
+    octoPrint.hangUpAll();
+    for(unsigned long waited = 0; updates < expected && waited < OPEN_TIMEOUT; waited++)
+    {
+        step();
+    }
+
+    TEST_ASSERT_EQUAL(expected, updates);
+    TEST_ASSERT_EQUAL(1, octoPrint.getHits("GET", OCTOPRINT_JOB));
+    TEST_ASSERT_EQUAL(1, octoPrint.getHits("GET", OCTOPRINT_PRINTER));
+    TEST_ASSERT_EQUAL(4237, monitor.getPrinterData(0)->progress);
+
+    for(unsigned long waited = 0; octoPrint.getOpenSockets() == 0 && waited < OCTOPRINT_PUSH_RETRY_INTERVAL + OPEN_TIMEOUT; waited++)
+    {
+        step();
+    }
+
+    TEST_ASSERT_EQUAL(1, octoPrint.getOpenSockets());
+    TEST_ASSERT_EQUAL(2, monitor.getPushStats()->subscribes);
+}
+
+int main(int argc, char** argv)
+{
+    SPIFFS.begin();
+    SPIFFS.format();
+
+    octoPrint.routeFixture("POST", OCTOPRINT_LOGIN, "octoprint_login.http");
+    octoPrint.routeFixture("GET", OCTOPRINT_JOB, "octoprint_job_printing.http");
+    octoPrint.routeFixture("GET", OCTOPRINT_PRINTER, "octoprint_printer_printing.http");
+    octoPrint.setWebSocket(OCTOPRINT_PUSH_SOCKET);
+
+    settings.init();
+    settings.addNewPrinter(PRINTER_HOST, 80, "", "", "B4D5E6F7", "Ender 3", true);
+    monitor.init(&settings);
+    monitor.setPrinterUpdatedCallback(printerUpdated);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_stream_loads);
+    RUN_TEST(test_subscribes);
+    RUN_TEST(test_connect_messages);
+    RUN_TEST(test_current_messages_update_printer);
+    RUN_TEST(test_not_polled_while_pushing);
+    RUN_TEST(test_pause_is_captured);
+    RUN_TEST(test_falls_back_to_polling);
+    return UNITY_END();
+}
@@ -0,0 +1,114 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "FakeDevice.h"
+#include "FakeHttpServer.h"
+#include "HeapMetrics.h"
+#include "SettingsManager.h"
+#include "OctoPrintMonitor.h"
+#include "OpenWeatherMapCurrent.h"
+
+// Runs the firmware's loop against the fakes past the warm up with a printer
+// and the weather set up, then fails on any allocation counted in a subsystem
+// from then on. Needs STATIC_ALLOCATION_MODE and the malloc wrappers, run with
+// pio test -e native_static.
+
+#define STEADY_STATE        (15 * MINUTES_MULT)     // past the weather interval, printer polls throughout
+
+// the firmware's globals
+extern SettingsManager settingsManager;
+extern OctoPrintMonitor octoPrintMonitor;
+
+static FakeHttpServer weatherServer(OPEN_WEATHER_HOST, OPEN_WEATHER_PORT);
+static FakeHttpServer octoPrintServer("octopi.local", 80);
+
+static unsigned long countedAllocations()
+{
+    unsigned long allocations = 0;
+
+    for(int i=0; i<HeapSubsystem_Count; i++)
+    {
+        allocations += HeapMetrics::getStats((HeapSubsystem)i)->allocations;
+    }
+    return allocations;
+}
+
+void setUp()
+{
+    FakeDevice::boot();
+}
+
+void tearDown()
+{
+}
+
+// nothing is counted until the warm up is over
+void test_warm_up()
+{
+    settingsManager.beginUpdate();
+    settingsManager.setOpenWeatherApiKey("0123456789abcdef");
+    settingsManager.setOpenWeatherlocationID("2643743");
+    settingsManager.setWeatherEnabled(true);
+    settingsManager.addNewPrinter("octopi.local", 80, "", "", "B4D5E6F7", "Ender 3", true);
+    settingsManager.setCurrentDisplay(1);
+    settingsManager.commitUpdate();
+
+    FakeDevice::run(STATIC_ALLOCATION_WARMUP + METRICS_INTERVAL);
+
+    TEST_ASSERT_TRUE(octoPrintMonitor.getPrinterData(0)->validPrintData);
+    TEST_ASSERT_GREATER_THAN(0, weatherServer.getHits("GET", "/data/2.5/weather?*"));
+    TEST_ASSERT_EQUAL(0, countedAllocations());
+}
+
+void test_steady_state_allocations()
+{
+    char message[96];
+    unsigned long polls = octoPrintServer.getHits("GET", OCTOPRINT_JOB);
+    unsigned long weather = weatherServer.getHits("GET", "/data/2.5/weather?*");
+
+    FakeDevice::run(STEADY_STATE);
+    snprintf(message, sizeof(message), "%lu loops, %lu ms", FakeDevice::getLoops(), millis());
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_GREATER_THAN(polls, octoPrintServer.getHits("GET", OCTOPRINT_JOB));
+    TEST_ASSERT_GREATER_THAN(weather, weatherServer.getHits("GET", "/data/2.5/weather?*"));
+
+    for(int i=0; i<HeapSubsystem_Count; i++)
+    {
+        HeapSubsystemStats* stats = HeapMetrics::getStats((HeapSubsystem)i);
+
+        snprintf(message, sizeof(message), "%s: %lu allocations, last %u bytes",
+            HeapMetrics::getName((HeapSubsystem)i), stats->allocations, (unsigned int)stats->lastAllocationSize);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_EQUAL_MESSAGE(0, stats->allocations, HeapMetrics::getName((HeapSubsystem)i));
+    }
+}
+
+// the wrappers are linked in and counting, so the zeros above mean something
+void test_allocation_is_counted()
+{
+    unsigned long before = HeapMetrics::getStats(HeapSubsystem_Display)->allocations;
+
+    {
+        HeapProbe probe(HeapSubsystem_Display);
+        void* volatile block = malloc(16);
+        free(block);
+    }
+
+    TEST_ASSERT_EQUAL(before + 1, HeapMetrics::getStats(HeapSubsystem_Display)->allocations);
+    TEST_ASSERT_EQUAL(16, HeapMetrics::getStats(HeapSubsystem_Display)->lastAllocationSize);
+}
+
+int main(int argc, char** argv)
+{
+    weatherServer.routeFixture("GET", "/data/2.5/weather?*", "openweather_current.http");
+    octoPrintServer.routeFixture("GET", OCTOPRINT_JOB, "octoprint_job_printing.http");
+    octoPrintServer.routeFixture("GET", OCTOPRINT_PRINTER, "octoprint_printer_printing.http");
+    octoPrintServer.routeFixture("POST", OCTOPRINT_LOGIN, "octoprint_login.http");
+    octoPrintServer.setWebSocket(OCTOPRINT_PUSH_SOCKET);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_warm_up);
+    RUN_TEST(test_steady_state_allocations);
+    RUN_TEST(test_allocation_is_counted);
+    return UNITY_END();
+}
@@ -0,0 +1,199 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <TFT_eSPI.h>
+#include "DisplayTFT.h"
+#include "tempArcTable.h"
+
+// Counts the triangles the temperature gauges push to the panel while a
+// printer heats up, holds and cools down, against what the trig based fillArc
+// they replaced would have drawn for the same updates. It redrew the whole arc,
+// two triangles for each of the TEMP_ARC_SEGMENTS, whenever the temperature
+// moved a segment, working out every vertex with cos and sin.
+
+#define UPDATE_TOOL         0
+#define UPDATE_BED          1
+#define DEG2RAD             0.0174532925    // as the old fillArc used
+
+static DisplayTFT* display = nullptr;
+static uint16_t incremental[TFT_WIDTH * TFT_HEIGHT];
+static OctoPrintMonitorData printer;
+
+// the gauges as the old code tracked them, segments shown and trig calls made
+static int oldSegments[2];
+static unsigned long oldTriangles;
+static unsigned long oldTrigCalls;
+
+// the old drawTempArc, counting instead of drawing
+static void oldDrawTempArc(int gauge, float value, float max)
+{
+    float temp = min(value, max);
+    float segments = ((temp / max) * TEMP_ARC_SPAN) / TEMP_ARC_DEGREE_PER_SEG;
+
+    if((int)segments == oldSegments[gauge])
+    {
+        return;
+    }
+    oldSegments[gauge] = (int)segments;
+
+    float background = ((max - temp) / max * TEMP_ARC_SPAN) / TEMP_ARC_DEGREE_PER_SEG;
+
+    // a fillArc call for each colour, a cos and sin for its first vertex and for every segment
+    oldTriangles += 2 * ((int)segments + (int)background);
+    oldTrigCalls += 2 * (2 + (int)segments + (int)background);
+}
+
+// the gauges for one status update, returns the triangles pushed
+static unsigned long update(int16_t tool, int16_t bed)
+{
+    printer.tool0Temp = tool;
+    printer.bedTemp = bed;
+
+    FakePanel::resetTrianglesDrawn();
+    display->drawOctoPrintStatus(&printer, "Ender 3", true);
+
+    oldDrawTempArc(UPDATE_TOOL, tool / 10.0f, TOOL_TEMP_MAX);
+    oldDrawTempArc(UPDATE_BED, bed / 10.0f, BED_TEMP_MAX);
+
+    return FakePanel::getTrianglesDrawn();
+}
+
+static void report(const char* run, unsigned long triangles)
+{
+    char message[128];
+
+    snprintf(message, sizeof(message), "%s: %lu triangles, trig fillArc %lu triangles and %lu cos/sin calls",
+        run, triangles, oldTriangles, oldTrigCalls);
+    TEST_MESSAGE(message);
+}
+
+void setUp()
+{
+    if(display == nullptr)
+    {
+        display = new DisplayTFT();
+    }
+
+    printer.fileName = "benchy_0.2mm_PLA.gcode";
+    printer.jobState = "Printing";
+    printer.printState = "Printing";
+    printer.printerFlags = PRINT_STATE_OPERATIONAL | PRINT_STATE_PRINTING;
+    printer.jobLoaded = true;
+    printer.tool0Target = 2150;
+    printer.bedTarget = 600;
+    printer.validJobData = true;
+    printer.validPrintData = true;
+
+    display->setDisplayMode(DisplayMode_PrintMonitor);
+    display->clearDisplay();
+
+    oldSegments[UPDATE_TOOL] = oldSegments[UPDATE_BED] = -1;
+    oldTriangles = 0;
+    oldTrigCalls = 0;
+}
+
+void tearDown()
+{
+}
+
+// the first draw fills every segment in one colour or the other, the old one
+// truncated both parts and could leave a segment between them undrawn
+void test_first_draw()
+{
+    unsigned long triangles = update(221, 219);
+    report("first draw", triangles);
+
+    TEST_ASSERT_EQUAL(4 * TEMP_ARC_SEGMENTS, triangles);
+}
+
+// a poll every 2 seconds from cold to 215C and 60C, then holding within half a degree
+void test_heat_up_and_hold()
+{
+    unsigned long triangles = update(221, 219);
+
+    for(int i=1; i<=130; i++)
+    {
+        triangles += update(min(221 + i * 15, 2150), min(219 + i * 4, 600));
+    }
+    for(int i=0; i<150; i++)
+    {
+        triangles += update(2150 + (i % 9) - 4, 600 + (i % 5) - 2);
+    }
+    report("heat up and hold", triangles);
+
+    // a segment is 1 degree of bed or 3.125 of tool, each step of the heat up only fills the ones passed
+    TEST_ASSERT_LESS_THAN(oldTriangles / 10, triangles);
+}
+
+void test_cool_down()
+{
+    unsigned long triangles = update(2150, 600);
+
+    for(int i=1; i<=200; i++)
+    {
+        triangles += update(max(2150 - i * 12, 240), max(600 - i * 3, 230));
+    }
+    report("cool down", triangles);
+
+    TEST_ASSERT_LESS_THAN(oldTriangles / 10, triangles);
+}
+
+// filling and erasing only what changed leaves the gauges as a full draw would
+void test_incremental_matches_full_draw()
+{
+    update(221, 219);
+    update(1844, 511);
+    update(2150, 600);
+    update(1203, 598);
+    update(1212, 602);
+    update(2493, 1000);
+    update(37, 990);
+    memcpy(incremental, FakePanel::getFrame(), sizeof(incremental));
+
+    display->clearDisplay();
+    update(37, 990);
+
+    TEST_ASSERT_EQUAL_MEMORY(incremental, FakePanel::getFrame(), sizeof(incremental));
+}
+
+// the table holds the offsets the old code's float maths put on screen, where
+// float cos and sin land the other side of a whole pixel it can be one off
+void test_table_matches_trig()
+{
+    char message[64];
+    int x = TOOL_TEMP_DISPLAY_X;
+    int y = TOOL_TEMP_DISPLAY_Y;
+    int moved = 0;
+
+    for(int i=0; i<=TEMP_ARC_SEGMENTS; i++)
+    {
+        ArcVertex vertex;
+        float sx = cos((TEMP_ARC_START + i * TEMP_ARC_DEGREE_PER_SEG - 90) * DEG2RAD);
+        float sy = sin((TEMP_ARC_START + i * TEMP_ARC_DEGREE_PER_SEG - 90) * DEG2RAD);
+        int old[4] = {
+            (int)(sx * (TEMP_ARC_RADIUS - TEMP_ARC_WIDTH) + x), (int)(sy * (TEMP_ARC_RADIUS - TEMP_ARC_WIDTH) + y),
+            (int)(sx * TEMP_ARC_RADIUS + x), (int)(sy * TEMP_ARC_RADIUS + y) };
+
+        memcpy_P(&vertex, &tempArcVertices[i], sizeof(ArcVertex));
+        int table[4] = { x + vertex.innerX, y + vertex.innerY, x + vertex.outerX, y + vertex.outerY };
+
+        for(int j=0; j<4; j++)
+        {
+            TEST_ASSERT_INT_WITHIN(1, old[j], table[j]);
+            moved += old[j] != table[j];
+        }
+    }
+
+    snprintf(message, sizeof(message), "%d of %d vertex coordinates one pixel off", moved, 4 * (TEMP_ARC_SEGMENTS + 1));
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_first_draw);
+    RUN_TEST(test_heat_up_and_hold);
+    RUN_TEST(test_cool_down);
+    RUN_TEST(test_incremental_matches_full_draw);
+    RUN_TEST(test_table_matches_trig);
+    return UNITY_END();
+}
@@ -0,0 +1,210 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <time.h>
+#include <TFT_eSPI.h>
+#include "FakeHeap.h"
+#include "TextLayout.h"
+
+// Compares TextLayout::truncate with the loop it replaced, which took a
+// character off a String and measured the whole string again until it fit,
+// then added the ellipsis. Checks the cut is the longest that fits with the
+// ellipsis and measures both on file names from the slicer.
+
+#define FILE_NAME_WIDTH     260     // drawJobInfo's width on the 320 wide screen
+#define BENCHMARK_CUTS      2000
+#define BENCHMARK_WIDTHS    (TEXT_LAYOUT_CACHE_SIZE + 1)    // more than are cached, every cut is worked out
+
+static TFT_eSPI tft;
+static TextLayout layout;
+
+static const char* fileNames[] = {
+    "benchy_0.2mm_PLA.gcode",
+    "Enclosure side panel left (PETG, 0.28mm, 4 walls, support).gcode",
+    "CE3PRO_Voron_StealthBurner_main_body_ASA_0.2mm_40pct_gyroid_tree_supports_brim_ironing_top_v2.1_final.gcode",
+    "Plate_3_of_7__Hinge_pins_x24__Lid_latch_x6__PETG_0.16mm_variable_layer_height_seam_rear_no_supports_MK3S.gcode",
+};
+
+static unsigned long nanos()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ul + now.tv_nsec;
+}
+
+// the old loop from drawJobInfo
+static String oldTruncate(const String& text, int width)
+{
+    String file = text;
+    bool truncated = false;
+
+    while(tft.textWidth(file) > width)
+    {
+        truncated = true;
+        file = file.substring(0, file.length()-1);
+    }
+
+    if(truncated)
+    {
+        file = file + "...";
+    }
+
+    return file;
+}
+
+// characters kept by the longest cut that fits with the ellipsis, measured the slow way
+static size_t longestCut(const char* text, int width)
+{
+    char buffer[160];
+    size_t length = strlen(text);
+
+    if(tft.textWidth(text) <= width)
+    {
+        return length;
+    }
+
+    for(size_t kept = length; kept > 0; kept--)
+    {
+        snprintf(buffer, sizeof(buffer), "%.*s...", (int)kept - 1, text);
+        if(tft.textWidth(buffer) <= width)
+        {
+            return kept - 1;
+        }
+    }
+    return 0;
+}
+
+void setUp()
+{
+    tft.setTextFont(2);
+}
+
+void tearDown()
+{
+}
+
+void test_short_text_unchanged()
+{
+    char buffer[128];
+    String old = oldTruncate(fileNames[0], FILE_NAME_WIDTH);
+
+    layout.truncate(buffer, sizeof(buffer), fileNames[0], FILE_NAME_WIDTH);
+    TEST_ASSERT_EQUAL_STRING(fileNames[0], buffer);
+    TEST_ASSERT_EQUAL_STRING(fileNames[0], old.c_str());
+}
+
+// the longest prefix that leaves room for the ellipsis, the old loop let the ellipsis run past the width
+void test_cut_fits()
+{
+    char buffer[128];
+    char message[96];
+
+    for(size_t i=1; i<sizeof(fileNames) / sizeof(fileNames[0]); i++)
+    {
+        size_t kept = longestCut(fileNames[i], FILE_NAME_WIDTH);
+
+        layout.truncate(buffer, sizeof(buffer), fileNames[i], FILE_NAME_WIDTH);
+        String old = oldTruncate(fileNames[i], FILE_NAME_WIDTH);
+
+        snprintf(message, sizeof(message), "%u characters: %d wide, old loop %d wide",
+            (unsigned int)strlen(fileNames[i]), tft.textWidth(buffer), tft.textWidth(old));
+        TEST_MESSAGE(message);
+
+        TEST_ASSERT_EQUAL(kept + 3, strlen(buffer));
+        TEST_ASSERT_EQUAL(0, strncmp(buffer, fileNames[i], kept));
+        TEST_ASSERT_EQUAL_STRING("...", buffer + kept);
+        TEST_ASSERT_LESS_OR_EQUAL(FILE_NAME_WIDTH, tft.textWidth(buffer));
+        TEST_ASSERT_EQUAL(tft.textWidth(fileNames[i]), layout.textWidth(fileNames[i], 2));
+    }
+}
+
+// a small buffer keeps the ellipsis
+void test_cut_to_buffer()
+{
+    char buffer[16];
+
+    layout.truncate(buffer, sizeof(buffer), fileNames[2], FILE_NAME_WIDTH);
+    TEST_ASSERT_EQUAL_STRING("CE3PRO_Voron...", buffer);
+}
+
+// a cut never lands inside a UTF-8 sequence
+void test_cut_utf8()
+{
+    const char* text = "Gehäuse_Rückwand_Lüfterhalterung_Kabelführung_Klemmbügel_Übergröße.gcode";
+    char buffer[128];
+
+    for(int width = 40; width < 200; width++)
+    {
+        layout.truncate(buffer, sizeof(buffer), text, width);
+        size_t kept = strlen(buffer) - 3;
+
+        TEST_ASSERT_NOT_EQUAL(0x80, text[kept] & 0xc0);
+    }
+}
+
+void test_no_heap()
+{
+    char buffer[128];
+
+    FakeHeap::rebase();
+    for(size_t i=0; i<sizeof(fileNames) / sizeof(fileNames[0]); i++)
+    {
+        layout.truncate(buffer, sizeof(buffer), fileNames[i], FILE_NAME_WIDTH - 1);
+    }
+    TEST_ASSERT_EQUAL(0, FakeHeap::getAllocations());
+}
+
+// host time, the allocations are what hurt most on the ESP8266
+void test_benchmark()
+{
+    char buffer[128];
+    char message[128];
+
+    for(size_t i=0; i<sizeof(fileNames) / sizeof(fileNames[0]); i++)
+    {
+        const char* text = fileNames[i];
+        String name = text;
+
+        FakeHeap::rebase();
+        unsigned long start = nanos();
+        for(int j=0; j<BENCHMARK_CUTS; j++)
+        {
+            oldTruncate(name, FILE_NAME_WIDTH - j % BENCHMARK_WIDTHS);
+        }
+        unsigned long old = (nanos() - start) / BENCHMARK_CUTS;
+        unsigned long oldAllocations = FakeHeap::getAllocations() / BENCHMARK_CUTS;
+
+        start = nanos();
+        for(int j=0; j<BENCHMARK_CUTS; j++)
+        {
+            layout.truncate(buffer, sizeof(buffer), text, FILE_NAME_WIDTH - j % BENCHMARK_WIDTHS);
+        }
+        unsigned long cut = (nanos() - start) / BENCHMARK_CUTS;
+
+        start = nanos();
+        for(int j=0; j<BENCHMARK_CUTS; j++)
+        {
+            layout.truncate(buffer, sizeof(buffer), text, FILE_NAME_WIDTH);
+        }
+        unsigned long cached = (nanos() - start) / BENCHMARK_CUTS;
+
+        snprintf(message, sizeof(message), "%u characters: old loop %lu ns and %lu allocations, truncate %lu ns, cached %lu ns",
+            (unsigned int)strlen(text), old, oldAllocations, cut, cached);
+        TEST_MESSAGE(message);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    tft.init();
+    layout.init(&tft);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_short_text_unchanged);
+    RUN_TEST(test_cut_fits);
+    RUN_TEST(test_cut_to_buffer);
+    RUN_TEST(test_cut_utf8);
+    RUN_TEST(test_no_heap);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <time.h>
+#include <TFT_eSPI.h>
+#include "DisplayTFT.h"
+#include "icons/weatherIcons.h"
+#include "icons/icon_01d.h"
+#include "icons/icon_01n.h"
+#include "icons/icon_02d.h"
+#include "icons/icon_02n.h"
+#include "icons/icon_03d.h"
+#include "icons/icon_09d.h"
+#include "icons/icon_09n.h"
+#include "icons/icon_10d.h"
+#include "icons/icon_11d.h"
+#include "icons/icon_11n.h"
+#include "icons/icon_13d.h"
+#include "icons/icon_13n.h"
+#include "icons/icon_50d.h"
+
+// Checks every OpenWeather icon code decodes from the run length encoded icons
+// to exactly the raw image it used to push, and measures the flash each takes
+// and the time to decode and push it against pushing the raw image.
+
+#define ICON_X              160
+#define ICON_Y              30
+#define ICON_PIXELS         (WEATHER_ICON_WIDTH * WEATHER_ICON_HEIGHT)
+#define BENCHMARK_DRAWS     500
+
+typedef struct IconCase
+{
+    const char* id;
+    const uint16_t* raw;
+    size_t rawSize;
+    const uint16_t* rle;
+    size_t rleSize;
+} IconCase;
+
+#define ICON(id, raw, rle) {id, raw, sizeof(raw), rle, sizeof(rle)}
+
+// the aliases share an image, only the first use of each counts towards flash
+static const IconCase icons[] = {
+    ICON("01d", icon_01d, icon_01d_rle), ICON("02d", icon_02d, icon_02d_rle), ICON("03d", icon_03d, icon_03d_rle),
+    ICON("09d", icon_09d, icon_09d_rle), ICON("10d", icon_10d, icon_10d_rle), ICON("11d", icon_11d, icon_11d_rle),
+    ICON("13d", icon_13d, icon_13d_rle), ICON("50d", icon_50d, icon_50d_rle), ICON("01n", icon_01n, icon_01n_rle),
+    ICON("02n", icon_02n, icon_02n_rle), ICON("09n", icon_09n, icon_09n_rle), ICON("11n", icon_11n, icon_11n_rle),
+    ICON("13n", icon_13n, icon_13n_rle),
+};
+
+static const IconCase aliases[] = {
+    ICON("04d", icon_03d, icon_03d_rle), ICON("03n", icon_03d, icon_03d_rle), ICON("04n", icon_03d, icon_03d_rle),
+    ICON("10n", icon_09n, icon_09n_rle), ICON("50n", icon_50d, icon_50d_rle),
+};
+
+static DisplayTFT* display = nullptr;
+
+static unsigned long nanos()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ul + now.tv_nsec;
+}
+
+// pixels in the icon's area that differ from the raw image
+static int compareIcon(const uint16_t* raw)
+{
+    int differences = 0;
+
+    for(int i=0; i<ICON_PIXELS; i++)
+    {
+        int x = ICON_X + i % WEATHER_ICON_WIDTH;
+        int y = ICON_Y + i / WEATHER_ICON_WIDTH;
+
+        differences += FakePanel::getPixel(x, y) != pgm_read_word(&raw[i]);
+    }
+    return differences;
+}
+
+static void assertDecodes(const IconCase* icon)
+{
+    char message[64];
+
+    FakePanel::clear(TFT_RED);
+    display->drawIcon(ICON_X, ICON_Y, display->getIconData(icon->id));
+
+    snprintf(message, sizeof(message), "icon %s", icon->id);
+    TEST_ASSERT_EQUAL_MESSAGE(0, compareIcon(icon->raw), message);
+}
+
+void setUp()
+{
+    if(display == nullptr)
+    {
+        display = new DisplayTFT();
+    }
+}
+
+void tearDown()
+{
+}
+
+void test_icons_decode_to_raw()
+{
+    for(size_t i=0; i<sizeof(icons) / sizeof(IconCase); i++)
+    {
+        assertDecodes(&icons[i]);
+    }
+}
+
+void test_aliases_decode_to_raw()
+{
+    for(size_t i=0; i<sizeof(aliases) / sizeof(IconCase); i++)
+    {
+        assertDecodes(&aliases[i]);
+    }
+}
+
+// an unknown code falls back to clear sky
+void test_unknown_icon()
+{
+    TEST_ASSERT_EQUAL_PTR(display->getIconData("01d"), display->getIconData("99x"));
+}
+
+void test_flash_size()
+{
+    char message[96];
+    size_t raw = 0;
+    size_t rle = 0;
+
+    for(size_t i=0; i<sizeof(icons) / sizeof(IconCase); i++)
+    {
+        snprintf(message, sizeof(message), "icon %s: %u bytes, %u raw", icons[i].id, (unsigned int)icons[i].rleSize, (unsigned int)icons[i].rawSize);
+        TEST_MESSAGE(message);
+
+        TEST_ASSERT_EQUAL(ICON_PIXELS * sizeof(uint16_t), icons[i].rawSize);
+        TEST_ASSERT_LESS_THAN(icons[i].rawSize, icons[i].rleSize);
+        raw += icons[i].rawSize;
+        rle += icons[i].rleSize;
+    }
+
+    snprintf(message, sizeof(message), "all icons: %u bytes, %u raw", (unsigned int)rle, (unsigned int)raw);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_LESS_THAN(raw / 2, rle);
+}
+
+// host time, only the difference between the two says anything about the ESP8266
+void test_decode_time()
+{
+    char message[96];
+
+    for(size_t i=0; i<sizeof(icons) / sizeof(IconCase); i++)
+    {
+        const uint16_t* rle = display->getIconData(icons[i].id);
+        unsigned long start = nanos();
+
+        for(int j=0; j<BENCHMARK_DRAWS; j++)
+        {
+            display->drawIcon(ICON_X, ICON_Y, rle);
+        }
+        unsigned long decoded = (nanos() - start) / BENCHMARK_DRAWS;
+
+        TFT_eSPI* panel = FakePanel::getPanel();
+        start = nanos();
+        for(int j=0; j<BENCHMARK_DRAWS; j++)
+        {
+            panel->pushImage(ICON_X, ICON_Y, WEATHER_ICON_WIDTH, WEATHER_ICON_HEIGHT, icons[i].raw);
+        }
+        unsigned long pushed = (nanos() - start) / BENCHMARK_DRAWS;
+
+        snprintf(message, sizeof(message), "icon %s: %lu ns decoded, %lu ns raw", icons[i].id, decoded, pushed);
+        TEST_MESSAGE(message);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_icons_decode_to_raw);
+    RUN_TEST(test_aliases_decode_to_raw);
+    RUN_TEST(test_unknown_icon);
+    RUN_TEST(test_flash_size);
+    RUN_TEST(test_decode_time);
+    return UNITY_END();
+}
@@ -0,0 +1,233 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <time.h>
+#include <FS.h>
+#include <ESPAsyncWebServer.h>
+#include "FakeHeap.h"
+#include "SettingsManager.h"
+#include "WebServer.h"
+
+// Renders the web pages from the precompiled templates through the fake server
+// and measures the printer settings page with MAX_PRINTERS printers, the
+// biggest page, for render time and peak heap. Pages are sent a chunk at a time
+// so the heap should only hold one chunk and the response, whatever the page size.
+
+#define PRINTER_SETTINGS_PAGE   "/printMonitorSettings.html"
+#define BENCHMARK_RENDERS       200
+#define RESPONSE_HEAP           1024    // bytes, the response object, its filler and the page's resume state
+#define FIRST_ROW               "<tr><td class='printer-id'>"
+#define LAST_ROW_END            "</td></tr>"
+
+static SettingsManager settings;
+static WebServer web;
+
+static unsigned long nanos()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ul + now.tv_nsec;
+}
+
+static void addPrinters(int count)
+{
+    char name[32];
+    char address[32];
+
+    settings.beginUpdate();
+    while(settings.getNumPrinters() > 0)
+    {
+        settings.deletePrinter(0);
+    }
+    for(int i=0; i<count; i++)
+    {
+        snprintf(name, sizeof(name), "Farm printer %02d", i + 1);
+        snprintf(address, sizeof(address), "octopi-farm-%02d.local", i + 1);
+        settings.addNewPrinter(address, 80 + i, "", "", "B4D5E6F7A8B9C0D1E2F3A4B5C6D7E8F9", name, i % 3 != 2);
+    }
+    settings.commitUpdate();
+}
+
+// a %NAME% left in the page is a token the renderer doesn't know
+static bool hasToken(const String& body)
+{
+    for(int start = body.indexOf('%'); start != -1; start = body.indexOf('%', start + 1))
+    {
+        int end = start + 1;
+
+        while(end < (int)body.length() && (isupper(body[end]) || isdigit(body[end]) || body[end] == '_'))
+        {
+            end++;
+        }
+        if(end > start + 1 && end < (int)body.length() && body[end] == '%')
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void render(const char* page, FakeWebReply& reply)
+{
+    WebServer::getServer()->handleFakeRequest(page, reply);
+
+    TEST_ASSERT_EQUAL(200, reply.code);
+    TEST_ASSERT_EQUAL_STRING("text/html", reply.contentType.c_str());
+    TEST_ASSERT_FALSE_MESSAGE(hasToken(reply.body), page);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_pages_render()
+{
+    const char* pages[] = { "/", "/index.html", "/screenGrab.html", "/settings.html", "/weatherSettings.html", PRINTER_SETTINGS_PAGE, "/tasks.html" };
+    FakeWebReply reply;
+
+    addPrinters(2);
+    for(size_t i=0; i<sizeof(pages) / sizeof(pages[0]); i++)
+    {
+        render(pages[i], reply);
+        TEST_ASSERT_GREATER_THAN(0, reply.body.length());
+    }
+}
+
+void test_printer_list()
+{
+    FakeWebReply reply;
+
+    addPrinters(MAX_PRINTERS);
+    render(PRINTER_SETTINGS_PAGE, reply);
+
+    TEST_ASSERT_NOT_EQUAL(-1, reply.body.indexOf("<td class='display-name'>Farm printer 01</td><td>octopi-farm-01.local</td><td>80</td>"));
+    TEST_ASSERT_NOT_EQUAL(-1, reply.body.indexOf("<td class='printer-id'>10</td>"));
+    TEST_ASSERT_NOT_EQUAL(-1, reply.body.indexOf("<td>octopi-farm-03.local</td><td>82</td><td><input type='checkbox' disabled></td>"));
+}
+
+// every printer is renamed to a name of a different length after each chunk.
+// Rows already sent stay as they were and the rest use the new names, the page
+// around the table is the same as an unchanged render, nothing repeated or cut
+void test_printer_list_changed_while_sending()
+{
+    FakeWebReply unchanged;
+    FakeWebReply reply;
+
+    addPrinters(MAX_PRINTERS);
+    render(PRINTER_SETTINGS_PAGE, unchanged);
+
+    reply.onChunk = [](size_t index)
+    {
+        char name[48];
+
+        settings.beginUpdate();
+        for(int i=0; i<settings.getNumPrinters(); i++)
+        {
+            OctoPrinterData* printer = settings.getPrinterData(i);
+
+            snprintf(name, sizeof(name), "Renamed %02d after %u bytes", i + 1, (unsigned int)index);
+            settings.editPrinter(i, printer->address, printer->port, printer->username, printer->password, printer->apiKey, name, printer->enabled);
+        }
+        settings.commitUpdate();
+    };
+    render(PRINTER_SETTINGS_PAGE, reply);
+
+    int tableStart = unchanged.body.indexOf(FIRST_ROW);
+    int tableEnd = unchanged.body.lastIndexOf(LAST_ROW_END) + strlen(LAST_ROW_END);
+    int replyTableEnd = reply.body.lastIndexOf(LAST_ROW_END) + strlen(LAST_ROW_END);
+
+    TEST_ASSERT_EQUAL(tableStart, reply.body.indexOf(FIRST_ROW));
+    TEST_ASSERT_EQUAL_STRING(unchanged.body.substring(0, tableStart).c_str(), reply.body.substring(0, tableStart).c_str());
+    TEST_ASSERT_EQUAL_STRING(unchanged.body.substring(tableEnd).c_str(), reply.body.substring(replyTableEnd).c_str());
+    TEST_ASSERT_NOT_EQUAL(-1, reply.body.indexOf("Renamed"));
+
+    // each printer has one whole row, in order
+    int row = tableStart;
+    for(int i=0; i<MAX_PRINTERS; i++)
+    {
+        char id[48];
+
+        snprintf(id, sizeof(id), FIRST_ROW "%d</td>", i + 1);
+        TEST_ASSERT_EQUAL(row, reply.body.indexOf(id, row));
+
+        int rowEnd = reply.body.indexOf(LAST_ROW_END, row) + strlen(LAST_ROW_END);
+        TEST_ASSERT_EQUAL(-1, reply.body.substring(row + 1, rowEnd).indexOf("<tr"));
+        row = rowEnd;
+    }
+    TEST_ASSERT_EQUAL(replyTableEnd, row);
+}
+
+// the heap holds one chunk and the response, the same peak and number of
+// allocations however many printers there are. The reply keeps its buffer from
+// the first render so the fake server's copy into it isn't counted, the device
+// sends each chunk as it's filled
+void test_printer_settings_peak_heap()
+{
+    FakeWebReply reply;
+    char message[128];
+    long peak[2];
+    unsigned long allocations[2];
+    size_t length[2];
+    int printers[2] = { 1, MAX_PRINTERS };
+
+    for(int i=0; i<2; i++)
+    {
+        addPrinters(printers[i]);
+        render(PRINTER_SETTINGS_PAGE, reply);
+
+        FakeHeap::rebase();
+        render(PRINTER_SETTINGS_PAGE, reply);
+        peak[i] = FakeHeap::getPeak();
+        allocations[i] = FakeHeap::getAllocations();
+        length[i] = reply.body.length();
+
+        snprintf(message, sizeof(message), "%d printers: %u bytes, peak heap %ld, %lu allocations",
+            printers[i], (unsigned int)length[i], peak[i], allocations[i]);
+        TEST_MESSAGE(message);
+
+        TEST_ASSERT_LESS_OR_EQUAL(FAKE_WEB_CHUNK_SIZE + RESPONSE_HEAP, peak[i]);
+    }
+
+    // the whole page no longer fits in the peak
+    TEST_ASSERT_GREATER_THAN(FAKE_WEB_CHUNK_SIZE + RESPONSE_HEAP, length[1]);
+    TEST_ASSERT_EQUAL(peak[0], peak[1]);
+}
+
+void test_printer_settings_render_time()
+{
+    FakeWebReply reply;
+    char message[96];
+
+    addPrinters(MAX_PRINTERS);
+
+    unsigned long start = nanos();
+    for(int i=0; i<BENCHMARK_RENDERS; i++)
+    {
+        WebServer::getServer()->handleFakeRequest(PRINTER_SETTINGS_PAGE, reply);
+    }
+    unsigned long elapsed = (nanos() - start) / BENCHMARK_RENDERS;
+
+    snprintf(message, sizeof(message), "%d printers: %lu ns a render, host time", MAX_PRINTERS, elapsed);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv)
+{
+    SPIFFS.begin();
+    SPIFFS.format();
+
+    settings.init();
+    web.init(&settings, nullptr);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_pages_render);
+    RUN_TEST(test_printer_list);
+    RUN_TEST(test_printer_list_changed_while_sending);
+    RUN_TEST(test_printer_settings_peak_heap);
+    RUN_TEST(test_printer_settings_render_time);
+    return UNITY_END();
+}